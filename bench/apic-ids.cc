@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <unistd.h>
+
+#include <cpuinfo.h>
+extern "C" {
+	#include <x86/api.h>
+}
+
+
+/*
+ * Sources of APIC IDs on x86 Linux: cpuinfo derives them from the topology directory of every processor in sysfs, and
+ * falls back to /proc/cpuinfo, which makes the kernel sample the frequency of every processor on each read.
+ * Declarations below mirror src/linux/api.h and src/x86/linux/api.h, which use C99 syntax.
+ */
+#define CPUINFO_LINUX_FLAG_VALID UINT32_C(0x00001000)
+
+struct cpuinfo_x86_linux_processor {
+	uint32_t apic_id;
+	uint32_t linux_id;
+	uint32_t flags;
+	uint32_t core_type;
+	uint32_t core_type_index;
+};
+
+extern "C" bool cpuinfo_x86_linux_parse_proc_cpuinfo(
+	uint32_t max_processors_count,
+	struct cpuinfo_x86_linux_processor* processors);
+extern "C" bool cpuinfo_x86_linux_detect_apic_ids(
+	uint32_t max_processors_count,
+	const struct cpuinfo_x86_topology* topology,
+	struct cpuinfo_x86_linux_processor* processors);
+
+static uint32_t get_processors_count() {
+	const long processors_count = sysconf(_SC_NPROCESSORS_CONF);
+	return processors_count > 0 ? static_cast<uint32_t>(processors_count) : 1;
+}
+
+static void apic_ids_sysfs_topology(benchmark::State& state) {
+	struct cpuinfo_x86_processor x86_processor = { };
+	cpuinfo_x86_init_processor(&x86_processor);
+
+	std::vector<cpuinfo_x86_linux_processor> processors(get_processors_count());
+	while (state.KeepRunning()) {
+		for (cpuinfo_x86_linux_processor& processor : processors) {
+			processor = cpuinfo_x86_linux_processor { };
+			processor.flags = CPUINFO_LINUX_FLAG_VALID;
+		}
+		if (!cpuinfo_x86_linux_detect_apic_ids(
+				static_cast<uint32_t>(processors.size()), &x86_processor.topology, processors.data()))
+		{
+			state.SkipWithError("failed to detect APIC IDs from sysfs topology");
+			break;
+		}
+	}
+}
+BENCHMARK(apic_ids_sysfs_topology)->Unit(benchmark::kMicrosecond);
+
+static void apic_ids_proc_cpuinfo(benchmark::State& state) {
+	std::vector<cpuinfo_x86_linux_processor> processors(get_processors_count());
+	while (state.KeepRunning()) {
+		for (cpuinfo_x86_linux_processor& processor : processors) {
+			processor = cpuinfo_x86_linux_processor { };
+		}
+		if (!cpuinfo_x86_linux_parse_proc_cpuinfo(static_cast<uint32_t>(processors.size()), processors.data())) {
+			state.SkipWithError("failed to parse /proc/cpuinfo");
+			break;
+		}
+	}
+}
+BENCHMARK(apic_ids_proc_cpuinfo)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
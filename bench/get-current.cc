@@ -2,6 +2,12 @@
 
 #include <cpuinfo.h>
 
+#if defined(__linux__)
+	#include <sched.h>
+	#include <unistd.h>
+	#include <sys/syscall.h>
+#endif
+
 
 static void cpuinfo_get_current_processor(benchmark::State& state) {
 	cpuinfo_initialize();
@@ -39,4 +45,92 @@ static void cpuinfo_get_current_uarch_index_with_default(benchmark::State& state
 }
 BENCHMARK(cpuinfo_get_current_uarch_index_with_default)->Unit(benchmark::kNanosecond);
 
+static void cpuinfo_get_current_location(benchmark::State& state) {
+	cpuinfo_initialize();
+	while (state.KeepRunning()) {
+		struct cpuinfo_current_location location;
+		benchmark::DoNotOptimize(cpuinfo_get_current_location(&location));
+		benchmark::DoNotOptimize(location);
+	}
+}
+BENCHMARK(cpuinfo_get_current_location)->Unit(benchmark::kNanosecond);
+
+/* Underlying methods to identify the current processor, in the order cpuinfo prefers them */
+
+#if defined(__linux__) && defined(__GLIBC__) && (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__))
+extern "C" {
+	extern const ptrdiff_t __rseq_offset __attribute__((__weak__));
+	extern const unsigned int __rseq_size __attribute__((__weak__));
+}
+
+static void rseq_cpu_id(benchmark::State& state) {
+	if (&__rseq_size == nullptr || &__rseq_offset == nullptr || __rseq_size == 0) {
+		state.SkipWithError("rseq is not registered by the C library");
+		return;
+	}
+	while (state.KeepRunning()) {
+		uintptr_t thread_pointer;
+		#if defined(__x86_64__)
+			__asm__ __volatile__("movq %%fs:0, %0" : "=r" (thread_pointer));
+		#elif defined(__i386__)
+			__asm__ __volatile__("movl %%gs:0, %0" : "=r" (thread_pointer));
+		#elif defined(__aarch64__)
+			__asm__ __volatile__("mrs %0, tpidr_el0" : "=r" (thread_pointer));
+		#endif
+		const int32_t cpu = *reinterpret_cast<const volatile int32_t*>(thread_pointer + __rseq_offset + 4);
+		benchmark::DoNotOptimize(cpu);
+	}
+}
+BENCHMARK(rseq_cpu_id)->Unit(benchmark::kNanosecond);
+#endif
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+static void rdpid(benchmark::State& state) {
+	cpuinfo_initialize();
+	if (!cpuinfo_has_x86_rdpid()) {
+		state.SkipWithError("RDPID is not supported");
+		return;
+	}
+	while (state.KeepRunning()) {
+		uintptr_t tsc_aux;
+		__asm__ __volatile__(".byte 0xF3, 0x0F, 0xC7, 0xF8" : "=a" (tsc_aux));
+		benchmark::DoNotOptimize(tsc_aux);
+	}
+}
+BENCHMARK(rdpid)->Unit(benchmark::kNanosecond);
+
+static void rdtscp(benchmark::State& state) {
+	cpuinfo_initialize();
+	if (!cpuinfo_has_x86_rdtscp()) {
+		state.SkipWithError("RDTSCP is not supported");
+		return;
+	}
+	while (state.KeepRunning()) {
+		uint32_t tsc_lo, tsc_hi, tsc_aux;
+		__asm__ __volatile__("rdtscp" : "=a" (tsc_lo), "=d" (tsc_hi), "=c" (tsc_aux));
+		benchmark::DoNotOptimize(tsc_aux);
+	}
+}
+BENCHMARK(rdtscp)->Unit(benchmark::kNanosecond);
+#endif
+
+#if defined(__linux__)
+static void sched_getcpu(benchmark::State& state) {
+	while (state.KeepRunning()) {
+		const int cpu = ::sched_getcpu();
+		benchmark::DoNotOptimize(cpu);
+	}
+}
+BENCHMARK(sched_getcpu)->Unit(benchmark::kNanosecond);
+
+static void getcpu_syscall(benchmark::State& state) {
+	while (state.KeepRunning()) {
+		unsigned cpu = 0;
+		benchmark::DoNotOptimize(syscall(__NR_getcpu, &cpu, NULL, NULL));
+		benchmark::DoNotOptimize(cpu);
+	}
+}
+BENCHMARK(getcpu_syscall)->Unit(benchmark::kNanosecond);
+#endif
+
 BENCHMARK_MAIN();
@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+
+#include <cpuinfo.h>
+
+
+/*
+ * Each iteration visits all entries of a table, through the exported functions or through the cpuinfo_get_topology
+ * view, which the caller gets once.
+ */
+
+static void cpuinfo_get_processor(benchmark::State& state) {
+	cpuinfo_initialize();
+	const uint32_t processors_count = cpuinfo_get_processors_count();
+	while (state.KeepRunning()) {
+		for (uint32_t i = 0; i < processors_count; i++) {
+			benchmark::DoNotOptimize(cpuinfo_get_processor(i)->core);
+		}
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * processors_count);
+}
+BENCHMARK(cpuinfo_get_processor)->Unit(benchmark::kNanosecond);
+
+static void topology_processors(benchmark::State& state) {
+	cpuinfo_initialize();
+	const cpuinfo_topology* topology = cpuinfo_get_topology();
+	while (state.KeepRunning()) {
+		for (uint32_t i = 0; i < topology->processors_count; i++) {
+			benchmark::DoNotOptimize(topology->processors[i].core);
+		}
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * topology->processors_count);
+}
+BENCHMARK(topology_processors)->Unit(benchmark::kNanosecond);
+
+static void cpuinfo_get_core(benchmark::State& state) {
+	cpuinfo_initialize();
+	const uint32_t cores_count = cpuinfo_get_cores_count();
+	while (state.KeepRunning()) {
+		for (uint32_t i = 0; i < cores_count; i++) {
+			benchmark::DoNotOptimize(cpuinfo_get_core(i)->uarch);
+		}
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * cores_count);
+}
+BENCHMARK(cpuinfo_get_core)->Unit(benchmark::kNanosecond);
+
+static void topology_cores(benchmark::State& state) {
+	cpuinfo_initialize();
+	const cpuinfo_topology* topology = cpuinfo_get_topology();
+	while (state.KeepRunning()) {
+		for (uint32_t i = 0; i < topology->cores_count; i++) {
+			benchmark::DoNotOptimize(topology->cores[i].uarch);
+		}
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * topology->cores_count);
+}
+BENCHMARK(topology_cores)->Unit(benchmark::kNanosecond);
+
+static void cpuinfo_get_l2_cache(benchmark::State& state) {
+	cpuinfo_initialize();
+	const uint32_t l2_caches_count = cpuinfo_get_l2_caches_count();
+	while (state.KeepRunning()) {
+		for (uint32_t i = 0; i < l2_caches_count; i++) {
+			benchmark::DoNotOptimize(cpuinfo_get_l2_cache(i)->size);
+		}
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * l2_caches_count);
+}
+BENCHMARK(cpuinfo_get_l2_cache)->Unit(benchmark::kNanosecond);
+
+static void topology_l2_caches(benchmark::State& state) {
+	cpuinfo_initialize();
+	const cpuinfo_topology* topology = cpuinfo_get_topology();
+	while (state.KeepRunning()) {
+		for (uint32_t i = 0; i < topology->l2_caches_count; i++) {
+			benchmark::DoNotOptimize(topology->l2_caches[i].size);
+		}
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * topology->l2_caches_count);
+}
+BENCHMARK(topology_l2_caches)->Unit(benchmark::kNanosecond);
+
+/* Cost of cpuinfo_initialize once cpuinfo is initialized, which is all that the first call pays with CPUINFO_INITIALIZE_ON_LOAD */
+static void cpuinfo_initialize_initialized(benchmark::State& state) {
+	cpuinfo_initialize();
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(cpuinfo_initialize());
+	}
+}
+BENCHMARK(cpuinfo_initialize_initialized)->Unit(benchmark::kNanosecond);
+
+BENCHMARK_MAIN();
@@ -2,6 +2,65 @@
 
 #include <cpuinfo.h>
 
+#if defined(__linux__)
+	#include <cstdio>
+	#include <functional>
+	#include <string>
+
+	#include <unistd.h>
+	#include <sys/wait.h>
+#endif
+
+
+#if defined(__linux__)
+/*
+ * cpuinfo initializes only once per process, so each iteration initializes cpuinfo in a new child process, like a
+ * short-lived worker does. These benchmarks include the cost of fork and exit. They are registered before the
+ * cpuinfo_initialize benchmark, which initializes cpuinfo in this process and thus in all later children.
+ */
+static bool initialize_in_child(const std::function<bool()>& initialize) {
+	const pid_t pid = fork();
+	if (pid == 0) {
+		_exit(initialize() ? 0 : 1);
+	}
+	int status = 0;
+	return pid > 0 && waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+static std::string snapshot_path() {
+	return "/tmp/cpuinfo-bench-snapshot-" + std::to_string(getpid());
+}
+
+static void cold_detection(benchmark::State& state, uint32_t flags) {
+	while (state.KeepRunning()) {
+		if (!initialize_in_child([flags] { return cpuinfo_initialize_ex(flags); })) {
+			state.SkipWithError("failed to initialize cpuinfo");
+			break;
+		}
+	}
+}
+BENCHMARK_CAPTURE(cold_detection, isa, CPUINFO_INITIALIZE_ISA)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(cold_detection, topology, CPUINFO_INITIALIZE_TOPOLOGY)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(cold_detection, full, CPUINFO_INITIALIZE_FULL)->Unit(benchmark::kMillisecond);
+
+static void snapshot_load(benchmark::State& state) {
+	const std::string path = snapshot_path();
+	const auto initialize = [&path] { return cpuinfo_initialize_from_snapshot(path.c_str()); };
+	/* The first initialization detects the topology and writes the snapshot */
+	if (!initialize_in_child(initialize)) {
+		state.SkipWithError("failed to save snapshot");
+		return;
+	}
+	while (state.KeepRunning()) {
+		if (!initialize_in_child(initialize)) {
+			state.SkipWithError("failed to initialize cpuinfo");
+			break;
+		}
+	}
+	std::remove(path.c_str());
+}
+BENCHMARK(snapshot_load)->Unit(benchmark::kMillisecond);
+#endif
 
 static void cpuinfo_initialize(benchmark::State& state) {
 	while (state.KeepRunning()) {
@@ -17,16 +17,18 @@ def main(args):
         "CLOG_LOG_TO_STDIO": int(not options.mock),
         "CPUINFO_MOCK": int(options.mock),
     }
+    if options.mock:
+        macros["CPUINFO_NO_BASELINE_ISA"] = 1
     if build.target.is_linux or build.target.is_android:
         macros["_GNU_SOURCE"] = 1
 
-    build.export_cpath("include", ["cpuinfo.h"])
+    build.export_cpath("include", ["cpuinfo.h", "cpuinfo.hpp"])
 
     with build.options(source_dir="src", macros=macros, extra_include_dirs="src", deps=build.deps.clog):
-        sources = ["api.c", "init.c", "cache.c"]
+        sources = ["api.c", "init.c", "cache.c", "threads.c", "spin.c", "dispatch.c", "features.c", "arena.c"]
         if build.target.is_x86 or build.target.is_x86_64:
             sources += [
-                "x86/init.c", "x86/info.c", "x86/isa.c", "x86/vendor.c",
+                "x86/init.c", "x86/info.c", "x86/isa.c", "x86/copy.c", "x86/vendor.c",
                 "x86/uarch.c", "x86/name.c", "x86/topology.c",
                 "x86/cache/init.c", "x86/cache/descriptor.c", "x86/cache/deterministic.c",
             ]
@@ -36,6 +38,9 @@ def main(args):
                 sources += [
                     "x86/linux/init.c",
                     "x86/linux/cpuinfo.c",
+                    "x86/linux/hybrid.c",
+                    "x86/linux/topology.c",
+                    "x86/linux/umwait.c",
                 ]
         if build.target.is_arm or build.target.is_arm64:
             sources += ["arm/uarch.c", "arm/cache.c"]
@@ -78,6 +83,12 @@ def main(args):
                 "linux/smallfile.c",
                 "linux/multiline.c",
                 "linux/processors.c",
+                "linux/nodes.c",
+                "linux/cgroup.c",
+                "linux/current.c",
+                "linux/usable.c",
+                "linux/snapshot.c",
+                "linux/sysfs.c",
             ]
             if options.mock:
                 sources += ["linux/mockfile.c"]
@@ -94,20 +105,33 @@ def main(args):
 
     with build.options(source_dir="test", deps=[build, build.deps.clog, build.deps.googletest]):
         build.smoketest("init-test", build.cxx("init.cc"))
+        build.smoketest("spin-wait-test", build.cxx("spin-wait.cc"))
+        build.smoketest("dispatch-test", build.cxx("dispatch.cc"))
+        build.smoketest("probe-isa-test", build.cxx("probe-isa.cc"))
+        build.smoketest("isa-features-test", build.cxx("isa-features.cc"))
+        build.smoketest("baseline-isa-test", build.cxx("baseline-isa.cc"))
         if build.target.is_linux:
             build.smoketest("get-current-test", build.cxx("get-current.cc"))
+            build.smoketest("snapshot-test", build.cxx("snapshot.cc"))
+            build.smoketest("sysfs-test", build.cxx("sysfs.cc"))
         if build.target.is_x86_64:
             build.smoketest("brand-string-test", build.cxx("name/brand-string.cc"))
     if options.mock:
-        with build.options(source_dir="test", include_dirs="test", macros="CPUINFO_MOCK", deps=[build, build.deps.googletest]):
+        with build.options(source_dir="test", include_dirs="test", macros={"CPUINFO_MOCK": 1, "CPUINFO_NO_BASELINE_ISA": 1}, deps=[build, build.deps.googletest]):
             if build.target.is_arm64 and build.target.is_linux:
+                build.unittest("graviton3-test", build.cxx("graviton3.cc"))
+                build.unittest("orange-pi-5-test", build.cxx("orange-pi-5.cc"))
                 build.unittest("scaleway-test", build.cxx("scaleway.cc"))
 
     if not options.mock:
         with build.options(source_dir="bench", deps=[build, build.deps.clog, build.deps.googlebenchmark]):
             build.benchmark("init-bench", build.cxx("init.cc"))
+            build.benchmark("getters-bench", build.cxx("getters.cc"))
             if not build.target.is_macos:
                 build.benchmark("get-current-bench", build.cxx("get-current.cc"))
+        if build.target.is_x86_64 and build.target.is_linux:
+            with build.options(source_dir="bench", include_dirs=["src", "include"], deps=[build, build.deps.clog, build.deps.googlebenchmark]):
+                build.benchmark("apic-ids-bench", build.cxx("apic-ids.cc"))
 
     return build
 
@@ -38,6 +38,12 @@ extern "C" {
 	void CPUINFO_ABI cpuinfo_mock_set_cpuid(struct cpuinfo_mock_cpuid* dump, size_t entries);
 	void CPUINFO_ABI cpuinfo_mock_get_cpuid(uint32_t eax, uint32_t regs[4]);
 	void CPUINFO_ABI cpuinfo_mock_get_cpuidex(uint32_t eax, uint32_t ecx, uint32_t regs[4]);
+	/*
+	 * Overrides the value of XCR0 returned by XGETBV. Without an override, the mock XCR0 has all state components
+	 * reported as supported in CPUID leaf 0xD enabled.
+	 */
+	void CPUINFO_ABI cpuinfo_mock_set_xcr0(uint64_t xcr0);
+	uint64_t CPUINFO_ABI cpuinfo_mock_get_xgetbv(uint32_t ext_ctrl_reg);
 #endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
 
 struct cpuinfo_mock_file {
@@ -64,6 +70,24 @@ struct cpuinfo_mock_property {
 	#if CPUINFO_ARCH_ARM
 		void CPUINFO_ABI cpuinfo_set_hwcap2(uint32_t hwcap2);
 	#endif
+	#if CPUINFO_ARCH_ARM64
+		void CPUINFO_ABI cpuinfo_set_hwcap2(uint64_t hwcap2);
+		struct cpuinfo_mock_id_registers {
+			uint64_t id_aa64isar0_el1;
+			uint64_t id_aa64isar1_el1;
+			uint64_t id_aa64isar2_el1;
+			uint64_t id_aa64pfr0_el1;
+			uint64_t id_aa64pfr1_el1;
+			uint64_t id_aa64zfr0_el1;
+			uint64_t id_aa64smfr0_el1;
+		};
+
+		/* Values returned for MRS reads of ID registers; they are only read if HWCAP_CPUID is set */
+		void CPUINFO_ABI cpuinfo_set_id_registers(const struct cpuinfo_mock_id_registers* registers);
+
+		/* SVE vector length and SME streaming vector length in bytes; they are only read if SVE and SME are detected */
+		void CPUINFO_ABI cpuinfo_set_vector_lengths(uint32_t sve_vector_length, uint32_t sme_vector_length);
+	#endif
 
 	#if CPUINFO_ARCH_LOONGARCH64
 		void CPUINFO_ABI cpuinfo_set_hwcap(uint32_t hwcap);
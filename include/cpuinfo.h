@@ -10,6 +10,7 @@
 	#include <TargetConditionals.h>
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 
 /* Identify architecture and define corresponding macro */
@@ -312,6 +313,12 @@ enum cpuinfo_uarch {
 	cpuinfo_uarch_palm_cove    = 0x0010020B,
 	/** Intel Sunny Cove microarchitecture (10 nm, Ice Lake). */
 	cpuinfo_uarch_sunny_cove   = 0x0010020C,
+	/** Intel Willow Cove microarchitecture (10 nm, Tiger Lake). */
+	cpuinfo_uarch_willow_cove  = 0x0010020D,
+	/** Intel Golden Cove microarchitecture (Intel 7, including Raptor Cove in Raptor Lake and Emerald Rapids). */
+	cpuinfo_uarch_golden_cove  = 0x0010020E,
+	/** Intel Redwood Cove microarchitecture (Intel 4/3, Meteor Lake and Granite Rapids). */
+	cpuinfo_uarch_redwood_cove = 0x0010020F,
 
 	/** Pentium 4 with Willamette, Northwood, or Foster cores. */
 	cpuinfo_uarch_willamette = 0x00100300,
@@ -330,6 +337,12 @@ enum cpuinfo_uarch {
 	cpuinfo_uarch_goldmont      = 0x00100404,
 	/** Intel Goldmont Plus microarchitecture (Gemini Lake). */
 	cpuinfo_uarch_goldmont_plus = 0x00100405,
+	/** Intel Tremont microarchitecture (Elkhart Lake, Jasper Lake, Snow Ridge, Lakefield E-cores). */
+	cpuinfo_uarch_tremont       = 0x00100406,
+	/** Intel Gracemont microarchitecture (Alder Lake-N, Alder Lake and Raptor Lake E-cores). */
+	cpuinfo_uarch_gracemont     = 0x00100407,
+	/** Intel Crestmont microarchitecture (Sierra Forest, Meteor Lake E-cores). */
+	cpuinfo_uarch_crestmont     = 0x00100408,
 
 	/** Intel Knights Ferry HPC boards. */
 	cpuinfo_uarch_knights_ferry   = 0x00100500,
@@ -375,6 +388,8 @@ enum cpuinfo_uarch {
 	cpuinfo_uarch_zen2        = 0x0020010A,
 	/** AMD Zen 3 microarchitecture. */
 	cpuinfo_uarch_zen3        = 0x0020010B,
+	/** AMD Zen 4 microarchitecture. */
+	cpuinfo_uarch_zen4        = 0x0020010C,
 
 	/** NSC Geode and AMD Geode GX and LX. */
 	cpuinfo_uarch_geode  = 0x00200200,
@@ -582,6 +597,10 @@ struct cpuinfo_processor {
 		/** Level 4 unified or data cache */
 		const struct cpuinfo_cache* l4;
 	} cache;
+	/** NUMA node containing this logical processor, or NULL if NUMA topology is unknown */
+	const struct cpuinfo_node* node;
+	/** Die containing this logical processor, or NULL if die topology is unknown */
+	const struct cpuinfo_die* die;
 };
 
 struct cpuinfo_core {
@@ -611,6 +630,10 @@ struct cpuinfo_core {
 #endif
 	/** Clock rate (non-Turbo) of the core, in Hz */
 	uint64_t frequency;
+	/** NUMA node containing this core, or NULL if NUMA topology is unknown */
+	const struct cpuinfo_node* node;
+	/** Die containing this core, or NULL if die topology is unknown */
+	const struct cpuinfo_die* die;
 };
 
 struct cpuinfo_cluster {
@@ -661,6 +684,42 @@ struct cpuinfo_package {
 	uint32_t cluster_start;
 	/** Number of clusters of cores on this physical package */
 	uint32_t cluster_count;
+	/** Index of the first die on this physical package */
+	uint32_t die_start;
+	/** Number of dies on this physical package, or 0 if die topology is unknown */
+	uint32_t die_count;
+};
+
+struct cpuinfo_die {
+	/** Index of the first logical processor on this die */
+	uint32_t processor_start;
+	/** Number of logical processors on this die */
+	uint32_t processor_count;
+	/** Index of the first core on this die */
+	uint32_t core_start;
+	/** Number of cores on this die */
+	uint32_t core_count;
+	/** Die ID within a package */
+	uint32_t die_id;
+	/** Physical package containing this die */
+	const struct cpuinfo_package* package;
+};
+
+struct cpuinfo_node {
+	/**
+	 * Operating system ID of the NUMA node:
+	 * - Linux kernel exposes information about this node in /sys/devices/system/node/node<node_id>/
+	 */
+	uint32_t node_id;
+	/** Number of logical processors on this NUMA node */
+	uint32_t processor_count;
+	/** Number of cores on this NUMA node */
+	uint32_t core_count;
+	/**
+	 * Relative distances from this NUMA node to all NUMA nodes, indexed by the node index in cpuinfo_get_nodes().
+	 * Distance from a node to itself is 10; remote nodes have larger distances.
+	 */
+	const uint32_t* distances;
 };
 
 struct cpuinfo_uarch_info {
@@ -688,6 +747,84 @@ extern "C" {
 
 bool CPUINFO_ABI cpuinfo_initialize(void);
 
+/**
+ * Detection tiers for cpuinfo_initialize_ex(). Every tier includes the lower tiers.
+ *
+ * CPUINFO_INITIALIZE_ISA detects only the ISA extensions reported by cpuinfo_has_* functions, and does not make
+ * other cpuinfo functions usable.
+ * CPUINFO_INITIALIZE_TOPOLOGY also detects processors, cores, clusters, dies, packages, NUMA nodes, caches, and
+ * microarchitectures. Until the full tier is detected, all logical processors are reported as usable.
+ * CPUINFO_INITIALIZE_FULL also detects the logical processors usable under the affinity mask and the cgroup cpuset,
+ * and the fastest method to look up the current processor. cpuinfo_initialize() detects this tier.
+ */
+#define CPUINFO_INITIALIZE_ISA      0x00000001
+#define CPUINFO_INITIALIZE_TOPOLOGY 0x00000002
+#define CPUINFO_INITIALIZE_FULL     0x00000004
+
+/**
+ * Initialize cpuinfo up to the detection tiers in flags.
+ *
+ * A later call with a higher tier detects the missing information; calls from multiple threads are safe. On Linux,
+ * the ISA tier skips the parsing of sysfs and, on x86, of /proc/cpuinfo. On other systems, all tiers are detected at
+ * once.
+ *
+ * @param flags - a combination of CPUINFO_INITIALIZE_* tiers.
+ * @returns true if all requested tiers are detected.
+ */
+bool CPUINFO_ABI cpuinfo_initialize_ex(uint32_t flags);
+
+/**
+ * Detect the ISA extensions reported by cpuinfo_has_* functions without memory allocation, locks, logging, or file
+ * I/O, so that they can be queried in GNU IFUNC resolvers and static constructors.
+ *
+ * On x86, the extensions are detected with CPUID and XGETBV only. The AMX permission is reported as not granted until
+ * cpuinfo_x86_request_amx_permission() is called, and UMWAIT limits are not detected. On ARM64 Linux, the extensions
+ * are detected from HWCAP, HWCAP2, and the ID registers, without the SVE and SME vector lengths and without
+ * chipset-specific workarounds. Other systems and architectures need cpuinfo_initialize() to detect the ISA.
+ *
+ * The function must not run concurrently with cpuinfo_initialize() or cpuinfo_initialize_ex(), which replace the
+ * probed extensions with the complete detection. If the ISA is already detected, the function does nothing.
+ *
+ * @returns true if the ISA extensions are detected, and false if the system is not supported.
+ */
+bool CPUINFO_ABI cpuinfo_probe_isa(void);
+
+/**
+ * Initialize cpuinfo from a snapshot file written by cpuinfo_save_snapshot() or by an earlier call of this function.
+ *
+ * The snapshot is memory-mapped and used only if it was saved on the same system since the last boot, with the same
+ * kernel and processor. Otherwise, cpuinfo detects the processors as cpuinfo_initialize() does, and tries to replace
+ * the snapshot with an up-to-date one. The usable logical processors are always detected anew, because the affinity
+ * mask and cgroups may differ between processes.
+ *
+ * Snapshots are supported only on Linux. On other systems, this function is equivalent to cpuinfo_initialize().
+ * If cpuinfo is already initialized, the function does not access the snapshot.
+ *
+ * @param path - path of the snapshot file.
+ * @returns true if cpuinfo is initialized, either from the snapshot or by detection.
+ */
+bool CPUINFO_ABI cpuinfo_initialize_from_snapshot(const char* path);
+
+/**
+ * Save the detected processor topology to a snapshot file for cpuinfo_initialize_from_snapshot().
+ * The file is written atomically: concurrent readers observe either the previous or the new snapshot.
+ *
+ * @param path - path of the snapshot file.
+ * @returns true if the snapshot is saved, and false if cpuinfo is not initialized, the file cannot be written, or
+ *          snapshots are not supported on the system.
+ */
+bool CPUINFO_ABI cpuinfo_save_snapshot(const char* path);
+
+/**
+ * Release the memory used by the detected processor topology.
+ *
+ * Every call of cpuinfo_initialize(), cpuinfo_initialize_ex() or cpuinfo_initialize_from_snapshot() takes a reference,
+ * and every call of cpuinfo_deinitialize() releases one. On Linux, releasing the last reference frees the tables, or
+ * unmaps the snapshot they were loaded from, and a subsequent cpuinfo_initialize() call detects the topology again.
+ * Pointers obtained from cpuinfo before then become invalid. Callers which never call cpuinfo_deinitialize() keep the
+ * tables for the lifetime of the process, as do programs built with CPUINFO_INITIALIZE_ON_LOAD.
+ * The function must not be called concurrently with other cpuinfo functions. On other systems, it does nothing.
+ */
 void CPUINFO_ABI cpuinfo_deinitialize(void);
 
 #if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
@@ -706,8 +843,14 @@ void CPUINFO_ABI cpuinfo_deinitialize(void);
 		bool clzero;
 		bool clflush;
 		bool clflushopt;
+		bool cldemote;
 		bool mwait;
 		bool mwaitx;
+		bool waitpkg;
+		/* Maximum time in TSC cycles of UMWAIT and TPAUSE waits allowed by the OS, or 0 if unknown */
+		uint32_t umwait_max_time;
+		/* Whether the OS allows UMWAIT and TPAUSE to enter the C0.2 optimized state */
+		bool umwait_c02;
 		#if CPUINFO_ARCH_X86
 			bool emmx;
 		#endif
@@ -726,6 +869,7 @@ void CPUINFO_ABI cpuinfo_deinitialize(void);
 		bool prefetch;
 		bool prefetchw;
 		bool prefetchwt1;
+		bool prefetchi;
 		#if CPUINFO_ARCH_X86
 			bool daz;
 			bool sse;
@@ -760,6 +904,22 @@ void CPUINFO_ABI cpuinfo_deinitialize(void);
 		bool avx512vp2intersect;
 		bool avx512_4vnniw;
 		bool avx512_4fmaps;
+		bool avx512fp16;
+		bool avxvnni;
+		bool avxvnniint8;
+		bool avxifma;
+		bool avxneconvert;
+		/* Version of AVX10 converged vector ISA, or 0 if AVX10 is not supported */
+		uint32_t avx10_version;
+		/* Maximum length in bits of vectors supported by AVX10 instructions, or 0 if AVX10 is not supported */
+		uint32_t avx10_max_vector_bits;
+		bool amx_tile;
+		bool amx_int8;
+		bool amx_bf16;
+		bool amx_fp16;
+		bool amx_complex;
+		/* Whether the process may use the AMX tile data state, which Linux grants on request */
+		bool amx_permitted;
 		bool hle;
 		bool rtm;
 		bool xtest;
@@ -771,8 +931,18 @@ void CPUINFO_ABI cpuinfo_deinitialize(void);
 		bool cmpxchg16b;
 		bool clwb;
 		bool movbe;
+		bool erms;
+		bool fsrm;
+		bool fzlrm;
+		bool fsrs;
+		bool fsrc;
+		bool movdiri;
+		bool movdir64b;
+		bool enqcmd;
+		bool serialize;
 		#if CPUINFO_ARCH_X86_64
 			bool lahf_sahf;
+			bool apx;
 		#endif
 		bool fs_gs_base;
 		bool lzcnt;
@@ -798,6 +968,290 @@ void CPUINFO_ABI cpuinfo_deinitialize(void);
 	};
 
 	extern struct cpuinfo_x86_isa cpuinfo_isa;
+
+	/*
+	 * Requests permission to use AMX tile data for the calling process; must be called after cpuinfo_initialize.
+	 * Linux requires the permission before the first AMX instruction, and until it is granted cpuinfo_has_x86_amx_*
+	 * functions return false. The permission is granted to all threads of the process and cannot be revoked.
+	 *
+	 * @returns true if AMX is supported and can be used by the calling process, false otherwise.
+	 */
+	bool CPUINFO_ABI cpuinfo_x86_request_amx_permission(void);
+
+	/** Strategy to copy a block of memory on x86 */
+	enum cpuinfo_x86_copy_strategy {
+		/** Vector loads and stores through the cache hierarchy. */
+		cpuinfo_x86_copy_strategy_vector = 0,
+		/** REP MOVSB instruction, executed as a fast-string microcode sequence. */
+		cpuinfo_x86_copy_strategy_rep_movsb = 1,
+		/** Vector loads and non-temporal stores which bypass the cache hierarchy. */
+		cpuinfo_x86_copy_strategy_non_temporal = 2,
+	};
+
+	/** Block sizes where the recommended strategy to copy memory on x86 changes */
+	struct cpuinfo_x86_copy_thresholds {
+		/** Minimum size in bytes for REP MOVSB to outperform vector copy, or SIZE_MAX if the CPU lacks ERMS */
+		size_t rep_movsb_min_size;
+		/** Size in bytes at which REP MOVSB becomes slower than vector copy again */
+		size_t rep_movsb_max_size;
+		/**
+		 * Minimum size in bytes for non-temporal stores to outperform cached stores, or SIZE_MAX if the size of the
+		 * last level cache is unknown
+		 */
+		size_t non_temporal_min_size;
+		/** Size in bytes of cache line to align the destination of non-temporal stores to */
+		uint32_t cache_line_size;
+	};
+
+	/**
+	 * Returns the block sizes where the recommended strategy to copy memory changes. The thresholds are computed
+	 * during cpuinfo_initialize from the fast-string ISA extensions and the smallest L2 and per-thread last level
+	 * cache of any core. Must be called after cpuinfo_initialize.
+	 */
+	void CPUINFO_ABI cpuinfo_x86_get_copy_thresholds(struct cpuinfo_x86_copy_thresholds* thresholds);
+
+	/**
+	 * Recommends a strategy to copy a block of memory of the specified size by comparing it against the thresholds
+	 * computed during initialization. Must be called after cpuinfo_initialize.
+	 */
+	enum cpuinfo_x86_copy_strategy CPUINFO_ABI cpuinfo_x86_get_copy_strategy(size_t size);
+#endif
+
+/*
+ * CPUINFO_BASELINE_X86_* macros are defined for ISA extensions which the compiler may use unconditionally in the
+ * translation unit, e.g. due to -mavx2 or -march=haswell. The corresponding cpuinfo_has_x86_* functions return true without
+ * a check at runtime, and calls to them fold into constants. Define CPUINFO_NO_BASELINE_ISA before including
+ * cpuinfo.h to check all extensions at runtime, e.g. in tests of ISA detection.
+ */
+#if (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && !defined(CPUINFO_NO_BASELINE_ISA)
+	#if defined(__RDPID__)
+		#define CPUINFO_BASELINE_X86_RDPID 1
+	#endif
+	#if defined(__CLZERO__)
+		#define CPUINFO_BASELINE_X86_CLZERO 1
+	#endif
+	#if defined(__MWAITX__)
+		#define CPUINFO_BASELINE_X86_MWAITX 1
+	#endif
+	#if defined(__WAITPKG__)
+		#define CPUINFO_BASELINE_X86_WAITPKG 1
+	#endif
+	#if defined(__FXSR__)
+		#define CPUINFO_BASELINE_X86_FXSAVE 1
+	#endif
+	#if defined(__XSAVE__)
+		#define CPUINFO_BASELINE_X86_XSAVE 1
+	#endif
+	#if defined(__MMX__)
+		#define CPUINFO_BASELINE_X86_MMX 1
+	#endif
+	#if defined(__3dNOW__)
+		#define CPUINFO_BASELINE_X86_3DNOW 1
+	#endif
+	#if defined(__3dNOW_A__)
+		#define CPUINFO_BASELINE_X86_3DNOW_PLUS 1
+	#endif
+	#if defined(__PRFCHW__)
+		#define CPUINFO_BASELINE_X86_PREFETCHW 1
+	#endif
+	#if defined(__PREFETCHWT1__)
+		#define CPUINFO_BASELINE_X86_PREFETCHWT1 1
+	#endif
+	#if defined(__PREFETCHI__)
+		#define CPUINFO_BASELINE_X86_PREFETCHI 1
+	#endif
+	#if defined(__SSE__) || defined(_M_X64) || defined(_M_IX86_FP) && _M_IX86_FP >= 1
+		#define CPUINFO_BASELINE_X86_SSE 1
+	#endif
+	#if defined(__SSE2__) || defined(_M_X64) || defined(_M_IX86_FP) && _M_IX86_FP >= 2
+		#define CPUINFO_BASELINE_X86_SSE2 1
+	#endif
+	#if defined(__SSE3__)
+		#define CPUINFO_BASELINE_X86_SSE3 1
+	#endif
+	#if defined(__SSSE3__)
+		#define CPUINFO_BASELINE_X86_SSSE3 1
+	#endif
+	#if defined(__SSE4_1__)
+		#define CPUINFO_BASELINE_X86_SSE4_1 1
+	#endif
+	#if defined(__SSE4_2__)
+		#define CPUINFO_BASELINE_X86_SSE4_2 1
+	#endif
+	#if defined(__SSE4A__)
+		#define CPUINFO_BASELINE_X86_SSE4A 1
+	#endif
+	#if defined(__AVX__)
+		#define CPUINFO_BASELINE_X86_AVX 1
+	#endif
+	#if defined(__FMA__)
+		#define CPUINFO_BASELINE_X86_FMA3 1
+	#endif
+	#if defined(__FMA4__)
+		#define CPUINFO_BASELINE_X86_FMA4 1
+	#endif
+	#if defined(__XOP__)
+		#define CPUINFO_BASELINE_X86_XOP 1
+	#endif
+	#if defined(__F16C__)
+		#define CPUINFO_BASELINE_X86_F16C 1
+	#endif
+	#if defined(__AVX2__)
+		#define CPUINFO_BASELINE_X86_AVX2 1
+	#endif
+	#if defined(__AVX512F__)
+		#define CPUINFO_BASELINE_X86_AVX512F 1
+	#endif
+	#if defined(__AVX512PF__)
+		#define CPUINFO_BASELINE_X86_AVX512PF 1
+	#endif
+	#if defined(__AVX512ER__)
+		#define CPUINFO_BASELINE_X86_AVX512ER 1
+	#endif
+	#if defined(__AVX512CD__)
+		#define CPUINFO_BASELINE_X86_AVX512CD 1
+	#endif
+	#if defined(__AVX512DQ__)
+		#define CPUINFO_BASELINE_X86_AVX512DQ 1
+	#endif
+	#if defined(__AVX512BW__)
+		#define CPUINFO_BASELINE_X86_AVX512BW 1
+	#endif
+	#if defined(__AVX512VL__)
+		#define CPUINFO_BASELINE_X86_AVX512VL 1
+	#endif
+	#if defined(__AVX512IFMA__)
+		#define CPUINFO_BASELINE_X86_AVX512IFMA 1
+	#endif
+	#if defined(__AVX512VBMI__)
+		#define CPUINFO_BASELINE_X86_AVX512VBMI 1
+	#endif
+	#if defined(__AVX512VBMI2__)
+		#define CPUINFO_BASELINE_X86_AVX512VBMI2 1
+	#endif
+	#if defined(__AVX512BITALG__)
+		#define CPUINFO_BASELINE_X86_AVX512BITALG 1
+	#endif
+	#if defined(__AVX512VPOPCNTDQ__)
+		#define CPUINFO_BASELINE_X86_AVX512VPOPCNTDQ 1
+	#endif
+	#if defined(__AVX512VNNI__)
+		#define CPUINFO_BASELINE_X86_AVX512VNNI 1
+	#endif
+	#if defined(__AVX512BF16__)
+		#define CPUINFO_BASELINE_X86_AVX512BF16 1
+	#endif
+	#if defined(__AVX512VP2INTERSECT__)
+		#define CPUINFO_BASELINE_X86_AVX512VP2INTERSECT 1
+	#endif
+	#if defined(__AVX5124VNNIW__)
+		#define CPUINFO_BASELINE_X86_AVX512_4VNNIW 1
+	#endif
+	#if defined(__AVX5124FMAPS__)
+		#define CPUINFO_BASELINE_X86_AVX512_4FMAPS 1
+	#endif
+	#if defined(__AVX512FP16__)
+		#define CPUINFO_BASELINE_X86_AVX512FP16 1
+	#endif
+	#if defined(__AVXVNNI__)
+		#define CPUINFO_BASELINE_X86_AVXVNNI 1
+	#endif
+	#if defined(__AVXVNNIINT8__)
+		#define CPUINFO_BASELINE_X86_AVXVNNIINT8 1
+	#endif
+	#if defined(__AVXIFMA__)
+		#define CPUINFO_BASELINE_X86_AVXIFMA 1
+	#endif
+	#if defined(__AVXNECONVERT__)
+		#define CPUINFO_BASELINE_X86_AVXNECONVERT 1
+	#endif
+	#if defined(__HLE__)
+		#define CPUINFO_BASELINE_X86_HLE 1
+	#endif
+	#if defined(__RTM__)
+		#define CPUINFO_BASELINE_X86_RTM 1
+	#endif
+	#if defined(__RTM__)
+		#define CPUINFO_BASELINE_X86_XTEST 1
+	#endif
+	#if defined(__i686__) || defined(_M_X64) || defined(__x86_64__)
+		#define CPUINFO_BASELINE_X86_CMOV 1
+	#endif
+	#if defined(__i586__) || defined(__i686__) || defined(_M_X64) || defined(__x86_64__)
+		#define CPUINFO_BASELINE_X86_CMPXCHG8B 1
+	#endif
+	#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+		#define CPUINFO_BASELINE_X86_CMPXCHG16B 1
+	#endif
+	#if defined(__CLWB__)
+		#define CPUINFO_BASELINE_X86_CLWB 1
+	#endif
+	#if defined(__MOVBE__)
+		#define CPUINFO_BASELINE_X86_MOVBE 1
+	#endif
+	#if defined(__MOVDIRI__)
+		#define CPUINFO_BASELINE_X86_MOVDIRI 1
+	#endif
+	#if defined(__MOVDIR64B__)
+		#define CPUINFO_BASELINE_X86_MOVDIR64B 1
+	#endif
+	#if defined(__ENQCMD__)
+		#define CPUINFO_BASELINE_X86_ENQCMD 1
+	#endif
+	#if defined(__CLDEMOTE__)
+		#define CPUINFO_BASELINE_X86_CLDEMOTE 1
+	#endif
+	#if defined(__SERIALIZE__)
+		#define CPUINFO_BASELINE_X86_SERIALIZE 1
+	#endif
+	#if defined(__LAHF_SAHF__)
+		#define CPUINFO_BASELINE_X86_LAHF_SAHF 1
+	#endif
+	#if defined(__APX_F__)
+		#define CPUINFO_BASELINE_X86_APX 1
+	#endif
+	#if defined(__LZCNT__)
+		#define CPUINFO_BASELINE_X86_LZCNT 1
+	#endif
+	#if defined(__POPCNT__)
+		#define CPUINFO_BASELINE_X86_POPCNT 1
+	#endif
+	#if defined(__TBM__)
+		#define CPUINFO_BASELINE_X86_TBM 1
+	#endif
+	#if defined(__BMI__)
+		#define CPUINFO_BASELINE_X86_BMI 1
+	#endif
+	#if defined(__BMI2__)
+		#define CPUINFO_BASELINE_X86_BMI2 1
+	#endif
+	#if defined(__ADX__)
+		#define CPUINFO_BASELINE_X86_ADX 1
+	#endif
+	#if defined(__AES__)
+		#define CPUINFO_BASELINE_X86_AES 1
+	#endif
+	#if defined(__VAES__)
+		#define CPUINFO_BASELINE_X86_VAES 1
+	#endif
+	#if defined(__PCLMUL__)
+		#define CPUINFO_BASELINE_X86_PCLMULQDQ 1
+	#endif
+	#if defined(__VPCLMULQDQ__)
+		#define CPUINFO_BASELINE_X86_VPCLMULQDQ 1
+	#endif
+	#if defined(__GFNI__)
+		#define CPUINFO_BASELINE_X86_GFNI 1
+	#endif
+	#if defined(__RDRND__)
+		#define CPUINFO_BASELINE_X86_RDRAND 1
+	#endif
+	#if defined(__RDSEED__)
+		#define CPUINFO_BASELINE_X86_RDSEED 1
+	#endif
+	#if defined(__SHA__)
+		#define CPUINFO_BASELINE_X86_SHA 1
+	#endif
 #endif
 
 static inline bool cpuinfo_has_x86_rdtsc(void) {
@@ -823,7 +1277,9 @@ static inline bool cpuinfo_has_x86_rdtscp(void) {
 }
 
 static inline bool cpuinfo_has_x86_rdpid(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_RDPID)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.rdpid;
 	#else
 		return false;
@@ -831,7 +1287,9 @@ static inline bool cpuinfo_has_x86_rdpid(void) {
 }
 
 static inline bool cpuinfo_has_x86_clzero(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_CLZERO)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.clzero;
 	#else
 		return false;
@@ -847,15 +1305,41 @@ static inline bool cpuinfo_has_x86_mwait(void) {
 }
 
 static inline bool cpuinfo_has_x86_mwaitx(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_MWAITX)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.mwaitx;
 	#else
 		return false;
 	#endif
 }
 
-static inline bool cpuinfo_has_x86_fxsave(void) {
+static inline bool cpuinfo_has_x86_waitpkg(void) {
+	#if defined(CPUINFO_BASELINE_X86_WAITPKG)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.waitpkg;
+	#else
+		return false;
+	#endif
+}
+
+/*
+ * Returns the maximum time in TSC cycles which UMWAIT and TPAUSE can wait before the OS forces a wakeup, as configured
+ * in /sys/devices/system/cpu/umwait_control on Linux, or 0 if WAITPKG is not supported or the limit is unknown.
+ */
+static inline uint32_t cpuinfo_get_x86_umwait_max_time(void) {
 	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.umwait_max_time;
+	#else
+		return 0;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_fxsave(void) {
+	#if defined(CPUINFO_BASELINE_X86_FXSAVE)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.fxsave;
 	#else
 		return false;
@@ -863,7 +1347,9 @@ static inline bool cpuinfo_has_x86_fxsave(void) {
 }
 
 static inline bool cpuinfo_has_x86_xsave(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_XSAVE)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.xsave;
 	#else
 		return false;
@@ -885,7 +1371,9 @@ static inline bool cpuinfo_has_x86_fpu(void) {
 }
 
 static inline bool cpuinfo_has_x86_mmx(void) {
-	#if CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_MMX)
+		return true;
+	#elif CPUINFO_ARCH_X86_64
 		return true;
 	#elif CPUINFO_ARCH_X86
 		#if defined(__ANDROID__)
@@ -913,7 +1401,9 @@ static inline bool cpuinfo_has_x86_mmx_plus(void) {
 }
 
 static inline bool cpuinfo_has_x86_3dnow(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_3DNOW)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.three_d_now;
 	#else
 		return false;
@@ -921,7 +1411,9 @@ static inline bool cpuinfo_has_x86_3dnow(void) {
 }
 
 static inline bool cpuinfo_has_x86_3dnow_plus(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_3DNOW_PLUS)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.three_d_now_plus;
 	#else
 		return false;
@@ -951,7 +1443,9 @@ static inline bool cpuinfo_has_x86_prefetch(void) {
 }
 
 static inline bool cpuinfo_has_x86_prefetchw(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_PREFETCHW)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.prefetchw;
 	#else
 		return false;
@@ -959,13 +1453,25 @@ static inline bool cpuinfo_has_x86_prefetchw(void) {
 }
 
 static inline bool cpuinfo_has_x86_prefetchwt1(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_PREFETCHWT1)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.prefetchwt1;
 	#else
 		return false;
 	#endif
 }
 
+static inline bool cpuinfo_has_x86_prefetchi(void) {
+	#if defined(CPUINFO_BASELINE_X86_PREFETCHI)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.prefetchi;
+	#else
+		return false;
+	#endif
+}
+
 static inline bool cpuinfo_has_x86_daz(void) {
 	#if CPUINFO_ARCH_X86_64
 		return true;
@@ -981,7 +1487,9 @@ static inline bool cpuinfo_has_x86_daz(void) {
 }
 
 static inline bool cpuinfo_has_x86_sse(void) {
-	#if CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_SSE)
+		return true;
+	#elif CPUINFO_ARCH_X86_64
 		return true;
 	#elif CPUINFO_ARCH_X86
 		#if defined(__ANDROID__)
@@ -995,7 +1503,9 @@ static inline bool cpuinfo_has_x86_sse(void) {
 }
 
 static inline bool cpuinfo_has_x86_sse2(void) {
-	#if CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_SSE2)
+		return true;
+	#elif CPUINFO_ARCH_X86_64
 		return true;
 	#elif CPUINFO_ARCH_X86
 		#if defined(__ANDROID__)
@@ -1009,7 +1519,9 @@ static inline bool cpuinfo_has_x86_sse2(void) {
 }
 
 static inline bool cpuinfo_has_x86_sse3(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_SSE3)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		#if defined(__ANDROID__)
 			return true;
 		#else
@@ -1021,7 +1533,9 @@ static inline bool cpuinfo_has_x86_sse3(void) {
 }
 
 static inline bool cpuinfo_has_x86_ssse3(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_SSSE3)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		#if defined(__ANDROID__)
 			return true;
 		#else
@@ -1033,7 +1547,9 @@ static inline bool cpuinfo_has_x86_ssse3(void) {
 }
 
 static inline bool cpuinfo_has_x86_sse4_1(void) {
-	#if CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_SSE4_1)
+		return true;
+	#elif CPUINFO_ARCH_X86_64
 		#if defined(__ANDROID__)
 			return true;
 		#else
@@ -1047,7 +1563,9 @@ static inline bool cpuinfo_has_x86_sse4_1(void) {
 }
 
 static inline bool cpuinfo_has_x86_sse4_2(void) {
-	#if CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_SSE4_2)
+		return true;
+	#elif CPUINFO_ARCH_X86_64
 		#if defined(__ANDROID__)
 			return true;
 		#else
@@ -1061,7 +1579,9 @@ static inline bool cpuinfo_has_x86_sse4_2(void) {
 }
 
 static inline bool cpuinfo_has_x86_sse4a(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_SSE4A)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.sse4a;
 	#else
 		return false;
@@ -1077,7 +1597,9 @@ static inline bool cpuinfo_has_x86_misaligned_sse(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx;
 	#else
 		return false;
@@ -1085,7 +1607,9 @@ static inline bool cpuinfo_has_x86_avx(void) {
 }
 
 static inline bool cpuinfo_has_x86_fma3(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_FMA3)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.fma3;
 	#else
 		return false;
@@ -1093,7 +1617,9 @@ static inline bool cpuinfo_has_x86_fma3(void) {
 }
 
 static inline bool cpuinfo_has_x86_fma4(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_FMA4)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.fma4;
 	#else
 		return false;
@@ -1101,7 +1627,9 @@ static inline bool cpuinfo_has_x86_fma4(void) {
 }
 
 static inline bool cpuinfo_has_x86_xop(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_XOP)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.xop;
 	#else
 		return false;
@@ -1109,7 +1637,9 @@ static inline bool cpuinfo_has_x86_xop(void) {
 }
 
 static inline bool cpuinfo_has_x86_f16c(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_F16C)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.f16c;
 	#else
 		return false;
@@ -1117,7 +1647,9 @@ static inline bool cpuinfo_has_x86_f16c(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx2(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX2)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx2;
 	#else
 		return false;
@@ -1125,7 +1657,9 @@ static inline bool cpuinfo_has_x86_avx2(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512f(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX512F)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512f;
 	#else
 		return false;
@@ -1133,7 +1667,9 @@ static inline bool cpuinfo_has_x86_avx512f(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512pf(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX512PF)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512pf;
 	#else
 		return false;
@@ -1141,7 +1677,9 @@ static inline bool cpuinfo_has_x86_avx512pf(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512er(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX512ER)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512er;
 	#else
 		return false;
@@ -1149,7 +1687,9 @@ static inline bool cpuinfo_has_x86_avx512er(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512cd(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX512CD)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512cd;
 	#else
 		return false;
@@ -1157,7 +1697,9 @@ static inline bool cpuinfo_has_x86_avx512cd(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512dq(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX512DQ)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512dq;
 	#else
 		return false;
@@ -1165,7 +1707,9 @@ static inline bool cpuinfo_has_x86_avx512dq(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512bw(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX512BW)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512bw;
 	#else
 		return false;
@@ -1173,7 +1717,9 @@ static inline bool cpuinfo_has_x86_avx512bw(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512vl(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX512VL)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512vl;
 	#else
 		return false;
@@ -1181,7 +1727,9 @@ static inline bool cpuinfo_has_x86_avx512vl(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512ifma(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX512IFMA)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512ifma;
 	#else
 		return false;
@@ -1189,7 +1737,9 @@ static inline bool cpuinfo_has_x86_avx512ifma(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512vbmi(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX512VBMI)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512vbmi;
 	#else
 		return false;
@@ -1197,7 +1747,9 @@ static inline bool cpuinfo_has_x86_avx512vbmi(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512vbmi2(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX512VBMI2)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512vbmi2;
 	#else
 		return false;
@@ -1205,7 +1757,9 @@ static inline bool cpuinfo_has_x86_avx512vbmi2(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512bitalg(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX512BITALG)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512bitalg;
 	#else
 		return false;
@@ -1213,7 +1767,9 @@ static inline bool cpuinfo_has_x86_avx512bitalg(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512vpopcntdq(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX512VPOPCNTDQ)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512vpopcntdq;
 	#else
 		return false;
@@ -1221,7 +1777,9 @@ static inline bool cpuinfo_has_x86_avx512vpopcntdq(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512vnni(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX512VNNI)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512vnni;
 	#else
 		return false;
@@ -1229,7 +1787,9 @@ static inline bool cpuinfo_has_x86_avx512vnni(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512bf16(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX512BF16)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512bf16;
 	#else
 		return false;
@@ -1237,7 +1797,9 @@ static inline bool cpuinfo_has_x86_avx512bf16(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512vp2intersect(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX512VP2INTERSECT)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512vp2intersect;
 	#else
 		return false;
@@ -1245,7 +1807,9 @@ static inline bool cpuinfo_has_x86_avx512vp2intersect(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512_4vnniw(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX512_4VNNIW)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512_4vnniw;
 	#else
 		return false;
@@ -1253,49 +1817,173 @@ static inline bool cpuinfo_has_x86_avx512_4vnniw(void) {
 }
 
 static inline bool cpuinfo_has_x86_avx512_4fmaps(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AVX512_4FMAPS)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.avx512_4fmaps;
 	#else
 		return false;
 	#endif
 }
 
-static inline bool cpuinfo_has_x86_hle(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
-		return cpuinfo_isa.hle;
+static inline bool cpuinfo_has_x86_avx512fp16(void) {
+	#if defined(CPUINFO_BASELINE_X86_AVX512FP16)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.avx512fp16;
 	#else
 		return false;
 	#endif
 }
 
-static inline bool cpuinfo_has_x86_rtm(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
-		return cpuinfo_isa.rtm;
+static inline bool cpuinfo_has_x86_avxvnni(void) {
+	#if defined(CPUINFO_BASELINE_X86_AVXVNNI)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.avxvnni;
 	#else
 		return false;
 	#endif
 }
 
-static inline bool cpuinfo_has_x86_xtest(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
-		return cpuinfo_isa.xtest;
+static inline bool cpuinfo_has_x86_avxvnniint8(void) {
+	#if defined(CPUINFO_BASELINE_X86_AVXVNNIINT8)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.avxvnniint8;
 	#else
 		return false;
 	#endif
 }
 
-static inline bool cpuinfo_has_x86_mpx(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
-		return cpuinfo_isa.mpx;
+static inline bool cpuinfo_has_x86_avxifma(void) {
+	#if defined(CPUINFO_BASELINE_X86_AVXIFMA)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.avxifma;
 	#else
 		return false;
 	#endif
 }
 
-static inline bool cpuinfo_has_x86_cmov(void) {
-	#if CPUINFO_ARCH_X86_64
+static inline bool cpuinfo_has_x86_avxneconvert(void) {
+	#if defined(CPUINFO_BASELINE_X86_AVXNECONVERT)
 		return true;
-	#elif CPUINFO_ARCH_X86
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.avxneconvert;
+	#else
+		return false;
+	#endif
+}
+
+/*
+ * Returns the version of AVX10 converged vector ISA, or 0 if AVX10 is not supported. All versions support 128-bit
+ * and 256-bit vectors; use cpuinfo_get_x86_avx10_max_vector_bits to check for 512-bit vectors.
+ */
+static inline uint32_t cpuinfo_get_x86_avx10_version(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.avx10_version;
+	#else
+		return 0;
+	#endif
+}
+
+/*
+ * Returns the maximum length in bits of vectors supported by AVX10 instructions (256 or 512), or 0 if AVX10 is
+ * not supported.
+ */
+static inline uint32_t cpuinfo_get_x86_avx10_max_vector_bits(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.avx10_max_vector_bits;
+	#else
+		return 0;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_amx_tile(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.amx_tile && cpuinfo_isa.amx_permitted;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_amx_int8(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.amx_int8 && cpuinfo_isa.amx_permitted;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_amx_bf16(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.amx_bf16 && cpuinfo_isa.amx_permitted;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_amx_fp16(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.amx_fp16 && cpuinfo_isa.amx_permitted;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_amx_complex(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.amx_complex && cpuinfo_isa.amx_permitted;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_hle(void) {
+	#if defined(CPUINFO_BASELINE_X86_HLE)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.hle;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_rtm(void) {
+	#if defined(CPUINFO_BASELINE_X86_RTM)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.rtm;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_xtest(void) {
+	#if defined(CPUINFO_BASELINE_X86_XTEST)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.xtest;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_mpx(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.mpx;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_cmov(void) {
+	#if defined(CPUINFO_BASELINE_X86_CMOV)
+		return true;
+	#elif CPUINFO_ARCH_X86_64
+		return true;
+	#elif CPUINFO_ARCH_X86
 		return cpuinfo_isa.cmov;
 	#else
 		return false;
@@ -1303,7 +1991,9 @@ static inline bool cpuinfo_has_x86_cmov(void) {
 }
 
 static inline bool cpuinfo_has_x86_cmpxchg8b(void) {
-	#if CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_CMPXCHG8B)
+		return true;
+	#elif CPUINFO_ARCH_X86_64
 		return true;
 	#elif CPUINFO_ARCH_X86
 		return cpuinfo_isa.cmpxchg8b;
@@ -1313,7 +2003,9 @@ static inline bool cpuinfo_has_x86_cmpxchg8b(void) {
 }
 
 static inline bool cpuinfo_has_x86_cmpxchg16b(void) {
-	#if CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_CMPXCHG16B)
+		return true;
+	#elif CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.cmpxchg16b;
 	#else
 		return false;
@@ -1321,7 +2013,9 @@ static inline bool cpuinfo_has_x86_cmpxchg16b(void) {
 }
 
 static inline bool cpuinfo_has_x86_clwb(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_CLWB)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.clwb;
 	#else
 		return false;
@@ -1329,15 +2023,109 @@ static inline bool cpuinfo_has_x86_clwb(void) {
 }
 
 static inline bool cpuinfo_has_x86_movbe(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_MOVBE)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.movbe;
 	#else
 		return false;
 	#endif
 }
 
+static inline bool cpuinfo_has_x86_erms(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.erms;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_fsrm(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.fsrm;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_fzlrm(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.fzlrm;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_fsrs(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.fsrs;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_fsrc(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.fsrc;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_movdiri(void) {
+	#if defined(CPUINFO_BASELINE_X86_MOVDIRI)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.movdiri;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_movdir64b(void) {
+	#if defined(CPUINFO_BASELINE_X86_MOVDIR64B)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.movdir64b;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_enqcmd(void) {
+	#if defined(CPUINFO_BASELINE_X86_ENQCMD)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.enqcmd;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_cldemote(void) {
+	#if defined(CPUINFO_BASELINE_X86_CLDEMOTE)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.cldemote;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_x86_serialize(void) {
+	#if defined(CPUINFO_BASELINE_X86_SERIALIZE)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.serialize;
+	#else
+		return false;
+	#endif
+}
+
 static inline bool cpuinfo_has_x86_lahf_sahf(void) {
-	#if CPUINFO_ARCH_X86
+	#if defined(CPUINFO_BASELINE_X86_LAHF_SAHF)
+		return true;
+	#elif CPUINFO_ARCH_X86
 		return true;
 	#elif CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.lahf_sahf;
@@ -1346,8 +2134,20 @@ static inline bool cpuinfo_has_x86_lahf_sahf(void) {
 	#endif
 }
 
+static inline bool cpuinfo_has_x86_apx(void) {
+	#if defined(CPUINFO_BASELINE_X86_APX)
+		return true;
+	#elif CPUINFO_ARCH_X86_64
+		return cpuinfo_isa.apx;
+	#else
+		return false;
+	#endif
+}
+
 static inline bool cpuinfo_has_x86_lzcnt(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_LZCNT)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.lzcnt;
 	#else
 		return false;
@@ -1355,7 +2155,9 @@ static inline bool cpuinfo_has_x86_lzcnt(void) {
 }
 
 static inline bool cpuinfo_has_x86_popcnt(void) {
-	#if CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_POPCNT)
+		return true;
+	#elif CPUINFO_ARCH_X86_64
 		#if defined(__ANDROID__)
 			return true;
 		#else
@@ -1369,7 +2171,9 @@ static inline bool cpuinfo_has_x86_popcnt(void) {
 }
 
 static inline bool cpuinfo_has_x86_tbm(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_TBM)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.tbm;
 	#else
 		return false;
@@ -1377,7 +2181,9 @@ static inline bool cpuinfo_has_x86_tbm(void) {
 }
 
 static inline bool cpuinfo_has_x86_bmi(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_BMI)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.bmi;
 	#else
 		return false;
@@ -1385,7 +2191,9 @@ static inline bool cpuinfo_has_x86_bmi(void) {
 }
 
 static inline bool cpuinfo_has_x86_bmi2(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_BMI2)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.bmi2;
 	#else
 		return false;
@@ -1393,7 +2201,9 @@ static inline bool cpuinfo_has_x86_bmi2(void) {
 }
 
 static inline bool cpuinfo_has_x86_adx(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_ADX)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.adx;
 	#else
 		return false;
@@ -1401,7 +2211,9 @@ static inline bool cpuinfo_has_x86_adx(void) {
 }
 
 static inline bool cpuinfo_has_x86_aes(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_AES)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.aes;
 	#else
 		return false;
@@ -1409,7 +2221,9 @@ static inline bool cpuinfo_has_x86_aes(void) {
 }
 
 static inline bool cpuinfo_has_x86_vaes(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_VAES)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.vaes;
 	#else
 		return false;
@@ -1417,7 +2231,9 @@ static inline bool cpuinfo_has_x86_vaes(void) {
 }
 
 static inline bool cpuinfo_has_x86_pclmulqdq(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_PCLMULQDQ)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.pclmulqdq;
 	#else
 		return false;
@@ -1425,7 +2241,9 @@ static inline bool cpuinfo_has_x86_pclmulqdq(void) {
 }
 
 static inline bool cpuinfo_has_x86_vpclmulqdq(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_VPCLMULQDQ)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.vpclmulqdq;
 	#else
 		return false;
@@ -1433,7 +2251,9 @@ static inline bool cpuinfo_has_x86_vpclmulqdq(void) {
 }
 
 static inline bool cpuinfo_has_x86_gfni(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_GFNI)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.gfni;
 	#else
 		return false;
@@ -1441,7 +2261,9 @@ static inline bool cpuinfo_has_x86_gfni(void) {
 }
 
 static inline bool cpuinfo_has_x86_rdrand(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_RDRAND)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.rdrand;
 	#else
 		return false;
@@ -1449,7 +2271,9 @@ static inline bool cpuinfo_has_x86_rdrand(void) {
 }
 
 static inline bool cpuinfo_has_x86_rdseed(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_RDSEED)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.rdseed;
 	#else
 		return false;
@@ -1457,7 +2281,9 @@ static inline bool cpuinfo_has_x86_rdseed(void) {
 }
 
 static inline bool cpuinfo_has_x86_sha(void) {
-	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(CPUINFO_BASELINE_X86_SHA)
+		return true;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_isa.sha;
 	#else
 		return false;
@@ -1492,10 +2318,44 @@ static inline bool cpuinfo_has_x86_sha(void) {
 		#endif
 		#if CPUINFO_ARCH_ARM64
 			bool atomics;
+			bool lse128;
 			bool bf16;
+			bool ebf16;
+			bool fhm;
+			bool i8mm;
 			bool sve;
 			bool svebf16;
 			bool sve2;
+			bool svei8mm;
+			bool svef32mm;
+			bool svef64mm;
+			bool sveaes;
+			bool svepmull;
+			bool svesha3;
+			bool svesm4;
+			bool svebitperm;
+			bool sve2p1;
+			bool sme;
+			bool sme2;
+			bool sme2p1;
+			bool smei16i64;
+			bool smef64f64;
+			bool smefa64;
+			bool sha3;
+			bool sha512;
+			bool sm3;
+			bool sm4;
+			bool rng;
+			bool rcpc;
+			bool rcpc2;
+			bool rcpc3;
+			bool flagm;
+			bool flagm2;
+			bool mops;
+			bool cssc;
+			/* SVE vector length and SME streaming vector length in bytes, or 0 if not supported */
+			uint32_t svelen;
+			uint32_t smelen;
 		#endif
 		bool rdm;
 		bool fp16arith;
@@ -1513,6 +2373,136 @@ static inline bool cpuinfo_has_x86_sha(void) {
 	extern struct cpuinfo_arm_isa cpuinfo_isa;
 #endif
 
+/*
+ * CPUINFO_BASELINE_ARM_* macros are defined for ISA extensions which the compiler may use unconditionally in the
+ * translation unit, e.g. due to -march=armv8.2-a+dotprod. See CPUINFO_BASELINE_X86_* for details.
+ */
+#if (CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64) && !defined(CPUINFO_NO_BASELINE_ISA)
+	#if defined(__ARM_ARCH) && __ARM_ARCH >= 8
+		#define CPUINFO_BASELINE_ARM_V8 1
+	#endif
+	#if defined(__ARM_FEATURE_IDIV)
+		#define CPUINFO_BASELINE_ARM_IDIV 1
+	#endif
+	#if defined(__ARM_NEON)
+		#define CPUINFO_BASELINE_ARM_NEON 1
+	#endif
+	#if defined(__ARM_NEON) && defined(__ARM_FEATURE_FMA)
+		#define CPUINFO_BASELINE_ARM_NEON_FMA 1
+	#endif
+	#if defined(__ARM_FEATURE_ATOMICS)
+		#define CPUINFO_BASELINE_ARM_ATOMICS 1
+	#endif
+	#if defined(__ARM_FEATURE_QRDMX)
+		#define CPUINFO_BASELINE_ARM_NEON_RDM 1
+	#endif
+	#if defined(__ARM_FEATURE_FP16_SCALAR_ARITHMETIC)
+		#define CPUINFO_BASELINE_ARM_FP16_ARITH 1
+	#endif
+	#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+		#define CPUINFO_BASELINE_ARM_NEON_FP16_ARITH 1
+	#endif
+	#if defined(__ARM_FEATURE_DOTPROD)
+		#define CPUINFO_BASELINE_ARM_NEON_DOT 1
+	#endif
+	#if defined(__ARM_FEATURE_JCVT)
+		#define CPUINFO_BASELINE_ARM_JSCVT 1
+	#endif
+	#if defined(__ARM_FEATURE_COMPLEX)
+		#define CPUINFO_BASELINE_ARM_FCMA 1
+	#endif
+	#if defined(__ARM_FEATURE_AES)
+		#define CPUINFO_BASELINE_ARM_AES 1
+	#endif
+	#if defined(__ARM_FEATURE_AES)
+		#define CPUINFO_BASELINE_ARM_PMULL 1
+	#endif
+	#if defined(__ARM_FEATURE_SHA2)
+		#define CPUINFO_BASELINE_ARM_SHA1 1
+	#endif
+	#if defined(__ARM_FEATURE_SHA2)
+		#define CPUINFO_BASELINE_ARM_SHA2 1
+	#endif
+	#if defined(__ARM_FEATURE_CRC32)
+		#define CPUINFO_BASELINE_ARM_CRC32 1
+	#endif
+	#if defined(__ARM_FEATURE_SVE)
+		#define CPUINFO_BASELINE_ARM_SVE 1
+	#endif
+	#if defined(__ARM_FEATURE_SVE2)
+		#define CPUINFO_BASELINE_ARM_SVE2 1
+	#endif
+	#if defined(__ARM_FEATURE_BF16_VECTOR_ARITHMETIC)
+		#define CPUINFO_BASELINE_ARM_BF16 1
+	#endif
+	#if defined(__ARM_FEATURE_SVE_BF16)
+		#define CPUINFO_BASELINE_ARM_SVEBF16 1
+	#endif
+	#if defined(__ARM_FEATURE_FP16_FML)
+		#define CPUINFO_BASELINE_ARM_FHM 1
+	#endif
+	#if defined(__ARM_FEATURE_MATMUL_INT8)
+		#define CPUINFO_BASELINE_ARM_I8MM 1
+	#endif
+	#if defined(__ARM_FEATURE_SVE_MATMUL_INT8)
+		#define CPUINFO_BASELINE_ARM_SVEI8MM 1
+	#endif
+	#if defined(__ARM_FEATURE_SVE_MATMUL_FP32)
+		#define CPUINFO_BASELINE_ARM_SVEF32MM 1
+	#endif
+	#if defined(__ARM_FEATURE_SVE_MATMUL_FP64)
+		#define CPUINFO_BASELINE_ARM_SVEF64MM 1
+	#endif
+	#if defined(__ARM_FEATURE_SVE2_AES)
+		#define CPUINFO_BASELINE_ARM_SVEAES 1
+	#endif
+	#if defined(__ARM_FEATURE_SVE2_AES)
+		#define CPUINFO_BASELINE_ARM_SVEPMULL 1
+	#endif
+	#if defined(__ARM_FEATURE_SVE2_SHA3)
+		#define CPUINFO_BASELINE_ARM_SVESHA3 1
+	#endif
+	#if defined(__ARM_FEATURE_SVE2_SM4)
+		#define CPUINFO_BASELINE_ARM_SVESM4 1
+	#endif
+	#if defined(__ARM_FEATURE_SVE2_BITPERM)
+		#define CPUINFO_BASELINE_ARM_SVEBITPERM 1
+	#endif
+	#if defined(__ARM_FEATURE_SME)
+		#define CPUINFO_BASELINE_ARM_SME 1
+	#endif
+	#if defined(__ARM_FEATURE_SME2)
+		#define CPUINFO_BASELINE_ARM_SME2 1
+	#endif
+	#if defined(__ARM_FEATURE_SHA3)
+		#define CPUINFO_BASELINE_ARM_SHA3 1
+	#endif
+	#if defined(__ARM_FEATURE_SHA512)
+		#define CPUINFO_BASELINE_ARM_SHA512 1
+	#endif
+	#if defined(__ARM_FEATURE_SM3)
+		#define CPUINFO_BASELINE_ARM_SM3 1
+	#endif
+	#if defined(__ARM_FEATURE_SM4)
+		#define CPUINFO_BASELINE_ARM_SM4 1
+	#endif
+	#if defined(__ARM_FEATURE_RNG)
+		#define CPUINFO_BASELINE_ARM_RNG 1
+	#endif
+	#if defined(__ARM_FEATURE_RCPC)
+		#define CPUINFO_BASELINE_ARM_RCPC 1
+	#endif
+	#if defined(__ARM_FEATURE_RCPC) && __ARM_FEATURE_RCPC >= 2
+		#define CPUINFO_BASELINE_ARM_RCPC2 1
+	#endif
+	#if defined(__ARM_FEATURE_RCPC) && __ARM_FEATURE_RCPC >= 3
+		#define CPUINFO_BASELINE_ARM_RCPC3 1
+	#endif
+	#if defined(__ARM_FEATURE_MOPS)
+		#define CPUINFO_BASELINE_ARM_MOPS 1
+	#endif
+#endif
+
 static inline bool cpuinfo_has_arm_thumb(void) {
 	#if CPUINFO_ARCH_ARM
 		return cpuinfo_isa.thumb;
@@ -1570,7 +2560,9 @@ static inline bool cpuinfo_has_arm_v7mp(void) {
 }
 
 static inline bool cpuinfo_has_arm_v8(void) {
-	#if CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_V8)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
 		return true;
 	#elif CPUINFO_ARCH_ARM
 		return cpuinfo_isa.armv8;
@@ -1580,7 +2572,9 @@ static inline bool cpuinfo_has_arm_v8(void) {
 }
 
 static inline bool cpuinfo_has_arm_idiv(void) {
-	#if CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_IDIV)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
 		return true;
 	#elif CPUINFO_ARCH_ARM
 		return cpuinfo_isa.idiv;
@@ -1674,7 +2668,9 @@ static inline bool cpuinfo_has_arm_wmmx2(void) {
 }
 
 static inline bool cpuinfo_has_arm_neon(void) {
-	#if CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_NEON)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
 		return true;
 	#elif CPUINFO_ARCH_ARM
 		return cpuinfo_isa.neon;
@@ -1694,7 +2690,9 @@ static inline bool cpuinfo_has_arm_neon_fp16(void) {
 }
 
 static inline bool cpuinfo_has_arm_neon_fma(void) {
-	#if CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_NEON_FMA)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
 		return true;
 	#elif CPUINFO_ARCH_ARM
 		return cpuinfo_isa.neon && cpuinfo_isa.fma;
@@ -1714,7 +2712,9 @@ static inline bool cpuinfo_has_arm_neon_v8(void) {
 }
 
 static inline bool cpuinfo_has_arm_atomics(void) {
-	#if CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_ATOMICS)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.atomics;
 	#else
 		return false;
@@ -1722,7 +2722,9 @@ static inline bool cpuinfo_has_arm_atomics(void) {
 }
 
 static inline bool cpuinfo_has_arm_neon_rdm(void) {
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_NEON_RDM)
+		return true;
+	#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.rdm;
 	#else
 		return false;
@@ -1730,7 +2732,9 @@ static inline bool cpuinfo_has_arm_neon_rdm(void) {
 }
 
 static inline bool cpuinfo_has_arm_neon_fp16_arith(void) {
-	#if CPUINFO_ARCH_ARM
+	#if defined(CPUINFO_BASELINE_ARM_NEON_FP16_ARITH)
+		return true;
+	#elif CPUINFO_ARCH_ARM
 		return cpuinfo_isa.neon && cpuinfo_isa.fp16arith;
 	#elif CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.fp16arith;
@@ -1740,7 +2744,9 @@ static inline bool cpuinfo_has_arm_neon_fp16_arith(void) {
 }
 
 static inline bool cpuinfo_has_arm_fp16_arith(void) {
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_FP16_ARITH)
+		return true;
+	#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.fp16arith;
 	#else
 		return false;
@@ -1748,7 +2754,9 @@ static inline bool cpuinfo_has_arm_fp16_arith(void) {
 }
 
 static inline bool cpuinfo_has_arm_neon_dot(void) {
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_NEON_DOT)
+		return true;
+	#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.dot;
 	#else
 		return false;
@@ -1756,7 +2764,9 @@ static inline bool cpuinfo_has_arm_neon_dot(void) {
 }
 
 static inline bool cpuinfo_has_arm_jscvt(void) {
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_JSCVT)
+		return true;
+	#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.jscvt;
 	#else
 		return false;
@@ -1764,7 +2774,9 @@ static inline bool cpuinfo_has_arm_jscvt(void) {
 }
 
 static inline bool cpuinfo_has_arm_fcma(void) {
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_FCMA)
+		return true;
+	#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.fcma;
 	#else
 		return false;
@@ -1772,7 +2784,9 @@ static inline bool cpuinfo_has_arm_fcma(void) {
 }
 
 static inline bool cpuinfo_has_arm_aes(void) {
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_AES)
+		return true;
+	#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.aes;
 	#else
 		return false;
@@ -1780,7 +2794,9 @@ static inline bool cpuinfo_has_arm_aes(void) {
 }
 
 static inline bool cpuinfo_has_arm_sha1(void) {
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_SHA1)
+		return true;
+	#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.sha1;
 	#else
 		return false;
@@ -1788,7 +2804,9 @@ static inline bool cpuinfo_has_arm_sha1(void) {
 }
 
 static inline bool cpuinfo_has_arm_sha2(void) {
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_SHA2)
+		return true;
+	#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.sha2;
 	#else
 		return false;
@@ -1796,7 +2814,9 @@ static inline bool cpuinfo_has_arm_sha2(void) {
 }
 
 static inline bool cpuinfo_has_arm_pmull(void) {
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_PMULL)
+		return true;
+	#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.pmull;
 	#else
 		return false;
@@ -1804,7 +2824,9 @@ static inline bool cpuinfo_has_arm_pmull(void) {
 }
 
 static inline bool cpuinfo_has_arm_crc32(void) {
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_CRC32)
+		return true;
+	#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.crc32;
 	#else
 		return false;
@@ -1812,7 +2834,9 @@ static inline bool cpuinfo_has_arm_crc32(void) {
 }
 
 static inline bool cpuinfo_has_arm_sve(void) {
-	#if CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_SVE)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.sve;
 	#else
 		return false;
@@ -1820,7 +2844,9 @@ static inline bool cpuinfo_has_arm_sve(void) {
 }
 
 static inline bool cpuinfo_has_arm_sve2(void) {
-	#if CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_SVE2)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.sve2;
 	#else
 		return false;
@@ -1828,7 +2854,9 @@ static inline bool cpuinfo_has_arm_sve2(void) {
 }
 
 static inline bool cpuinfo_has_arm_bf16(void) {
-	#if CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_BF16)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.bf16;
 	#else
 		return false;
@@ -1836,13 +2864,329 @@ static inline bool cpuinfo_has_arm_bf16(void) {
 }
 
 static inline bool cpuinfo_has_arm_svebf16(void) {
-	#if CPUINFO_ARCH_ARM64
+	#if defined(CPUINFO_BASELINE_ARM_SVEBF16)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
 		return cpuinfo_isa.svebf16;
 	#else
 		return false;
 	#endif
 }
 
+static inline bool cpuinfo_has_arm_lse128(void) {
+	#if CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.lse128;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_ebf16(void) {
+	#if CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.ebf16;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_fhm(void) {
+	#if defined(CPUINFO_BASELINE_ARM_FHM)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.fhm;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_i8mm(void) {
+	#if defined(CPUINFO_BASELINE_ARM_I8MM)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.i8mm;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_svei8mm(void) {
+	#if defined(CPUINFO_BASELINE_ARM_SVEI8MM)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.svei8mm;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_svef32mm(void) {
+	#if defined(CPUINFO_BASELINE_ARM_SVEF32MM)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.svef32mm;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_svef64mm(void) {
+	#if defined(CPUINFO_BASELINE_ARM_SVEF64MM)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.svef64mm;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_sveaes(void) {
+	#if defined(CPUINFO_BASELINE_ARM_SVEAES)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.sveaes;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_svepmull(void) {
+	#if defined(CPUINFO_BASELINE_ARM_SVEPMULL)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.svepmull;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_svesha3(void) {
+	#if defined(CPUINFO_BASELINE_ARM_SVESHA3)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.svesha3;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_svesm4(void) {
+	#if defined(CPUINFO_BASELINE_ARM_SVESM4)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.svesm4;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_svebitperm(void) {
+	#if defined(CPUINFO_BASELINE_ARM_SVEBITPERM)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.svebitperm;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_sve2p1(void) {
+	#if CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.sve2p1;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_sme(void) {
+	#if defined(CPUINFO_BASELINE_ARM_SME)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.sme;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_sme2(void) {
+	#if defined(CPUINFO_BASELINE_ARM_SME2)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.sme2;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_sme2p1(void) {
+	#if CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.sme2p1;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_smei16i64(void) {
+	#if CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.smei16i64;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_smef64f64(void) {
+	#if CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.smef64f64;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_smefa64(void) {
+	#if CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.smefa64;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_sha3(void) {
+	#if defined(CPUINFO_BASELINE_ARM_SHA3)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.sha3;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_sha512(void) {
+	#if defined(CPUINFO_BASELINE_ARM_SHA512)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.sha512;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_sm3(void) {
+	#if defined(CPUINFO_BASELINE_ARM_SM3)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.sm3;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_sm4(void) {
+	#if defined(CPUINFO_BASELINE_ARM_SM4)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.sm4;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_rng(void) {
+	#if defined(CPUINFO_BASELINE_ARM_RNG)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.rng;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_rcpc(void) {
+	#if defined(CPUINFO_BASELINE_ARM_RCPC)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.rcpc;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_rcpc2(void) {
+	#if defined(CPUINFO_BASELINE_ARM_RCPC2)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.rcpc2;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_rcpc3(void) {
+	#if defined(CPUINFO_BASELINE_ARM_RCPC3)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.rcpc3;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_flagm(void) {
+	#if CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.flagm;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_flagm2(void) {
+	#if CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.flagm2;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_mops(void) {
+	#if defined(CPUINFO_BASELINE_ARM_MOPS)
+		return true;
+	#elif CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.mops;
+	#else
+		return false;
+	#endif
+}
+
+static inline bool cpuinfo_has_arm_cssc(void) {
+	#if CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.cssc;
+	#else
+		return false;
+	#endif
+}
+
+/*
+ * Returns the length of SVE vectors in bits as configured for the calling thread at initialization,
+ * or 0 if SVE is not supported.
+ */
+static inline uint32_t cpuinfo_get_arm_sve_vector_bits(void) {
+	#if CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.svelen * 8;
+	#else
+		return 0;
+	#endif
+}
+
+/*
+ * Returns the length of SVE vectors in SME streaming mode in bits as configured for the calling thread at
+ * initialization, or 0 if SME is not supported.
+ */
+static inline uint32_t cpuinfo_get_arm_sme_streaming_vector_bits(void) {
+	#if CPUINFO_ARCH_ARM64
+		return cpuinfo_isa.smelen * 8;
+	#else
+		return 0;
+	#endif
+}
+
 #if CPUINFO_ARCH_LOONGARCH64
 	/* This structure is not a part of stable API. Use cpuinfo_has_loongarch_* functions instead. */
 	struct cpuinfo_loongarch_isa {
@@ -1865,6 +3209,19 @@ static inline bool cpuinfo_has_arm_svebf16(void) {
 	extern struct cpuinfo_loongarch_isa cpuinfo_isa;
 #endif
 
+/*
+ * CPUINFO_BASELINE_LOONGARCH_* macros are defined for ISA extensions which the compiler may use unconditionally in the
+ * translation unit, e.g. due to -mlasx. See CPUINFO_BASELINE_X86_* for details.
+ */
+#if CPUINFO_ARCH_LOONGARCH64 && !defined(CPUINFO_NO_BASELINE_ISA)
+	#if defined(__loongarch_sx)
+		#define CPUINFO_BASELINE_LOONGARCH_LSX 1
+	#endif
+	#if defined(__loongarch_asx)
+		#define CPUINFO_BASELINE_LOONGARCH_LASX 1
+	#endif
+#endif
+
 static inline bool cpuinfo_has_loongarch_cpucfg(void) {
 	#if CPUINFO_ARCH_LOONGARCH64
 		return cpuinfo_isa.cpucfg;
@@ -1898,7 +3255,9 @@ static inline bool cpuinfo_has_loongarch_fpu(void) {
 }
 
 static inline bool cpuinfo_has_loongarch_lsx(void) {
-	#if CPUINFO_ARCH_LOONGARCH64
+	#if defined(CPUINFO_BASELINE_LOONGARCH_LSX)
+		return true;
+	#elif CPUINFO_ARCH_LOONGARCH64
 			return cpuinfo_isa.lsx;
 	#else
 		return false;
@@ -1906,7 +3265,9 @@ static inline bool cpuinfo_has_loongarch_lsx(void) {
 }
 
 static inline bool cpuinfo_has_loongarch_lasx(void) {
-	#if CPUINFO_ARCH_LOONGARCH64
+	#if defined(CPUINFO_BASELINE_LOONGARCH_LASX)
+		return true;
+	#elif CPUINFO_ARCH_LOONGARCH64
 			return cpuinfo_isa.lasx;
 	#else
 		return false;
@@ -1973,6 +3334,8 @@ const struct cpuinfo_processor* CPUINFO_ABI cpuinfo_get_processors(void);
 const struct cpuinfo_core* CPUINFO_ABI cpuinfo_get_cores(void);
 const struct cpuinfo_cluster* CPUINFO_ABI cpuinfo_get_clusters(void);
 const struct cpuinfo_package* CPUINFO_ABI cpuinfo_get_packages(void);
+const struct cpuinfo_die* CPUINFO_ABI cpuinfo_get_dies(void);
+const struct cpuinfo_node* CPUINFO_ABI cpuinfo_get_nodes(void);
 const struct cpuinfo_uarch_info* CPUINFO_ABI cpuinfo_get_uarchs(void);
 const struct cpuinfo_cache* CPUINFO_ABI cpuinfo_get_l1i_caches(void);
 const struct cpuinfo_cache* CPUINFO_ABI cpuinfo_get_l1d_caches(void);
@@ -1984,6 +3347,8 @@ const struct cpuinfo_processor* CPUINFO_ABI cpuinfo_get_processor(uint32_t index
 const struct cpuinfo_core* CPUINFO_ABI cpuinfo_get_core(uint32_t index);
 const struct cpuinfo_cluster* CPUINFO_ABI cpuinfo_get_cluster(uint32_t index);
 const struct cpuinfo_package* CPUINFO_ABI cpuinfo_get_package(uint32_t index);
+const struct cpuinfo_die* CPUINFO_ABI cpuinfo_get_die(uint32_t index);
+const struct cpuinfo_node* CPUINFO_ABI cpuinfo_get_node(uint32_t index);
 const struct cpuinfo_uarch_info* CPUINFO_ABI cpuinfo_get_uarch(uint32_t index);
 const struct cpuinfo_cache* CPUINFO_ABI cpuinfo_get_l1i_cache(uint32_t index);
 const struct cpuinfo_cache* CPUINFO_ABI cpuinfo_get_l1d_cache(uint32_t index);
@@ -1995,6 +3360,16 @@ uint32_t CPUINFO_ABI cpuinfo_get_processors_count(void);
 uint32_t CPUINFO_ABI cpuinfo_get_cores_count(void);
 uint32_t CPUINFO_ABI cpuinfo_get_clusters_count(void);
 uint32_t CPUINFO_ABI cpuinfo_get_packages_count(void);
+/**
+ * Returns the number of dies in all physical packages.
+ * If the platform does not report die topology, the function returns 0.
+ */
+uint32_t CPUINFO_ABI cpuinfo_get_dies_count(void);
+/**
+ * Returns the number of NUMA nodes with at least one logical processor.
+ * If the platform does not report NUMA topology, the function returns 0.
+ */
+uint32_t CPUINFO_ABI cpuinfo_get_nodes_count(void);
 uint32_t CPUINFO_ABI cpuinfo_get_uarchs_count(void);
 uint32_t CPUINFO_ABI cpuinfo_get_l1i_caches_count(void);
 uint32_t CPUINFO_ABI cpuinfo_get_l1d_caches_count(void);
@@ -2007,6 +3382,145 @@ uint32_t CPUINFO_ABI cpuinfo_get_l4_caches_count(void);
  */
 uint32_t CPUINFO_ABI cpuinfo_get_max_cache_size(void);
 
+/**
+ * Read-only view of the tables returned by the cpuinfo_get_<type>s() and cpuinfo_get_<type>s_count() functions.
+ * Unlike these functions, indexing the arrays of the view costs neither a call nor a check of the initialization.
+ */
+struct cpuinfo_topology {
+	const struct cpuinfo_processor* processors;
+	const struct cpuinfo_core* cores;
+	const struct cpuinfo_cluster* clusters;
+	const struct cpuinfo_package* packages;
+	const struct cpuinfo_die* dies;
+	const struct cpuinfo_node* nodes;
+	const struct cpuinfo_uarch_info* uarchs;
+	const struct cpuinfo_cache* l1i_caches;
+	const struct cpuinfo_cache* l1d_caches;
+	const struct cpuinfo_cache* l2_caches;
+	const struct cpuinfo_cache* l3_caches;
+	const struct cpuinfo_cache* l4_caches;
+
+	uint32_t processors_count;
+	uint32_t cores_count;
+	uint32_t clusters_count;
+	uint32_t packages_count;
+	uint32_t dies_count;
+	uint32_t nodes_count;
+	uint32_t uarchs_count;
+	uint32_t l1i_caches_count;
+	uint32_t l1d_caches_count;
+	uint32_t l2_caches_count;
+	uint32_t l3_caches_count;
+	uint32_t l4_caches_count;
+	uint32_t max_cache_size;
+};
+
+/**
+ * Returns the view of the detected topology. The view stays valid and unchanged until cpuinfo_deinitialize is called,
+ * so callers on hot paths should get it once and keep the pointer.
+ */
+const struct cpuinfo_topology* CPUINFO_ABI cpuinfo_get_topology(void);
+
+/**
+ * Returns the number of logical processors the process may run on.
+ *
+ * On Linux, usable logical processors are those both in the affinity mask of the thread that initialized cpuinfo and
+ * in the effective cpuset of its cgroup (cgroup v1 or v2), as of cpuinfo initialization. On other operating systems,
+ * all logical processors are usable, and the function returns the same value as cpuinfo_get_processors_count().
+ *
+ * Thread pools should size themselves by this count rather than by cpuinfo_get_processors_count().
+ */
+uint32_t CPUINFO_ABI cpuinfo_get_usable_processors_count(void);
+/**
+ * Returns the number of cores with at least one usable logical processor.
+ */
+uint32_t CPUINFO_ABI cpuinfo_get_usable_cores_count(void);
+/**
+ * Returns the number of clusters with at least one usable logical processor.
+ */
+uint32_t CPUINFO_ABI cpuinfo_get_usable_clusters_count(void);
+/**
+ * Returns the number of physical packages with at least one usable logical processor.
+ */
+uint32_t CPUINFO_ABI cpuinfo_get_usable_packages_count(void);
+
+/**
+ * Usable logical processors, cores, clusters, and packages, in the same order as in cpuinfo_get_processors(),
+ * cpuinfo_get_cores(), cpuinfo_get_clusters(), and cpuinfo_get_packages().
+ * The index is in [0, cpuinfo_get_usable_<type>s_count()); out-of-range indices return NULL.
+ */
+const struct cpuinfo_processor* CPUINFO_ABI cpuinfo_get_usable_processor(uint32_t index);
+const struct cpuinfo_core* CPUINFO_ABI cpuinfo_get_usable_core(uint32_t index);
+const struct cpuinfo_cluster* CPUINFO_ABI cpuinfo_get_usable_cluster(uint32_t index);
+const struct cpuinfo_package* CPUINFO_ABI cpuinfo_get_usable_package(uint32_t index);
+
+enum cpuinfo_thread_policy {
+	/** One thread per usable logical processor. */
+	cpuinfo_thread_policy_all_logical = 0,
+	/** One thread per usable core, leaving SMT siblings idle. */
+	cpuinfo_thread_policy_physical_cores = 1,
+	/**
+	 * One thread per usable high-performance core, leaving SMT siblings idle.
+	 * On systems without energy-efficient cores, all cores are considered high-performance.
+	 */
+	cpuinfo_thread_policy_big_cores = 2,
+};
+
+/**
+ * Returns the recommended number of threads for a pool of CPU-bound workers.
+ *
+ * The count is limited by the usable logical processors (see cpuinfo_get_usable_processors_count()) and, on Linux,
+ * by the CPU bandwidth quota of the cgroup (cgroup v2 cpu.max, or cgroup v1 cpu.cfs_quota_us and cpu.cfs_period_us).
+ * The quota is rounded down, so that the workers do not get throttled. Unlike the usable logical processors, the quota
+ * is read on every call.
+ */
+uint32_t CPUINFO_ABI cpuinfo_get_recommended_thread_count(enum cpuinfo_thread_policy policy);
+
+enum cpuinfo_placement_policy {
+	/** Fill usable logical processors in order, so that SMT siblings and cores sharing caches are adjacent. */
+	cpuinfo_placement_policy_compact = 0,
+	/** Distribute workers round-robin across physical packages, using SMT siblings only after all cores. */
+	cpuinfo_placement_policy_scatter = 1,
+	/** One worker per core, using SMT siblings only after all cores. */
+	cpuinfo_placement_policy_per_core = 2,
+	/** One worker per L2 cache, using other logical processors sharing the L2 cache only after all L2 caches. */
+	cpuinfo_placement_policy_per_l2 = 3,
+	/** One worker per last-level cache, using other logical processors sharing the cache only after all caches. */
+	cpuinfo_placement_policy_per_llc = 4,
+	/** One worker per core, starting with high-performance cores, using SMT siblings only after all cores. */
+	cpuinfo_placement_policy_big_cores_first = 5,
+};
+
+/**
+ * Plans placement of a pool of workers on usable logical processors (see cpuinfo_get_usable_processor()).
+ *
+ * Writes the logical processor for each of workers_count workers to processors. If there are more workers than usable
+ * logical processors, placement wraps around. Returns false if the policy is not supported or memory allocation fails.
+ */
+bool CPUINFO_ABI cpuinfo_plan_placement(
+	enum cpuinfo_placement_policy policy,
+	uint32_t workers_count,
+	const struct cpuinfo_processor* processors[]);
+
+#if defined(__linux__)
+/**
+ * Plans placement of a pool of workers as cpuinfo_plan_placement(), and writes an affinity mask for each worker to
+ * cpusets. The mask covers the usable logical processors of the domain the worker is placed on: the logical processor
+ * itself for the compact policy, the package for the scatter policy, the core for the per-core and big-cores-first
+ * policies, and the cache for per-L2 and per-LLC policies. The processors argument may be NULL.
+ *
+ * As for sched_setaffinity(), cpusets points to workers_count cpu_set_t masks of cpuset_size bytes each, e.g. an array
+ * of cpu_set_t with cpuset_size = sizeof(cpu_set_t), or masks from CPU_ALLOC() with cpuset_size = CPU_ALLOC_SIZE().
+ * Logical processors which do not fit into cpuset_size bytes are left out of the masks.
+ */
+bool CPUINFO_ABI cpuinfo_plan_placement_cpusets(
+	enum cpuinfo_placement_policy policy,
+	uint32_t workers_count,
+	const struct cpuinfo_processor* processors[],
+	size_t cpuset_size,
+	void* cpusets);
+#endif
+
 /**
  * Identify the logical processor that executes the current thread.
  *
@@ -2041,6 +3555,396 @@ uint32_t CPUINFO_ABI cpuinfo_get_current_uarch_index(void);
  */
 uint32_t CPUINFO_ABI cpuinfo_get_current_uarch_index_with_default(uint32_t default_uarch_index);
 
+struct cpuinfo_current_location {
+	/** Logical processor that executes the current thread */
+	const struct cpuinfo_processor* processor;
+	/** Core that executes the current thread */
+	const struct cpuinfo_core* core;
+	/** Cluster of cores that executes the current thread */
+	const struct cpuinfo_cluster* cluster;
+	/** Index of the microarchitecture of the core in cpuinfo_get_uarchs() */
+	uint32_t uarch_index;
+};
+
+/**
+ * Identify the logical processor, core, cluster, and microarchitecture index of the current thread with a single
+ * lookup of the current logical processor.
+ * If the system does not support such identification, the function returns false, sets the pointers to NULL, and sets
+ * the microarchitecture index to 0.
+ *
+ * There is no guarantee that the thread will stay on the same logical processor for any time.
+ * Callers should treat the result as only a hint.
+ */
+bool CPUINFO_ABI cpuinfo_get_current_location(struct cpuinfo_current_location location[1]);
+
+/**
+ * Returns the current time in nanoseconds of a monotonic clock, the same clock as deadlines of
+ * cpuinfo_spin_wait_until use. On POSIX systems this is CLOCK_MONOTONIC.
+ */
+uint64_t CPUINFO_ABI cpuinfo_get_monotonic_time_ns(void);
+
+/**
+ * Waits until the 32-bit word at the specified address equals the specified value, or until the deadline.
+ *
+ * The wait uses the lowest-power mechanism available to user code:
+ * - UMONITOR and UMWAIT on x86 processors with WAITPKG, after cpuinfo_initialize.
+ * - Exclusive monitor and WFE on ARM64. The wait relies on the timer event stream to re-check the deadline, which
+ *   Linux enables by default with 100 us period.
+ * - PAUSE or YIELD with exponential backoff on other x86 and ARM processors.
+ *
+ * @param address - address of the word to wait on. Writers must store the value with release semantics.
+ * @param value - the value to wait for.
+ * @param deadline - time in nanoseconds of cpuinfo_get_monotonic_time_ns clock to stop waiting at, or UINT64_MAX to
+ *                   wait indefinitely.
+ *
+ * @returns true if the word equals the value, or false if the deadline passed first.
+ */
+bool CPUINFO_ABI cpuinfo_spin_wait_until(const volatile uint32_t* address, uint32_t value, uint64_t deadline);
+
+/** Maximum number of ISA predicates of a dispatch variant */
+#define CPUINFO_DISPATCH_MAX_PREDICATES 8
+/** Maximum number of microarchitectures for which a dispatch table keeps separate variants */
+#define CPUINFO_DISPATCH_MAX_UARCHS 8
+
+/** Generic type of kernel functions in dispatch tables; callers cast them back to the actual function type */
+typedef void (*cpuinfo_dispatch_function)(void);
+
+/** Predicate of an ISA extension, such as cpuinfo_has_x86_avx2 */
+typedef bool (*cpuinfo_isa_predicate)(void);
+
+/** Implementation of a kernel with the ISA extensions it requires */
+struct cpuinfo_dispatch_variant {
+	/** Implementation of the kernel */
+	cpuinfo_dispatch_function function;
+	/** Predicates which must all hold for the variant to be used, followed by NULL entries */
+	cpuinfo_isa_predicate predicates[CPUINFO_DISPATCH_MAX_PREDICATES];
+	/** Microarchitecture which the variant is tuned for, or cpuinfo_uarch_unknown if it is generic */
+	enum cpuinfo_uarch uarch;
+};
+
+/**
+ * Table of kernel variants, resolved once to the best supported variant. Tables are intended to be static variables
+ * with only variants and variants_count initialized, and other fields zero-initialized.
+ */
+struct cpuinfo_dispatch_table {
+	/** Variants in order of preference, usually from the most to the least advanced ISA */
+	const struct cpuinfo_dispatch_variant* variants;
+	/** Number of elements in variants */
+	uint32_t variants_count;
+	/** Resolution state, which is private to cpuinfo_dispatch_* functions */
+	uint32_t state;
+	cpuinfo_dispatch_function function;
+	uint32_t uarchs_count;
+	cpuinfo_dispatch_function uarch_functions[CPUINFO_DISPATCH_MAX_UARCHS];
+};
+
+/**
+ * Returns the best variant in the dispatch table for all cores of the system, resolving the table on the first call.
+ * Must be called after cpuinfo_initialize.
+ *
+ * A variant is supported if all its predicates hold. Among supported variants the function prefers the first variant
+ * tuned for the microarchitecture of the majority of logical processors, then the first generic variant, then the
+ * first variant tuned for another microarchitecture.
+ *
+ * @returns the function of the best variant, or NULL if no variant is supported.
+ */
+cpuinfo_dispatch_function CPUINFO_ABI cpuinfo_dispatch_resolve(struct cpuinfo_dispatch_table* table);
+
+/**
+ * Returns the best variant in the dispatch table for the microarchitecture of the core which executes the calling
+ * thread, as identified by cpuinfo_get_current_uarch_index. Must be called after cpuinfo_initialize.
+ *
+ * The table is resolved for every microarchitecture on the first call, and further calls only look up the current
+ * microarchitecture. As the thread may migrate to another type of core, the result is only a performance hint; ISA
+ * extensions are detected for the whole system, so every supported variant runs correctly on all cores.
+ *
+ * @returns the function of the best variant, or NULL if no variant is supported.
+ */
+cpuinfo_dispatch_function CPUINFO_ABI cpuinfo_dispatch_resolve_current(struct cpuinfo_dispatch_table* table);
+
+/**
+ * Version of the layout of struct cpuinfo_isa_features. Identifiers of ISA features are never reassigned, and new
+ * features take unused identifiers in the range of their architecture, so feature sets persisted with the same
+ * version remain valid.
+ */
+#define CPUINFO_ISA_FEATURES_VERSION 1
+/** Upper bound on the identifiers of ISA features */
+#define CPUINFO_ISA_FEATURE_MAX 512
+/** Number of 64-bit words in struct cpuinfo_isa_features */
+#define CPUINFO_ISA_FEATURE_WORDS (CPUINFO_ISA_FEATURE_MAX / 64)
+
+/**
+ * Stable identifiers of ISA features, one for every cpuinfo_has_* function. x86 features take identifiers 0-127, ARM
+ * features 128-255, and LoongArch features 256-319.
+ */
+enum cpuinfo_isa_feature {
+	cpuinfo_isa_feature_x86_rdtsc = 0,
+	cpuinfo_isa_feature_x86_rdtscp = 1,
+	cpuinfo_isa_feature_x86_rdpid = 2,
+	cpuinfo_isa_feature_x86_clzero = 3,
+	cpuinfo_isa_feature_x86_mwait = 4,
+	cpuinfo_isa_feature_x86_mwaitx = 5,
+	cpuinfo_isa_feature_x86_waitpkg = 6,
+	cpuinfo_isa_feature_x86_fxsave = 7,
+	cpuinfo_isa_feature_x86_xsave = 8,
+	cpuinfo_isa_feature_x86_fpu = 9,
+	cpuinfo_isa_feature_x86_mmx = 10,
+	cpuinfo_isa_feature_x86_mmx_plus = 11,
+	cpuinfo_isa_feature_x86_3dnow = 12,
+	cpuinfo_isa_feature_x86_3dnow_plus = 13,
+	cpuinfo_isa_feature_x86_3dnow_geode = 14,
+	cpuinfo_isa_feature_x86_prefetch = 15,
+	cpuinfo_isa_feature_x86_prefetchw = 16,
+	cpuinfo_isa_feature_x86_prefetchwt1 = 17,
+	cpuinfo_isa_feature_x86_prefetchi = 18,
+	cpuinfo_isa_feature_x86_daz = 19,
+	cpuinfo_isa_feature_x86_sse = 20,
+	cpuinfo_isa_feature_x86_sse2 = 21,
+	cpuinfo_isa_feature_x86_sse3 = 22,
+	cpuinfo_isa_feature_x86_ssse3 = 23,
+	cpuinfo_isa_feature_x86_sse4_1 = 24,
+	cpuinfo_isa_feature_x86_sse4_2 = 25,
+	cpuinfo_isa_feature_x86_sse4a = 26,
+	cpuinfo_isa_feature_x86_misaligned_sse = 27,
+	cpuinfo_isa_feature_x86_avx = 28,
+	cpuinfo_isa_feature_x86_fma3 = 29,
+	cpuinfo_isa_feature_x86_fma4 = 30,
+	cpuinfo_isa_feature_x86_xop = 31,
+	cpuinfo_isa_feature_x86_f16c = 32,
+	cpuinfo_isa_feature_x86_avx2 = 33,
+	cpuinfo_isa_feature_x86_avx512f = 34,
+	cpuinfo_isa_feature_x86_avx512pf = 35,
+	cpuinfo_isa_feature_x86_avx512er = 36,
+	cpuinfo_isa_feature_x86_avx512cd = 37,
+	cpuinfo_isa_feature_x86_avx512dq = 38,
+	cpuinfo_isa_feature_x86_avx512bw = 39,
+	cpuinfo_isa_feature_x86_avx512vl = 40,
+	cpuinfo_isa_feature_x86_avx512ifma = 41,
+	cpuinfo_isa_feature_x86_avx512vbmi = 42,
+	cpuinfo_isa_feature_x86_avx512vbmi2 = 43,
+	cpuinfo_isa_feature_x86_avx512bitalg = 44,
+	cpuinfo_isa_feature_x86_avx512vpopcntdq = 45,
+	cpuinfo_isa_feature_x86_avx512vnni = 46,
+	cpuinfo_isa_feature_x86_avx512bf16 = 47,
+	cpuinfo_isa_feature_x86_avx512vp2intersect = 48,
+	cpuinfo_isa_feature_x86_avx512_4vnniw = 49,
+	cpuinfo_isa_feature_x86_avx512_4fmaps = 50,
+	cpuinfo_isa_feature_x86_avx512fp16 = 51,
+	cpuinfo_isa_feature_x86_avxvnni = 52,
+	cpuinfo_isa_feature_x86_avxvnniint8 = 53,
+	cpuinfo_isa_feature_x86_avxifma = 54,
+	cpuinfo_isa_feature_x86_avxneconvert = 55,
+	cpuinfo_isa_feature_x86_amx_tile = 56,
+	cpuinfo_isa_feature_x86_amx_int8 = 57,
+	cpuinfo_isa_feature_x86_amx_bf16 = 58,
+	cpuinfo_isa_feature_x86_amx_fp16 = 59,
+	cpuinfo_isa_feature_x86_amx_complex = 60,
+	cpuinfo_isa_feature_x86_hle = 61,
+	cpuinfo_isa_feature_x86_rtm = 62,
+	cpuinfo_isa_feature_x86_xtest = 63,
+	cpuinfo_isa_feature_x86_mpx = 64,
+	cpuinfo_isa_feature_x86_cmov = 65,
+	cpuinfo_isa_feature_x86_cmpxchg8b = 66,
+	cpuinfo_isa_feature_x86_cmpxchg16b = 67,
+	cpuinfo_isa_feature_x86_clwb = 68,
+	cpuinfo_isa_feature_x86_movbe = 69,
+	cpuinfo_isa_feature_x86_erms = 70,
+	cpuinfo_isa_feature_x86_fsrm = 71,
+	cpuinfo_isa_feature_x86_fzlrm = 72,
+	cpuinfo_isa_feature_x86_fsrs = 73,
+	cpuinfo_isa_feature_x86_fsrc = 74,
+	cpuinfo_isa_feature_x86_movdiri = 75,
+	cpuinfo_isa_feature_x86_movdir64b = 76,
+	cpuinfo_isa_feature_x86_enqcmd = 77,
+	cpuinfo_isa_feature_x86_cldemote = 78,
+	cpuinfo_isa_feature_x86_serialize = 79,
+	cpuinfo_isa_feature_x86_lahf_sahf = 80,
+	cpuinfo_isa_feature_x86_apx = 81,
+	cpuinfo_isa_feature_x86_lzcnt = 82,
+	cpuinfo_isa_feature_x86_popcnt = 83,
+	cpuinfo_isa_feature_x86_tbm = 84,
+	cpuinfo_isa_feature_x86_bmi = 85,
+	cpuinfo_isa_feature_x86_bmi2 = 86,
+	cpuinfo_isa_feature_x86_adx = 87,
+	cpuinfo_isa_feature_x86_aes = 88,
+	cpuinfo_isa_feature_x86_vaes = 89,
+	cpuinfo_isa_feature_x86_pclmulqdq = 90,
+	cpuinfo_isa_feature_x86_vpclmulqdq = 91,
+	cpuinfo_isa_feature_x86_gfni = 92,
+	cpuinfo_isa_feature_x86_rdrand = 93,
+	cpuinfo_isa_feature_x86_rdseed = 94,
+	cpuinfo_isa_feature_x86_sha = 95,
+	cpuinfo_isa_feature_arm_thumb = 128,
+	cpuinfo_isa_feature_arm_thumb2 = 129,
+	cpuinfo_isa_feature_arm_v5e = 130,
+	cpuinfo_isa_feature_arm_v6 = 131,
+	cpuinfo_isa_feature_arm_v6k = 132,
+	cpuinfo_isa_feature_arm_v7 = 133,
+	cpuinfo_isa_feature_arm_v7mp = 134,
+	cpuinfo_isa_feature_arm_v8 = 135,
+	cpuinfo_isa_feature_arm_idiv = 136,
+	cpuinfo_isa_feature_arm_vfpv2 = 137,
+	cpuinfo_isa_feature_arm_vfpv3 = 138,
+	cpuinfo_isa_feature_arm_vfpv3_d32 = 139,
+	cpuinfo_isa_feature_arm_vfpv3_fp16 = 140,
+	cpuinfo_isa_feature_arm_vfpv3_fp16_d32 = 141,
+	cpuinfo_isa_feature_arm_vfpv4 = 142,
+	cpuinfo_isa_feature_arm_vfpv4_d32 = 143,
+	cpuinfo_isa_feature_arm_wmmx = 144,
+	cpuinfo_isa_feature_arm_wmmx2 = 145,
+	cpuinfo_isa_feature_arm_neon = 146,
+	cpuinfo_isa_feature_arm_neon_fp16 = 147,
+	cpuinfo_isa_feature_arm_neon_fma = 148,
+	cpuinfo_isa_feature_arm_neon_v8 = 149,
+	cpuinfo_isa_feature_arm_atomics = 150,
+	cpuinfo_isa_feature_arm_neon_rdm = 151,
+	cpuinfo_isa_feature_arm_neon_fp16_arith = 152,
+	cpuinfo_isa_feature_arm_fp16_arith = 153,
+	cpuinfo_isa_feature_arm_neon_dot = 154,
+	cpuinfo_isa_feature_arm_jscvt = 155,
+	cpuinfo_isa_feature_arm_fcma = 156,
+	cpuinfo_isa_feature_arm_aes = 157,
+	cpuinfo_isa_feature_arm_sha1 = 158,
+	cpuinfo_isa_feature_arm_sha2 = 159,
+	cpuinfo_isa_feature_arm_pmull = 160,
+	cpuinfo_isa_feature_arm_crc32 = 161,
+	cpuinfo_isa_feature_arm_sve = 162,
+	cpuinfo_isa_feature_arm_sve2 = 163,
+	cpuinfo_isa_feature_arm_bf16 = 164,
+	cpuinfo_isa_feature_arm_svebf16 = 165,
+	cpuinfo_isa_feature_arm_lse128 = 166,
+	cpuinfo_isa_feature_arm_ebf16 = 167,
+	cpuinfo_isa_feature_arm_fhm = 168,
+	cpuinfo_isa_feature_arm_i8mm = 169,
+	cpuinfo_isa_feature_arm_svei8mm = 170,
+	cpuinfo_isa_feature_arm_svef32mm = 171,
+	cpuinfo_isa_feature_arm_svef64mm = 172,
+	cpuinfo_isa_feature_arm_sveaes = 173,
+	cpuinfo_isa_feature_arm_svepmull = 174,
+	cpuinfo_isa_feature_arm_svesha3 = 175,
+	cpuinfo_isa_feature_arm_svesm4 = 176,
+	cpuinfo_isa_feature_arm_svebitperm = 177,
+	cpuinfo_isa_feature_arm_sve2p1 = 178,
+	cpuinfo_isa_feature_arm_sme = 179,
+	cpuinfo_isa_feature_arm_sme2 = 180,
+	cpuinfo_isa_feature_arm_sme2p1 = 181,
+	cpuinfo_isa_feature_arm_smei16i64 = 182,
+	cpuinfo_isa_feature_arm_smef64f64 = 183,
+	cpuinfo_isa_feature_arm_smefa64 = 184,
+	cpuinfo_isa_feature_arm_sha3 = 185,
+	cpuinfo_isa_feature_arm_sha512 = 186,
+	cpuinfo_isa_feature_arm_sm3 = 187,
+	cpuinfo_isa_feature_arm_sm4 = 188,
+	cpuinfo_isa_feature_arm_rng = 189,
+	cpuinfo_isa_feature_arm_rcpc = 190,
+	cpuinfo_isa_feature_arm_rcpc2 = 191,
+	cpuinfo_isa_feature_arm_rcpc3 = 192,
+	cpuinfo_isa_feature_arm_flagm = 193,
+	cpuinfo_isa_feature_arm_flagm2 = 194,
+	cpuinfo_isa_feature_arm_mops = 195,
+	cpuinfo_isa_feature_arm_cssc = 196,
+	cpuinfo_isa_feature_loongarch_cpucfg = 256,
+	cpuinfo_isa_feature_loongarch_lam = 257,
+	cpuinfo_isa_feature_loongarch_ual = 258,
+	cpuinfo_isa_feature_loongarch_fpu = 259,
+	cpuinfo_isa_feature_loongarch_lsx = 260,
+	cpuinfo_isa_feature_loongarch_lasx = 261,
+	cpuinfo_isa_feature_loongarch_crc32 = 262,
+	cpuinfo_isa_feature_loongarch_complex = 263,
+	cpuinfo_isa_feature_loongarch_crypto = 264,
+	cpuinfo_isa_feature_loongarch_lvz = 265,
+	cpuinfo_isa_feature_loongarch_lbt_x86 = 266,
+	cpuinfo_isa_feature_loongarch_lbt_arm = 267,
+	cpuinfo_isa_feature_loongarch_lbt_mips = 268,
+};
+
+/** Set of ISA features, with bit (id % 64) of words[id / 64] set for every feature in the set */
+struct cpuinfo_isa_features {
+	uint64_t words[CPUINFO_ISA_FEATURE_WORDS];
+};
+
+/* This variable is not a part of stable API. Use cpuinfo_isa_has_* and cpuinfo_get_isa_features functions instead. */
+extern struct cpuinfo_isa_features cpuinfo_detected_isa_features;
+
+/** Adds a feature to the set */
+static inline void cpuinfo_isa_features_add(struct cpuinfo_isa_features* features, enum cpuinfo_isa_feature feature) {
+	features->words[(uint32_t) feature / 64] |= UINT64_C(1) << ((uint32_t) feature % 64);
+}
+
+/** Checks whether the set contains a feature */
+static inline bool cpuinfo_isa_features_contain(
+	const struct cpuinfo_isa_features* features,
+	enum cpuinfo_isa_feature feature)
+{
+	return (features->words[(uint32_t) feature / 64] >> ((uint32_t) feature % 64)) & 1;
+}
+
+/**
+ * Checks whether the processor supports all features in the mask. Must be called after cpuinfo_initialize or
+ * cpuinfo_probe_isa; the result matches the cpuinfo_has_* functions for the features in the mask.
+ */
+static inline bool cpuinfo_isa_has_all(const struct cpuinfo_isa_features* mask) {
+	uint64_t missing = 0;
+	for (uint32_t i = 0; i < CPUINFO_ISA_FEATURE_WORDS; i++) {
+		missing |= mask->words[i] & ~cpuinfo_detected_isa_features.words[i];
+	}
+	return missing == 0;
+}
+
+/**
+ * Checks whether the processor supports any of the features in the mask. Must be called after cpuinfo_initialize or
+ * cpuinfo_probe_isa.
+ */
+static inline bool cpuinfo_isa_has_any(const struct cpuinfo_isa_features* mask) {
+	uint64_t supported = 0;
+	for (uint32_t i = 0; i < CPUINFO_ISA_FEATURE_WORDS; i++) {
+		supported |= mask->words[i] & cpuinfo_detected_isa_features.words[i];
+	}
+	return supported != 0;
+}
+
+/**
+ * Copies the set of ISA features supported by the processor. Must be called after cpuinfo_initialize or
+ * cpuinfo_probe_isa.
+ */
+void CPUINFO_ABI cpuinfo_get_isa_features(struct cpuinfo_isa_features* features);
+
+/**
+ * Returns the name of an ISA feature, which is the suffix of the corresponding cpuinfo_has_* function, e.g. "avx2"
+ * for cpuinfo_isa_feature_x86_avx2.
+ *
+ * @returns the name of the feature, or NULL if the identifier is not assigned to a feature.
+ */
+const char* CPUINFO_ABI cpuinfo_isa_feature_name(enum cpuinfo_isa_feature feature);
+
+/**
+ * Parses a list of feature names separated by commas, e.g. "avx2,fma3,bmi2", and adds the features to the set. Names
+ * are looked up among features of the architecture cpuinfo is built for, and then among features of other
+ * architectures. Whitespace around names is ignored, and an empty list adds no features.
+ *
+ * @param list - NUL-terminated list of feature names.
+ * @param features - set to add the parsed features to.
+ *
+ * @returns true if all names in the list are known, and false otherwise. On failure, features of known names that
+ *          precede the unknown name are added to the set.
+ */
+bool CPUINFO_ABI cpuinfo_isa_parse_features(const char* list, struct cpuinfo_isa_features* features);
+
+/**
+ * Formats a set of features as a list of feature names separated by commas, in the order of their identifiers.
+ * The output is truncated to fit into the buffer, and is NUL-terminated if the buffer size is not 0.
+ *
+ * @param features - set of features to format.
+ * @param buffer - buffer for the formatted list.
+ * @param buffer_size - size of the buffer in bytes.
+ *
+ * @returns the length of the complete list without the terminating NUL, like snprintf.
+ */
+size_t CPUINFO_ABI cpuinfo_isa_format_features(
+	const struct cpuinfo_isa_features* features,
+	char* buffer,
+	size_t buffer_size);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
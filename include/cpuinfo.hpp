@@ -0,0 +1,627 @@
+#pragma once
+#ifndef CPUINFO_HPP
+#define CPUINFO_HPP
+
+#include <type_traits>
+
+#include <cpuinfo.h>
+
+
+namespace cpuinfo {
+
+/* Identifiers of x86 ISA features, available on all architectures */
+namespace x86 {
+	constexpr cpuinfo_isa_feature rdtsc = cpuinfo_isa_feature_x86_rdtsc;
+	constexpr cpuinfo_isa_feature rdtscp = cpuinfo_isa_feature_x86_rdtscp;
+	constexpr cpuinfo_isa_feature rdpid = cpuinfo_isa_feature_x86_rdpid;
+	constexpr cpuinfo_isa_feature clzero = cpuinfo_isa_feature_x86_clzero;
+	constexpr cpuinfo_isa_feature mwait = cpuinfo_isa_feature_x86_mwait;
+	constexpr cpuinfo_isa_feature mwaitx = cpuinfo_isa_feature_x86_mwaitx;
+	constexpr cpuinfo_isa_feature waitpkg = cpuinfo_isa_feature_x86_waitpkg;
+	constexpr cpuinfo_isa_feature fxsave = cpuinfo_isa_feature_x86_fxsave;
+	constexpr cpuinfo_isa_feature xsave = cpuinfo_isa_feature_x86_xsave;
+	constexpr cpuinfo_isa_feature fpu = cpuinfo_isa_feature_x86_fpu;
+	constexpr cpuinfo_isa_feature mmx = cpuinfo_isa_feature_x86_mmx;
+	constexpr cpuinfo_isa_feature mmx_plus = cpuinfo_isa_feature_x86_mmx_plus;
+	constexpr cpuinfo_isa_feature three_d_now = cpuinfo_isa_feature_x86_3dnow;
+	constexpr cpuinfo_isa_feature three_d_now_plus = cpuinfo_isa_feature_x86_3dnow_plus;
+	constexpr cpuinfo_isa_feature three_d_now_geode = cpuinfo_isa_feature_x86_3dnow_geode;
+	constexpr cpuinfo_isa_feature prefetch = cpuinfo_isa_feature_x86_prefetch;
+	constexpr cpuinfo_isa_feature prefetchw = cpuinfo_isa_feature_x86_prefetchw;
+	constexpr cpuinfo_isa_feature prefetchwt1 = cpuinfo_isa_feature_x86_prefetchwt1;
+	constexpr cpuinfo_isa_feature prefetchi = cpuinfo_isa_feature_x86_prefetchi;
+	constexpr cpuinfo_isa_feature daz = cpuinfo_isa_feature_x86_daz;
+	constexpr cpuinfo_isa_feature sse = cpuinfo_isa_feature_x86_sse;
+	constexpr cpuinfo_isa_feature sse2 = cpuinfo_isa_feature_x86_sse2;
+	constexpr cpuinfo_isa_feature sse3 = cpuinfo_isa_feature_x86_sse3;
+	constexpr cpuinfo_isa_feature ssse3 = cpuinfo_isa_feature_x86_ssse3;
+	constexpr cpuinfo_isa_feature sse4_1 = cpuinfo_isa_feature_x86_sse4_1;
+	constexpr cpuinfo_isa_feature sse4_2 = cpuinfo_isa_feature_x86_sse4_2;
+	constexpr cpuinfo_isa_feature sse4a = cpuinfo_isa_feature_x86_sse4a;
+	constexpr cpuinfo_isa_feature misaligned_sse = cpuinfo_isa_feature_x86_misaligned_sse;
+	constexpr cpuinfo_isa_feature avx = cpuinfo_isa_feature_x86_avx;
+	constexpr cpuinfo_isa_feature fma3 = cpuinfo_isa_feature_x86_fma3;
+	constexpr cpuinfo_isa_feature fma4 = cpuinfo_isa_feature_x86_fma4;
+	constexpr cpuinfo_isa_feature xop = cpuinfo_isa_feature_x86_xop;
+	constexpr cpuinfo_isa_feature f16c = cpuinfo_isa_feature_x86_f16c;
+	constexpr cpuinfo_isa_feature avx2 = cpuinfo_isa_feature_x86_avx2;
+	constexpr cpuinfo_isa_feature avx512f = cpuinfo_isa_feature_x86_avx512f;
+	constexpr cpuinfo_isa_feature avx512pf = cpuinfo_isa_feature_x86_avx512pf;
+	constexpr cpuinfo_isa_feature avx512er = cpuinfo_isa_feature_x86_avx512er;
+	constexpr cpuinfo_isa_feature avx512cd = cpuinfo_isa_feature_x86_avx512cd;
+	constexpr cpuinfo_isa_feature avx512dq = cpuinfo_isa_feature_x86_avx512dq;
+	constexpr cpuinfo_isa_feature avx512bw = cpuinfo_isa_feature_x86_avx512bw;
+	constexpr cpuinfo_isa_feature avx512vl = cpuinfo_isa_feature_x86_avx512vl;
+	constexpr cpuinfo_isa_feature avx512ifma = cpuinfo_isa_feature_x86_avx512ifma;
+	constexpr cpuinfo_isa_feature avx512vbmi = cpuinfo_isa_feature_x86_avx512vbmi;
+	constexpr cpuinfo_isa_feature avx512vbmi2 = cpuinfo_isa_feature_x86_avx512vbmi2;
+	constexpr cpuinfo_isa_feature avx512bitalg = cpuinfo_isa_feature_x86_avx512bitalg;
+	constexpr cpuinfo_isa_feature avx512vpopcntdq = cpuinfo_isa_feature_x86_avx512vpopcntdq;
+	constexpr cpuinfo_isa_feature avx512vnni = cpuinfo_isa_feature_x86_avx512vnni;
+	constexpr cpuinfo_isa_feature avx512bf16 = cpuinfo_isa_feature_x86_avx512bf16;
+	constexpr cpuinfo_isa_feature avx512vp2intersect = cpuinfo_isa_feature_x86_avx512vp2intersect;
+	constexpr cpuinfo_isa_feature avx512_4vnniw = cpuinfo_isa_feature_x86_avx512_4vnniw;
+	constexpr cpuinfo_isa_feature avx512_4fmaps = cpuinfo_isa_feature_x86_avx512_4fmaps;
+	constexpr cpuinfo_isa_feature avx512fp16 = cpuinfo_isa_feature_x86_avx512fp16;
+	constexpr cpuinfo_isa_feature avxvnni = cpuinfo_isa_feature_x86_avxvnni;
+	constexpr cpuinfo_isa_feature avxvnniint8 = cpuinfo_isa_feature_x86_avxvnniint8;
+	constexpr cpuinfo_isa_feature avxifma = cpuinfo_isa_feature_x86_avxifma;
+	constexpr cpuinfo_isa_feature avxneconvert = cpuinfo_isa_feature_x86_avxneconvert;
+	constexpr cpuinfo_isa_feature amx_tile = cpuinfo_isa_feature_x86_amx_tile;
+	constexpr cpuinfo_isa_feature amx_int8 = cpuinfo_isa_feature_x86_amx_int8;
+	constexpr cpuinfo_isa_feature amx_bf16 = cpuinfo_isa_feature_x86_amx_bf16;
+	constexpr cpuinfo_isa_feature amx_fp16 = cpuinfo_isa_feature_x86_amx_fp16;
+	constexpr cpuinfo_isa_feature amx_complex = cpuinfo_isa_feature_x86_amx_complex;
+	constexpr cpuinfo_isa_feature hle = cpuinfo_isa_feature_x86_hle;
+	constexpr cpuinfo_isa_feature rtm = cpuinfo_isa_feature_x86_rtm;
+	constexpr cpuinfo_isa_feature xtest = cpuinfo_isa_feature_x86_xtest;
+	constexpr cpuinfo_isa_feature mpx = cpuinfo_isa_feature_x86_mpx;
+	constexpr cpuinfo_isa_feature cmov = cpuinfo_isa_feature_x86_cmov;
+	constexpr cpuinfo_isa_feature cmpxchg8b = cpuinfo_isa_feature_x86_cmpxchg8b;
+	constexpr cpuinfo_isa_feature cmpxchg16b = cpuinfo_isa_feature_x86_cmpxchg16b;
+	constexpr cpuinfo_isa_feature clwb = cpuinfo_isa_feature_x86_clwb;
+	constexpr cpuinfo_isa_feature movbe = cpuinfo_isa_feature_x86_movbe;
+	constexpr cpuinfo_isa_feature erms = cpuinfo_isa_feature_x86_erms;
+	constexpr cpuinfo_isa_feature fsrm = cpuinfo_isa_feature_x86_fsrm;
+	constexpr cpuinfo_isa_feature fzlrm = cpuinfo_isa_feature_x86_fzlrm;
+	constexpr cpuinfo_isa_feature fsrs = cpuinfo_isa_feature_x86_fsrs;
+	constexpr cpuinfo_isa_feature fsrc = cpuinfo_isa_feature_x86_fsrc;
+	constexpr cpuinfo_isa_feature movdiri = cpuinfo_isa_feature_x86_movdiri;
+	constexpr cpuinfo_isa_feature movdir64b = cpuinfo_isa_feature_x86_movdir64b;
+	constexpr cpuinfo_isa_feature enqcmd = cpuinfo_isa_feature_x86_enqcmd;
+	constexpr cpuinfo_isa_feature cldemote = cpuinfo_isa_feature_x86_cldemote;
+	constexpr cpuinfo_isa_feature serialize = cpuinfo_isa_feature_x86_serialize;
+	constexpr cpuinfo_isa_feature lahf_sahf = cpuinfo_isa_feature_x86_lahf_sahf;
+	constexpr cpuinfo_isa_feature apx = cpuinfo_isa_feature_x86_apx;
+	constexpr cpuinfo_isa_feature lzcnt = cpuinfo_isa_feature_x86_lzcnt;
+	constexpr cpuinfo_isa_feature popcnt = cpuinfo_isa_feature_x86_popcnt;
+	constexpr cpuinfo_isa_feature tbm = cpuinfo_isa_feature_x86_tbm;
+	constexpr cpuinfo_isa_feature bmi = cpuinfo_isa_feature_x86_bmi;
+	constexpr cpuinfo_isa_feature bmi2 = cpuinfo_isa_feature_x86_bmi2;
+	constexpr cpuinfo_isa_feature adx = cpuinfo_isa_feature_x86_adx;
+	constexpr cpuinfo_isa_feature aes = cpuinfo_isa_feature_x86_aes;
+	constexpr cpuinfo_isa_feature vaes = cpuinfo_isa_feature_x86_vaes;
+	constexpr cpuinfo_isa_feature pclmulqdq = cpuinfo_isa_feature_x86_pclmulqdq;
+	constexpr cpuinfo_isa_feature vpclmulqdq = cpuinfo_isa_feature_x86_vpclmulqdq;
+	constexpr cpuinfo_isa_feature gfni = cpuinfo_isa_feature_x86_gfni;
+	constexpr cpuinfo_isa_feature rdrand = cpuinfo_isa_feature_x86_rdrand;
+	constexpr cpuinfo_isa_feature rdseed = cpuinfo_isa_feature_x86_rdseed;
+	constexpr cpuinfo_isa_feature sha = cpuinfo_isa_feature_x86_sha;
+}
+
+/* Identifiers of ARM ISA features, available on all architectures */
+namespace arm {
+	constexpr cpuinfo_isa_feature thumb = cpuinfo_isa_feature_arm_thumb;
+	constexpr cpuinfo_isa_feature thumb2 = cpuinfo_isa_feature_arm_thumb2;
+	constexpr cpuinfo_isa_feature v5e = cpuinfo_isa_feature_arm_v5e;
+	constexpr cpuinfo_isa_feature v6 = cpuinfo_isa_feature_arm_v6;
+	constexpr cpuinfo_isa_feature v6k = cpuinfo_isa_feature_arm_v6k;
+	constexpr cpuinfo_isa_feature v7 = cpuinfo_isa_feature_arm_v7;
+	constexpr cpuinfo_isa_feature v7mp = cpuinfo_isa_feature_arm_v7mp;
+	constexpr cpuinfo_isa_feature v8 = cpuinfo_isa_feature_arm_v8;
+	constexpr cpuinfo_isa_feature idiv = cpuinfo_isa_feature_arm_idiv;
+	constexpr cpuinfo_isa_feature vfpv2 = cpuinfo_isa_feature_arm_vfpv2;
+	constexpr cpuinfo_isa_feature vfpv3 = cpuinfo_isa_feature_arm_vfpv3;
+	constexpr cpuinfo_isa_feature vfpv3_d32 = cpuinfo_isa_feature_arm_vfpv3_d32;
+	constexpr cpuinfo_isa_feature vfpv3_fp16 = cpuinfo_isa_feature_arm_vfpv3_fp16;
+	constexpr cpuinfo_isa_feature vfpv3_fp16_d32 = cpuinfo_isa_feature_arm_vfpv3_fp16_d32;
+	constexpr cpuinfo_isa_feature vfpv4 = cpuinfo_isa_feature_arm_vfpv4;
+	constexpr cpuinfo_isa_feature vfpv4_d32 = cpuinfo_isa_feature_arm_vfpv4_d32;
+	constexpr cpuinfo_isa_feature wmmx = cpuinfo_isa_feature_arm_wmmx;
+	constexpr cpuinfo_isa_feature wmmx2 = cpuinfo_isa_feature_arm_wmmx2;
+	constexpr cpuinfo_isa_feature neon = cpuinfo_isa_feature_arm_neon;
+	constexpr cpuinfo_isa_feature neon_fp16 = cpuinfo_isa_feature_arm_neon_fp16;
+	constexpr cpuinfo_isa_feature neon_fma = cpuinfo_isa_feature_arm_neon_fma;
+	constexpr cpuinfo_isa_feature neon_v8 = cpuinfo_isa_feature_arm_neon_v8;
+	constexpr cpuinfo_isa_feature atomics = cpuinfo_isa_feature_arm_atomics;
+	constexpr cpuinfo_isa_feature neon_rdm = cpuinfo_isa_feature_arm_neon_rdm;
+	constexpr cpuinfo_isa_feature neon_fp16_arith = cpuinfo_isa_feature_arm_neon_fp16_arith;
+	constexpr cpuinfo_isa_feature fp16_arith = cpuinfo_isa_feature_arm_fp16_arith;
+	constexpr cpuinfo_isa_feature neon_dot = cpuinfo_isa_feature_arm_neon_dot;
+	constexpr cpuinfo_isa_feature jscvt = cpuinfo_isa_feature_arm_jscvt;
+	constexpr cpuinfo_isa_feature fcma = cpuinfo_isa_feature_arm_fcma;
+	constexpr cpuinfo_isa_feature aes = cpuinfo_isa_feature_arm_aes;
+	constexpr cpuinfo_isa_feature sha1 = cpuinfo_isa_feature_arm_sha1;
+	constexpr cpuinfo_isa_feature sha2 = cpuinfo_isa_feature_arm_sha2;
+	constexpr cpuinfo_isa_feature pmull = cpuinfo_isa_feature_arm_pmull;
+	constexpr cpuinfo_isa_feature crc32 = cpuinfo_isa_feature_arm_crc32;
+	constexpr cpuinfo_isa_feature sve = cpuinfo_isa_feature_arm_sve;
+	constexpr cpuinfo_isa_feature sve2 = cpuinfo_isa_feature_arm_sve2;
+	constexpr cpuinfo_isa_feature bf16 = cpuinfo_isa_feature_arm_bf16;
+	constexpr cpuinfo_isa_feature svebf16 = cpuinfo_isa_feature_arm_svebf16;
+	constexpr cpuinfo_isa_feature lse128 = cpuinfo_isa_feature_arm_lse128;
+	constexpr cpuinfo_isa_feature ebf16 = cpuinfo_isa_feature_arm_ebf16;
+	constexpr cpuinfo_isa_feature fhm = cpuinfo_isa_feature_arm_fhm;
+	constexpr cpuinfo_isa_feature i8mm = cpuinfo_isa_feature_arm_i8mm;
+	constexpr cpuinfo_isa_feature svei8mm = cpuinfo_isa_feature_arm_svei8mm;
+	constexpr cpuinfo_isa_feature svef32mm = cpuinfo_isa_feature_arm_svef32mm;
+	constexpr cpuinfo_isa_feature svef64mm = cpuinfo_isa_feature_arm_svef64mm;
+	constexpr cpuinfo_isa_feature sveaes = cpuinfo_isa_feature_arm_sveaes;
+	constexpr cpuinfo_isa_feature svepmull = cpuinfo_isa_feature_arm_svepmull;
+	constexpr cpuinfo_isa_feature svesha3 = cpuinfo_isa_feature_arm_svesha3;
+	constexpr cpuinfo_isa_feature svesm4 = cpuinfo_isa_feature_arm_svesm4;
+	constexpr cpuinfo_isa_feature svebitperm = cpuinfo_isa_feature_arm_svebitperm;
+	constexpr cpuinfo_isa_feature sve2p1 = cpuinfo_isa_feature_arm_sve2p1;
+	constexpr cpuinfo_isa_feature sme = cpuinfo_isa_feature_arm_sme;
+	constexpr cpuinfo_isa_feature sme2 = cpuinfo_isa_feature_arm_sme2;
+	constexpr cpuinfo_isa_feature sme2p1 = cpuinfo_isa_feature_arm_sme2p1;
+	constexpr cpuinfo_isa_feature smei16i64 = cpuinfo_isa_feature_arm_smei16i64;
+	constexpr cpuinfo_isa_feature smef64f64 = cpuinfo_isa_feature_arm_smef64f64;
+	constexpr cpuinfo_isa_feature smefa64 = cpuinfo_isa_feature_arm_smefa64;
+	constexpr cpuinfo_isa_feature sha3 = cpuinfo_isa_feature_arm_sha3;
+	constexpr cpuinfo_isa_feature sha512 = cpuinfo_isa_feature_arm_sha512;
+	constexpr cpuinfo_isa_feature sm3 = cpuinfo_isa_feature_arm_sm3;
+	constexpr cpuinfo_isa_feature sm4 = cpuinfo_isa_feature_arm_sm4;
+	constexpr cpuinfo_isa_feature rng = cpuinfo_isa_feature_arm_rng;
+	constexpr cpuinfo_isa_feature rcpc = cpuinfo_isa_feature_arm_rcpc;
+	constexpr cpuinfo_isa_feature rcpc2 = cpuinfo_isa_feature_arm_rcpc2;
+	constexpr cpuinfo_isa_feature rcpc3 = cpuinfo_isa_feature_arm_rcpc3;
+	constexpr cpuinfo_isa_feature flagm = cpuinfo_isa_feature_arm_flagm;
+	constexpr cpuinfo_isa_feature flagm2 = cpuinfo_isa_feature_arm_flagm2;
+	constexpr cpuinfo_isa_feature mops = cpuinfo_isa_feature_arm_mops;
+	constexpr cpuinfo_isa_feature cssc = cpuinfo_isa_feature_arm_cssc;
+}
+
+/* Identifiers of LoongArch ISA features, available on all architectures */
+namespace loongarch {
+	constexpr cpuinfo_isa_feature cpucfg = cpuinfo_isa_feature_loongarch_cpucfg;
+	constexpr cpuinfo_isa_feature lam = cpuinfo_isa_feature_loongarch_lam;
+	constexpr cpuinfo_isa_feature ual = cpuinfo_isa_feature_loongarch_ual;
+	constexpr cpuinfo_isa_feature fpu = cpuinfo_isa_feature_loongarch_fpu;
+	constexpr cpuinfo_isa_feature lsx = cpuinfo_isa_feature_loongarch_lsx;
+	constexpr cpuinfo_isa_feature lasx = cpuinfo_isa_feature_loongarch_lasx;
+	constexpr cpuinfo_isa_feature crc32 = cpuinfo_isa_feature_loongarch_crc32;
+	constexpr cpuinfo_isa_feature complex = cpuinfo_isa_feature_loongarch_complex;
+	constexpr cpuinfo_isa_feature crypto = cpuinfo_isa_feature_loongarch_crypto;
+	constexpr cpuinfo_isa_feature lvz = cpuinfo_isa_feature_loongarch_lvz;
+	constexpr cpuinfo_isa_feature lbt_x86 = cpuinfo_isa_feature_loongarch_lbt_x86;
+	constexpr cpuinfo_isa_feature lbt_arm = cpuinfo_isa_feature_loongarch_lbt_arm;
+	constexpr cpuinfo_isa_feature lbt_mips = cpuinfo_isa_feature_loongarch_lbt_mips;
+}
+
+/* Identifiers of ISA features of the architecture cpuinfo is built for, e.g. cpuinfo::feature::avx2 */
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	namespace feature = x86;
+#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	namespace feature = arm;
+#elif CPUINFO_ARCH_LOONGARCH64
+	namespace feature = loongarch;
+#endif
+
+/*
+ * The baseline depends on the compiler options of each translation unit, e.g. -mavx2, so the templates which use it
+ * have internal linkage: otherwise translation units built with different options would hold different definitions of
+ * the same entity, and the linker would keep only one of them.
+ */
+namespace {
+
+/*
+ * Whether the compiler may use the ISA feature unconditionally in this translation unit, as reported by the
+ * CPUINFO_BASELINE_* macros.
+ */
+template<cpuinfo_isa_feature Feature>
+struct baseline : std::false_type {};
+
+#ifdef CPUINFO_BASELINE_X86_RDPID
+	template<> struct baseline<cpuinfo_isa_feature_x86_rdpid> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_CLZERO
+	template<> struct baseline<cpuinfo_isa_feature_x86_clzero> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_MWAITX
+	template<> struct baseline<cpuinfo_isa_feature_x86_mwaitx> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_WAITPKG
+	template<> struct baseline<cpuinfo_isa_feature_x86_waitpkg> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_FXSAVE
+	template<> struct baseline<cpuinfo_isa_feature_x86_fxsave> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_XSAVE
+	template<> struct baseline<cpuinfo_isa_feature_x86_xsave> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_MMX
+	template<> struct baseline<cpuinfo_isa_feature_x86_mmx> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_3DNOW
+	template<> struct baseline<cpuinfo_isa_feature_x86_3dnow> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_3DNOW_PLUS
+	template<> struct baseline<cpuinfo_isa_feature_x86_3dnow_plus> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_PREFETCHW
+	template<> struct baseline<cpuinfo_isa_feature_x86_prefetchw> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_PREFETCHWT1
+	template<> struct baseline<cpuinfo_isa_feature_x86_prefetchwt1> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_PREFETCHI
+	template<> struct baseline<cpuinfo_isa_feature_x86_prefetchi> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_SSE
+	template<> struct baseline<cpuinfo_isa_feature_x86_sse> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_SSE2
+	template<> struct baseline<cpuinfo_isa_feature_x86_sse2> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_SSE3
+	template<> struct baseline<cpuinfo_isa_feature_x86_sse3> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_SSSE3
+	template<> struct baseline<cpuinfo_isa_feature_x86_ssse3> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_SSE4_1
+	template<> struct baseline<cpuinfo_isa_feature_x86_sse4_1> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_SSE4_2
+	template<> struct baseline<cpuinfo_isa_feature_x86_sse4_2> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_SSE4A
+	template<> struct baseline<cpuinfo_isa_feature_x86_sse4a> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_FMA3
+	template<> struct baseline<cpuinfo_isa_feature_x86_fma3> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_FMA4
+	template<> struct baseline<cpuinfo_isa_feature_x86_fma4> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_XOP
+	template<> struct baseline<cpuinfo_isa_feature_x86_xop> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_F16C
+	template<> struct baseline<cpuinfo_isa_feature_x86_f16c> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX2
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx2> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX512F
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx512f> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX512PF
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx512pf> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX512ER
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx512er> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX512CD
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx512cd> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX512DQ
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx512dq> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX512BW
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx512bw> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX512VL
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx512vl> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX512IFMA
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx512ifma> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX512VBMI
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx512vbmi> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX512VBMI2
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx512vbmi2> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX512BITALG
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx512bitalg> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX512VPOPCNTDQ
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx512vpopcntdq> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX512VNNI
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx512vnni> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX512BF16
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx512bf16> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX512VP2INTERSECT
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx512vp2intersect> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX512_4VNNIW
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx512_4vnniw> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX512_4FMAPS
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx512_4fmaps> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVX512FP16
+	template<> struct baseline<cpuinfo_isa_feature_x86_avx512fp16> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVXVNNI
+	template<> struct baseline<cpuinfo_isa_feature_x86_avxvnni> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVXVNNIINT8
+	template<> struct baseline<cpuinfo_isa_feature_x86_avxvnniint8> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVXIFMA
+	template<> struct baseline<cpuinfo_isa_feature_x86_avxifma> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AVXNECONVERT
+	template<> struct baseline<cpuinfo_isa_feature_x86_avxneconvert> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_HLE
+	template<> struct baseline<cpuinfo_isa_feature_x86_hle> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_RTM
+	template<> struct baseline<cpuinfo_isa_feature_x86_rtm> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_XTEST
+	template<> struct baseline<cpuinfo_isa_feature_x86_xtest> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_CMOV
+	template<> struct baseline<cpuinfo_isa_feature_x86_cmov> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_CMPXCHG8B
+	template<> struct baseline<cpuinfo_isa_feature_x86_cmpxchg8b> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_CMPXCHG16B
+	template<> struct baseline<cpuinfo_isa_feature_x86_cmpxchg16b> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_CLWB
+	template<> struct baseline<cpuinfo_isa_feature_x86_clwb> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_MOVBE
+	template<> struct baseline<cpuinfo_isa_feature_x86_movbe> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_MOVDIRI
+	template<> struct baseline<cpuinfo_isa_feature_x86_movdiri> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_MOVDIR64B
+	template<> struct baseline<cpuinfo_isa_feature_x86_movdir64b> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_ENQCMD
+	template<> struct baseline<cpuinfo_isa_feature_x86_enqcmd> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_CLDEMOTE
+	template<> struct baseline<cpuinfo_isa_feature_x86_cldemote> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_SERIALIZE
+	template<> struct baseline<cpuinfo_isa_feature_x86_serialize> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_LAHF_SAHF
+	template<> struct baseline<cpuinfo_isa_feature_x86_lahf_sahf> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_APX
+	template<> struct baseline<cpuinfo_isa_feature_x86_apx> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_LZCNT
+	template<> struct baseline<cpuinfo_isa_feature_x86_lzcnt> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_POPCNT
+	template<> struct baseline<cpuinfo_isa_feature_x86_popcnt> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_TBM
+	template<> struct baseline<cpuinfo_isa_feature_x86_tbm> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_BMI
+	template<> struct baseline<cpuinfo_isa_feature_x86_bmi> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_BMI2
+	template<> struct baseline<cpuinfo_isa_feature_x86_bmi2> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_ADX
+	template<> struct baseline<cpuinfo_isa_feature_x86_adx> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_AES
+	template<> struct baseline<cpuinfo_isa_feature_x86_aes> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_VAES
+	template<> struct baseline<cpuinfo_isa_feature_x86_vaes> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_PCLMULQDQ
+	template<> struct baseline<cpuinfo_isa_feature_x86_pclmulqdq> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_VPCLMULQDQ
+	template<> struct baseline<cpuinfo_isa_feature_x86_vpclmulqdq> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_GFNI
+	template<> struct baseline<cpuinfo_isa_feature_x86_gfni> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_RDRAND
+	template<> struct baseline<cpuinfo_isa_feature_x86_rdrand> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_RDSEED
+	template<> struct baseline<cpuinfo_isa_feature_x86_rdseed> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_X86_SHA
+	template<> struct baseline<cpuinfo_isa_feature_x86_sha> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_V8
+	template<> struct baseline<cpuinfo_isa_feature_arm_v8> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_IDIV
+	template<> struct baseline<cpuinfo_isa_feature_arm_idiv> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_NEON
+	template<> struct baseline<cpuinfo_isa_feature_arm_neon> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_NEON_FMA
+	template<> struct baseline<cpuinfo_isa_feature_arm_neon_fma> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_ATOMICS
+	template<> struct baseline<cpuinfo_isa_feature_arm_atomics> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_NEON_RDM
+	template<> struct baseline<cpuinfo_isa_feature_arm_neon_rdm> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_FP16_ARITH
+	template<> struct baseline<cpuinfo_isa_feature_arm_fp16_arith> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_NEON_FP16_ARITH
+	template<> struct baseline<cpuinfo_isa_feature_arm_neon_fp16_arith> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_NEON_DOT
+	template<> struct baseline<cpuinfo_isa_feature_arm_neon_dot> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_JSCVT
+	template<> struct baseline<cpuinfo_isa_feature_arm_jscvt> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_FCMA
+	template<> struct baseline<cpuinfo_isa_feature_arm_fcma> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_AES
+	template<> struct baseline<cpuinfo_isa_feature_arm_aes> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_PMULL
+	template<> struct baseline<cpuinfo_isa_feature_arm_pmull> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SHA1
+	template<> struct baseline<cpuinfo_isa_feature_arm_sha1> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SHA2
+	template<> struct baseline<cpuinfo_isa_feature_arm_sha2> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_CRC32
+	template<> struct baseline<cpuinfo_isa_feature_arm_crc32> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SVE
+	template<> struct baseline<cpuinfo_isa_feature_arm_sve> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SVE2
+	template<> struct baseline<cpuinfo_isa_feature_arm_sve2> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_BF16
+	template<> struct baseline<cpuinfo_isa_feature_arm_bf16> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SVEBF16
+	template<> struct baseline<cpuinfo_isa_feature_arm_svebf16> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_FHM
+	template<> struct baseline<cpuinfo_isa_feature_arm_fhm> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_I8MM
+	template<> struct baseline<cpuinfo_isa_feature_arm_i8mm> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SVEI8MM
+	template<> struct baseline<cpuinfo_isa_feature_arm_svei8mm> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SVEF32MM
+	template<> struct baseline<cpuinfo_isa_feature_arm_svef32mm> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SVEF64MM
+	template<> struct baseline<cpuinfo_isa_feature_arm_svef64mm> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SVEAES
+	template<> struct baseline<cpuinfo_isa_feature_arm_sveaes> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SVEPMULL
+	template<> struct baseline<cpuinfo_isa_feature_arm_svepmull> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SVESHA3
+	template<> struct baseline<cpuinfo_isa_feature_arm_svesha3> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SVESM4
+	template<> struct baseline<cpuinfo_isa_feature_arm_svesm4> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SVEBITPERM
+	template<> struct baseline<cpuinfo_isa_feature_arm_svebitperm> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SME
+	template<> struct baseline<cpuinfo_isa_feature_arm_sme> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SME2
+	template<> struct baseline<cpuinfo_isa_feature_arm_sme2> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SHA3
+	template<> struct baseline<cpuinfo_isa_feature_arm_sha3> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SHA512
+	template<> struct baseline<cpuinfo_isa_feature_arm_sha512> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SM3
+	template<> struct baseline<cpuinfo_isa_feature_arm_sm3> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_SM4
+	template<> struct baseline<cpuinfo_isa_feature_arm_sm4> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_RNG
+	template<> struct baseline<cpuinfo_isa_feature_arm_rng> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_RCPC
+	template<> struct baseline<cpuinfo_isa_feature_arm_rcpc> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_RCPC2
+	template<> struct baseline<cpuinfo_isa_feature_arm_rcpc2> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_RCPC3
+	template<> struct baseline<cpuinfo_isa_feature_arm_rcpc3> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_ARM_MOPS
+	template<> struct baseline<cpuinfo_isa_feature_arm_mops> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_LOONGARCH_LSX
+	template<> struct baseline<cpuinfo_isa_feature_loongarch_lsx> : std::true_type {};
+#endif
+#ifdef CPUINFO_BASELINE_LOONGARCH_LASX
+	template<> struct baseline<cpuinfo_isa_feature_loongarch_lasx> : std::true_type {};
+#endif
+
+/* Whether all ISA features are in the baseline of this translation unit; evaluates at compile time */
+template<cpuinfo_isa_feature... Features>
+struct all_baseline : std::true_type {};
+
+template<cpuinfo_isa_feature First, cpuinfo_isa_feature... Rest>
+struct all_baseline<First, Rest...> :
+	std::integral_constant<bool, baseline<First>::value && all_baseline<Rest...>::value> {};
+
+template<cpuinfo_isa_feature... Features>
+constexpr bool in_baseline() {
+	return all_baseline<Features...>::value;
+}
+
+namespace detail {
+	template<cpuinfo_isa_feature... Features>
+	struct detected {
+		static inline bool check() {
+			return true;
+		}
+	};
+
+	template<cpuinfo_isa_feature First, cpuinfo_isa_feature... Rest>
+	struct detected<First, Rest...> {
+		static inline bool check() {
+			return (baseline<First>::value || cpuinfo_isa_features_contain(&cpuinfo_detected_isa_features, First)) &&
+				detected<Rest...>::check();
+		}
+	};
+}
+
+/*
+ * Checks whether the processor supports all ISA features, e.g. cpuinfo::has<cpuinfo::feature::avx2>(). Features in
+ * the baseline of the translation unit fold to true, and others are looked up in the set of detected features. Must
+ * be called after cpuinfo_initialize or cpuinfo_probe_isa, unless all features are in the baseline.
+ */
+template<cpuinfo_isa_feature... Features>
+inline bool has() {
+	return in_baseline<Features...>() || detail::detected<Features...>::check();
+}
+
+} /* namespace */
+
+} /* namespace cpuinfo */
+
+#endif /* CPUINFO_HPP */
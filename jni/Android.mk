@@ -6,10 +6,21 @@ LOCAL_SRC_FILES := \
 	src/init.c \
 	src/api.c \
 	src/cache.c \
+	src/threads.c \
+	src/spin.c \
+	src/dispatch.c \
+	src/features.c \
+	src/arena.c \
 	src/linux/processors.c \
 	src/linux/smallfile.c \
 	src/linux/multiline.c \
-	src/linux/cpulist.c
+	src/linux/cpulist.c \
+	src/linux/nodes.c \
+	src/linux/cgroup.c \
+	src/linux/usable.c \
+	src/linux/current.c \
+	src/linux/snapshot.c \
+	src/linux/sysfs.c
 ifeq ($(TARGET_ARCH_ABI),$(filter $(TARGET_ARCH_ABI),armeabi-v7a arm64-v8a))
 LOCAL_SRC_FILES += \
 	src/arm/uarch.c \
@@ -34,6 +45,7 @@ LOCAL_SRC_FILES += \
 	src/x86/info.c \
 	src/x86/name.c \
 	src/x86/isa.c \
+	src/x86/copy.c \
 	src/x86/vendor.c \
 	src/x86/uarch.c \
 	src/x86/topology.c \
@@ -41,7 +53,10 @@ LOCAL_SRC_FILES += \
 	src/x86/cache/descriptor.c \
 	src/x86/cache/deterministic.c \
 	src/x86/linux/cpuinfo.c \
-	src/x86/linux/init.c
+	src/x86/linux/init.c \
+	src/x86/linux/hybrid.c \
+	src/x86/linux/topology.c \
+	src/x86/linux/umwait.c
 endif # x86 or x86_64
 LOCAL_EXPORT_C_INCLUDES := $(LOCAL_PATH)/include
 LOCAL_C_INCLUDES := $(LOCAL_EXPORT_C_INCLUDES) $(LOCAL_PATH)/src
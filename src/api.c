@@ -8,11 +8,6 @@
 #ifdef __linux__
 	#include <linux/api.h>
 
-	#include <unistd.h>
-	#include <sys/syscall.h>
-	#if !defined(__NR_getcpu)
-		#include <asm-generic/unistd.h>
-	#endif
 #endif
 
 bool cpuinfo_is_initialized = false;
@@ -21,21 +16,43 @@ struct cpuinfo_processor* cpuinfo_processors = NULL;
 struct cpuinfo_core* cpuinfo_cores = NULL;
 struct cpuinfo_cluster* cpuinfo_clusters = NULL;
 struct cpuinfo_package* cpuinfo_packages = NULL;
+struct cpuinfo_die* cpuinfo_dies = NULL;
+struct cpuinfo_node* cpuinfo_nodes = NULL;
 struct cpuinfo_cache* cpuinfo_cache[cpuinfo_cache_level_max] = { NULL };
 
 uint32_t cpuinfo_processors_count = 0;
 uint32_t cpuinfo_cores_count = 0;
 uint32_t cpuinfo_clusters_count = 0;
 uint32_t cpuinfo_packages_count = 0;
+uint32_t cpuinfo_dies_count = 0;
+uint32_t cpuinfo_nodes_count = 0;
 uint32_t cpuinfo_cache_count[cpuinfo_cache_level_max] = { 0 };
 uint32_t cpuinfo_max_cache_size = 0;
 
+static struct cpuinfo_topology cpuinfo_global_topology = { NULL };
+
+struct cpuinfo_arena cpuinfo_tables_arena = { NULL, 0 };
+
+const struct cpuinfo_processor** cpuinfo_usable_processors = NULL;
+const struct cpuinfo_core** cpuinfo_usable_cores = NULL;
+const struct cpuinfo_cluster** cpuinfo_usable_clusters = NULL;
+const struct cpuinfo_package** cpuinfo_usable_packages = NULL;
+
+uint32_t cpuinfo_usable_processors_count = 0;
+uint32_t cpuinfo_usable_cores_count = 0;
+uint32_t cpuinfo_usable_clusters_count = 0;
+uint32_t cpuinfo_usable_packages_count = 0;
+
 #if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 	struct cpuinfo_uarch_info* cpuinfo_uarchs = NULL;
 	uint32_t cpuinfo_uarchs_count = 0;
 #elif CPUINFO_ARCH_LOONGARCH64
 	struct cpuinfo_uarch_info* cpuinfo_uarchs = NULL;
 	uint32_t cpuinfo_uarchs_count = 0;
+#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	struct cpuinfo_uarch_info cpuinfo_global_uarch = { cpuinfo_uarch_unknown };
+	struct cpuinfo_uarch_info* cpuinfo_uarchs = &cpuinfo_global_uarch;
+	uint32_t cpuinfo_uarchs_count = 1;
 #else
 	struct cpuinfo_uarch_info cpuinfo_global_uarch = { cpuinfo_uarch_unknown };
 #endif
@@ -48,9 +65,102 @@ uint32_t cpuinfo_max_cache_size = 0;
 		const uint32_t* cpuinfo_linux_cpu_to_uarch_index_map = NULL;
 	#elif CPUINFO_ARCH_LOONGARCH64
 		const uint32_t* cpuinfo_linux_cpu_to_uarch_index_map = NULL;
+	#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		const uint32_t* cpuinfo_linux_cpu_to_uarch_index_map = NULL;
+	#endif
+#endif
+
+void cpuinfo_reset_tables(void) {
+	cpuinfo_processors = NULL;
+	cpuinfo_cores = NULL;
+	cpuinfo_clusters = NULL;
+	cpuinfo_packages = NULL;
+	cpuinfo_dies = NULL;
+	cpuinfo_nodes = NULL;
+	for (uint32_t level = 0; level < cpuinfo_cache_level_max; level++) {
+		cpuinfo_cache[level] = NULL;
+		cpuinfo_cache_count[level] = 0;
+	}
+
+	cpuinfo_processors_count = 0;
+	cpuinfo_cores_count = 0;
+	cpuinfo_clusters_count = 0;
+	cpuinfo_packages_count = 0;
+	cpuinfo_dies_count = 0;
+	cpuinfo_nodes_count = 0;
+	cpuinfo_max_cache_size = 0;
+
+	cpuinfo_tables_arena = (struct cpuinfo_arena) { NULL, 0 };
+	cpuinfo_global_topology = (struct cpuinfo_topology) { NULL };
+
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 || CPUINFO_ARCH_LOONGARCH64
+	cpuinfo_uarchs = NULL;
+	cpuinfo_uarchs_count = 0;
+#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	cpuinfo_global_uarch = (struct cpuinfo_uarch_info) { cpuinfo_uarch_unknown };
+	cpuinfo_uarchs = &cpuinfo_global_uarch;
+	cpuinfo_uarchs_count = 1;
+#else
+	cpuinfo_global_uarch = (struct cpuinfo_uarch_info) { cpuinfo_uarch_unknown };
+#endif
+
+#ifdef __linux__
+	cpuinfo_linux_cpu_max = 0;
+	cpuinfo_linux_cpu_to_processor_map = NULL;
+	cpuinfo_linux_cpu_to_core_map = NULL;
+	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 || CPUINFO_ARCH_LOONGARCH64 || CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		cpuinfo_linux_cpu_to_uarch_index_map = NULL;
+	#endif
+#endif
+}
+
+void cpuinfo_update_topology(void) {
+	cpuinfo_global_topology = (struct cpuinfo_topology) {
+		.processors = cpuinfo_processors,
+		.cores = cpuinfo_cores,
+		.clusters = cpuinfo_clusters,
+		.packages = cpuinfo_packages,
+		.dies = cpuinfo_dies,
+		.nodes = cpuinfo_nodes,
+	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 || CPUINFO_ARCH_LOONGARCH64 || CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		.uarchs = cpuinfo_uarchs,
+	#else
+		.uarchs = &cpuinfo_global_uarch,
 	#endif
+		.l1i_caches = cpuinfo_cache[cpuinfo_cache_level_1i],
+		.l1d_caches = cpuinfo_cache[cpuinfo_cache_level_1d],
+		.l2_caches = cpuinfo_cache[cpuinfo_cache_level_2],
+		.l3_caches = cpuinfo_cache[cpuinfo_cache_level_3],
+		.l4_caches = cpuinfo_cache[cpuinfo_cache_level_4],
+		.processors_count = cpuinfo_processors_count,
+		.cores_count = cpuinfo_cores_count,
+		.clusters_count = cpuinfo_clusters_count,
+		.packages_count = cpuinfo_packages_count,
+		.dies_count = cpuinfo_dies_count,
+		.nodes_count = cpuinfo_nodes_count,
+	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 || CPUINFO_ARCH_LOONGARCH64 || CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		.uarchs_count = cpuinfo_uarchs_count,
+	#else
+		.uarchs_count = 1,
+	#endif
+		.l1i_caches_count = cpuinfo_cache_count[cpuinfo_cache_level_1i],
+		.l1d_caches_count = cpuinfo_cache_count[cpuinfo_cache_level_1d],
+		.l2_caches_count = cpuinfo_cache_count[cpuinfo_cache_level_2],
+		.l3_caches_count = cpuinfo_cache_count[cpuinfo_cache_level_3],
+		.l4_caches_count = cpuinfo_cache_count[cpuinfo_cache_level_4],
+		.max_cache_size = cpuinfo_max_cache_size,
+	};
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	cpuinfo_x86_update_copy_thresholds();
 #endif
+}
 
+const struct cpuinfo_topology* CPUINFO_ABI cpuinfo_get_topology(void) {
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "topology");
+	}
+	return &cpuinfo_global_topology;
+}
 
 const struct cpuinfo_processor* cpuinfo_get_processors(void) {
 	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
@@ -80,11 +190,25 @@ const struct cpuinfo_package* cpuinfo_get_packages(void) {
 	return cpuinfo_packages;
 }
 
+const struct cpuinfo_die* cpuinfo_get_dies(void) {
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "dies");
+	}
+	return cpuinfo_dies;
+}
+
+const struct cpuinfo_node* cpuinfo_get_nodes(void) {
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "nodes");
+	}
+	return cpuinfo_nodes;
+}
+
 const struct cpuinfo_uarch_info* cpuinfo_get_uarchs() {
 	if (!cpuinfo_is_initialized) {
 		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "uarchs");
 	}
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 || CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_uarchs;
 	#elif CPUINFO_ARCH_LOONGARCH64
 		return cpuinfo_uarchs;
@@ -133,11 +257,31 @@ const struct cpuinfo_package* cpuinfo_get_package(uint32_t index) {
 	return &cpuinfo_packages[index];
 }
 
+const struct cpuinfo_die* cpuinfo_get_die(uint32_t index) {
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "die");
+	}
+	if CPUINFO_UNLIKELY(index >= cpuinfo_dies_count) {
+		return NULL;
+	}
+	return &cpuinfo_dies[index];
+}
+
+const struct cpuinfo_node* cpuinfo_get_node(uint32_t index) {
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "node");
+	}
+	if CPUINFO_UNLIKELY(index >= cpuinfo_nodes_count) {
+		return NULL;
+	}
+	return &cpuinfo_nodes[index];
+}
+
 const struct cpuinfo_uarch_info* cpuinfo_get_uarch(uint32_t index) {
 	if (!cpuinfo_is_initialized) {
 		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "uarch");
 	}
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 || CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		if CPUINFO_UNLIKELY(index >= cpuinfo_uarchs_count) {
 			return NULL;
 		}
@@ -183,11 +327,25 @@ uint32_t cpuinfo_get_packages_count(void) {
 	return cpuinfo_packages_count;
 }
 
+uint32_t cpuinfo_get_dies_count(void) {
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "dies_count");
+	}
+	return cpuinfo_dies_count;
+}
+
+uint32_t cpuinfo_get_nodes_count(void) {
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "nodes_count");
+	}
+	return cpuinfo_nodes_count;
+}
+
 uint32_t cpuinfo_get_uarchs_count(void) {
 	if (!cpuinfo_is_initialized) {
 		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "uarchs_count");
 	}
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 || CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		return cpuinfo_uarchs_count;
 	#elif CPUINFO_ARCH_LOONGARCH64
 		return cpuinfo_uarchs_count;
@@ -323,17 +481,121 @@ uint32_t CPUINFO_ABI cpuinfo_get_max_cache_size(void) {
 	return cpuinfo_max_cache_size;
 }
 
+uint32_t CPUINFO_ABI cpuinfo_get_usable_processors_count(void) {
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "usable_processors_count");
+	}
+	if (cpuinfo_usable_processors == NULL) {
+		/* Usable processors are not tracked on this platform: all processors are usable */
+		return cpuinfo_processors_count;
+	}
+	return cpuinfo_usable_processors_count;
+}
+
+uint32_t CPUINFO_ABI cpuinfo_get_usable_cores_count(void) {
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "usable_cores_count");
+	}
+	if (cpuinfo_usable_cores == NULL) {
+		/* Usable cores are not tracked on this platform: all cores are usable */
+		return cpuinfo_cores_count;
+	}
+	return cpuinfo_usable_cores_count;
+}
+
+uint32_t CPUINFO_ABI cpuinfo_get_usable_clusters_count(void) {
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "usable_clusters_count");
+	}
+	if (cpuinfo_usable_clusters == NULL) {
+		/* Usable clusters are not tracked on this platform: all clusters are usable */
+		return cpuinfo_clusters_count;
+	}
+	return cpuinfo_usable_clusters_count;
+}
+
+uint32_t CPUINFO_ABI cpuinfo_get_usable_packages_count(void) {
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "usable_packages_count");
+	}
+	if (cpuinfo_usable_packages == NULL) {
+		/* Usable packages are not tracked on this platform: all packages are usable */
+		return cpuinfo_packages_count;
+	}
+	return cpuinfo_usable_packages_count;
+}
+
+const struct cpuinfo_processor* CPUINFO_ABI cpuinfo_get_usable_processor(uint32_t index) {
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "usable_processor");
+	}
+	if (cpuinfo_usable_processors == NULL) {
+		if CPUINFO_UNLIKELY(index >= cpuinfo_processors_count) {
+			return NULL;
+		}
+		return &cpuinfo_processors[index];
+	}
+	if CPUINFO_UNLIKELY(index >= cpuinfo_usable_processors_count) {
+		return NULL;
+	}
+	return cpuinfo_usable_processors[index];
+}
+
+const struct cpuinfo_core* CPUINFO_ABI cpuinfo_get_usable_core(uint32_t index) {
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "usable_core");
+	}
+	if (cpuinfo_usable_cores == NULL) {
+		if CPUINFO_UNLIKELY(index >= cpuinfo_cores_count) {
+			return NULL;
+		}
+		return &cpuinfo_cores[index];
+	}
+	if CPUINFO_UNLIKELY(index >= cpuinfo_usable_cores_count) {
+		return NULL;
+	}
+	return cpuinfo_usable_cores[index];
+}
+
+const struct cpuinfo_cluster* CPUINFO_ABI cpuinfo_get_usable_cluster(uint32_t index) {
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "usable_cluster");
+	}
+	if (cpuinfo_usable_clusters == NULL) {
+		if CPUINFO_UNLIKELY(index >= cpuinfo_clusters_count) {
+			return NULL;
+		}
+		return &cpuinfo_clusters[index];
+	}
+	if CPUINFO_UNLIKELY(index >= cpuinfo_usable_clusters_count) {
+		return NULL;
+	}
+	return cpuinfo_usable_clusters[index];
+}
+
+const struct cpuinfo_package* CPUINFO_ABI cpuinfo_get_usable_package(uint32_t index) {
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "usable_package");
+	}
+	if (cpuinfo_usable_packages == NULL) {
+		if CPUINFO_UNLIKELY(index >= cpuinfo_packages_count) {
+			return NULL;
+		}
+		return &cpuinfo_packages[index];
+	}
+	if CPUINFO_UNLIKELY(index >= cpuinfo_usable_packages_count) {
+		return NULL;
+	}
+	return cpuinfo_usable_packages[index];
+}
+
 const struct cpuinfo_processor* CPUINFO_ABI cpuinfo_get_current_processor(void) {
 	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
 		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "current_processor");
 	}
 	#ifdef __linux__
-		/* Initializing this variable silences a MemorySanitizer error. */
-		unsigned cpu = 0;
-		if CPUINFO_UNLIKELY(syscall(__NR_getcpu, &cpu, NULL, NULL) != 0) {
-			return 0;
-		}
-		if CPUINFO_UNLIKELY((uint32_t) cpu >= cpuinfo_linux_cpu_max) {
+		const uint32_t cpu = cpuinfo_linux_get_current_cpu();
+		if CPUINFO_UNLIKELY(cpu >= cpuinfo_linux_cpu_max) {
 			return 0;
 		}
 		return cpuinfo_linux_cpu_to_processor_map[cpu];
@@ -347,12 +609,8 @@ const struct cpuinfo_core* CPUINFO_ABI cpuinfo_get_current_core(void) {
 		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "current_core");
 	}
 	#ifdef __linux__
-		/* Initializing this variable silences a MemorySanitizer error. */
-		unsigned cpu = 0;
-		if CPUINFO_UNLIKELY(syscall(__NR_getcpu, &cpu, NULL, NULL) != 0) {
-			return 0;
-		}
-		if CPUINFO_UNLIKELY((uint32_t) cpu >= cpuinfo_linux_cpu_max) {
+		const uint32_t cpu = cpuinfo_linux_get_current_cpu();
+		if CPUINFO_UNLIKELY(cpu >= cpuinfo_linux_cpu_max) {
 			return 0;
 		}
 		return cpuinfo_linux_cpu_to_core_map[cpu];
@@ -365,20 +623,16 @@ uint32_t CPUINFO_ABI cpuinfo_get_current_uarch_index(void) {
 	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
 		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "current_uarch_index");
 	}
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 || CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		#ifdef __linux__
 			if (cpuinfo_linux_cpu_to_uarch_index_map == NULL) {
-				/* Special case: avoid syscall on systems with only a single type of cores */
+				/* Special case: avoid lookup on systems with only a single type of cores */
 				return 0;
 			}
 
 			/* General case */
-			/* Initializing this variable silences a MemorySanitizer error. */
-			unsigned cpu = 0;
-			if CPUINFO_UNLIKELY(syscall(__NR_getcpu, &cpu, NULL, NULL) != 0) {
-				return 0;
-			}
-			if CPUINFO_UNLIKELY((uint32_t) cpu >= cpuinfo_linux_cpu_max) {
+			const uint32_t cpu = cpuinfo_linux_get_current_cpu();
+			if CPUINFO_UNLIKELY(cpu >= cpuinfo_linux_cpu_max) {
 				return 0;
 			}
 			return cpuinfo_linux_cpu_to_uarch_index_map[cpu];
@@ -387,7 +641,7 @@ uint32_t CPUINFO_ABI cpuinfo_get_current_uarch_index(void) {
 			return 0;
 		#endif
 	#else
-		/* Only ARM/ARM64 processors may include cores of different types in the same package. */
+		/* Only ARM/ARM64 and hybrid x86 processors may include cores of different types in the same package. */
 		return 0;
 	#endif
 }
@@ -396,20 +650,16 @@ uint32_t CPUINFO_ABI cpuinfo_get_current_uarch_index_with_default(uint32_t defau
 	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
 		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "current_uarch_index_with_default");
 	}
-	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 || CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
 		#ifdef __linux__
 			if (cpuinfo_linux_cpu_to_uarch_index_map == NULL) {
-				/* Special case: avoid syscall on systems with only a single type of cores */
+				/* Special case: avoid lookup on systems with only a single type of cores */
 				return 0;
 			}
 
 			/* General case */
-			/* Initializing this variable silences a MemorySanitizer error. */
-			unsigned cpu = 0;
-			if CPUINFO_UNLIKELY(syscall(__NR_getcpu, &cpu, NULL, NULL) != 0) {
-				return default_uarch_index;
-			}
-			if CPUINFO_UNLIKELY((uint32_t) cpu >= cpuinfo_linux_cpu_max) {
+			const uint32_t cpu = cpuinfo_linux_get_current_cpu();
+			if CPUINFO_UNLIKELY(cpu >= cpuinfo_linux_cpu_max) {
 				return default_uarch_index;
 			}
 			return cpuinfo_linux_cpu_to_uarch_index_map[cpu];
@@ -418,7 +668,35 @@ uint32_t CPUINFO_ABI cpuinfo_get_current_uarch_index_with_default(uint32_t defau
 			return default_uarch_index;
 		#endif
 	#else
-		/* Only ARM/ARM64 processors may include cores of different types in the same package. */
+		/* Only ARM/ARM64 and hybrid x86 processors may include cores of different types in the same package. */
 		return 0;
 	#endif
 }
+
+bool CPUINFO_ABI cpuinfo_get_current_location(struct cpuinfo_current_location location[restrict static 1]) {
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "current_location");
+	}
+	*location = (struct cpuinfo_current_location) { 0 };
+	#ifdef __linux__
+		const uint32_t cpu = cpuinfo_linux_get_current_cpu();
+		if CPUINFO_UNLIKELY(cpu >= cpuinfo_linux_cpu_max) {
+			return false;
+		}
+		const struct cpuinfo_processor* processor = cpuinfo_linux_cpu_to_processor_map[cpu];
+		if CPUINFO_UNLIKELY(processor == NULL) {
+			return false;
+		}
+		location->processor = processor;
+		location->core = processor->core;
+		location->cluster = processor->cluster;
+		#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 || CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 || CPUINFO_ARCH_LOONGARCH64
+			if (cpuinfo_linux_cpu_to_uarch_index_map != NULL) {
+				location->uarch_index = cpuinfo_linux_cpu_to_uarch_index_map[cpu];
+			}
+		#endif
+		return true;
+	#else
+		return false;
+	#endif
+}
@@ -0,0 +1,81 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32) || defined(__CYGWIN__)
+	#include <malloc.h>
+#endif
+
+#include <cpuinfo/arena.h>
+#include <cpuinfo/log.h>
+
+
+static size_t align_arena_offset(size_t offset) {
+	return (offset + (CPUINFO_ARENA_ALIGNMENT - 1)) & ~(size_t) (CPUINFO_ARENA_ALIGNMENT - 1);
+}
+
+bool cpuinfo_arena_allocate(
+	struct cpuinfo_arena arena[restrict static 1],
+	size_t tables_count,
+	const struct cpuinfo_arena_table tables[restrict static tables_count])
+{
+	arena->base = NULL;
+	arena->size = 0;
+
+	size_t size = 0;
+	for (size_t i = 0; i < tables_count; i++) {
+		if (tables[i].count != 0) {
+			if (tables[i].count > (SIZE_MAX - CPUINFO_ARENA_ALIGNMENT - size) / tables[i].element_size) {
+				cpuinfo_log_error("failed to allocate arena: table %zu of %zu %zu-byte elements is too large",
+					i, tables[i].count, tables[i].element_size);
+				return false;
+			}
+			size = align_arena_offset(size) + tables[i].count * tables[i].element_size;
+		}
+	}
+	size = align_arena_offset(size);
+
+	void* base = NULL;
+	if (size != 0) {
+		#if defined(_WIN32) || defined(__CYGWIN__)
+			base = _aligned_malloc(size, CPUINFO_ARENA_ALIGNMENT);
+		#else
+			if (posix_memalign(&base, CPUINFO_ARENA_ALIGNMENT, size) != 0) {
+				base = NULL;
+			}
+		#endif
+		if (base == NULL) {
+			cpuinfo_log_error("failed to allocate %zu bytes for arena of %zu tables", size, tables_count);
+			return false;
+		}
+		memset(base, 0, size);
+	}
+
+	size_t offset = 0;
+	for (size_t i = 0; i < tables_count; i++) {
+		void* table = NULL;
+		if (tables[i].count != 0) {
+			offset = align_arena_offset(offset);
+			table = (char*) base + offset;
+			offset += tables[i].count * tables[i].element_size;
+		}
+		/* The pointer variable may have any object pointer type, so it is written without a typed access */
+		memcpy(tables[i].pointer, &table, sizeof(table));
+	}
+
+	arena->base = base;
+	arena->size = size;
+	return true;
+}
+
+void cpuinfo_arena_free(struct cpuinfo_arena arena[restrict static 1]) {
+	#if defined(_WIN32) || defined(__CYGWIN__)
+		_aligned_free(arena->base);
+	#else
+		free(arena->base);
+	#endif
+	arena->base = NULL;
+	arena->size = 0;
+}
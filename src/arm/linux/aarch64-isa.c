@@ -6,7 +6,7 @@
 
 void cpuinfo_arm64_linux_decode_isa_from_proc_cpuinfo(
 	uint32_t features,
-	uint32_t features2,
+	uint64_t features2,
 	uint32_t midr,
 	const struct cpuinfo_arm_chipset chipset[restrict static 1],
 	struct cpuinfo_arm_isa isa[restrict static 1])
@@ -69,12 +69,9 @@ void cpuinfo_arm64_linux_decode_isa_from_proc_cpuinfo(
 				isa->rdm = true;
 				break;
 			default:
+				/* Partial support for only scalar or only SIMD operations is reported by cpuinfo_arm_linux_init */
 				if ((features & fp16arith_mask) == fp16arith_mask) {
 					isa->fp16arith = true;
-				} else if (features & CPUINFO_ARM_LINUX_FEATURE_FPHP) {
-					cpuinfo_log_warning("FP16 arithmetics disabled: detected support only for scalar operations");
-				} else if (features & CPUINFO_ARM_LINUX_FEATURE_ASIMDHP) {
-					cpuinfo_log_warning("FP16 arithmetics disabled: detected support only for SIMD operations");
 				}
 				if (features & CPUINFO_ARM_LINUX_FEATURE_ASIMDRDM) {
 					isa->rdm = true;
@@ -130,10 +127,396 @@ void cpuinfo_arm64_linux_decode_isa_from_proc_cpuinfo(
 	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_SVE2) {
 		isa->sve2 = true;
 	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_SVE2P1) {
+		isa->sve2p1 = true;
+	}
 	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_BF16) {
 		isa->bf16 = true;
 	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_EBF16) {
+		isa->ebf16 = true;
+	}
 	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_SVEBF16) {
 		isa->svebf16 = true;
 	}
+	if (features & CPUINFO_ARM_LINUX_FEATURE_ASIMDFHM) {
+		isa->fhm = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_I8MM) {
+		isa->i8mm = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_SVEI8MM) {
+		isa->svei8mm = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_SVEF32MM) {
+		isa->svef32mm = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_SVEF64MM) {
+		isa->svef64mm = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_SVEAES) {
+		isa->sveaes = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_SVEPMULL) {
+		isa->svepmull = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_SVESHA3) {
+		isa->svesha3 = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_SVESM4) {
+		isa->svesm4 = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_SVEBITPERM) {
+		isa->svebitperm = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_SME) {
+		isa->sme = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_SME2) {
+		isa->sme2 = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_SME2P1) {
+		isa->sme2p1 = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_SME_I16I64) {
+		isa->smei16i64 = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_SME_F64F64) {
+		isa->smef64f64 = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_SME_FA64) {
+		isa->smefa64 = true;
+	}
+	if (features & CPUINFO_ARM_LINUX_FEATURE_SHA3) {
+		isa->sha3 = true;
+	}
+	if (features & CPUINFO_ARM_LINUX_FEATURE_SHA512) {
+		isa->sha512 = true;
+	}
+	if (features & CPUINFO_ARM_LINUX_FEATURE_SM3) {
+		isa->sm3 = true;
+	}
+	if (features & CPUINFO_ARM_LINUX_FEATURE_SM4) {
+		isa->sm4 = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_RNG) {
+		isa->rng = true;
+	}
+	if (features & CPUINFO_ARM_LINUX_FEATURE_LRCPC) {
+		isa->rcpc = true;
+	}
+	if (features & CPUINFO_ARM_LINUX_FEATURE_ILRCPC) {
+		isa->rcpc2 = true;
+	}
+	if (features & CPUINFO_ARM_LINUX_FEATURE_FLAGM) {
+		isa->flagm = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_LRCPC3) {
+		isa->rcpc3 = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_FLAGM2) {
+		isa->flagm2 = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_LSE128) {
+		isa->lse128 = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_MOPS) {
+		isa->mops = true;
+	}
+	if (features2 & CPUINFO_ARM_LINUX_FEATURE2_CSSC) {
+		isa->cssc = true;
+	}
+}
+
+/* Extracts a 4-bit field from an ID register */
+static inline uint32_t id_field(uint64_t id_register, uint32_t shift) {
+	return (uint32_t) (id_register >> shift) & UINT32_C(0xF);
+}
+
+void cpuinfo_arm64_linux_decode_isa_from_id_registers(
+	const struct cpuinfo_arm64_id_registers registers[restrict static 1],
+	uint32_t features[restrict static 1],
+	uint64_t features2[restrict static 1])
+{
+	/* The mapping of fields follows arm64_elf_hwcaps in arch/arm64/kernel/cpufeature.c */
+	uint32_t id_features = 0;
+	uint64_t id_features2 = 0;
+
+	const uint64_t isar0 = registers->id_aa64isar0_el1;
+	switch (id_field(isar0, 4)) {
+		default:
+			id_features |= CPUINFO_ARM_LINUX_FEATURE_PMULL;
+			/* fall through */
+		case 1:
+			id_features |= CPUINFO_ARM_LINUX_FEATURE_AES;
+			/* fall through */
+		case 0:
+			break;
+	}
+	if (id_field(isar0, 8) >= 1) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_SHA1;
+	}
+	switch (id_field(isar0, 12)) {
+		default:
+			id_features |= CPUINFO_ARM_LINUX_FEATURE_SHA512;
+			/* fall through */
+		case 1:
+			id_features |= CPUINFO_ARM_LINUX_FEATURE_SHA2;
+			/* fall through */
+		case 0:
+			break;
+	}
+	if (id_field(isar0, 16) >= 1) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_CRC32;
+	}
+	/* Atomic: 2 = FEAT_LSE, 3 = FEAT_LSE128 */
+	const uint32_t atomic = id_field(isar0, 20);
+	if (atomic >= 2) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_ATOMICS;
+	}
+	if (atomic >= 3) {
+		id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_LSE128;
+	}
+	if (id_field(isar0, 28) >= 1) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_ASIMDRDM;
+	}
+	if (id_field(isar0, 32) >= 1) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_SHA3;
+	}
+	if (id_field(isar0, 36) >= 1) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_SM3;
+	}
+	if (id_field(isar0, 40) >= 1) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_SM4;
+	}
+	if (id_field(isar0, 44) >= 1) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_ASIMDDP;
+	}
+	if (id_field(isar0, 48) >= 1) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_ASIMDFHM;
+	}
+	/* TS: 1 = FEAT_FlagM, 2 = FEAT_FlagM2 */
+	switch (id_field(isar0, 52)) {
+		default:
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_FLAGM2;
+			/* fall through */
+		case 1:
+			id_features |= CPUINFO_ARM_LINUX_FEATURE_FLAGM;
+			/* fall through */
+		case 0:
+			break;
+	}
+	if (id_field(isar0, 60) >= 1) {
+		id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_RNG;
+	}
+
+	const uint64_t isar1 = registers->id_aa64isar1_el1;
+	switch (id_field(isar1, 0)) {
+		default:
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_DCPODP;
+			/* fall through */
+		case 1:
+			id_features |= CPUINFO_ARM_LINUX_FEATURE_DCPOP;
+			/* fall through */
+		case 0:
+			break;
+	}
+	/* APA, API, or APA3 report address authentication; GPA, GPI, or GPA3 report generic authentication */
+	if (id_field(isar1, 4) | id_field(isar1, 8) | id_field(registers->id_aa64isar2_el1, 12)) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_PACA;
+	}
+	if (id_field(isar1, 24) | id_field(isar1, 28) | id_field(registers->id_aa64isar2_el1, 8)) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_PACG;
+	}
+	if (id_field(isar1, 12) >= 1) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_JSCVT;
+	}
+	if (id_field(isar1, 16) >= 1) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_FCMA;
+	}
+	/* LRCPC: 1 = FEAT_LRCPC, 2 = FEAT_LRCPC2, 3 = FEAT_LRCPC3 */
+	const uint32_t lrcpc = id_field(isar1, 20);
+	if (lrcpc >= 1) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_LRCPC;
+	}
+	if (lrcpc >= 2) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_ILRCPC;
+	}
+	if (lrcpc >= 3) {
+		id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_LRCPC3;
+	}
+	if (id_field(isar1, 32) >= 1) {
+		id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_FRINT;
+	}
+	if (id_field(isar1, 36) >= 1) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_SB;
+	}
+	/* BF16: 1 = FEAT_BF16, 2 = FEAT_EBF16 */
+	const uint32_t bf16 = id_field(isar1, 44);
+	if (bf16 >= 1) {
+		id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_BF16;
+	}
+	if (bf16 >= 2) {
+		id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_EBF16;
+	}
+	if (id_field(isar1, 48) >= 1) {
+		id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_DGH;
+	}
+	if (id_field(isar1, 52) >= 1) {
+		id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_I8MM;
+	}
+
+	const uint64_t isar2 = registers->id_aa64isar2_el1;
+	if (id_field(isar2, 16) >= 1) {
+		id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_MOPS;
+	}
+	if (id_field(isar2, 52) >= 1) {
+		id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_CSSC;
+	}
+
+	/* FP and AdvSIMD are signed fields: 0xF means not implemented, 1 adds half-precision arithmetics */
+	const uint64_t pfr0 = registers->id_aa64pfr0_el1;
+	const uint32_t fp = id_field(pfr0, 16);
+	if (fp != 0xF) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_FP;
+		if (fp >= 1) {
+			id_features |= CPUINFO_ARM_LINUX_FEATURE_FPHP;
+		}
+	}
+	const uint32_t asimd = id_field(pfr0, 20);
+	if (asimd != 0xF) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_ASIMD;
+		if (asimd >= 1) {
+			id_features |= CPUINFO_ARM_LINUX_FEATURE_ASIMDHP;
+		}
+	}
+	const bool sve = id_field(pfr0, 32) >= 1;
+	if (sve) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_SVE;
+	}
+	if (id_field(pfr0, 48) >= 1) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_DIT;
+	}
+
+	const uint64_t pfr1 = registers->id_aa64pfr1_el1;
+	if (id_field(pfr1, 0) >= 1) {
+		id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_BTI;
+	}
+	/* SSBS: 1 = FEAT_SSBS, 2 = FEAT_SSBS2, which adds the MSR/MRS instructions reported by HWCAP_SSBS */
+	if (id_field(pfr1, 4) >= 2) {
+		id_features |= CPUINFO_ARM_LINUX_FEATURE_SSBS;
+	}
+	const bool sme = id_field(pfr1, 24) >= 1;
+	if (sme) {
+		id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SME;
+	}
+
+	/* ID_AA64ZFR0_EL1 is only meaningful if SVE is implemented */
+	if (sve) {
+		const uint64_t zfr0 = registers->id_aa64zfr0_el1;
+		/* SVEver: 1 = FEAT_SVE2, 2 = FEAT_SVE2p1 */
+		switch (id_field(zfr0, 0)) {
+			default:
+				id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVE2P1;
+				/* fall through */
+			case 1:
+				id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVE2;
+				/* fall through */
+			case 0:
+				break;
+		}
+		switch (id_field(zfr0, 4)) {
+			default:
+				id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVEPMULL;
+				/* fall through */
+			case 1:
+				id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVEAES;
+				/* fall through */
+			case 0:
+				break;
+		}
+		if (id_field(zfr0, 16) >= 1) {
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVEBITPERM;
+		}
+		/* BF16: 1 = FEAT_BF16, 2 = FEAT_EBF16 */
+		switch (id_field(zfr0, 20)) {
+			default:
+				id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVE_EBF16;
+				/* fall through */
+			case 1:
+				id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVEBF16;
+				/* fall through */
+			case 0:
+				break;
+		}
+		if (id_field(zfr0, 32) >= 1) {
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVESHA3;
+		}
+		if (id_field(zfr0, 40) >= 1) {
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVESM4;
+		}
+		if (id_field(zfr0, 44) >= 1) {
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVEI8MM;
+		}
+		if (id_field(zfr0, 52) >= 1) {
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVEF32MM;
+		}
+		if (id_field(zfr0, 56) >= 1) {
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SVEF64MM;
+		}
+	}
+
+	/* ID_AA64SMFR0_EL1 is only meaningful if SME is implemented */
+	if (sme) {
+		const uint64_t smfr0 = registers->id_aa64smfr0_el1;
+		/* Single-bit fields */
+		if (smfr0 & (UINT64_C(1) << 32)) {
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SME_F32F32;
+		}
+		if (smfr0 & (UINT64_C(1) << 33)) {
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SME_BI32I32;
+		}
+		if (smfr0 & (UINT64_C(1) << 34)) {
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SME_B16F32;
+		}
+		if (smfr0 & (UINT64_C(1) << 35)) {
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SME_F16F32;
+		}
+		if (smfr0 & (UINT64_C(1) << 42)) {
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SME_F16F16;
+		}
+		if (smfr0 & (UINT64_C(1) << 43)) {
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SME_B16B16;
+		}
+		if (smfr0 & (UINT64_C(1) << 48)) {
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SME_F64F64;
+		}
+		if (smfr0 & (UINT64_C(1) << 63)) {
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SME_FA64;
+		}
+		/* I8I32 and I16I64 report the instructions as 0b1111, and I16I32 as 0b0101 */
+		if (id_field(smfr0, 36) == 0xF) {
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SME_I8I32;
+		}
+		if (id_field(smfr0, 44) == 0x5) {
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SME_I16I32;
+		}
+		if (id_field(smfr0, 52) == 0xF) {
+			id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SME_I16I64;
+		}
+		/* SMEver: 1 = FEAT_SME2, 2 = FEAT_SME2p1 */
+		switch (id_field(smfr0, 56)) {
+			default:
+				id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SME2P1;
+				/* fall through */
+			case 1:
+				id_features2 |= CPUINFO_ARM_LINUX_FEATURE2_SME2;
+				/* fall through */
+			case 0:
+				break;
+		}
+	}
+
+	*features |= id_features;
+	*features2 |= id_features2;
 }
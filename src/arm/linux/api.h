@@ -115,24 +115,55 @@ struct cpuinfo_arm_linux_proc_cpuinfo_cache {
 	#define CPUINFO_ARM_LINUX_FEATURE_PACA     UINT32_C(0x40000000)
 	#define CPUINFO_ARM_LINUX_FEATURE_PACG     UINT32_C(0x80000000)
 
-	#define CPUINFO_ARM_LINUX_FEATURE2_DCPODP     UINT32_C(0x00000001)
-	#define CPUINFO_ARM_LINUX_FEATURE2_SVE2       UINT32_C(0x00000002)
-	#define CPUINFO_ARM_LINUX_FEATURE2_SVEAES     UINT32_C(0x00000004)
-	#define CPUINFO_ARM_LINUX_FEATURE2_SVEPMULL   UINT32_C(0x00000008)
-	#define CPUINFO_ARM_LINUX_FEATURE2_SVEBITPERM UINT32_C(0x00000010)
-	#define CPUINFO_ARM_LINUX_FEATURE2_SVESHA3    UINT32_C(0x00000020)
-	#define CPUINFO_ARM_LINUX_FEATURE2_SVESM4     UINT32_C(0x00000040)
-	#define CPUINFO_ARM_LINUX_FEATURE2_FLAGM2     UINT32_C(0x00000080)
-	#define CPUINFO_ARM_LINUX_FEATURE2_FRINT      UINT32_C(0x00000100)
-	#define CPUINFO_ARM_LINUX_FEATURE2_SVEI8MM    UINT32_C(0x00000200)
-	#define CPUINFO_ARM_LINUX_FEATURE2_SVEF32MM   UINT32_C(0x00000400)
-	#define CPUINFO_ARM_LINUX_FEATURE2_SVEF64MM   UINT32_C(0x00000800)
-	#define CPUINFO_ARM_LINUX_FEATURE2_SVEBF16    UINT32_C(0x00001000)
-	#define CPUINFO_ARM_LINUX_FEATURE2_I8MM       UINT32_C(0x00002000)
-	#define CPUINFO_ARM_LINUX_FEATURE2_BF16       UINT32_C(0x00004000)
-	#define CPUINFO_ARM_LINUX_FEATURE2_DGH        UINT32_C(0x00008000)
-	#define CPUINFO_ARM_LINUX_FEATURE2_RNG        UINT32_C(0x00010000)
-	#define CPUINFO_ARM_LINUX_FEATURE2_BTI        UINT32_C(0x00020000)
+	/* HWCAP2 bits past 31 are only reported in the 64-bit auxiliary vector of ARM64 */
+	#define CPUINFO_ARM_LINUX_FEATURE2_DCPODP      UINT64_C(0x0000000000000001)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVE2        UINT64_C(0x0000000000000002)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVEAES      UINT64_C(0x0000000000000004)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVEPMULL    UINT64_C(0x0000000000000008)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVEBITPERM  UINT64_C(0x0000000000000010)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVESHA3     UINT64_C(0x0000000000000020)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVESM4      UINT64_C(0x0000000000000040)
+	#define CPUINFO_ARM_LINUX_FEATURE2_FLAGM2      UINT64_C(0x0000000000000080)
+	#define CPUINFO_ARM_LINUX_FEATURE2_FRINT       UINT64_C(0x0000000000000100)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVEI8MM     UINT64_C(0x0000000000000200)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVEF32MM    UINT64_C(0x0000000000000400)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVEF64MM    UINT64_C(0x0000000000000800)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVEBF16     UINT64_C(0x0000000000001000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_I8MM        UINT64_C(0x0000000000002000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_BF16        UINT64_C(0x0000000000004000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_DGH         UINT64_C(0x0000000000008000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_RNG         UINT64_C(0x0000000000010000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_BTI         UINT64_C(0x0000000000020000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_MTE         UINT64_C(0x0000000000040000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_ECV         UINT64_C(0x0000000000080000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_AFP         UINT64_C(0x0000000000100000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_RPRES       UINT64_C(0x0000000000200000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_MTE3        UINT64_C(0x0000000000400000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SME         UINT64_C(0x0000000000800000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SME_I16I64  UINT64_C(0x0000000001000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SME_F64F64  UINT64_C(0x0000000002000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SME_I8I32   UINT64_C(0x0000000004000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SME_F16F32  UINT64_C(0x0000000008000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SME_B16F32  UINT64_C(0x0000000010000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SME_F32F32  UINT64_C(0x0000000020000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SME_FA64    UINT64_C(0x0000000040000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_WFXT        UINT64_C(0x0000000080000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_EBF16       UINT64_C(0x0000000100000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVE_EBF16   UINT64_C(0x0000000200000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_CSSC        UINT64_C(0x0000000400000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_RPRFM       UINT64_C(0x0000000800000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVE2P1      UINT64_C(0x0000001000000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SME2        UINT64_C(0x0000002000000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SME2P1      UINT64_C(0x0000004000000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SME_I16I32  UINT64_C(0x0000008000000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SME_BI32I32 UINT64_C(0x0000010000000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SME_B16B16  UINT64_C(0x0000020000000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SME_F16F16  UINT64_C(0x0000040000000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_MOPS        UINT64_C(0x0000080000000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_HBC         UINT64_C(0x0000100000000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_SVE_B16B16  UINT64_C(0x0000200000000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_LRCPC3      UINT64_C(0x0000400000000000)
+	#define CPUINFO_ARM_LINUX_FEATURE2_LSE128      UINT64_C(0x0000800000000000)
 #endif
 
 #define CPUINFO_ARM_LINUX_VALID_ARCHITECTURE UINT32_C(0x00010000)
@@ -142,6 +173,7 @@ struct cpuinfo_arm_linux_proc_cpuinfo_cache {
 #define CPUINFO_ARM_LINUX_VALID_REVISION     UINT32_C(0x00100000)
 #define CPUINFO_ARM_LINUX_VALID_PROCESSOR    UINT32_C(0x00200000)
 #define CPUINFO_ARM_LINUX_VALID_FEATURES     UINT32_C(0x00400000)
+#define CPUINFO_ARM_LINUX_VALID_SYSFS_MIDR   UINT32_C(0x00800000)
 #if CPUINFO_ARCH_ARM
 	#define CPUINFO_ARM_LINUX_VALID_ICACHE_SIZE UINT32_C(0x01000000)
 	#define CPUINFO_ARM_LINUX_VALID_ICACHE_SETS UINT32_C(0x02000000)
@@ -173,6 +205,11 @@ struct cpuinfo_arm_linux_processor {
 	 * Main ID Register value.
 	 */
 	uint32_t midr;
+	/**
+	 * Revision ID Register value.
+	 * The value is parsed from /sys/devices/system/cpu/cpu<N>/regs/identification/revidr_el1
+	 */
+	uint32_t revidr;
 	enum cpuinfo_vendor vendor;
 	enum cpuinfo_uarch uarch;
 	uint32_t uarch_index;
@@ -304,14 +341,51 @@ CPUINFO_INTERNAL bool cpuinfo_arm_linux_parse_proc_cpuinfo(
 #elif CPUINFO_ARCH_ARM64
 	CPUINFO_INTERNAL void cpuinfo_arm_linux_hwcap_from_getauxval(
 		uint32_t hwcap[restrict static 1],
-		uint32_t hwcap2[restrict static 1]);
+		uint64_t hwcap2[restrict static 1]);
 
 	CPUINFO_INTERNAL void cpuinfo_arm64_linux_decode_isa_from_proc_cpuinfo(
 		uint32_t features,
-		uint32_t features2,
+		uint64_t features2,
 		uint32_t midr,
 		const struct cpuinfo_arm_chipset chipset[restrict static 1],
 		struct cpuinfo_arm_isa isa[restrict static 1]);
+
+	/* Sanitised ID registers, which Linux exposes to user space by emulating MRS instructions */
+	struct cpuinfo_arm64_id_registers {
+		/* MIDR_EL1 of the core which executes MRS, or 0 if unknown */
+		uint64_t midr_el1;
+		uint64_t id_aa64isar0_el1;
+		uint64_t id_aa64isar1_el1;
+		uint64_t id_aa64isar2_el1;
+		uint64_t id_aa64pfr0_el1;
+		uint64_t id_aa64pfr1_el1;
+		uint64_t id_aa64zfr0_el1;
+		uint64_t id_aa64smfr0_el1;
+	};
+
+	/*
+	 * Reads the ID registers if the kernel reports HWCAP_CPUID in @p features, i.e. traps and emulates MRS reads of
+	 * the ID register space. Returns false without touching the registers otherwise.
+	 */
+	CPUINFO_INTERNAL bool cpuinfo_arm64_linux_read_id_registers(
+		uint32_t features,
+		struct cpuinfo_arm64_id_registers registers[restrict static 1]);
+
+	/*
+	 * Translates the ID register fields into the equivalent HWCAP/HWCAP2 bits, so that older kernels which expose a
+	 * field without the corresponding HWCAP bit still report the feature.
+	 */
+	CPUINFO_INTERNAL void cpuinfo_arm64_linux_decode_isa_from_id_registers(
+		const struct cpuinfo_arm64_id_registers registers[restrict static 1],
+		uint32_t features[restrict static 1],
+		uint64_t features2[restrict static 1]);
+
+	/*
+	 * Detects the SVE vector length and the SME streaming vector length of the calling thread, if @p isa reports
+	 * the respective extension, and stores them in @p isa.
+	 */
+	CPUINFO_INTERNAL void cpuinfo_arm64_linux_detect_vector_lengths(
+		struct cpuinfo_arm_isa isa[restrict static 1]);
 #endif
 
 #ifdef __ANDROID__
@@ -361,6 +435,16 @@ CPUINFO_INTERNAL struct cpuinfo_arm_chipset
 			const char proc_cpuinfo_revision[restrict static CPUINFO_REVISION_VALUE_MAX]);
 #endif
 
+/*
+ * Reads MIDR_EL1 and REVIDR_EL1 of all valid processors from /sys/devices/system/cpu/cpu<N>/regs/identification.
+ * The files are provided by arm64 kernels, including to 32-bit processes. MIDR read from sysfs replaces the value
+ * assembled from /proc/cpuinfo, and processors with a sysfs MIDR get CPUINFO_ARM_LINUX_VALID_SYSFS_MIDR flag.
+ * Returns the number of processors with MIDR read from sysfs.
+ */
+CPUINFO_INTERNAL uint32_t cpuinfo_arm_linux_detect_sysfs_midr(
+	uint32_t max_processors,
+	struct cpuinfo_arm_linux_processor processors[restrict static max_processors]);
+
 CPUINFO_INTERNAL bool cpuinfo_arm_linux_detect_core_clusters_by_heuristic(
 	uint32_t usable_processors,
 	uint32_t max_processors,
@@ -370,6 +454,15 @@ CPUINFO_INTERNAL void cpuinfo_arm_linux_detect_core_clusters_by_sequential_scan(
 	uint32_t max_processors,
 	struct cpuinfo_arm_linux_processor processors[restrict static max_processors]);
 
+/*
+ * Splits core clusters of processors with MIDR read from sysfs so that every cluster has a single MIDR value.
+ * If package_clusters is false, clusters are formed from processors with the same MIDR.
+ */
+CPUINFO_INTERNAL void cpuinfo_arm_linux_detect_core_clusters_by_midr(
+	uint32_t max_processors,
+	bool package_clusters,
+	struct cpuinfo_arm_linux_processor processors[restrict static max_processors]);
+
 CPUINFO_INTERNAL void cpuinfo_arm_linux_count_cluster_processors(
 	uint32_t max_processors,
 	struct cpuinfo_arm_linux_processor processors[restrict static max_processors]);
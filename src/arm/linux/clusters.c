@@ -461,6 +461,50 @@ new_cluster:
 	}
 }
 
+/*
+ * Assigns processors with MIDR read from sysfs into clusters of cores with the same MIDR value.
+ *
+ * Linux reports all cores of a DynamIQ complex as package siblings, even if they have different microarchitectures,
+ * and may not report topology at all. When MIDR of every processor is known from sysfs, no heuristics are needed:
+ * the leader of a cluster is the lowest-numbered processor with the same MIDR (and, if package_clusters is true,
+ * in the same package cluster).
+ *
+ * @param max_processors - number of elements in the @p processors array.
+ * @param package_clusters - whether all usable processors are assigned to package clusters from sysfs siblings lists.
+ * @param[in,out] processors - processor descriptors with pre-parsed POSSIBLE and PRESENT flags, MIDR information,
+ *                             and core cluster (package siblings list) information.
+ */
+void cpuinfo_arm_linux_detect_core_clusters_by_midr(
+	uint32_t max_processors,
+	bool package_clusters,
+	struct cpuinfo_arm_linux_processor processors[restrict static max_processors])
+{
+	const uint32_t cluster_flags = CPUINFO_LINUX_FLAG_VALID | CPUINFO_ARM_LINUX_VALID_SYSFS_MIDR;
+	/* Visit processors in reverse order, so lower-numbered processors still have the original package leader */
+	for (uint32_t i = max_processors; i-- != 0; ) {
+		if (!bitmask_all(processors[i].flags, cluster_flags)) {
+			continue;
+		}
+
+		uint32_t cluster_leader = 0;
+		for (; cluster_leader < i; cluster_leader++) {
+			if (bitmask_all(processors[cluster_leader].flags, cluster_flags) &&
+				processors[cluster_leader].midr == processors[i].midr &&
+				(!package_clusters || processors[cluster_leader].package_leader_id == processors[i].package_leader_id))
+			{
+				break;
+			}
+		}
+
+		if (package_clusters && cluster_leader != processors[i].package_leader_id) {
+			cpuinfo_log_debug("processor %"PRIu32" with MIDR 0x%08"PRIx32" moved from cluster %"PRIu32" to cluster %"PRIu32,
+				i, processors[i].midr, processors[i].package_leader_id, cluster_leader);
+		}
+		processors[i].package_leader_id = cluster_leader;
+		processors[i].flags |= CPUINFO_LINUX_FLAG_PACKAGE_CLUSTER;
+	}
+}
+
 /*
  * Counts the number of logical processors in each core cluster.
  * This function should be called after all processors are assigned to core clusters.
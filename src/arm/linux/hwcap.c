@@ -22,6 +22,21 @@
 	#define AT_HWCAP2 26
 #endif
 
+#if CPUINFO_ARCH_ARM64 && !CPUINFO_MOCK
+	#include <sys/prctl.h>
+
+	/* include/uapi/linux/prctl.h */
+	#ifndef PR_SVE_GET_VL
+		#define PR_SVE_GET_VL 51
+	#endif
+	#ifndef PR_SME_GET_VL
+		#define PR_SME_GET_VL 64
+	#endif
+	#ifndef PR_SVE_VL_LEN_MASK
+		#define PR_SVE_VL_LEN_MASK 0xFFFF
+	#endif
+#endif
+
 
 #if CPUINFO_MOCK
 	static uint32_t mock_hwcap = 0;
@@ -29,10 +44,35 @@
 		mock_hwcap = hwcap;
 	}
 
-	static uint32_t mock_hwcap2 = 0;
-	void cpuinfo_set_hwcap2(uint32_t hwcap2) {
-		mock_hwcap2 = hwcap2;
-	}
+	#if CPUINFO_ARCH_ARM64
+		static uint64_t mock_hwcap2 = 0;
+		void cpuinfo_set_hwcap2(uint64_t hwcap2) {
+			mock_hwcap2 = hwcap2;
+		}
+
+		static uint32_t mock_sve_vector_length = 0;
+		static uint32_t mock_sme_vector_length = 0;
+		void cpuinfo_set_vector_lengths(uint32_t sve_vector_length, uint32_t sme_vector_length) {
+			mock_sve_vector_length = sve_vector_length;
+			mock_sme_vector_length = sme_vector_length;
+		}
+
+		static struct cpuinfo_arm64_id_registers mock_id_registers = { 0 };
+		void cpuinfo_set_id_registers(const struct cpuinfo_mock_id_registers* registers) {
+			mock_id_registers.id_aa64isar0_el1 = registers->id_aa64isar0_el1;
+			mock_id_registers.id_aa64isar1_el1 = registers->id_aa64isar1_el1;
+			mock_id_registers.id_aa64isar2_el1 = registers->id_aa64isar2_el1;
+			mock_id_registers.id_aa64pfr0_el1 = registers->id_aa64pfr0_el1;
+			mock_id_registers.id_aa64pfr1_el1 = registers->id_aa64pfr1_el1;
+			mock_id_registers.id_aa64zfr0_el1 = registers->id_aa64zfr0_el1;
+			mock_id_registers.id_aa64smfr0_el1 = registers->id_aa64smfr0_el1;
+		}
+	#else
+		static uint32_t mock_hwcap2 = 0;
+		void cpuinfo_set_hwcap2(uint32_t hwcap2) {
+			mock_hwcap2 = hwcap2;
+		}
+	#endif
 #endif
 
 
@@ -145,15 +185,94 @@
 #elif CPUINFO_ARCH_ARM64
 	void cpuinfo_arm_linux_hwcap_from_getauxval(
 		uint32_t hwcap[restrict static 1],
-		uint32_t hwcap2[restrict static 1])
+		uint64_t hwcap2[restrict static 1])
 	{
 		#if CPUINFO_MOCK
 			*hwcap  = mock_hwcap;
 			*hwcap2 = mock_hwcap2;
 		#else
 			*hwcap  = (uint32_t) getauxval(AT_HWCAP);
-			*hwcap2 = (uint32_t) getauxval(AT_HWCAP2);
+			*hwcap2 = (uint64_t) getauxval(AT_HWCAP2);
 			return ;
 		#endif
 	}
+
+	#if !CPUINFO_MOCK
+		/* Generic system register names, for assemblers which do not know the ID registers */
+		#define CPUINFO_ARM64_MRS(register_name, value) \
+			__asm__ __volatile__("mrs %0, " register_name : "=r" (value))
+	#endif
+
+	bool cpuinfo_arm64_linux_read_id_registers(
+		uint32_t features,
+		struct cpuinfo_arm64_id_registers registers[restrict static 1])
+	{
+		/* Without HWCAP_CPUID, MRS from the ID registers raises SIGILL */
+		if (!(features & CPUINFO_ARM_LINUX_FEATURE_CPUID)) {
+			return false;
+		}
+
+		#if CPUINFO_MOCK
+			*registers = mock_id_registers;
+		#else
+			CPUINFO_ARM64_MRS("S3_0_C0_C0_0", registers->midr_el1);
+			CPUINFO_ARM64_MRS("S3_0_C0_C6_0", registers->id_aa64isar0_el1);
+			CPUINFO_ARM64_MRS("S3_0_C0_C6_1", registers->id_aa64isar1_el1);
+			CPUINFO_ARM64_MRS("S3_0_C0_C6_2", registers->id_aa64isar2_el1);
+			CPUINFO_ARM64_MRS("S3_0_C0_C4_0", registers->id_aa64pfr0_el1);
+			CPUINFO_ARM64_MRS("S3_0_C0_C4_1", registers->id_aa64pfr1_el1);
+			CPUINFO_ARM64_MRS("S3_0_C0_C4_4", registers->id_aa64zfr0_el1);
+			CPUINFO_ARM64_MRS("S3_0_C0_C4_5", registers->id_aa64smfr0_el1);
+		#endif
+		return true;
+	}
+
+	#if !CPUINFO_MOCK
+		/* RDVL X0, #1 and RDSVL X0, #1, encoded for assemblers without SVE and SME support */
+		static uint32_t read_sve_vector_length(void) {
+			register uint64_t vector_length __asm__("x0");
+			__asm__ __volatile__(".inst 0x04BF5020" : "=r" (vector_length));
+			return (uint32_t) vector_length;
+		}
+
+		/* RDSVL returns the streaming vector length even outside of streaming mode */
+		static uint32_t read_sme_vector_length(void) {
+			register uint64_t vector_length __asm__("x0");
+			__asm__ __volatile__(".inst 0x04BF5820" : "=r" (vector_length));
+			return (uint32_t) vector_length;
+		}
+	#endif
+
+	void cpuinfo_arm64_linux_detect_vector_lengths(
+		struct cpuinfo_arm_isa isa[restrict static 1])
+	{
+		if (isa->sve) {
+			#if CPUINFO_MOCK
+				isa->svelen = mock_sve_vector_length;
+			#else
+				const int result = prctl(PR_SVE_GET_VL, 0, 0, 0, 0);
+				if (result >= 0) {
+					isa->svelen = (uint32_t) result & PR_SVE_VL_LEN_MASK;
+				} else {
+					cpuinfo_log_info("failed to query SVE vector length: %s; reading it with RDVL", strerror(errno));
+					isa->svelen = read_sve_vector_length();
+				}
+			#endif
+			cpuinfo_log_debug("SVE vector length: %"PRIu32" bytes", isa->svelen);
+		}
+		if (isa->sme) {
+			#if CPUINFO_MOCK
+				isa->smelen = mock_sme_vector_length;
+			#else
+				const int result = prctl(PR_SME_GET_VL, 0, 0, 0, 0);
+				if (result >= 0) {
+					isa->smelen = (uint32_t) result & PR_SVE_VL_LEN_MASK;
+				} else {
+					cpuinfo_log_info("failed to query SME streaming vector length: %s; reading it with RDSVL", strerror(errno));
+					isa->smelen = read_sme_vector_length();
+				}
+			#endif
+			cpuinfo_log_debug("SME streaming vector length: %"PRIu32" bytes", isa->smelen);
+		}
+	}
 #endif
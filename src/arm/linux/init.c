@@ -17,8 +17,6 @@
 
 struct cpuinfo_arm_isa cpuinfo_isa = { 0 };
 
-static struct cpuinfo_package package = { { 0 } };
-
 static inline bool bitmask_all(uint32_t bitfield, uint32_t mask) {
 	return (bitfield & mask) == mask;
 }
@@ -101,11 +99,21 @@ static int cmp_arm_linux_processor(const void* ptr_a, const void* ptr_b) {
 	return cmp(id_a, id_b);
 }
 
-void cpuinfo_arm_linux_init(void) {
+/*
+ * Detects the ISA extensions, and unless isa_only is set, the topology of the processors. The detected ISA extensions
+ * are published in cpuinfo_isa only if update_isa is set. Returns true if the ISA extensions are detected.
+ */
+static bool arm_linux_init(bool isa_only, bool update_isa) {
+	bool isa_detected = false;
+	struct cpuinfo_arm_isa isa = { 0 };
+	struct cpuinfo_arena scratch_arena = { NULL, 0 };
+	struct cpuinfo_arena arena = { NULL, 0 };
 	struct cpuinfo_arm_linux_processor* arm_linux_processors = NULL;
 	struct cpuinfo_processor* processors = NULL;
 	struct cpuinfo_core* cores = NULL;
 	struct cpuinfo_cluster* clusters = NULL;
+	struct cpuinfo_package* package = NULL;
+	struct cpuinfo_node* nodes = NULL;
 	struct cpuinfo_uarch_info* uarchs = NULL;
 	struct cpuinfo_cache* l1i = NULL;
 	struct cpuinfo_cache* l1d = NULL;
@@ -137,16 +145,17 @@ void cpuinfo_arm_linux_init(void) {
 	}
 	if ((max_present_processors_count | max_possible_processors_count) == 0) {
 		cpuinfo_log_error("failed to parse both lists of possible and present processors");
-		return;
+		return false;
 	}
 
-	arm_linux_processors = calloc(arm_linux_processors_count, sizeof(struct cpuinfo_arm_linux_processor));
-	if (arm_linux_processors == NULL) {
-		cpuinfo_log_error(
-			"failed to allocate %zu bytes for descriptions of %"PRIu32" ARM logical processors",
-			arm_linux_processors_count * sizeof(struct cpuinfo_arm_linux_processor),
+	/* Temporary descriptions of Linux processors are released together after initialization */
+	const struct cpuinfo_arena_table scratch_tables[] = {
+		{ &arm_linux_processors, arm_linux_processors_count, sizeof(struct cpuinfo_arm_linux_processor) },
+	};
+	if (!cpuinfo_arena_allocate(&scratch_arena, CPUINFO_COUNT_OF(scratch_tables), scratch_tables)) {
+		cpuinfo_log_error("failed to allocate descriptions of %"PRIu32" ARM logical processors",
 			arm_linux_processors_count);
-		return;
+		return false;
 	}
 
 	if (max_possible_processors_count) {
@@ -163,30 +172,52 @@ void cpuinfo_arm_linux_init(void) {
 			CPUINFO_LINUX_FLAG_PRESENT);
 	}
 
+	for (uint32_t i = 0; i < arm_linux_processors_count; i++) {
+		if (bitmask_all(arm_linux_processors[i].flags, valid_processor_mask)) {
+			arm_linux_processors[i].flags |= CPUINFO_LINUX_FLAG_VALID;
+		}
+	}
+
 #if defined(__ANDROID__)
 	struct cpuinfo_android_properties android_properties;
 	cpuinfo_arm_android_parse_properties(&android_properties);
 #else
-	char proc_cpuinfo_hardware[CPUINFO_HARDWARE_VALUE_MAX];
+	char proc_cpuinfo_hardware[CPUINFO_HARDWARE_VALUE_MAX] = { 0 };
 #endif
-	char proc_cpuinfo_revision[CPUINFO_REVISION_VALUE_MAX];
+	char proc_cpuinfo_revision[CPUINFO_REVISION_VALUE_MAX] = { 0 };
 
-	if (!cpuinfo_arm_linux_parse_proc_cpuinfo(
+	const bool proc_cpuinfo_parsed = cpuinfo_arm_linux_parse_proc_cpuinfo(
 #if defined(__ANDROID__)
-			android_properties.proc_cpuinfo_hardware,
+		android_properties.proc_cpuinfo_hardware,
+#else
+		proc_cpuinfo_hardware,
+#endif
+		proc_cpuinfo_revision,
+		arm_linux_processors_count,
+		arm_linux_processors);
+	/* MIDR in sysfs is read from the registers of each processor and takes precedence over /proc/cpuinfo */
+	const uint32_t sysfs_midr_count =
+		cpuinfo_arm_linux_detect_sysfs_midr(arm_linux_processors_count, arm_linux_processors);
+#if CPUINFO_ARCH_ARM64 && !defined(__ANDROID__)
+	/*
+	 * ISA features come from getauxval, so arm64 Linux needs /proc/cpuinfo only for MIDR and for the Hardware and
+	 * Revision lines, which some vendor kernels print for chipset detection.
+	 */
+	const bool proc_cpuinfo_required = sysfs_midr_count == 0;
 #else
-			proc_cpuinfo_hardware,
+	const bool proc_cpuinfo_required = true;
+	(void) sysfs_midr_count;
 #endif
-			proc_cpuinfo_revision,
-			arm_linux_processors_count,
-			arm_linux_processors)) {
-		cpuinfo_log_error("failed to parse processor information from /proc/cpuinfo");
-		return;
+	if (!proc_cpuinfo_parsed) {
+		if (proc_cpuinfo_required) {
+			cpuinfo_log_error("failed to parse processor information from /proc/cpuinfo");
+			goto cleanup;
+		}
+		cpuinfo_log_info("failed to parse /proc/cpuinfo, using MIDR from sysfs");
 	}
 
 	for (uint32_t i = 0; i < arm_linux_processors_count; i++) {
-		if (bitmask_all(arm_linux_processors[i].flags, valid_processor_mask)) {
-			arm_linux_processors[i].flags |= CPUINFO_LINUX_FLAG_VALID;
+		if (bitmask_all(arm_linux_processors[i].flags, CPUINFO_LINUX_FLAG_VALID)) {
 			cpuinfo_log_debug("parsed processor %"PRIu32" MIDR 0x%08"PRIx32,
 				i, arm_linux_processors[i].midr);
 		}
@@ -275,54 +306,83 @@ void cpuinfo_arm_linux_init(void) {
 		cpuinfo_arm_linux_decode_isa_from_proc_cpuinfo(
 			isa_features, isa_features2,
 			last_midr, last_architecture_version, last_architecture_flags,
-			&chipset, &cpuinfo_isa);
+			&chipset, &isa);
 	#elif CPUINFO_ARCH_ARM64
-		uint32_t isa_features = 0, isa_features2 = 0;
+		uint32_t isa_features = 0;
+		uint64_t isa_features2 = 0;
 		/* getauxval is always available on ARM64 Android */
 		cpuinfo_arm_linux_hwcap_from_getauxval(&isa_features, &isa_features2);
-		cpuinfo_arm64_linux_decode_isa_from_proc_cpuinfo(
-			isa_features, isa_features2, last_midr, &chipset, &cpuinfo_isa);
-	#endif
-
-	/* Detect min/max frequency and package ID */
-	for (uint32_t i = 0; i < arm_linux_processors_count; i++) {
-		if (bitmask_all(arm_linux_processors[i].flags, CPUINFO_LINUX_FLAG_VALID)) {
-			const uint32_t max_frequency = cpuinfo_linux_get_processor_max_frequency(i);
-			if (max_frequency != 0) {
-				arm_linux_processors[i].max_frequency = max_frequency;
-				arm_linux_processors[i].flags |= CPUINFO_LINUX_FLAG_MAX_FREQUENCY;
-			}
-
-			const uint32_t min_frequency = cpuinfo_linux_get_processor_min_frequency(i);
-			if (min_frequency != 0) {
-				arm_linux_processors[i].min_frequency = min_frequency;
-				arm_linux_processors[i].flags |= CPUINFO_LINUX_FLAG_MIN_FREQUENCY;
+		struct cpuinfo_arm64_id_registers id_registers;
+		if (cpuinfo_arm64_linux_read_id_registers(isa_features, &id_registers)) {
+			cpuinfo_log_debug("ID_AA64ISAR0_EL1 = 0x%016"PRIx64", ID_AA64ISAR1_EL1 = 0x%016"PRIx64", ID_AA64ISAR2_EL1 = 0x%016"PRIx64,
+				id_registers.id_aa64isar0_el1, id_registers.id_aa64isar1_el1, id_registers.id_aa64isar2_el1);
+			cpuinfo_log_debug("ID_AA64PFR0_EL1 = 0x%016"PRIx64", ID_AA64PFR1_EL1 = 0x%016"PRIx64", ID_AA64ZFR0_EL1 = 0x%016"PRIx64
+				", ID_AA64SMFR0_EL1 = 0x%016"PRIx64,
+				id_registers.id_aa64pfr0_el1, id_registers.id_aa64pfr1_el1,
+				id_registers.id_aa64zfr0_el1, id_registers.id_aa64smfr0_el1);
+
+			const uint32_t hwcap_features = isa_features;
+			const uint64_t hwcap_features2 = isa_features2;
+			cpuinfo_arm64_linux_decode_isa_from_id_registers(&id_registers, &isa_features, &isa_features2);
+			if ((isa_features & ~hwcap_features) | (isa_features2 & ~hwcap_features2)) {
+				cpuinfo_log_debug("ID registers report features 0x%08"PRIx32" and 0x%016"PRIx64" missing in HWCAP and HWCAP2",
+					isa_features & ~hwcap_features, isa_features2 & ~hwcap_features2);
 			}
-
-			if (cpuinfo_linux_get_processor_package_id(i, &arm_linux_processors[i].package_id)) {
-				arm_linux_processors[i].flags |= CPUINFO_LINUX_FLAG_PACKAGE_ID;
+		}
+		cpuinfo_arm64_linux_decode_isa_from_proc_cpuinfo(
+			isa_features, isa_features2, last_midr, &chipset, &isa);
+		if (!isa.fp16arith) {
+			const uint32_t fp16arith_mask = CPUINFO_ARM_LINUX_FEATURE_FPHP | CPUINFO_ARM_LINUX_FEATURE_ASIMDHP;
+			if ((isa_features & fp16arith_mask) == CPUINFO_ARM_LINUX_FEATURE_FPHP) {
+				cpuinfo_log_warning("FP16 arithmetics disabled: detected support only for scalar operations");
+			} else if ((isa_features & fp16arith_mask) == CPUINFO_ARM_LINUX_FEATURE_ASIMDHP) {
+				cpuinfo_log_warning("FP16 arithmetics disabled: detected support only for SIMD operations");
 			}
 		}
+		cpuinfo_arm64_linux_detect_vector_lengths(&isa);
+	#endif
+	if (update_isa) {
+		cpuinfo_isa = isa;
+	}
+	isa_detected = true;
+	if (isa_only) {
+		goto cleanup;
 	}
 
+	/* Detect min/max frequency and package ID */
+	const struct cpuinfo_linux_processor_field processor_fields[] = {
+		{
+			cpuinfo_linux_processor_attribute_max_frequency,
+			&arm_linux_processors->max_frequency,
+			CPUINFO_LINUX_FLAG_MAX_FREQUENCY,
+		},
+		{
+			cpuinfo_linux_processor_attribute_min_frequency,
+			&arm_linux_processors->min_frequency,
+			CPUINFO_LINUX_FLAG_MIN_FREQUENCY,
+		},
+		{
+			cpuinfo_linux_processor_attribute_package_id,
+			&arm_linux_processors->package_id,
+			CPUINFO_LINUX_FLAG_PACKAGE_ID,
+		},
+	};
+	cpuinfo_linux_read_processor_attributes(
+		arm_linux_processors_count, &arm_linux_processors->flags,
+		sizeof(struct cpuinfo_arm_linux_processor), CPUINFO_LINUX_FLAG_VALID,
+		CPUINFO_COUNT_OF(processor_fields), processor_fields);
+
 	/* Initialize topology group IDs */
 	for (uint32_t i = 0; i < arm_linux_processors_count; i++) {
 		arm_linux_processors[i].package_leader_id = i;
 	}
 
 	/* Propagate topology group IDs among siblings */
-	for (uint32_t i = 0; i < arm_linux_processors_count; i++) {
-		if (!bitmask_all(arm_linux_processors[i].flags, CPUINFO_LINUX_FLAG_VALID)) {
-			continue;
-		}
-
-		if (arm_linux_processors[i].flags & CPUINFO_LINUX_FLAG_PACKAGE_ID) {
-			cpuinfo_linux_detect_core_siblings(
-				arm_linux_processors_count, i,
-				(cpuinfo_siblings_callback) cluster_siblings_parser,
-				arm_linux_processors);
-		}
-	}
+	cpuinfo_linux_detect_all_core_siblings(
+		arm_linux_processors_count, &arm_linux_processors->flags,
+		sizeof(struct cpuinfo_arm_linux_processor), CPUINFO_LINUX_FLAG_VALID | CPUINFO_LINUX_FLAG_PACKAGE_ID,
+		(cpuinfo_siblings_callback) cluster_siblings_parser,
+		arm_linux_processors);
 
 	/* Propagate all cluster IDs */
 	uint32_t clustered_processors = 0;
@@ -340,7 +400,18 @@ void cpuinfo_arm_linux_init(void) {
 		}
 	}
 
-	if (clustered_processors != valid_processors) {
+	uint32_t sysfs_midr_processors = 0;
+	for (uint32_t i = 0; i < arm_linux_processors_count; i++) {
+		if (bitmask_all(arm_linux_processors[i].flags, CPUINFO_LINUX_FLAG_VALID | CPUINFO_ARM_LINUX_VALID_SYSFS_MIDR)) {
+			sysfs_midr_processors += 1;
+		}
+	}
+
+	if (sysfs_midr_processors == valid_processors) {
+		/* MIDR of every processor is known: split package clusters, or form clusters if topology is unknown */
+		cpuinfo_arm_linux_detect_core_clusters_by_midr(
+			arm_linux_processors_count, clustered_processors == valid_processors, arm_linux_processors);
+	} else if (clustered_processors != valid_processors) {
 		/*
 		 * Topology information about some or all logical processors may be unavailable, for the following reasons:
 		 * - Linux kernel is too old, or configured without support for topology information in sysfs.
@@ -415,81 +486,85 @@ void cpuinfo_arm_linux_init(void) {
 		}
 	}
 
-	/*
-	 * Assumptions:
-	 * - No SMP (i.e. each core supports only one hardware thread).
-	 * - Level 1 instruction and data caches are private to the core clusters.
-	 * - Level 2 and level 3 cache is shared between cores in the same cluster.
-	 */
-	cpuinfo_arm_chipset_to_string(&chipset, package.name);
-	package.processor_count = valid_processors;
-	package.core_count = valid_processors;
-	package.cluster_count = cluster_count;
-
-	processors = calloc(valid_processors, sizeof(struct cpuinfo_processor));
-	if (processors == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" logical processors",
-			valid_processors * sizeof(struct cpuinfo_processor), valid_processors);
-		goto cleanup;
-	}
-
-	cores = calloc(valid_processors, sizeof(struct cpuinfo_core));
-	if (cores == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" cores",
-			valid_processors * sizeof(struct cpuinfo_core), valid_processors);
-		goto cleanup;
-	}
-
-	clusters = calloc(cluster_count, sizeof(struct cpuinfo_cluster));
-	if (clusters == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" core clusters",
-			cluster_count * sizeof(struct cpuinfo_cluster), cluster_count);
-		goto cleanup;
-	}
-
-	uarchs = calloc(uarchs_count, sizeof(struct cpuinfo_uarch_info));
-	if (uarchs == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" microarchitectures",
-			uarchs_count * sizeof(struct cpuinfo_uarch_info), uarchs_count);
-		goto cleanup;
-	}
-
-	linux_cpu_to_processor_map = calloc(arm_linux_processors_count, sizeof(struct cpuinfo_processor*));
-	if (linux_cpu_to_processor_map == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for %"PRIu32" logical processor mapping entries",
-			arm_linux_processors_count * sizeof(struct cpuinfo_processor*), arm_linux_processors_count);
-		goto cleanup;
-	}
+	/* Count L2 and L3 caches before allocating the tables */
+	uint32_t l2_count = 0, l3_count = 0, big_l3_size = 0, cluster_id = UINT32_MAX;
+	/* Indication whether L3 (if it exists) is shared between all cores */
+	bool shared_l3 = true;
+	for (uint32_t i = 0; i < valid_processors; i++) {
+		if (arm_linux_processors[i].package_leader_id == arm_linux_processors[i].system_processor_id) {
+			cluster_id += 1;
+		}
 
-	linux_cpu_to_core_map = calloc(arm_linux_processors_count, sizeof(struct cpuinfo_core*));
-	if (linux_cpu_to_core_map == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for %"PRIu32" core mapping entries",
-			arm_linux_processors_count * sizeof(struct cpuinfo_core*), arm_linux_processors_count);
-		goto cleanup;
-	}
+		struct cpuinfo_cache dummy_l1i, dummy_l1d, temp_l2 = { 0 }, temp_l3 = { 0 };
+		cpuinfo_arm_decode_cache(
+			arm_linux_processors[i].uarch,
+			arm_linux_processors[i].package_processor_count,
+			arm_linux_processors[i].midr,
+			&chipset,
+			cluster_id,
+			arm_linux_processors[i].architecture_version,
+			&dummy_l1i, &dummy_l1d, &temp_l2, &temp_l3);
 
-	if (uarchs_count > 1) {
-		linux_cpu_to_uarch_index_map = calloc(arm_linux_processors_count, sizeof(uint32_t));
-		if (linux_cpu_to_uarch_index_map == NULL) {
-			cpuinfo_log_error("failed to allocate %zu bytes for %"PRIu32" uarch index mapping entries",
-				arm_linux_processors_count * sizeof(uint32_t), arm_linux_processors_count);
-			goto cleanup;
+		if (temp_l3.size != 0) {
+			/*
+			 * Assumptions:
+			 * - L2 is private to each core
+			 * - L3 is shared by cores in the same cluster
+			 * - If cores in different clusters report the same L3, it is shared between all cores.
+			 */
+			l2_count += 1;
+			if (arm_linux_processors[i].package_leader_id == arm_linux_processors[i].system_processor_id) {
+				if (cluster_id == 0) {
+					big_l3_size = temp_l3.size;
+					l3_count = 1;
+				} else if (temp_l3.size != big_l3_size) {
+					/* If some cores have different L3 size, L3 is not shared between all cores */
+					shared_l3 = false;
+					l3_count += 1;
+				}
+			}
+		} else {
+			/* If some cores don't have L3 cache, L3 is not shared between all cores */
+			shared_l3 = false;
+			if (temp_l2.size != 0) {
+				/* Assume L2 is shared by cores in the same cluster */
+				if (arm_linux_processors[i].package_leader_id == arm_linux_processors[i].system_processor_id) {
+					l2_count += 1;
+				}
+			}
 		}
 	}
 
-	l1i = calloc(valid_processors, sizeof(struct cpuinfo_cache));
-	if (l1i == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" L1I caches",
-			valid_processors * sizeof(struct cpuinfo_cache), valid_processors);
+	/* All published tables share one arena, in the order in which lookups traverse them */
+	const struct cpuinfo_arena_table tables[] = {
+		{ &processors, valid_processors, sizeof(struct cpuinfo_processor) },
+		{ &cores, valid_processors, sizeof(struct cpuinfo_core) },
+		{ &clusters, cluster_count, sizeof(struct cpuinfo_cluster) },
+		{ &package, 1, sizeof(struct cpuinfo_package) },
+		{ &l1i, valid_processors, sizeof(struct cpuinfo_cache) },
+		{ &l1d, valid_processors, sizeof(struct cpuinfo_cache) },
+		{ &l2, l2_count, sizeof(struct cpuinfo_cache) },
+		{ &l3, l3_count, sizeof(struct cpuinfo_cache) },
+		{ &uarchs, uarchs_count, sizeof(struct cpuinfo_uarch_info) },
+		{ &linux_cpu_to_processor_map, arm_linux_processors_count, sizeof(struct cpuinfo_processor*) },
+		{ &linux_cpu_to_core_map, arm_linux_processors_count, sizeof(struct cpuinfo_core*) },
+		{ &linux_cpu_to_uarch_index_map, uarchs_count > 1 ? arm_linux_processors_count : 0, sizeof(uint32_t) },
+	};
+	if (!cpuinfo_arena_allocate(&arena, CPUINFO_COUNT_OF(tables), tables)) {
+		cpuinfo_log_error("failed to allocate descriptions of %"PRIu32" logical processors", valid_processors);
 		goto cleanup;
 	}
 
-	l1d = calloc(valid_processors, sizeof(struct cpuinfo_cache));
-	if (l1d == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" L1D caches",
-			valid_processors * sizeof(struct cpuinfo_cache), valid_processors);
-		goto cleanup;
-	}
+	/*
+	 * Assumptions:
+	 * - No SMP (i.e. each core supports only one hardware thread).
+	 * - Level 1 instruction and data caches are private to the core clusters.
+	 * - Level 2 and level 3 cache is shared between cores in the same cluster.
+	 */
+	cpuinfo_arm_chipset_to_string(&chipset, package->name);
+	package->processor_count = valid_processors;
+	package->core_count = valid_processors;
+	package->cluster_count = cluster_count;
 
 	uint32_t uarchs_index = 0;
 	for (uint32_t i = 0; i < arm_linux_processors_count; i++) {
@@ -507,9 +582,7 @@ void cpuinfo_arm_linux_init(void) {
 		}
 	}
 
-	uint32_t l2_count = 0, l3_count = 0, big_l3_size = 0, cluster_id = UINT32_MAX;
-	/* Indication whether L3 (if it exists) is shared between all cores */
-	bool shared_l3 = true;
+	cluster_id = UINT32_MAX;
 	/* Populate cache information structures in l1i, l1d */
 	for (uint32_t i = 0; i < valid_processors; i++) {
 		if (arm_linux_processors[i].package_leader_id == arm_linux_processors[i].system_processor_id) {
@@ -520,7 +593,7 @@ void cpuinfo_arm_linux_init(void) {
 				.core_start = i,
 				.core_count = arm_linux_processors[i].package_processor_count,
 				.cluster_id = cluster_id,
-				.package = &package,
+				.package = package,
 				.vendor = arm_linux_processors[i].vendor,
 				.uarch = arm_linux_processors[i].uarch,
 				.midr = arm_linux_processors[i].midr,
@@ -530,7 +603,7 @@ void cpuinfo_arm_linux_init(void) {
 		processors[i].smt_id = 0;
 		processors[i].core = cores + i;
 		processors[i].cluster = clusters + cluster_id;
-		processors[i].package = &package;
+		processors[i].package = package;
 		processors[i].linux_id = (int) arm_linux_processors[i].system_processor_id;
 		processors[i].cache.l1i = l1i + i;
 		processors[i].cache.l1d = l1d + i;
@@ -540,7 +613,7 @@ void cpuinfo_arm_linux_init(void) {
 		cores[i].processor_count = 1;
 		cores[i].core_id = i;
 		cores[i].cluster = clusters + cluster_id;
-		cores[i].package = &package;
+		cores[i].package = package;
 		cores[i].vendor = arm_linux_processors[i].vendor;
 		cores[i].uarch = arm_linux_processors[i].uarch;
 		cores[i].midr = arm_linux_processors[i].midr;
@@ -584,53 +657,6 @@ void cpuinfo_arm_linux_init(void) {
 				};
 			}
 		#endif
-
-		if (temp_l3.size != 0) {
-			/*
-			 * Assumptions:
-			 * - L2 is private to each core
-			 * - L3 is shared by cores in the same cluster
-			 * - If cores in different clusters report the same L3, it is shared between all cores.
-			 */
-			l2_count += 1;
-			if (arm_linux_processors[i].package_leader_id == arm_linux_processors[i].system_processor_id) {
-				if (cluster_id == 0) {
-					big_l3_size = temp_l3.size;
-					l3_count = 1;
-				} else if (temp_l3.size != big_l3_size) {
-					/* If some cores have different L3 size, L3 is not shared between all cores */
-					shared_l3 = false;
-					l3_count += 1;
-				}
-			}
-		} else {
-			/* If some cores don't have L3 cache, L3 is not shared between all cores */
-			shared_l3 = false;
-			if (temp_l2.size != 0) {
-				/* Assume L2 is shared by cores in the same cluster */
-				if (arm_linux_processors[i].package_leader_id == arm_linux_processors[i].system_processor_id) {
-					l2_count += 1;
-				}
-			}
-		}
-	}
-
-	if (l2_count != 0) {
-		l2 = calloc(l2_count, sizeof(struct cpuinfo_cache));
-		if (l2 == NULL) {
-			cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" L2 caches",
-				l2_count * sizeof(struct cpuinfo_cache), l2_count);
-			goto cleanup;
-		}
-
-		if (l3_count != 0) {
-			l3 = calloc(l3_count, sizeof(struct cpuinfo_cache));
-			if (l3 == NULL) {
-				cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" L3 caches",
-					l3_count * sizeof(struct cpuinfo_cache), l3_count);
-				goto cleanup;
-			}
-		}
 	}
 
 	cluster_id = UINT32_MAX;
@@ -709,11 +735,20 @@ void cpuinfo_arm_linux_init(void) {
 		}
 	}
 
+	uint32_t nodes_count = 0;
+	if (!cpuinfo_linux_detect_nodes(arm_linux_processors_count, valid_processors, processors, valid_processors, cores,
+		&nodes, &nodes_count))
+	{
+		cpuinfo_log_error("failed to detect NUMA nodes");
+		goto cleanup;
+	}
+
 	/* Commit */
 	cpuinfo_processors = processors;
 	cpuinfo_cores = cores;
 	cpuinfo_clusters = clusters;
-	cpuinfo_packages = &package;
+	cpuinfo_packages = package;
+	cpuinfo_nodes = nodes;
 	cpuinfo_uarchs = uarchs;
 	cpuinfo_cache[cpuinfo_cache_level_1i] = l1i;
 	cpuinfo_cache[cpuinfo_cache_level_1d] = l1d;
@@ -724,6 +759,7 @@ void cpuinfo_arm_linux_init(void) {
 	cpuinfo_cores_count = valid_processors;
 	cpuinfo_clusters_count = cluster_count;
 	cpuinfo_packages_count = 1;
+	cpuinfo_nodes_count = nodes_count;
 	cpuinfo_uarchs_count = uarchs_count;
 	cpuinfo_cache_count[cpuinfo_cache_level_1i] = valid_processors;
 	cpuinfo_cache_count[cpuinfo_cache_level_1d] = valid_processors;
@@ -735,31 +771,54 @@ void cpuinfo_arm_linux_init(void) {
 	cpuinfo_linux_cpu_to_processor_map = linux_cpu_to_processor_map;
 	cpuinfo_linux_cpu_to_core_map = linux_cpu_to_core_map;
 	cpuinfo_linux_cpu_to_uarch_index_map = linux_cpu_to_uarch_index_map;
+	cpuinfo_tables_arena = arena;
 
 	__sync_synchronize();
 
 	cpuinfo_is_initialized = true;
 
-	processors = NULL;
-	cores = NULL;
-	clusters = NULL;
-	uarchs = NULL;
-	l1i = l1d = l2 = l3 = NULL;
-	linux_cpu_to_processor_map = NULL;
-	linux_cpu_to_core_map = NULL;
-	linux_cpu_to_uarch_index_map = NULL;
+	arena = (struct cpuinfo_arena) { NULL, 0 };
+	nodes = NULL;
 
 cleanup:
-	free(arm_linux_processors);
-	free(processors);
-	free(cores);
-	free(clusters);
-	free(uarchs);
-	free(l1i);
-	free(l1d);
-	free(l2);
-	free(l3);
-	free(linux_cpu_to_processor_map);
-	free(linux_cpu_to_core_map);
-	free(linux_cpu_to_uarch_index_map);
+	cpuinfo_arena_free(&scratch_arena);
+	cpuinfo_arena_free(&arena);
+	free(nodes);
+	return isa_detected;
+}
+
+void cpuinfo_arm_linux_init(bool update_isa) {
+	arm_linux_init(false, update_isa);
+}
+
+bool cpuinfo_arm_linux_init_isa(void) {
+	return arm_linux_init(true, true);
+}
+
+bool cpuinfo_arm_linux_probe_isa(struct cpuinfo_arm_isa isa[restrict static 1]) {
+#if CPUINFO_ARCH_ARM64
+	/*
+	 * Without /proc/cpuinfo and sysfs, only the MIDR of the current core is known, and only if the kernel emulates
+	 * MRS reads of ID registers. The chipset is unknown, so no chipset-specific workarounds apply.
+	 */
+	uint32_t isa_features = 0;
+	uint64_t isa_features2 = 0;
+	cpuinfo_arm_linux_hwcap_from_getauxval(&isa_features, &isa_features2);
+	uint32_t midr = 0;
+	struct cpuinfo_arm64_id_registers id_registers;
+	if (cpuinfo_arm64_linux_read_id_registers(isa_features, &id_registers)) {
+		midr = (uint32_t) id_registers.midr_el1;
+		cpuinfo_arm64_linux_decode_isa_from_id_registers(&id_registers, &isa_features, &isa_features2);
+	}
+	const struct cpuinfo_arm_chipset chipset = {
+		.vendor = cpuinfo_arm_chipset_vendor_unknown,
+		.series = cpuinfo_arm_chipset_series_unknown,
+	};
+	*isa = (struct cpuinfo_arm_isa) { 0 };
+	cpuinfo_arm64_linux_decode_isa_from_proc_cpuinfo(isa_features, isa_features2, midr, &chipset, isa);
+	return true;
+#else
+	/* AArch32 decoding depends on the architecture version reported only in /proc/cpuinfo */
+	return false;
+#endif
 }
@@ -1,5 +1,6 @@
 #include <stdint.h>
 #include <stddef.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -11,6 +12,7 @@
 #include <arm/api.h>
 #include <arm/midr.h>
 #include <linux/api.h>
+#include <cpuinfo/arena.h>
 #include <cpuinfo/internal-api.h>
 #include <cpuinfo/log.h>
 #include <cpuinfo/common.h>
@@ -861,3 +863,147 @@ uint32_t cpuinfo_arm_linux_detect_cluster_midr(
 	}
 	return clusters_count;
 }
+
+/* Size of buffer for "0x0000000000000000\n" identification register values */
+#define ID_REGISTER_BUFFER_SIZE 32
+
+/*
+ * Parses a hexadecimal value of a 64-bit identification register, as formatted by the arm64 kernel in
+ * /sys/devices/system/cpu/cpu<N>/regs/identification. The reserved upper half of MIDR_EL1 and REVIDR_EL1 is ignored.
+ */
+static bool parse_id_register(const struct cpuinfo_linux_sysfs_file file[restrict static 1], uint32_t value[restrict static 1]) {
+	if (file->size <= 2 || (size_t) file->size == file->buffer_size) {
+		return false;
+	}
+
+	const char* text = file->buffer;
+	const char* text_end = file->buffer + file->size;
+	if (text[0] != '0' || (text[1] != 'x' && text[1] != 'X')) {
+		return false;
+	}
+
+	uint64_t register_value = 0;
+	const char* digit_ptr = text + 2;
+	for (; digit_ptr != text_end; digit_ptr++) {
+		const char digit_char = *digit_ptr;
+		uint32_t digit;
+		if (digit_char >= '0' && digit_char <= '9') {
+			digit = digit_char - '0';
+		} else if ((uint32_t) (digit_char - 'a') < 6) {
+			digit = 10 + (digit_char - 'a');
+		} else if ((uint32_t) (digit_char - 'A') < 6) {
+			digit = 10 + (digit_char - 'A');
+		} else {
+			break;
+		}
+		if (register_value >> 60 != 0) {
+			return false;
+		}
+		register_value = register_value * 16 + digit;
+	}
+	if (digit_ptr == text + 2) {
+		return false;
+	}
+	for (; digit_ptr != text_end; digit_ptr++) {
+		if (*digit_ptr != '\n') {
+			return false;
+		}
+	}
+
+	*value = (uint32_t) register_value;
+	return true;
+}
+
+uint32_t cpuinfo_arm_linux_detect_sysfs_midr(
+	uint32_t max_processors,
+	struct cpuinfo_arm_linux_processor processors[restrict static max_processors])
+{
+	uint32_t valid_processors = 0;
+	for (uint32_t i = 0; i < max_processors; i++) {
+		if (bitmask_all(processors[i].flags, CPUINFO_LINUX_FLAG_VALID)) {
+			valid_processors += 1;
+		}
+	}
+	if (valid_processors == 0) {
+		return 0;
+	}
+
+	/* Two files per processor: midr_el1 and revidr_el1 */
+	const uint32_t files_count = 2 * valid_processors;
+	struct cpuinfo_arena arena = { NULL, 0 };
+	struct cpuinfo_linux_sysfs_file* files = NULL;
+	char* buffers = NULL;
+	const struct cpuinfo_arena_table tables[] = {
+		{ &files, files_count, sizeof(struct cpuinfo_linux_sysfs_file) },
+		{ &buffers, files_count, ID_REGISTER_BUFFER_SIZE },
+	};
+	if (!cpuinfo_arena_allocate(&arena, CPUINFO_COUNT_OF(tables), tables)) {
+		cpuinfo_log_error("failed to allocate buffers for identification registers of %"PRIu32" processors",
+			valid_processors);
+		return 0;
+	}
+
+	uint32_t file_index = 0;
+	for (uint32_t i = 0; i < max_processors; i++) {
+		if (bitmask_all(processors[i].flags, CPUINFO_LINUX_FLAG_VALID)) {
+			snprintf(files[file_index].path, CPUINFO_LINUX_SYSFS_PATH_MAX,
+				"cpu%"PRIu32"/regs/identification/midr_el1", i);
+			snprintf(files[file_index + 1].path, CPUINFO_LINUX_SYSFS_PATH_MAX,
+				"cpu%"PRIu32"/regs/identification/revidr_el1", i);
+			for (uint32_t j = file_index; j < file_index + 2; j++) {
+				files[j].buffer = &buffers[j * ID_REGISTER_BUFFER_SIZE];
+				files[j].buffer_size = ID_REGISTER_BUFFER_SIZE;
+			}
+			file_index += 2;
+		}
+	}
+
+	cpuinfo_linux_read_sysfs_files(files_count, files);
+
+	uint32_t sysfs_midr_processors = 0;
+	file_index = 0;
+	for (uint32_t i = 0; i < max_processors; i++) {
+		if (!bitmask_all(processors[i].flags, CPUINFO_LINUX_FLAG_VALID)) {
+			continue;
+		}
+
+		const struct cpuinfo_linux_sysfs_file* midr_file = &files[file_index];
+		const struct cpuinfo_linux_sysfs_file* revidr_file = &files[file_index + 1];
+		file_index += 2;
+
+		uint32_t midr = 0;
+		if (!parse_id_register(midr_file, &midr)) {
+			/* Offline processors and kernels before 4.11 do not provide identification registers */
+			if (midr_file->size > 0) {
+				cpuinfo_log_info("failed to parse MIDR for processor %"PRIu32" from %s: \"%.*s\"",
+					i, midr_file->path, (int) midr_file->size, midr_file->buffer);
+			}
+			continue;
+		}
+		if (parse_id_register(revidr_file, &processors[i].revidr)) {
+			cpuinfo_log_debug("parsed REVIDR 0x%08"PRIx32" for processor %"PRIu32" from %s",
+				processors[i].revidr, i, revidr_file->path);
+		}
+
+		if (bitmask_all(processors[i].flags, CPUINFO_ARM_LINUX_VALID_MIDR) && processors[i].midr != midr) {
+			cpuinfo_log_info("MIDR 0x%08"PRIx32" for processor %"PRIu32" in sysfs overrides MIDR 0x%08"PRIx32" in /proc/cpuinfo",
+				midr, i, processors[i].midr);
+		}
+		processors[i].midr = midr;
+		processors[i].flags |= CPUINFO_ARM_LINUX_VALID_SYSFS_MIDR | CPUINFO_ARM_LINUX_VALID_IMPLEMENTER |
+			CPUINFO_ARM_LINUX_VALID_VARIANT | CPUINFO_ARM_LINUX_VALID_PART | CPUINFO_ARM_LINUX_VALID_REVISION |
+			CPUINFO_ARM_LINUX_VALID_PROCESSOR;
+#if CPUINFO_ARCH_ARM64
+		/* On AArch64 the architecture field is always 0xF, and /proc/cpuinfo reports architecture 8 */
+		if (!(processors[i].flags & CPUINFO_ARM_LINUX_VALID_ARCHITECTURE)) {
+			processors[i].architecture_version = 8;
+			processors[i].flags |= CPUINFO_ARM_LINUX_VALID_ARCHITECTURE;
+		}
+#endif
+		cpuinfo_log_debug("parsed MIDR 0x%08"PRIx32" for processor %"PRIu32" from %s", midr, i, midr_file->path);
+		sysfs_midr_processors += 1;
+	}
+
+	cpuinfo_arena_free(&arena);
+	return sysfs_midr_processors;
+}
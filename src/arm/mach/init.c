@@ -594,6 +594,8 @@ void cpuinfo_arm_mach_init(void) {
 	cpuinfo_cache_count[cpuinfo_cache_level_2]  = l2_count;
 	cpuinfo_cache_count[cpuinfo_cache_level_3]  = l3_count;
 	cpuinfo_max_cache_size = cpuinfo_compute_max_cache_size(&processors[0]);
+	cpuinfo_update_isa_features();
+	cpuinfo_update_topology();
 
 	__sync_synchronize();
 
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <cpuinfo/common.h>
+
+
+/* Tables in an arena start at cache line boundaries */
+#define CPUINFO_ARENA_ALIGNMENT 64
+
+/* A single allocation that holds several tables, which are all released at once */
+struct cpuinfo_arena {
+	void* base;
+	size_t size;
+};
+
+/* A table in an arena: the arena stores the address of the table in the pointer variable at the given address */
+struct cpuinfo_arena_table {
+	void* pointer;
+	size_t count;
+	size_t element_size;
+};
+
+/*
+ * Allocates zero-initialized tables with the counts and element sizes from a counting pass in a single arena.
+ * Tables with zero elements get NULL pointers. On failure, the function leaves the arena empty and returns false.
+ */
+CPUINFO_INTERNAL bool cpuinfo_arena_allocate(
+	struct cpuinfo_arena arena[restrict static 1],
+	size_t tables_count,
+	const struct cpuinfo_arena_table tables[restrict static tables_count]);
+
+CPUINFO_INTERNAL void cpuinfo_arena_free(struct cpuinfo_arena arena[restrict static 1]);
@@ -8,6 +8,7 @@
 #endif
 
 #include <cpuinfo.h>
+#include <cpuinfo/arena.h>
 #include <cpuinfo/common.h>
 
 
@@ -26,21 +27,42 @@ extern CPUINFO_INTERNAL struct cpuinfo_processor* cpuinfo_processors;
 extern CPUINFO_INTERNAL struct cpuinfo_core* cpuinfo_cores;
 extern CPUINFO_INTERNAL struct cpuinfo_cluster* cpuinfo_clusters;
 extern CPUINFO_INTERNAL struct cpuinfo_package* cpuinfo_packages;
+extern CPUINFO_INTERNAL struct cpuinfo_die* cpuinfo_dies;
+extern CPUINFO_INTERNAL struct cpuinfo_node* cpuinfo_nodes;
 extern CPUINFO_INTERNAL struct cpuinfo_cache* cpuinfo_cache[cpuinfo_cache_level_max];
 
 extern CPUINFO_INTERNAL uint32_t cpuinfo_processors_count;
 extern CPUINFO_INTERNAL uint32_t cpuinfo_cores_count;
 extern CPUINFO_INTERNAL uint32_t cpuinfo_clusters_count;
 extern CPUINFO_INTERNAL uint32_t cpuinfo_packages_count;
+extern CPUINFO_INTERNAL uint32_t cpuinfo_dies_count;
+extern CPUINFO_INTERNAL uint32_t cpuinfo_nodes_count;
 extern CPUINFO_INTERNAL uint32_t cpuinfo_cache_count[cpuinfo_cache_level_max];
 extern CPUINFO_INTERNAL uint32_t cpuinfo_max_cache_size;
 
+/* Arena with the detected tables, or an empty arena if the tables are not allocated in an arena */
+extern CPUINFO_INTERNAL struct cpuinfo_arena cpuinfo_tables_arena;
+
+extern CPUINFO_INTERNAL const struct cpuinfo_processor** cpuinfo_usable_processors;
+extern CPUINFO_INTERNAL const struct cpuinfo_core** cpuinfo_usable_cores;
+extern CPUINFO_INTERNAL const struct cpuinfo_cluster** cpuinfo_usable_clusters;
+extern CPUINFO_INTERNAL const struct cpuinfo_package** cpuinfo_usable_packages;
+
+extern CPUINFO_INTERNAL uint32_t cpuinfo_usable_processors_count;
+extern CPUINFO_INTERNAL uint32_t cpuinfo_usable_cores_count;
+extern CPUINFO_INTERNAL uint32_t cpuinfo_usable_clusters_count;
+extern CPUINFO_INTERNAL uint32_t cpuinfo_usable_packages_count;
+
 #if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 	extern CPUINFO_INTERNAL struct cpuinfo_uarch_info* cpuinfo_uarchs;
 	extern CPUINFO_INTERNAL uint32_t cpuinfo_uarchs_count;
 #elif CPUINFO_ARCH_LOONGARCH64
 	extern CPUINFO_INTERNAL struct cpuinfo_uarch_info* cpuinfo_uarchs;
 	extern CPUINFO_INTERNAL uint32_t cpuinfo_uarchs_count;
+#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	extern CPUINFO_INTERNAL struct cpuinfo_uarch_info cpuinfo_global_uarch;
+	extern CPUINFO_INTERNAL struct cpuinfo_uarch_info* cpuinfo_uarchs;
+	extern CPUINFO_INTERNAL uint32_t cpuinfo_uarchs_count;
 #else
 	extern CPUINFO_INTERNAL struct cpuinfo_uarch_info cpuinfo_global_uarch;
 #endif
@@ -52,15 +74,49 @@ extern CPUINFO_INTERNAL uint32_t cpuinfo_max_cache_size;
 #endif
 
 CPUINFO_PRIVATE void cpuinfo_x86_mach_init(void);
-CPUINFO_PRIVATE void cpuinfo_x86_linux_init(void);
+/*
+ * Linux initialization of the topology also detects the ISA extensions, unless update_isa is false because the ISA
+ * tier already published cpuinfo_isa, which other threads may read without locks.
+ */
+CPUINFO_PRIVATE void cpuinfo_x86_linux_init(bool update_isa);
 #if defined(_WIN32) || defined(__CYGWIN__)
 	CPUINFO_PRIVATE BOOL CALLBACK cpuinfo_x86_windows_init(PINIT_ONCE init_once, PVOID parameter, PVOID* context);
 #endif
 CPUINFO_PRIVATE void cpuinfo_arm_mach_init(void);
-CPUINFO_PRIVATE void cpuinfo_arm_linux_init(void);
+CPUINFO_PRIVATE void cpuinfo_arm_linux_init(bool update_isa);
 CPUINFO_PRIVATE void cpuinfo_emscripten_init(void);
-CPUINFO_PRIVATE void cpuinfo_loongarch_linux_init(void);
+CPUINFO_PRIVATE void cpuinfo_loongarch_linux_init(bool update_isa);
+
+/*
+ * Detect only the ISA extensions for cpuinfo_initialize_ex(CPUINFO_INITIALIZE_ISA). On x86, the initialization of the
+ * topology on other operating systems also detects the ISA extensions with cpuinfo_x86_init_isa.
+ */
+CPUINFO_PRIVATE void cpuinfo_x86_init_isa(void);
+CPUINFO_PRIVATE bool cpuinfo_arm_linux_init_isa(void);
+CPUINFO_PRIVATE void cpuinfo_loongarch_linux_init_isa(void);
+
+/* Detect the ISA extensions without memory allocation, locks, logging, or file I/O for cpuinfo_probe_isa() */
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	CPUINFO_PRIVATE bool cpuinfo_x86_probe_isa(struct cpuinfo_x86_isa isa[restrict static 1]);
+#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	CPUINFO_PRIVATE bool cpuinfo_arm_linux_probe_isa(struct cpuinfo_arm_isa isa[restrict static 1]);
+#endif
+
+/* Recomputes cpuinfo_detected_isa_features from the cpuinfo_has_* functions after the ISA is detected */
+CPUINFO_PRIVATE void cpuinfo_update_isa_features(void);
+/* Fills the view returned by cpuinfo_get_topology from the tables after the topology is detected or loaded */
+CPUINFO_PRIVATE void cpuinfo_update_topology(void);
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	/* Computes the thresholds returned by cpuinfo_x86_get_copy_thresholds from the detected caches and ISA */
+	CPUINFO_PRIVATE void cpuinfo_x86_update_copy_thresholds(void);
+#endif
 
 CPUINFO_PRIVATE uint32_t cpuinfo_compute_max_cache_size(const struct cpuinfo_processor* processor);
 
+/* Resets the published tables to their state before initialization, without releasing their memory */
+CPUINFO_INTERNAL void cpuinfo_reset_tables(void);
+
+CPUINFO_INTERNAL bool cpuinfo_has_efficiency_cores(void);
+CPUINFO_INTERNAL bool cpuinfo_is_big_core(const struct cpuinfo_core* core, bool has_efficiency_cores);
+
 typedef void (*cpuinfo_processor_callback)(uint32_t);
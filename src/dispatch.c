@@ -0,0 +1,157 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+#include <cpuinfo.h>
+#include <cpuinfo/log.h>
+
+
+enum dispatch_state {
+	dispatch_state_unresolved = 0,
+	dispatch_state_resolving = 1,
+	dispatch_state_resolved = 2,
+};
+
+static inline uint32_t load_state(const uint32_t* state) {
+#if defined(__GNUC__)
+	return __atomic_load_n(state, __ATOMIC_ACQUIRE);
+#else
+	const uint32_t value = *(const volatile uint32_t*) state;
+	_ReadWriteBarrier();
+	return value;
+#endif
+}
+
+static inline void store_state(uint32_t* state, uint32_t value) {
+#if defined(__GNUC__)
+	__atomic_store_n(state, value, __ATOMIC_RELEASE);
+#else
+	_ReadWriteBarrier();
+	*(volatile uint32_t*) state = value;
+#endif
+}
+
+static inline bool claim_state(uint32_t* state) {
+#if defined(__GNUC__)
+	uint32_t expected = dispatch_state_unresolved;
+	return __atomic_compare_exchange_n(state, &expected, dispatch_state_resolving,
+		false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+#else
+	return _InterlockedCompareExchange((volatile long*) state, dispatch_state_resolving, dispatch_state_unresolved) ==
+		dispatch_state_unresolved;
+#endif
+}
+
+static bool is_supported(const struct cpuinfo_dispatch_variant variant[restrict static 1]) {
+	for (uint32_t i = 0; i < CPUINFO_DISPATCH_MAX_PREDICATES; i++) {
+		if (variant->predicates[i] == NULL) {
+			break;
+		}
+		if (!variant->predicates[i]()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static cpuinfo_dispatch_function select_variant(
+	const struct cpuinfo_dispatch_table table[restrict static 1],
+	enum cpuinfo_uarch uarch)
+{
+	cpuinfo_dispatch_function generic_function = NULL, other_function = NULL;
+	for (uint32_t i = 0; i < table->variants_count; i++) {
+		const struct cpuinfo_dispatch_variant* variant = &table->variants[i];
+		if (!is_supported(variant)) {
+			continue;
+		}
+		if (variant->uarch == uarch && uarch != cpuinfo_uarch_unknown) {
+			return variant->function;
+		} else if (variant->uarch == cpuinfo_uarch_unknown) {
+			if (generic_function == NULL) {
+				generic_function = variant->function;
+			}
+		} else if (other_function == NULL) {
+			other_function = variant->function;
+		}
+	}
+	return generic_function != NULL ? generic_function : other_function;
+}
+
+/*
+ * Selects variants for the microarchitecture of the majority of logical processors and for each microarchitecture.
+ * Returns the number of microarchitectures with separate variants, which is 0 if there are too many of them.
+ */
+static uint32_t resolve_variants(
+	const struct cpuinfo_dispatch_table table[restrict static 1],
+	cpuinfo_dispatch_function function[restrict static 1],
+	cpuinfo_dispatch_function uarch_functions[restrict static CPUINFO_DISPATCH_MAX_UARCHS])
+{
+	const uint32_t uarchs_count = cpuinfo_get_uarchs_count();
+	const struct cpuinfo_uarch_info* majority_uarch = NULL;
+	for (uint32_t i = 0; i < uarchs_count; i++) {
+		const struct cpuinfo_uarch_info* uarch = cpuinfo_get_uarch(i);
+		if (majority_uarch == NULL || uarch->processor_count > majority_uarch->processor_count) {
+			majority_uarch = uarch;
+		}
+	}
+	*function = select_variant(table, majority_uarch != NULL ? majority_uarch->uarch : cpuinfo_uarch_unknown);
+
+	if (uarchs_count > CPUINFO_DISPATCH_MAX_UARCHS) {
+		cpuinfo_log_info("%"PRIu32" microarchitectures exceed the limit of %d per dispatch table",
+			uarchs_count, CPUINFO_DISPATCH_MAX_UARCHS);
+		return 0;
+	}
+	for (uint32_t i = 0; i < uarchs_count; i++) {
+		uarch_functions[i] = select_variant(table, cpuinfo_get_uarch(i)->uarch);
+	}
+	return uarchs_count;
+}
+
+static cpuinfo_dispatch_function select_current_variant(
+	cpuinfo_dispatch_function function,
+	uint32_t uarchs_count,
+	const cpuinfo_dispatch_function uarch_functions[restrict static 1])
+{
+	if (uarchs_count == 0) {
+		return function;
+	}
+	const uint32_t uarch_index = cpuinfo_get_current_uarch_index();
+	return uarch_index < uarchs_count ? uarch_functions[uarch_index] : function;
+}
+
+/*
+ * Resolves the table if it is not resolved yet. Threads which race with the first resolution compute the same variants
+ * and use them without waiting for the table to be updated.
+ */
+static cpuinfo_dispatch_function resolve(struct cpuinfo_dispatch_table table[restrict static 1], bool current) {
+	if (load_state(&table->state) == dispatch_state_resolved) {
+		return current ?
+			select_current_variant(table->function, table->uarchs_count, table->uarch_functions) : table->function;
+	}
+
+	cpuinfo_dispatch_function function;
+	cpuinfo_dispatch_function uarch_functions[CPUINFO_DISPATCH_MAX_UARCHS];
+	const uint32_t uarchs_count = resolve_variants(table, &function, uarch_functions);
+	if (claim_state(&table->state)) {
+		table->function = function;
+		table->uarchs_count = uarchs_count;
+		for (uint32_t i = 0; i < uarchs_count; i++) {
+			table->uarch_functions[i] = uarch_functions[i];
+		}
+		store_state(&table->state, dispatch_state_resolved);
+	}
+	return current ? select_current_variant(function, uarchs_count, uarch_functions) : function;
+}
+
+cpuinfo_dispatch_function CPUINFO_ABI cpuinfo_dispatch_resolve(struct cpuinfo_dispatch_table* table) {
+	return resolve(table, false);
+}
+
+cpuinfo_dispatch_function CPUINFO_ABI cpuinfo_dispatch_resolve_current(struct cpuinfo_dispatch_table* table) {
+	return resolve(table, true);
+}
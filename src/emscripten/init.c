@@ -259,6 +259,7 @@ void cpuinfo_emscripten_init(void) {
 	cpuinfo_packages_count = 1;
 
 	cpuinfo_max_cache_size = is_x86 ? 128 * 1024 * 1024 : 8 * 1024 * 1024;
+	cpuinfo_update_topology();
 
 	cpuinfo_is_initialized = true;
 
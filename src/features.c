@@ -0,0 +1,497 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <cpuinfo.h>
+#include <cpuinfo/internal-api.h>
+
+
+struct cpuinfo_isa_features cpuinfo_detected_isa_features = { { 0 } };
+
+static const char* const feature_names[CPUINFO_ISA_FEATURE_MAX] = {
+	[cpuinfo_isa_feature_x86_rdtsc] = "rdtsc",
+	[cpuinfo_isa_feature_x86_rdtscp] = "rdtscp",
+	[cpuinfo_isa_feature_x86_rdpid] = "rdpid",
+	[cpuinfo_isa_feature_x86_clzero] = "clzero",
+	[cpuinfo_isa_feature_x86_mwait] = "mwait",
+	[cpuinfo_isa_feature_x86_mwaitx] = "mwaitx",
+	[cpuinfo_isa_feature_x86_waitpkg] = "waitpkg",
+	[cpuinfo_isa_feature_x86_fxsave] = "fxsave",
+	[cpuinfo_isa_feature_x86_xsave] = "xsave",
+	[cpuinfo_isa_feature_x86_fpu] = "fpu",
+	[cpuinfo_isa_feature_x86_mmx] = "mmx",
+	[cpuinfo_isa_feature_x86_mmx_plus] = "mmx_plus",
+	[cpuinfo_isa_feature_x86_3dnow] = "3dnow",
+	[cpuinfo_isa_feature_x86_3dnow_plus] = "3dnow_plus",
+	[cpuinfo_isa_feature_x86_3dnow_geode] = "3dnow_geode",
+	[cpuinfo_isa_feature_x86_prefetch] = "prefetch",
+	[cpuinfo_isa_feature_x86_prefetchw] = "prefetchw",
+	[cpuinfo_isa_feature_x86_prefetchwt1] = "prefetchwt1",
+	[cpuinfo_isa_feature_x86_prefetchi] = "prefetchi",
+	[cpuinfo_isa_feature_x86_daz] = "daz",
+	[cpuinfo_isa_feature_x86_sse] = "sse",
+	[cpuinfo_isa_feature_x86_sse2] = "sse2",
+	[cpuinfo_isa_feature_x86_sse3] = "sse3",
+	[cpuinfo_isa_feature_x86_ssse3] = "ssse3",
+	[cpuinfo_isa_feature_x86_sse4_1] = "sse4_1",
+	[cpuinfo_isa_feature_x86_sse4_2] = "sse4_2",
+	[cpuinfo_isa_feature_x86_sse4a] = "sse4a",
+	[cpuinfo_isa_feature_x86_misaligned_sse] = "misaligned_sse",
+	[cpuinfo_isa_feature_x86_avx] = "avx",
+	[cpuinfo_isa_feature_x86_fma3] = "fma3",
+	[cpuinfo_isa_feature_x86_fma4] = "fma4",
+	[cpuinfo_isa_feature_x86_xop] = "xop",
+	[cpuinfo_isa_feature_x86_f16c] = "f16c",
+	[cpuinfo_isa_feature_x86_avx2] = "avx2",
+	[cpuinfo_isa_feature_x86_avx512f] = "avx512f",
+	[cpuinfo_isa_feature_x86_avx512pf] = "avx512pf",
+	[cpuinfo_isa_feature_x86_avx512er] = "avx512er",
+	[cpuinfo_isa_feature_x86_avx512cd] = "avx512cd",
+	[cpuinfo_isa_feature_x86_avx512dq] = "avx512dq",
+	[cpuinfo_isa_feature_x86_avx512bw] = "avx512bw",
+	[cpuinfo_isa_feature_x86_avx512vl] = "avx512vl",
+	[cpuinfo_isa_feature_x86_avx512ifma] = "avx512ifma",
+	[cpuinfo_isa_feature_x86_avx512vbmi] = "avx512vbmi",
+	[cpuinfo_isa_feature_x86_avx512vbmi2] = "avx512vbmi2",
+	[cpuinfo_isa_feature_x86_avx512bitalg] = "avx512bitalg",
+	[cpuinfo_isa_feature_x86_avx512vpopcntdq] = "avx512vpopcntdq",
+	[cpuinfo_isa_feature_x86_avx512vnni] = "avx512vnni",
+	[cpuinfo_isa_feature_x86_avx512bf16] = "avx512bf16",
+	[cpuinfo_isa_feature_x86_avx512vp2intersect] = "avx512vp2intersect",
+	[cpuinfo_isa_feature_x86_avx512_4vnniw] = "avx512_4vnniw",
+	[cpuinfo_isa_feature_x86_avx512_4fmaps] = "avx512_4fmaps",
+	[cpuinfo_isa_feature_x86_avx512fp16] = "avx512fp16",
+	[cpuinfo_isa_feature_x86_avxvnni] = "avxvnni",
+	[cpuinfo_isa_feature_x86_avxvnniint8] = "avxvnniint8",
+	[cpuinfo_isa_feature_x86_avxifma] = "avxifma",
+	[cpuinfo_isa_feature_x86_avxneconvert] = "avxneconvert",
+	[cpuinfo_isa_feature_x86_amx_tile] = "amx_tile",
+	[cpuinfo_isa_feature_x86_amx_int8] = "amx_int8",
+	[cpuinfo_isa_feature_x86_amx_bf16] = "amx_bf16",
+	[cpuinfo_isa_feature_x86_amx_fp16] = "amx_fp16",
+	[cpuinfo_isa_feature_x86_amx_complex] = "amx_complex",
+	[cpuinfo_isa_feature_x86_hle] = "hle",
+	[cpuinfo_isa_feature_x86_rtm] = "rtm",
+	[cpuinfo_isa_feature_x86_xtest] = "xtest",
+	[cpuinfo_isa_feature_x86_mpx] = "mpx",
+	[cpuinfo_isa_feature_x86_cmov] = "cmov",
+	[cpuinfo_isa_feature_x86_cmpxchg8b] = "cmpxchg8b",
+	[cpuinfo_isa_feature_x86_cmpxchg16b] = "cmpxchg16b",
+	[cpuinfo_isa_feature_x86_clwb] = "clwb",
+	[cpuinfo_isa_feature_x86_movbe] = "movbe",
+	[cpuinfo_isa_feature_x86_erms] = "erms",
+	[cpuinfo_isa_feature_x86_fsrm] = "fsrm",
+	[cpuinfo_isa_feature_x86_fzlrm] = "fzlrm",
+	[cpuinfo_isa_feature_x86_fsrs] = "fsrs",
+	[cpuinfo_isa_feature_x86_fsrc] = "fsrc",
+	[cpuinfo_isa_feature_x86_movdiri] = "movdiri",
+	[cpuinfo_isa_feature_x86_movdir64b] = "movdir64b",
+	[cpuinfo_isa_feature_x86_enqcmd] = "enqcmd",
+	[cpuinfo_isa_feature_x86_cldemote] = "cldemote",
+	[cpuinfo_isa_feature_x86_serialize] = "serialize",
+	[cpuinfo_isa_feature_x86_lahf_sahf] = "lahf_sahf",
+	[cpuinfo_isa_feature_x86_apx] = "apx",
+	[cpuinfo_isa_feature_x86_lzcnt] = "lzcnt",
+	[cpuinfo_isa_feature_x86_popcnt] = "popcnt",
+	[cpuinfo_isa_feature_x86_tbm] = "tbm",
+	[cpuinfo_isa_feature_x86_bmi] = "bmi",
+	[cpuinfo_isa_feature_x86_bmi2] = "bmi2",
+	[cpuinfo_isa_feature_x86_adx] = "adx",
+	[cpuinfo_isa_feature_x86_aes] = "aes",
+	[cpuinfo_isa_feature_x86_vaes] = "vaes",
+	[cpuinfo_isa_feature_x86_pclmulqdq] = "pclmulqdq",
+	[cpuinfo_isa_feature_x86_vpclmulqdq] = "vpclmulqdq",
+	[cpuinfo_isa_feature_x86_gfni] = "gfni",
+	[cpuinfo_isa_feature_x86_rdrand] = "rdrand",
+	[cpuinfo_isa_feature_x86_rdseed] = "rdseed",
+	[cpuinfo_isa_feature_x86_sha] = "sha",
+	[cpuinfo_isa_feature_arm_thumb] = "thumb",
+	[cpuinfo_isa_feature_arm_thumb2] = "thumb2",
+	[cpuinfo_isa_feature_arm_v5e] = "v5e",
+	[cpuinfo_isa_feature_arm_v6] = "v6",
+	[cpuinfo_isa_feature_arm_v6k] = "v6k",
+	[cpuinfo_isa_feature_arm_v7] = "v7",
+	[cpuinfo_isa_feature_arm_v7mp] = "v7mp",
+	[cpuinfo_isa_feature_arm_v8] = "v8",
+	[cpuinfo_isa_feature_arm_idiv] = "idiv",
+	[cpuinfo_isa_feature_arm_vfpv2] = "vfpv2",
+	[cpuinfo_isa_feature_arm_vfpv3] = "vfpv3",
+	[cpuinfo_isa_feature_arm_vfpv3_d32] = "vfpv3_d32",
+	[cpuinfo_isa_feature_arm_vfpv3_fp16] = "vfpv3_fp16",
+	[cpuinfo_isa_feature_arm_vfpv3_fp16_d32] = "vfpv3_fp16_d32",
+	[cpuinfo_isa_feature_arm_vfpv4] = "vfpv4",
+	[cpuinfo_isa_feature_arm_vfpv4_d32] = "vfpv4_d32",
+	[cpuinfo_isa_feature_arm_wmmx] = "wmmx",
+	[cpuinfo_isa_feature_arm_wmmx2] = "wmmx2",
+	[cpuinfo_isa_feature_arm_neon] = "neon",
+	[cpuinfo_isa_feature_arm_neon_fp16] = "neon_fp16",
+	[cpuinfo_isa_feature_arm_neon_fma] = "neon_fma",
+	[cpuinfo_isa_feature_arm_neon_v8] = "neon_v8",
+	[cpuinfo_isa_feature_arm_atomics] = "atomics",
+	[cpuinfo_isa_feature_arm_neon_rdm] = "neon_rdm",
+	[cpuinfo_isa_feature_arm_neon_fp16_arith] = "neon_fp16_arith",
+	[cpuinfo_isa_feature_arm_fp16_arith] = "fp16_arith",
+	[cpuinfo_isa_feature_arm_neon_dot] = "neon_dot",
+	[cpuinfo_isa_feature_arm_jscvt] = "jscvt",
+	[cpuinfo_isa_feature_arm_fcma] = "fcma",
+	[cpuinfo_isa_feature_arm_aes] = "aes",
+	[cpuinfo_isa_feature_arm_sha1] = "sha1",
+	[cpuinfo_isa_feature_arm_sha2] = "sha2",
+	[cpuinfo_isa_feature_arm_pmull] = "pmull",
+	[cpuinfo_isa_feature_arm_crc32] = "crc32",
+	[cpuinfo_isa_feature_arm_sve] = "sve",
+	[cpuinfo_isa_feature_arm_sve2] = "sve2",
+	[cpuinfo_isa_feature_arm_bf16] = "bf16",
+	[cpuinfo_isa_feature_arm_svebf16] = "svebf16",
+	[cpuinfo_isa_feature_arm_lse128] = "lse128",
+	[cpuinfo_isa_feature_arm_ebf16] = "ebf16",
+	[cpuinfo_isa_feature_arm_fhm] = "fhm",
+	[cpuinfo_isa_feature_arm_i8mm] = "i8mm",
+	[cpuinfo_isa_feature_arm_svei8mm] = "svei8mm",
+	[cpuinfo_isa_feature_arm_svef32mm] = "svef32mm",
+	[cpuinfo_isa_feature_arm_svef64mm] = "svef64mm",
+	[cpuinfo_isa_feature_arm_sveaes] = "sveaes",
+	[cpuinfo_isa_feature_arm_svepmull] = "svepmull",
+	[cpuinfo_isa_feature_arm_svesha3] = "svesha3",
+	[cpuinfo_isa_feature_arm_svesm4] = "svesm4",
+	[cpuinfo_isa_feature_arm_svebitperm] = "svebitperm",
+	[cpuinfo_isa_feature_arm_sve2p1] = "sve2p1",
+	[cpuinfo_isa_feature_arm_sme] = "sme",
+	[cpuinfo_isa_feature_arm_sme2] = "sme2",
+	[cpuinfo_isa_feature_arm_sme2p1] = "sme2p1",
+	[cpuinfo_isa_feature_arm_smei16i64] = "smei16i64",
+	[cpuinfo_isa_feature_arm_smef64f64] = "smef64f64",
+	[cpuinfo_isa_feature_arm_smefa64] = "smefa64",
+	[cpuinfo_isa_feature_arm_sha3] = "sha3",
+	[cpuinfo_isa_feature_arm_sha512] = "sha512",
+	[cpuinfo_isa_feature_arm_sm3] = "sm3",
+	[cpuinfo_isa_feature_arm_sm4] = "sm4",
+	[cpuinfo_isa_feature_arm_rng] = "rng",
+	[cpuinfo_isa_feature_arm_rcpc] = "rcpc",
+	[cpuinfo_isa_feature_arm_rcpc2] = "rcpc2",
+	[cpuinfo_isa_feature_arm_rcpc3] = "rcpc3",
+	[cpuinfo_isa_feature_arm_flagm] = "flagm",
+	[cpuinfo_isa_feature_arm_flagm2] = "flagm2",
+	[cpuinfo_isa_feature_arm_mops] = "mops",
+	[cpuinfo_isa_feature_arm_cssc] = "cssc",
+	[cpuinfo_isa_feature_loongarch_cpucfg] = "cpucfg",
+	[cpuinfo_isa_feature_loongarch_lam] = "lam",
+	[cpuinfo_isa_feature_loongarch_ual] = "ual",
+	[cpuinfo_isa_feature_loongarch_fpu] = "fpu",
+	[cpuinfo_isa_feature_loongarch_lsx] = "lsx",
+	[cpuinfo_isa_feature_loongarch_lasx] = "lasx",
+	[cpuinfo_isa_feature_loongarch_crc32] = "crc32",
+	[cpuinfo_isa_feature_loongarch_complex] = "complex",
+	[cpuinfo_isa_feature_loongarch_crypto] = "crypto",
+	[cpuinfo_isa_feature_loongarch_lvz] = "lvz",
+	[cpuinfo_isa_feature_loongarch_lbt_x86] = "lbt_x86",
+	[cpuinfo_isa_feature_loongarch_lbt_arm] = "lbt_arm",
+	[cpuinfo_isa_feature_loongarch_lbt_mips] = "lbt_mips",
+};
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#define NATIVE_FEATURES_BEGIN 0
+	#define NATIVE_FEATURES_END   128
+#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#define NATIVE_FEATURES_BEGIN 128
+	#define NATIVE_FEATURES_END   256
+#elif CPUINFO_ARCH_LOONGARCH64
+	#define NATIVE_FEATURES_BEGIN 256
+	#define NATIVE_FEATURES_END   320
+#else
+	#define NATIVE_FEATURES_BEGIN 0
+	#define NATIVE_FEATURES_END   0
+#endif
+
+static inline void set_feature(
+	struct cpuinfo_isa_features features[restrict static 1],
+	enum cpuinfo_isa_feature feature,
+	bool supported)
+{
+	if (supported) {
+		cpuinfo_isa_features_add(features, feature);
+	}
+}
+
+void cpuinfo_update_isa_features(void) {
+	struct cpuinfo_isa_features features = { { 0 } };
+	set_feature(&features, cpuinfo_isa_feature_x86_rdtsc, cpuinfo_has_x86_rdtsc());
+	set_feature(&features, cpuinfo_isa_feature_x86_rdtscp, cpuinfo_has_x86_rdtscp());
+	set_feature(&features, cpuinfo_isa_feature_x86_rdpid, cpuinfo_has_x86_rdpid());
+	set_feature(&features, cpuinfo_isa_feature_x86_clzero, cpuinfo_has_x86_clzero());
+	set_feature(&features, cpuinfo_isa_feature_x86_mwait, cpuinfo_has_x86_mwait());
+	set_feature(&features, cpuinfo_isa_feature_x86_mwaitx, cpuinfo_has_x86_mwaitx());
+	set_feature(&features, cpuinfo_isa_feature_x86_waitpkg, cpuinfo_has_x86_waitpkg());
+	set_feature(&features, cpuinfo_isa_feature_x86_fxsave, cpuinfo_has_x86_fxsave());
+	set_feature(&features, cpuinfo_isa_feature_x86_xsave, cpuinfo_has_x86_xsave());
+	set_feature(&features, cpuinfo_isa_feature_x86_fpu, cpuinfo_has_x86_fpu());
+	set_feature(&features, cpuinfo_isa_feature_x86_mmx, cpuinfo_has_x86_mmx());
+	set_feature(&features, cpuinfo_isa_feature_x86_mmx_plus, cpuinfo_has_x86_mmx_plus());
+	set_feature(&features, cpuinfo_isa_feature_x86_3dnow, cpuinfo_has_x86_3dnow());
+	set_feature(&features, cpuinfo_isa_feature_x86_3dnow_plus, cpuinfo_has_x86_3dnow_plus());
+	set_feature(&features, cpuinfo_isa_feature_x86_3dnow_geode, cpuinfo_has_x86_3dnow_geode());
+	set_feature(&features, cpuinfo_isa_feature_x86_prefetch, cpuinfo_has_x86_prefetch());
+	set_feature(&features, cpuinfo_isa_feature_x86_prefetchw, cpuinfo_has_x86_prefetchw());
+	set_feature(&features, cpuinfo_isa_feature_x86_prefetchwt1, cpuinfo_has_x86_prefetchwt1());
+	set_feature(&features, cpuinfo_isa_feature_x86_prefetchi, cpuinfo_has_x86_prefetchi());
+	set_feature(&features, cpuinfo_isa_feature_x86_daz, cpuinfo_has_x86_daz());
+	set_feature(&features, cpuinfo_isa_feature_x86_sse, cpuinfo_has_x86_sse());
+	set_feature(&features, cpuinfo_isa_feature_x86_sse2, cpuinfo_has_x86_sse2());
+	set_feature(&features, cpuinfo_isa_feature_x86_sse3, cpuinfo_has_x86_sse3());
+	set_feature(&features, cpuinfo_isa_feature_x86_ssse3, cpuinfo_has_x86_ssse3());
+	set_feature(&features, cpuinfo_isa_feature_x86_sse4_1, cpuinfo_has_x86_sse4_1());
+	set_feature(&features, cpuinfo_isa_feature_x86_sse4_2, cpuinfo_has_x86_sse4_2());
+	set_feature(&features, cpuinfo_isa_feature_x86_sse4a, cpuinfo_has_x86_sse4a());
+	set_feature(&features, cpuinfo_isa_feature_x86_misaligned_sse, cpuinfo_has_x86_misaligned_sse());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx, cpuinfo_has_x86_avx());
+	set_feature(&features, cpuinfo_isa_feature_x86_fma3, cpuinfo_has_x86_fma3());
+	set_feature(&features, cpuinfo_isa_feature_x86_fma4, cpuinfo_has_x86_fma4());
+	set_feature(&features, cpuinfo_isa_feature_x86_xop, cpuinfo_has_x86_xop());
+	set_feature(&features, cpuinfo_isa_feature_x86_f16c, cpuinfo_has_x86_f16c());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx2, cpuinfo_has_x86_avx2());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx512f, cpuinfo_has_x86_avx512f());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx512pf, cpuinfo_has_x86_avx512pf());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx512er, cpuinfo_has_x86_avx512er());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx512cd, cpuinfo_has_x86_avx512cd());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx512dq, cpuinfo_has_x86_avx512dq());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx512bw, cpuinfo_has_x86_avx512bw());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx512vl, cpuinfo_has_x86_avx512vl());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx512ifma, cpuinfo_has_x86_avx512ifma());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx512vbmi, cpuinfo_has_x86_avx512vbmi());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx512vbmi2, cpuinfo_has_x86_avx512vbmi2());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx512bitalg, cpuinfo_has_x86_avx512bitalg());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx512vpopcntdq, cpuinfo_has_x86_avx512vpopcntdq());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx512vnni, cpuinfo_has_x86_avx512vnni());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx512bf16, cpuinfo_has_x86_avx512bf16());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx512vp2intersect, cpuinfo_has_x86_avx512vp2intersect());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx512_4vnniw, cpuinfo_has_x86_avx512_4vnniw());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx512_4fmaps, cpuinfo_has_x86_avx512_4fmaps());
+	set_feature(&features, cpuinfo_isa_feature_x86_avx512fp16, cpuinfo_has_x86_avx512fp16());
+	set_feature(&features, cpuinfo_isa_feature_x86_avxvnni, cpuinfo_has_x86_avxvnni());
+	set_feature(&features, cpuinfo_isa_feature_x86_avxvnniint8, cpuinfo_has_x86_avxvnniint8());
+	set_feature(&features, cpuinfo_isa_feature_x86_avxifma, cpuinfo_has_x86_avxifma());
+	set_feature(&features, cpuinfo_isa_feature_x86_avxneconvert, cpuinfo_has_x86_avxneconvert());
+	set_feature(&features, cpuinfo_isa_feature_x86_amx_tile, cpuinfo_has_x86_amx_tile());
+	set_feature(&features, cpuinfo_isa_feature_x86_amx_int8, cpuinfo_has_x86_amx_int8());
+	set_feature(&features, cpuinfo_isa_feature_x86_amx_bf16, cpuinfo_has_x86_amx_bf16());
+	set_feature(&features, cpuinfo_isa_feature_x86_amx_fp16, cpuinfo_has_x86_amx_fp16());
+	set_feature(&features, cpuinfo_isa_feature_x86_amx_complex, cpuinfo_has_x86_amx_complex());
+	set_feature(&features, cpuinfo_isa_feature_x86_hle, cpuinfo_has_x86_hle());
+	set_feature(&features, cpuinfo_isa_feature_x86_rtm, cpuinfo_has_x86_rtm());
+	set_feature(&features, cpuinfo_isa_feature_x86_xtest, cpuinfo_has_x86_xtest());
+	set_feature(&features, cpuinfo_isa_feature_x86_mpx, cpuinfo_has_x86_mpx());
+	set_feature(&features, cpuinfo_isa_feature_x86_cmov, cpuinfo_has_x86_cmov());
+	set_feature(&features, cpuinfo_isa_feature_x86_cmpxchg8b, cpuinfo_has_x86_cmpxchg8b());
+	set_feature(&features, cpuinfo_isa_feature_x86_cmpxchg16b, cpuinfo_has_x86_cmpxchg16b());
+	set_feature(&features, cpuinfo_isa_feature_x86_clwb, cpuinfo_has_x86_clwb());
+	set_feature(&features, cpuinfo_isa_feature_x86_movbe, cpuinfo_has_x86_movbe());
+	set_feature(&features, cpuinfo_isa_feature_x86_erms, cpuinfo_has_x86_erms());
+	set_feature(&features, cpuinfo_isa_feature_x86_fsrm, cpuinfo_has_x86_fsrm());
+	set_feature(&features, cpuinfo_isa_feature_x86_fzlrm, cpuinfo_has_x86_fzlrm());
+	set_feature(&features, cpuinfo_isa_feature_x86_fsrs, cpuinfo_has_x86_fsrs());
+	set_feature(&features, cpuinfo_isa_feature_x86_fsrc, cpuinfo_has_x86_fsrc());
+	set_feature(&features, cpuinfo_isa_feature_x86_movdiri, cpuinfo_has_x86_movdiri());
+	set_feature(&features, cpuinfo_isa_feature_x86_movdir64b, cpuinfo_has_x86_movdir64b());
+	set_feature(&features, cpuinfo_isa_feature_x86_enqcmd, cpuinfo_has_x86_enqcmd());
+	set_feature(&features, cpuinfo_isa_feature_x86_cldemote, cpuinfo_has_x86_cldemote());
+	set_feature(&features, cpuinfo_isa_feature_x86_serialize, cpuinfo_has_x86_serialize());
+	set_feature(&features, cpuinfo_isa_feature_x86_lahf_sahf, cpuinfo_has_x86_lahf_sahf());
+	set_feature(&features, cpuinfo_isa_feature_x86_apx, cpuinfo_has_x86_apx());
+	set_feature(&features, cpuinfo_isa_feature_x86_lzcnt, cpuinfo_has_x86_lzcnt());
+	set_feature(&features, cpuinfo_isa_feature_x86_popcnt, cpuinfo_has_x86_popcnt());
+	set_feature(&features, cpuinfo_isa_feature_x86_tbm, cpuinfo_has_x86_tbm());
+	set_feature(&features, cpuinfo_isa_feature_x86_bmi, cpuinfo_has_x86_bmi());
+	set_feature(&features, cpuinfo_isa_feature_x86_bmi2, cpuinfo_has_x86_bmi2());
+	set_feature(&features, cpuinfo_isa_feature_x86_adx, cpuinfo_has_x86_adx());
+	set_feature(&features, cpuinfo_isa_feature_x86_aes, cpuinfo_has_x86_aes());
+	set_feature(&features, cpuinfo_isa_feature_x86_vaes, cpuinfo_has_x86_vaes());
+	set_feature(&features, cpuinfo_isa_feature_x86_pclmulqdq, cpuinfo_has_x86_pclmulqdq());
+	set_feature(&features, cpuinfo_isa_feature_x86_vpclmulqdq, cpuinfo_has_x86_vpclmulqdq());
+	set_feature(&features, cpuinfo_isa_feature_x86_gfni, cpuinfo_has_x86_gfni());
+	set_feature(&features, cpuinfo_isa_feature_x86_rdrand, cpuinfo_has_x86_rdrand());
+	set_feature(&features, cpuinfo_isa_feature_x86_rdseed, cpuinfo_has_x86_rdseed());
+	set_feature(&features, cpuinfo_isa_feature_x86_sha, cpuinfo_has_x86_sha());
+	set_feature(&features, cpuinfo_isa_feature_arm_thumb, cpuinfo_has_arm_thumb());
+	set_feature(&features, cpuinfo_isa_feature_arm_thumb2, cpuinfo_has_arm_thumb2());
+	set_feature(&features, cpuinfo_isa_feature_arm_v5e, cpuinfo_has_arm_v5e());
+	set_feature(&features, cpuinfo_isa_feature_arm_v6, cpuinfo_has_arm_v6());
+	set_feature(&features, cpuinfo_isa_feature_arm_v6k, cpuinfo_has_arm_v6k());
+	set_feature(&features, cpuinfo_isa_feature_arm_v7, cpuinfo_has_arm_v7());
+	set_feature(&features, cpuinfo_isa_feature_arm_v7mp, cpuinfo_has_arm_v7mp());
+	set_feature(&features, cpuinfo_isa_feature_arm_v8, cpuinfo_has_arm_v8());
+	set_feature(&features, cpuinfo_isa_feature_arm_idiv, cpuinfo_has_arm_idiv());
+	set_feature(&features, cpuinfo_isa_feature_arm_vfpv2, cpuinfo_has_arm_vfpv2());
+	set_feature(&features, cpuinfo_isa_feature_arm_vfpv3, cpuinfo_has_arm_vfpv3());
+	set_feature(&features, cpuinfo_isa_feature_arm_vfpv3_d32, cpuinfo_has_arm_vfpv3_d32());
+	set_feature(&features, cpuinfo_isa_feature_arm_vfpv3_fp16, cpuinfo_has_arm_vfpv3_fp16());
+	set_feature(&features, cpuinfo_isa_feature_arm_vfpv3_fp16_d32, cpuinfo_has_arm_vfpv3_fp16_d32());
+	set_feature(&features, cpuinfo_isa_feature_arm_vfpv4, cpuinfo_has_arm_vfpv4());
+	set_feature(&features, cpuinfo_isa_feature_arm_vfpv4_d32, cpuinfo_has_arm_vfpv4_d32());
+	set_feature(&features, cpuinfo_isa_feature_arm_wmmx, cpuinfo_has_arm_wmmx());
+	set_feature(&features, cpuinfo_isa_feature_arm_wmmx2, cpuinfo_has_arm_wmmx2());
+	set_feature(&features, cpuinfo_isa_feature_arm_neon, cpuinfo_has_arm_neon());
+	set_feature(&features, cpuinfo_isa_feature_arm_neon_fp16, cpuinfo_has_arm_neon_fp16());
+	set_feature(&features, cpuinfo_isa_feature_arm_neon_fma, cpuinfo_has_arm_neon_fma());
+	set_feature(&features, cpuinfo_isa_feature_arm_neon_v8, cpuinfo_has_arm_neon_v8());
+	set_feature(&features, cpuinfo_isa_feature_arm_atomics, cpuinfo_has_arm_atomics());
+	set_feature(&features, cpuinfo_isa_feature_arm_neon_rdm, cpuinfo_has_arm_neon_rdm());
+	set_feature(&features, cpuinfo_isa_feature_arm_neon_fp16_arith, cpuinfo_has_arm_neon_fp16_arith());
+	set_feature(&features, cpuinfo_isa_feature_arm_fp16_arith, cpuinfo_has_arm_fp16_arith());
+	set_feature(&features, cpuinfo_isa_feature_arm_neon_dot, cpuinfo_has_arm_neon_dot());
+	set_feature(&features, cpuinfo_isa_feature_arm_jscvt, cpuinfo_has_arm_jscvt());
+	set_feature(&features, cpuinfo_isa_feature_arm_fcma, cpuinfo_has_arm_fcma());
+	set_feature(&features, cpuinfo_isa_feature_arm_aes, cpuinfo_has_arm_aes());
+	set_feature(&features, cpuinfo_isa_feature_arm_sha1, cpuinfo_has_arm_sha1());
+	set_feature(&features, cpuinfo_isa_feature_arm_sha2, cpuinfo_has_arm_sha2());
+	set_feature(&features, cpuinfo_isa_feature_arm_pmull, cpuinfo_has_arm_pmull());
+	set_feature(&features, cpuinfo_isa_feature_arm_crc32, cpuinfo_has_arm_crc32());
+	set_feature(&features, cpuinfo_isa_feature_arm_sve, cpuinfo_has_arm_sve());
+	set_feature(&features, cpuinfo_isa_feature_arm_sve2, cpuinfo_has_arm_sve2());
+	set_feature(&features, cpuinfo_isa_feature_arm_bf16, cpuinfo_has_arm_bf16());
+	set_feature(&features, cpuinfo_isa_feature_arm_svebf16, cpuinfo_has_arm_svebf16());
+	set_feature(&features, cpuinfo_isa_feature_arm_lse128, cpuinfo_has_arm_lse128());
+	set_feature(&features, cpuinfo_isa_feature_arm_ebf16, cpuinfo_has_arm_ebf16());
+	set_feature(&features, cpuinfo_isa_feature_arm_fhm, cpuinfo_has_arm_fhm());
+	set_feature(&features, cpuinfo_isa_feature_arm_i8mm, cpuinfo_has_arm_i8mm());
+	set_feature(&features, cpuinfo_isa_feature_arm_svei8mm, cpuinfo_has_arm_svei8mm());
+	set_feature(&features, cpuinfo_isa_feature_arm_svef32mm, cpuinfo_has_arm_svef32mm());
+	set_feature(&features, cpuinfo_isa_feature_arm_svef64mm, cpuinfo_has_arm_svef64mm());
+	set_feature(&features, cpuinfo_isa_feature_arm_sveaes, cpuinfo_has_arm_sveaes());
+	set_feature(&features, cpuinfo_isa_feature_arm_svepmull, cpuinfo_has_arm_svepmull());
+	set_feature(&features, cpuinfo_isa_feature_arm_svesha3, cpuinfo_has_arm_svesha3());
+	set_feature(&features, cpuinfo_isa_feature_arm_svesm4, cpuinfo_has_arm_svesm4());
+	set_feature(&features, cpuinfo_isa_feature_arm_svebitperm, cpuinfo_has_arm_svebitperm());
+	set_feature(&features, cpuinfo_isa_feature_arm_sve2p1, cpuinfo_has_arm_sve2p1());
+	set_feature(&features, cpuinfo_isa_feature_arm_sme, cpuinfo_has_arm_sme());
+	set_feature(&features, cpuinfo_isa_feature_arm_sme2, cpuinfo_has_arm_sme2());
+	set_feature(&features, cpuinfo_isa_feature_arm_sme2p1, cpuinfo_has_arm_sme2p1());
+	set_feature(&features, cpuinfo_isa_feature_arm_smei16i64, cpuinfo_has_arm_smei16i64());
+	set_feature(&features, cpuinfo_isa_feature_arm_smef64f64, cpuinfo_has_arm_smef64f64());
+	set_feature(&features, cpuinfo_isa_feature_arm_smefa64, cpuinfo_has_arm_smefa64());
+	set_feature(&features, cpuinfo_isa_feature_arm_sha3, cpuinfo_has_arm_sha3());
+	set_feature(&features, cpuinfo_isa_feature_arm_sha512, cpuinfo_has_arm_sha512());
+	set_feature(&features, cpuinfo_isa_feature_arm_sm3, cpuinfo_has_arm_sm3());
+	set_feature(&features, cpuinfo_isa_feature_arm_sm4, cpuinfo_has_arm_sm4());
+	set_feature(&features, cpuinfo_isa_feature_arm_rng, cpuinfo_has_arm_rng());
+	set_feature(&features, cpuinfo_isa_feature_arm_rcpc, cpuinfo_has_arm_rcpc());
+	set_feature(&features, cpuinfo_isa_feature_arm_rcpc2, cpuinfo_has_arm_rcpc2());
+	set_feature(&features, cpuinfo_isa_feature_arm_rcpc3, cpuinfo_has_arm_rcpc3());
+	set_feature(&features, cpuinfo_isa_feature_arm_flagm, cpuinfo_has_arm_flagm());
+	set_feature(&features, cpuinfo_isa_feature_arm_flagm2, cpuinfo_has_arm_flagm2());
+	set_feature(&features, cpuinfo_isa_feature_arm_mops, cpuinfo_has_arm_mops());
+	set_feature(&features, cpuinfo_isa_feature_arm_cssc, cpuinfo_has_arm_cssc());
+	set_feature(&features, cpuinfo_isa_feature_loongarch_cpucfg, cpuinfo_has_loongarch_cpucfg());
+	set_feature(&features, cpuinfo_isa_feature_loongarch_lam, cpuinfo_has_loongarch_lam());
+	set_feature(&features, cpuinfo_isa_feature_loongarch_ual, cpuinfo_has_loongarch_ual());
+	set_feature(&features, cpuinfo_isa_feature_loongarch_fpu, cpuinfo_has_loongarch_fpu());
+	set_feature(&features, cpuinfo_isa_feature_loongarch_lsx, cpuinfo_has_loongarch_lsx());
+	set_feature(&features, cpuinfo_isa_feature_loongarch_lasx, cpuinfo_has_loongarch_lasx());
+	set_feature(&features, cpuinfo_isa_feature_loongarch_crc32, cpuinfo_has_loongarch_crc32());
+	set_feature(&features, cpuinfo_isa_feature_loongarch_complex, cpuinfo_has_loongarch_complex());
+	set_feature(&features, cpuinfo_isa_feature_loongarch_crypto, cpuinfo_has_loongarch_crypto());
+	set_feature(&features, cpuinfo_isa_feature_loongarch_lvz, cpuinfo_has_loongarch_lvz());
+	set_feature(&features, cpuinfo_isa_feature_loongarch_lbt_x86, cpuinfo_has_loongarch_lbt_x86());
+	set_feature(&features, cpuinfo_isa_feature_loongarch_lbt_arm, cpuinfo_has_loongarch_lbt_arm());
+	set_feature(&features, cpuinfo_isa_feature_loongarch_lbt_mips, cpuinfo_has_loongarch_lbt_mips());
+
+	cpuinfo_detected_isa_features = features;
+}
+
+void CPUINFO_ABI cpuinfo_get_isa_features(struct cpuinfo_isa_features* features) {
+	*features = cpuinfo_detected_isa_features;
+}
+
+const char* CPUINFO_ABI cpuinfo_isa_feature_name(enum cpuinfo_isa_feature feature) {
+	if ((uint32_t) feature >= CPUINFO_ISA_FEATURE_MAX) {
+		return NULL;
+	}
+	return feature_names[feature];
+}
+
+static bool find_feature(const char* name, size_t length, uint32_t begin, uint32_t end, uint32_t feature[restrict static 1]) {
+	for (uint32_t i = begin; i < end; i++) {
+		const char* feature_name = feature_names[i];
+		if (feature_name != NULL && strncmp(feature_name, name, length) == 0 && feature_name[length] == '\0') {
+			*feature = i;
+			return true;
+		}
+	}
+	return false;
+}
+
+static inline bool is_space(char c) {
+	return c == ' ' || c == '\t' || c == '\n';
+}
+
+bool CPUINFO_ABI cpuinfo_isa_parse_features(const char* list, struct cpuinfo_isa_features* features) {
+	const char* name_start = list;
+	while (is_space(*name_start)) {
+		name_start++;
+	}
+	if (*name_start == '\0') {
+		return true;
+	}
+
+	for (;;) {
+		const char* separator = name_start;
+		while (*separator != '\0' && *separator != ',') {
+			separator++;
+		}
+
+		/* Skip whitespace around the name */
+		const char* name_end = separator;
+		while (name_start != name_end && is_space(*name_start)) {
+			name_start++;
+		}
+		while (name_end != name_start && is_space(name_end[-1])) {
+			name_end--;
+		}
+
+		uint32_t feature;
+		const size_t length = (size_t) (name_end - name_start);
+		if (length == 0) {
+			return false;
+		}
+		if (!find_feature(name_start, length, NATIVE_FEATURES_BEGIN, NATIVE_FEATURES_END, &feature) &&
+			!find_feature(name_start, length, 0, CPUINFO_ISA_FEATURE_MAX, &feature))
+		{
+			return false;
+		}
+		cpuinfo_isa_features_add(features, (enum cpuinfo_isa_feature) feature);
+
+		if (*separator == '\0') {
+			return true;
+		}
+		name_start = separator + 1;
+	}
+}
+
+size_t CPUINFO_ABI cpuinfo_isa_format_features(
+	const struct cpuinfo_isa_features* features,
+	char* buffer,
+	size_t buffer_size)
+{
+	size_t length = 0;
+	for (uint32_t i = 0; i < CPUINFO_ISA_FEATURE_MAX; i++) {
+		if (feature_names[i] == NULL || !cpuinfo_isa_features_contain(features, (enum cpuinfo_isa_feature) i)) {
+			continue;
+		}
+		if (length != 0) {
+			if (length + 1 < buffer_size) {
+				buffer[length] = ',';
+			}
+			length += 1;
+		}
+		for (const char* c = feature_names[i]; *c != '\0'; c++) {
+			if (length + 1 < buffer_size) {
+				buffer[length] = *c;
+			}
+			length += 1;
+		}
+	}
+	if (buffer_size != 0) {
+		buffer[length < buffer_size ? length : buffer_size - 1] = '\0';
+	}
+	return length;
+}
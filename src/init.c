@@ -1,3 +1,6 @@
+#include <stdint.h>
+#include <stdlib.h>
+
 #if defined(_WIN32) || defined(__CYGWIN__)
 	#include <windows.h>
 #elif !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__)
@@ -8,12 +11,122 @@
 #include <cpuinfo/internal-api.h>
 #include <cpuinfo/log.h>
 
+#ifdef __linux__
+	#include <linux/api.h>
+#endif
+
 #ifdef __APPLE__
 	#include "TargetConditionals.h"
 #endif
 
 
-#if defined(_WIN32) || defined(__CYGWIN__)
+#if defined(__linux__) && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 || CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 || CPUINFO_ARCH_LOONGARCH64)
+	#define CPUINFO_LINUX_INIT 1
+#else
+	#define CPUINFO_LINUX_INIT 0
+#endif
+
+#if CPUINFO_LINUX_INIT
+	/*
+	 * Detection tiers which were attempted, and which succeeded. Unlike pthread_once_t, the state can be upgraded to
+	 * a higher tier by a later call, and reset by cpuinfo_deinitialize.
+	 */
+	static pthread_mutex_t init_mutex = PTHREAD_MUTEX_INITIALIZER;
+	static uint32_t attempted_tiers = 0;
+	static uint32_t completed_tiers = 0;
+	/* Initialization calls which cpuinfo_deinitialize did not release yet */
+	static uint32_t init_references = 0;
+
+	static bool cpuinfo_linux_init_isa(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		cpuinfo_x86_init_isa();
+		return true;
+	#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+		return cpuinfo_arm_linux_init_isa();
+	#elif CPUINFO_ARCH_LOONGARCH64
+		cpuinfo_loongarch_linux_init_isa();
+		return true;
+	#endif
+	}
+
+	static void cpuinfo_linux_init_topology(bool update_isa) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		cpuinfo_x86_linux_init(update_isa);
+	#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+		cpuinfo_arm_linux_init(update_isa);
+	#elif CPUINFO_ARCH_LOONGARCH64
+		cpuinfo_loongarch_linux_init(update_isa);
+	#endif
+	}
+
+	/*
+	 * Runs the detection tiers which were not attempted yet, and returns whether all requested tiers succeeded.
+	 * If snapshot_path is not NULL, the topology is loaded from the snapshot, or detected and saved to it.
+	 */
+	static bool cpuinfo_linux_initialize_tiers(uint32_t flags, const char* snapshot_path) {
+		__atomic_add_fetch(&init_references, 1, __ATOMIC_RELAXED);
+
+		/* Every tier includes the lower tiers */
+		uint32_t tiers = flags;
+		if (tiers & CPUINFO_INITIALIZE_FULL) {
+			tiers |= CPUINFO_INITIALIZE_TOPOLOGY;
+		}
+		if (tiers & CPUINFO_INITIALIZE_TOPOLOGY) {
+			tiers |= CPUINFO_INITIALIZE_ISA;
+		}
+
+		if ((__atomic_load_n(&attempted_tiers, __ATOMIC_ACQUIRE) & tiers) == tiers) {
+			return (completed_tiers & tiers) == tiers;
+		}
+
+		pthread_mutex_lock(&init_mutex);
+		const uint32_t pending_tiers = tiers & ~attempted_tiers;
+		/*
+		 * Once the ISA tier is complete, other threads read cpuinfo_isa without locks, so upgrades to higher tiers must
+		 * not rewrite it.
+		 */
+		const bool isa_completed = (completed_tiers & CPUINFO_INITIALIZE_ISA) != 0;
+		if (pending_tiers & CPUINFO_INITIALIZE_TOPOLOGY) {
+			if (snapshot_path != NULL && cpuinfo_linux_load_snapshot(snapshot_path, !isa_completed)) {
+				/* Snapshots include all tiers */
+				completed_tiers = CPUINFO_INITIALIZE_ISA | CPUINFO_INITIALIZE_TOPOLOGY | CPUINFO_INITIALIZE_FULL;
+			} else {
+				/* Detection of the topology includes detection of the ISA */
+				cpuinfo_linux_init_topology(!isa_completed);
+				if (cpuinfo_is_initialized) {
+					completed_tiers |= CPUINFO_INITIALIZE_ISA | CPUINFO_INITIALIZE_TOPOLOGY;
+				}
+			}
+		} else if (pending_tiers & CPUINFO_INITIALIZE_ISA) {
+			if (cpuinfo_linux_init_isa()) {
+				completed_tiers |= CPUINFO_INITIALIZE_ISA;
+			}
+		}
+		if ((pending_tiers & CPUINFO_INITIALIZE_FULL) && (completed_tiers & CPUINFO_INITIALIZE_TOPOLOGY) &&
+			!(completed_tiers & CPUINFO_INITIALIZE_FULL))
+		{
+			/* Affinity mask, cgroups, and the C library may differ between processes that share a snapshot */
+			cpuinfo_linux_init_usable_processors(cpuinfo_linux_cpu_max);
+			cpuinfo_linux_init_current_cpu();
+			completed_tiers |= CPUINFO_INITIALIZE_FULL;
+
+			/* Refresh the missing or outdated snapshot for subsequent processes */
+			if (snapshot_path != NULL) {
+				cpuinfo_linux_save_snapshot(snapshot_path);
+			}
+		}
+		if (!isa_completed && (completed_tiers & CPUINFO_INITIALIZE_ISA)) {
+			cpuinfo_update_isa_features();
+		}
+		if ((pending_tiers & CPUINFO_INITIALIZE_TOPOLOGY) && (completed_tiers & CPUINFO_INITIALIZE_TOPOLOGY)) {
+			cpuinfo_update_topology();
+		}
+		__atomic_store_n(&attempted_tiers, attempted_tiers | pending_tiers, __ATOMIC_RELEASE);
+		const bool status = (completed_tiers & tiers) == tiers;
+		pthread_mutex_unlock(&init_mutex);
+		return status;
+	}
+#elif defined(_WIN32) || defined(__CYGWIN__)
 	static INIT_ONCE init_guard = INIT_ONCE_STATIC_INIT;
 #elif !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__)
 	static pthread_once_t init_guard = PTHREAD_ONCE_INIT;
@@ -26,7 +139,7 @@ bool CPUINFO_ABI cpuinfo_initialize(void) {
 	#if defined(__MACH__) && defined(__APPLE__)
 		pthread_once(&init_guard, &cpuinfo_x86_mach_init);
 	#elif defined(__linux__)
-		pthread_once(&init_guard, &cpuinfo_x86_linux_init);
+		cpuinfo_linux_initialize_tiers(CPUINFO_INITIALIZE_FULL, NULL);
 	#elif defined(_WIN32) || defined(__CYGWIN__)
 		InitOnceExecuteOnce(&init_guard, &cpuinfo_x86_windows_init, NULL, NULL);
 	#else
@@ -34,7 +147,7 @@ bool CPUINFO_ABI cpuinfo_initialize(void) {
 	#endif
 #elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
 	#if defined(__linux__)
-		pthread_once(&init_guard, &cpuinfo_arm_linux_init);
+		cpuinfo_linux_initialize_tiers(CPUINFO_INITIALIZE_FULL, NULL);
 	#elif defined(__MACH__) && defined(__APPLE__)
 		pthread_once(&init_guard, &cpuinfo_arm_mach_init);
 	#else
@@ -51,7 +164,7 @@ bool CPUINFO_ABI cpuinfo_initialize(void) {
 	#endif
 #elif CPUINFO_ARCH_LOONGARCH64
 	#if defined(__linux__)
-		pthread_once(&init_guard, &cpuinfo_loongarch_linux_init);
+		cpuinfo_linux_initialize_tiers(CPUINFO_INITIALIZE_FULL, NULL);
 	#else
 		cpuinfo_log_error("loongarch operating system is not supported in cpuinfo");
 	#endif
@@ -62,5 +175,96 @@ bool CPUINFO_ABI cpuinfo_initialize(void) {
 	return cpuinfo_is_initialized;
 }
 
+#if defined(CPUINFO_INITIALIZE_ON_LOAD) && CPUINFO_INITIALIZE_ON_LOAD && defined(__ELF__)
+	/*
+	 * Initializes cpuinfo before main, or when the shared library is loaded, so that even the first cpuinfo_initialize
+	 * call takes the fast path. A static library links this constructor only into programs calling cpuinfo_initialize.
+	 * Snapshots are not loaded in this mode, because cpuinfo_initialize_from_snapshot finds cpuinfo already initialized.
+	 */
+	static void __attribute__((__constructor__)) cpuinfo_initialize_on_load(void) {
+		cpuinfo_initialize();
+	}
+#endif
+
+bool CPUINFO_ABI cpuinfo_initialize_ex(uint32_t flags) {
+#if CPUINFO_LINUX_INIT
+	return cpuinfo_linux_initialize_tiers(flags, NULL);
+#else
+	/* Other platforms detect all tiers at once */
+	return cpuinfo_initialize();
+#endif
+}
+
+bool CPUINFO_ABI cpuinfo_probe_isa(void) {
+#if CPUINFO_LINUX_INIT
+	/* The ISA tier detects a superset of the probed information */
+	if (__atomic_load_n(&attempted_tiers, __ATOMIC_ACQUIRE) & CPUINFO_INITIALIZE_ISA) {
+		return (completed_tiers & CPUINFO_INITIALIZE_ISA) != 0;
+	}
+#else
+	if (cpuinfo_is_initialized) {
+		return true;
+	}
+#endif
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	const bool probed = cpuinfo_x86_probe_isa(&cpuinfo_isa);
+#elif (CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64) && defined(__linux__)
+	const bool probed = cpuinfo_arm_linux_probe_isa(&cpuinfo_isa);
+#else
+	const bool probed = false;
+#endif
+	if (probed) {
+		cpuinfo_update_isa_features();
+	}
+	return probed;
+}
+
+bool CPUINFO_ABI cpuinfo_initialize_from_snapshot(const char* path) {
+#if CPUINFO_LINUX_INIT
+	return cpuinfo_linux_initialize_tiers(CPUINFO_INITIALIZE_FULL, path);
+#else
+	return cpuinfo_initialize();
+#endif
+}
+
+bool CPUINFO_ABI cpuinfo_save_snapshot(const char* path) {
+#if CPUINFO_LINUX_INIT
+	return cpuinfo_linux_save_snapshot(path);
+#else
+	cpuinfo_log_warning("snapshots are not supported on this platform");
+	return false;
+#endif
+}
+
 void CPUINFO_ABI cpuinfo_deinitialize(void) {
+#if CPUINFO_LINUX_INIT
+	pthread_mutex_lock(&init_mutex);
+	if (init_references == 0) {
+		cpuinfo_log_warning("cpuinfo_deinitialize called more times than cpuinfo initialization functions");
+		pthread_mutex_unlock(&init_mutex);
+		return;
+	}
+	if (__atomic_sub_fetch(&init_references, 1, __ATOMIC_RELAXED) != 0) {
+		/* Other users still hold pointers to the tables */
+		pthread_mutex_unlock(&init_mutex);
+		return;
+	}
+	if (cpuinfo_is_initialized) {
+		cpuinfo_is_initialized = false;
+		__sync_synchronize();
+
+		/* Detected tables live in one arena, except NUMA nodes, which are counted only during detection */
+		if (!cpuinfo_linux_release_snapshot()) {
+			cpuinfo_arena_free(&cpuinfo_tables_arena);
+			free(cpuinfo_nodes);
+		}
+		cpuinfo_linux_release_usable_processors();
+
+		cpuinfo_reset_tables();
+	}
+	completed_tiers = 0;
+	__atomic_store_n(&attempted_tiers, 0, __ATOMIC_RELEASE);
+	pthread_mutex_unlock(&init_mutex);
+#endif
 }
@@ -3,6 +3,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
+#include <limits.h>
+
+#include <sys/types.h>
 
 #include <cpuinfo.h>
 #include <cpuinfo/common.h>
@@ -21,10 +24,13 @@
 #define CPUINFO_LINUX_FLAG_PACKAGE_CLUSTER    UINT32_C(0x00000400)
 #define CPUINFO_LINUX_FLAG_PROC_CPUINFO       UINT32_C(0x00000800)
 #define CPUINFO_LINUX_FLAG_VALID              UINT32_C(0x00001000)
+#define CPUINFO_LINUX_FLAG_DIE_ID             UINT32_C(0x00002000)
 
 
 typedef bool (*cpuinfo_cpulist_callback)(uint32_t, uint32_t, void*);
 CPUINFO_INTERNAL bool cpuinfo_linux_parse_cpulist(const char* filename, cpuinfo_cpulist_callback callback, void* context);
+CPUINFO_INTERNAL bool cpuinfo_linux_parse_cpulist_text(const char* text_start, const char* text_end,
+	cpuinfo_cpulist_callback callback, void* context);
 typedef bool (*cpuinfo_smallfile_callback)(const char*, const char*, void*);
 CPUINFO_INTERNAL bool cpuinfo_linux_parse_small_file(const char* filename, size_t buffer_size, cpuinfo_smallfile_callback, void* context);
 typedef bool (*cpuinfo_line_callback)(const char*, const char*, void*, uint64_t);
@@ -37,13 +43,81 @@ CPUINFO_INTERNAL uint32_t cpuinfo_linux_get_processor_min_frequency(uint32_t pro
 CPUINFO_INTERNAL uint32_t cpuinfo_linux_get_processor_max_frequency(uint32_t processor);
 CPUINFO_INTERNAL bool cpuinfo_linux_get_processor_package_id(uint32_t processor, uint32_t package_id[restrict static 1]);
 CPUINFO_INTERNAL bool cpuinfo_linux_get_processor_core_id(uint32_t processor, uint32_t core_id[restrict static 1]);
+CPUINFO_INTERNAL bool cpuinfo_linux_get_processor_die_id(uint32_t processor, uint32_t die_id[restrict static 1]);
 
 CPUINFO_INTERNAL bool cpuinfo_linux_detect_possible_processors(uint32_t max_processors_count,
 	uint32_t* processor0_flags, uint32_t processor_struct_size, uint32_t possible_flag);
 CPUINFO_INTERNAL bool cpuinfo_linux_detect_present_processors(uint32_t max_processors_count,
 	uint32_t* processor0_flags, uint32_t processor_struct_size, uint32_t present_flag);
 
+/* Maximum length of a path relative to /sys/devices/system/cpu, including the terminating null character */
+#define CPUINFO_LINUX_SYSFS_PATH_MAX 64
+
+struct cpuinfo_linux_sysfs_file {
+	/* Path relative to /sys/devices/system/cpu */
+	char path[CPUINFO_LINUX_SYSFS_PATH_MAX];
+	char* buffer;
+	size_t buffer_size;
+	/* Number of bytes read, or -1 if the file could not be read. Equals buffer_size if the content is truncated. */
+	ssize_t size;
+};
+
+/*
+ * Reads a batch of files in /sys/devices/system/cpu. Files are opened relative to a single directory descriptor.
+ * If cpuinfo is built with CPUINFO_LINUX_IO_URING=1, large batches are submitted through io_uring when the kernel
+ * supports it, and read sequentially otherwise.
+ */
+CPUINFO_INTERNAL void cpuinfo_linux_read_sysfs_files(
+	uint32_t files_count,
+	struct cpuinfo_linux_sysfs_file files[restrict static files_count]);
+
+enum cpuinfo_linux_processor_attribute {
+	cpuinfo_linux_processor_attribute_max_frequency,
+	cpuinfo_linux_processor_attribute_min_frequency,
+	cpuinfo_linux_processor_attribute_package_id,
+	cpuinfo_linux_processor_attribute_core_id,
+	cpuinfo_linux_processor_attribute_die_id,
+};
+
+struct cpuinfo_linux_processor_field {
+	enum cpuinfo_linux_processor_attribute attribute;
+	/* Address of the field in the first processor structure */
+	uint32_t* processor0_value;
+	/* Flag to set on processors where the attribute was parsed */
+	uint32_t flag;
+};
+
+/*
+ * Reads numeric attributes of all processors which have all of the required flags set in one batch.
+ * Zero frequencies are treated as unknown, like in cpuinfo_linux_get_processor_max_frequency.
+ */
+CPUINFO_INTERNAL void cpuinfo_linux_read_processor_attributes(
+	uint32_t max_processors_count,
+	uint32_t* processor0_flags,
+	uint32_t processor_struct_size,
+	uint32_t required_flags,
+	uint32_t fields_count,
+	const struct cpuinfo_linux_processor_field fields[restrict static fields_count]);
+
 typedef bool (*cpuinfo_siblings_callback)(uint32_t, uint32_t, uint32_t, void*);
+/*
+ * Read core_siblings_list or thread_siblings_list of all processors which have all of the required flags set in one
+ * batch, and report the siblings of each processor in the order of processor numbers.
+ */
+CPUINFO_INTERNAL void cpuinfo_linux_detect_all_core_siblings(
+	uint32_t max_processors_count,
+	const uint32_t* processor0_flags,
+	uint32_t processor_struct_size,
+	uint32_t required_flags,
+	cpuinfo_siblings_callback callback,
+	void* context);
+CPUINFO_INTERNAL void cpuinfo_linux_detect_all_thread_siblings(
+	uint32_t max_processors_count,
+	const uint32_t* processor0_flags,
+	uint32_t processor_struct_size,
+	uint32_t required_flags,
+	cpuinfo_siblings_callback callback,
+	void* context);
 CPUINFO_INTERNAL bool cpuinfo_linux_detect_core_siblings(
 	uint32_t max_processors_count,
 	uint32_t processor,
@@ -55,5 +129,48 @@ CPUINFO_INTERNAL bool cpuinfo_linux_detect_thread_siblings(
 	cpuinfo_siblings_callback callback,
 	void* context);
 
+CPUINFO_INTERNAL bool cpuinfo_linux_detect_nodes(
+	uint32_t max_processors_count,
+	uint32_t processors_count,
+	struct cpuinfo_processor processors[restrict static processors_count],
+	uint32_t cores_count,
+	struct cpuinfo_core cores[restrict static cores_count],
+	struct cpuinfo_node* nodes[restrict static 1],
+	uint32_t nodes_count[restrict static 1]);
+
+CPUINFO_INTERNAL void cpuinfo_linux_init_usable_processors(uint32_t max_processors_count);
+CPUINFO_INTERNAL void cpuinfo_linux_release_usable_processors(void);
+
+/* Returns the Linux number of the processor that executes the calling thread, or UINT32_MAX on failure */
+extern CPUINFO_INTERNAL uint32_t (*cpuinfo_linux_get_current_cpu)(void);
+CPUINFO_INTERNAL void cpuinfo_linux_init_current_cpu(void);
+
+CPUINFO_INTERNAL bool cpuinfo_linux_save_snapshot(const char* path);
+/* Loads the tables from a snapshot, and the ISA extensions unless update_isa is false */
+CPUINFO_INTERNAL bool cpuinfo_linux_load_snapshot(const char* path, bool update_isa);
+/* Unmaps the loaded snapshot, and returns false if the tables were not loaded from a snapshot */
+CPUINFO_INTERNAL bool cpuinfo_linux_release_snapshot(void);
+
+struct cpuinfo_linux_cgroup_paths {
+	/* Controllers of the v1 hierarchy with the requested controller, e.g. "cpu,cpuacct" */
+	char v1_controllers[64];
+	/* Path of the cgroup in the v1 hierarchy, or empty if the controller is not attached to a v1 hierarchy */
+	char v1_path[PATH_MAX];
+	/* Path of the cgroup in the v2 unified hierarchy, or empty if there is no v2 hierarchy */
+	char v2_path[PATH_MAX];
+};
+
+CPUINFO_INTERNAL bool cpuinfo_linux_detect_cgroup_paths(
+	const char* controller,
+	struct cpuinfo_linux_cgroup_paths paths[restrict static 1]);
+CPUINFO_INTERNAL bool cpuinfo_linux_format_cgroup_filename(
+	const struct cpuinfo_linux_cgroup_paths paths[restrict static 1],
+	bool v1,
+	const char* cgroup_path,
+	const char* filename,
+	char formatted_filename[restrict static PATH_MAX]);
+CPUINFO_INTERNAL bool cpuinfo_linux_get_parent_cgroup(char cgroup_path[restrict static PATH_MAX]);
+CPUINFO_INTERNAL bool cpuinfo_linux_get_cpu_quota(uint32_t max_processors[restrict static 1]);
+
 extern CPUINFO_INTERNAL const struct cpuinfo_processor** cpuinfo_linux_cpu_to_processor_map;
 extern CPUINFO_INTERNAL const struct cpuinfo_core** cpuinfo_linux_cpu_to_core_map;
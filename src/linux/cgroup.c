@@ -0,0 +1,294 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+#include <linux/api.h>
+#include <cpuinfo/log.h>
+
+
+#define PROC_SELF_CGROUP_FILENAME "/proc/self/cgroup"
+#define CGROUP_V1_ROOT "/sys/fs/cgroup/"
+#define CGROUP_V2_ROOT "/sys/fs/cgroup"
+
+/* Lines of /proc/self/cgroup contain a cgroup path, which can be as long as any path */
+#define PROC_SELF_CGROUP_BUFFER_SIZE (PATH_MAX + 64)
+
+/* Period of CFS bandwidth control is at most 1 second, and each number in quota files takes at most 20 characters */
+#define CPU_QUOTA_BUFFER_SIZE 64
+
+
+struct cgroup_context {
+	const char* controller;
+	size_t controller_length;
+	struct cpuinfo_linux_cgroup_paths* paths;
+};
+
+/* Returns true if the comma-separated list of controllers in [list_start, list_end) contains the controller */
+static bool has_controller(const char* list_start, const char* list_end, const char* controller, size_t controller_length) {
+	const char* entry_start = list_start;
+	while (entry_start != list_end) {
+		const char* entry_end = entry_start;
+		while (entry_end != list_end && *entry_end != ',') {
+			entry_end++;
+		}
+		if ((size_t) (entry_end - entry_start) == controller_length && memcmp(entry_start, controller, controller_length) == 0) {
+			return true;
+		}
+		if (entry_end == list_end) {
+			break;
+		}
+		entry_start = entry_end + 1;
+	}
+	return false;
+}
+
+/*
+ * Parses a line of /proc/self/cgroup in the format "hierarchy-ID:controller-list:cgroup-path".
+ * The v2 unified hierarchy has ID 0 and an empty list of controllers.
+ */
+static bool cgroup_line_parser(const char* line_start, const char* line_end, void* context, uint64_t line_number) {
+	struct cgroup_context* cgroup_context = (struct cgroup_context*) context;
+	if (line_start == line_end) {
+		return true;
+	}
+
+	const char* hierarchy_end = (const char*) memchr(line_start, ':', (size_t) (line_end - line_start));
+	if (hierarchy_end == NULL) {
+		cpuinfo_log_info("ignore line %"PRIu64" in %s: missing controller list", line_number, PROC_SELF_CGROUP_FILENAME);
+		return true;
+	}
+	const char* controllers_start = hierarchy_end + 1;
+	const char* controllers_end = (const char*) memchr(controllers_start, ':', (size_t) (line_end - controllers_start));
+	if (controllers_end == NULL) {
+		cpuinfo_log_info("ignore line %"PRIu64" in %s: missing cgroup path", line_number, PROC_SELF_CGROUP_FILENAME);
+		return true;
+	}
+	const char* path_start = controllers_end + 1;
+	const size_t path_length = (size_t) (line_end - path_start);
+	if (path_length == 0 || *path_start != '/') {
+		cpuinfo_log_info("ignore line %"PRIu64" in %s: invalid cgroup path", line_number, PROC_SELF_CGROUP_FILENAME);
+		return true;
+	}
+
+	char* path = NULL;
+	const bool is_unified = (hierarchy_end - line_start == 1) && (*line_start == '0') && (controllers_start == controllers_end);
+	if (is_unified) {
+		path = cgroup_context->paths->v2_path;
+	} else if (has_controller(controllers_start, controllers_end, cgroup_context->controller, cgroup_context->controller_length)) {
+		/* The v1 hierarchy is mounted in a directory named after its controllers, e.g. /sys/fs/cgroup/cpu,cpuacct */
+		const size_t controllers_length = (size_t) (controllers_end - controllers_start);
+		if (controllers_length >= sizeof(cgroup_context->paths->v1_controllers)) {
+			cpuinfo_log_warning("ignore %zu-character controller list in %s", controllers_length, PROC_SELF_CGROUP_FILENAME);
+			return true;
+		}
+		memcpy(cgroup_context->paths->v1_controllers, controllers_start, controllers_length);
+		cgroup_context->paths->v1_controllers[controllers_length] = '\0';
+		path = cgroup_context->paths->v1_path;
+	} else {
+		return true;
+	}
+
+	if (path_length >= PATH_MAX) {
+		cpuinfo_log_warning("ignore %zu-character cgroup path in %s", path_length, PROC_SELF_CGROUP_FILENAME);
+		return true;
+	}
+	memcpy(path, path_start, path_length);
+	path[path_length] = '\0';
+	return true;
+}
+
+bool cpuinfo_linux_detect_cgroup_paths(const char* controller, struct cpuinfo_linux_cgroup_paths paths[restrict static 1]) {
+	memset(paths, 0, sizeof(struct cpuinfo_linux_cgroup_paths));
+	struct cgroup_context context = {
+		.controller = controller,
+		.controller_length = strlen(controller),
+		.paths = paths,
+	};
+	if (!cpuinfo_linux_parse_multiline_file(PROC_SELF_CGROUP_FILENAME, PROC_SELF_CGROUP_BUFFER_SIZE,
+		cgroup_line_parser, &context))
+	{
+		cpuinfo_log_info("failed to parse cgroups of the process from %s", PROC_SELF_CGROUP_FILENAME);
+		return false;
+	}
+	return paths->v1_path[0] != '\0' || paths->v2_path[0] != '\0';
+}
+
+bool cpuinfo_linux_format_cgroup_filename(
+	const struct cpuinfo_linux_cgroup_paths paths[restrict static 1],
+	bool v1,
+	const char* cgroup_path,
+	const char* filename,
+	char formatted_filename[restrict static PATH_MAX])
+{
+	/* Path of the root cgroup is "/": omit it to avoid a double separator */
+	if (cgroup_path[1] == '\0') {
+		cgroup_path = "";
+	}
+	int chars_formatted;
+	if (v1) {
+		chars_formatted = snprintf(formatted_filename, PATH_MAX, "%s%s%s/%s",
+			CGROUP_V1_ROOT, paths->v1_controllers, cgroup_path, filename);
+	} else {
+		chars_formatted = snprintf(formatted_filename, PATH_MAX, "%s%s/%s",
+			CGROUP_V2_ROOT, cgroup_path, filename);
+	}
+	if ((unsigned int) chars_formatted >= PATH_MAX) {
+		cpuinfo_log_warning("failed to format path to %s for cgroup %s", filename, cgroup_path);
+		return false;
+	}
+	return true;
+}
+
+bool cpuinfo_linux_get_parent_cgroup(char cgroup_path[restrict static PATH_MAX]) {
+	char* last_separator = strrchr(cgroup_path, '/');
+	if (last_separator == NULL || cgroup_path[1] == '\0') {
+		return false;
+	}
+	if (last_separator == cgroup_path) {
+		last_separator[1] = '\0';
+	} else {
+		last_separator[0] = '\0';
+	}
+	return true;
+}
+
+struct cpu_quota_context {
+	/* Number of values in the file: 2 for cpu.max, 1 for cpu.cfs_quota_us and cpu.cfs_period_us */
+	uint32_t values_count;
+	uint32_t parsed_count;
+	/* UINT64_MAX for "max" or negative values, which indicate no limit */
+	uint64_t values[2];
+};
+
+static bool cpu_quota_parser(const char* text_start, const char* text_end, void* context) {
+	struct cpu_quota_context* cpu_quota_context = (struct cpu_quota_context*) context;
+	const char* text = text_start;
+	while (text != text_end && cpu_quota_context->parsed_count < cpu_quota_context->values_count) {
+		/* Skip separators */
+		if (*text == ' ' || *text == '\n') {
+			text++;
+			continue;
+		}
+
+		uint64_t value = 0;
+		if (*text == '-') {
+			/* Negative quota in cgroup v1 indicates no limit */
+			value = UINT64_MAX;
+			do {
+				text++;
+			} while (text != text_end && *text >= '0' && *text <= '9');
+		} else if (text_end - text >= 3 && memcmp(text, "max", 3) == 0) {
+			value = UINT64_MAX;
+			text += 3;
+		} else if (*text >= '0' && *text <= '9') {
+			do {
+				const uint64_t digit = (uint64_t) (*text - '0');
+				if (value > (UINT64_MAX - digit) / 10) {
+					cpuinfo_log_warning("failed to parse CPU quota: value overflows 64 bits");
+					return false;
+				}
+				value = value * 10 + digit;
+				text++;
+			} while (text != text_end && *text >= '0' && *text <= '9');
+		} else {
+			cpuinfo_log_warning("failed to parse CPU quota: unexpected character %c", *text);
+			return false;
+		}
+		cpu_quota_context->values[cpu_quota_context->parsed_count++] = value;
+	}
+	return true;
+}
+
+static bool parse_cpu_quota_file(const char* filename, uint32_t values_count, uint64_t values[restrict static values_count]) {
+	struct cpu_quota_context context = {
+		.values_count = values_count,
+	};
+	if (!cpuinfo_linux_parse_small_file(filename, CPU_QUOTA_BUFFER_SIZE, cpu_quota_parser, &context)) {
+		return false;
+	}
+	if (context.parsed_count != values_count) {
+		cpuinfo_log_warning("failed to parse CPU quota from %s: expected %"PRIu32" values, parsed %"PRIu32,
+			filename, values_count, context.parsed_count);
+		return false;
+	}
+	memcpy(values, context.values, values_count * sizeof(uint64_t));
+	return true;
+}
+
+/*
+ * Reads quota and period of CFS bandwidth control for a cgroup.
+ * Returns false if the files do not exist; sets quota to UINT64_MAX if bandwidth is not limited.
+ */
+static bool read_cpu_quota(
+	const struct cpuinfo_linux_cgroup_paths paths[restrict static 1],
+	bool v1,
+	const char* cgroup_path,
+	uint64_t quota[restrict static 1],
+	uint64_t period[restrict static 1])
+{
+	char filename[PATH_MAX];
+	if (v1) {
+		if (!cpuinfo_linux_format_cgroup_filename(paths, true, cgroup_path, "cpu.cfs_quota_us", filename) ||
+			!parse_cpu_quota_file(filename, 1, quota))
+		{
+			return false;
+		}
+		if (!cpuinfo_linux_format_cgroup_filename(paths, true, cgroup_path, "cpu.cfs_period_us", filename) ||
+			!parse_cpu_quota_file(filename, 1, period))
+		{
+			return false;
+		}
+	} else {
+		/* cpu.max contains "$MAX $PERIOD", where $MAX is either a quota in microseconds or "max" */
+		uint64_t values[2];
+		if (!cpuinfo_linux_format_cgroup_filename(paths, false, cgroup_path, "cpu.max", filename) ||
+			!parse_cpu_quota_file(filename, 2, values))
+		{
+			return false;
+		}
+		*quota = values[0];
+		*period = values[1];
+	}
+	return true;
+}
+
+bool cpuinfo_linux_get_cpu_quota(uint32_t max_processors[restrict static 1]) {
+	struct cpuinfo_linux_cgroup_paths* paths = calloc(1, sizeof(struct cpuinfo_linux_cgroup_paths));
+	if (paths == NULL) {
+		cpuinfo_log_warning("failed to allocate %zu bytes for cgroup paths", sizeof(struct cpuinfo_linux_cgroup_paths));
+		return false;
+	}
+
+	bool limited = false;
+	uint64_t min_processors = UINT64_MAX;
+	if (cpuinfo_linux_detect_cgroup_paths("cpu", paths)) {
+		/* Bandwidth limits of all ancestors apply: the effective limit is the strictest one */
+		const bool v1 = paths->v1_path[0] != '\0';
+		char* cgroup_path = v1 ? paths->v1_path : paths->v2_path;
+		do {
+			uint64_t quota = UINT64_MAX, period = 0;
+			if (read_cpu_quota(paths, v1, cgroup_path, &quota, &period) && quota != UINT64_MAX && period != 0) {
+				/* Round down to avoid throttling, but leave at least one processor */
+				uint64_t processors = quota / period;
+				if (processors == 0) {
+					processors = 1;
+				}
+				cpuinfo_log_debug("cgroup %s is limited to %"PRIu64" us of CPU time per %"PRIu64" us period",
+					cgroup_path, quota, period);
+				if (processors < min_processors) {
+					min_processors = processors;
+				}
+				limited = true;
+			}
+		} while (cpuinfo_linux_get_parent_cgroup(cgroup_path));
+	}
+	free(paths);
+
+	if (limited) {
+		*max_processors = min_processors < UINT32_MAX ? (uint32_t) min_processors : UINT32_MAX;
+	}
+	return limited;
+}
@@ -212,3 +212,18 @@ cleanup:
 	}
 	return status;
 }
+
+bool cpuinfo_linux_parse_cpulist_text(const char* text_start, const char* text_end,
+	cpuinfo_cpulist_callback callback, void* context)
+{
+	bool status = true;
+	const char* entry_start = text_start;
+	for (const char* entry_end = text_start; entry_end != text_end; entry_end++) {
+		if (*entry_end == ',') {
+			status &= parse_entry(entry_start, entry_end, callback, context);
+			entry_start = entry_end + 1;
+		}
+	}
+	status &= parse_entry(entry_start, text_end, callback, context);
+	return status;
+}
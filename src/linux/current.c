@@ -0,0 +1,149 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#if !defined(__NR_getcpu)
+	#include <asm-generic/unistd.h>
+#endif
+
+#include <cpuinfo.h>
+#include <linux/api.h>
+#include <cpuinfo/internal-api.h>
+#include <cpuinfo/log.h>
+
+
+/*
+ * Restartable sequences: since version 2.35, glibc registers a struct rseq for every thread, and exports its offset
+ * from the thread pointer in __rseq_offset and its size in __rseq_size (0 if registration is disabled).
+ * The kernel keeps the cpu_id field of the registered structure up to date whenever the thread is scheduled.
+ */
+#if defined(__GLIBC__) && (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__))
+	#define CPUINFO_LINUX_RSEQ 1
+
+	extern const ptrdiff_t __rseq_offset __attribute__((__weak__));
+	extern const unsigned int __rseq_size __attribute__((__weak__));
+
+	/* Offset of the cpu_id field in struct rseq, following the 32-bit cpu_id_start field */
+	#define RSEQ_CPU_ID_OFFSET 4
+#else
+	#define CPUINFO_LINUX_RSEQ 0
+#endif
+
+
+static uint32_t get_current_cpu_syscall(void) {
+	/* Initializing this variable silences a MemorySanitizer error. */
+	unsigned cpu = 0;
+	if CPUINFO_UNLIKELY(syscall(__NR_getcpu, &cpu, NULL, NULL) != 0) {
+		return UINT32_MAX;
+	}
+	return (uint32_t) cpu;
+}
+
+/* glibc implements sched_getcpu through the vDSO getcpu function where the kernel provides one */
+static uint32_t get_current_cpu_vdso(void) {
+	const int cpu = sched_getcpu();
+	if CPUINFO_UNLIKELY(cpu < 0) {
+		return UINT32_MAX;
+	}
+	return (uint32_t) cpu;
+}
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	/*
+	 * Linux stores the processor number in bits 0-11 and the NUMA node in bits 12-31 of the TSC_AUX MSR,
+	 * which the RDPID and RDTSCP instructions read in user mode. Processor numbers above 4095 do not fit.
+	 */
+	#define TSC_AUX_CPU_MASK UINT32_C(0x00000FFF)
+	#define TSC_AUX_MAX_CPUS (TSC_AUX_CPU_MASK + 1)
+
+	static uint32_t get_current_cpu_rdpid(void) {
+		uintptr_t tsc_aux;
+		/* rdpid %eax / rdpid %rax, encoded manually for older assemblers */
+		__asm__ __volatile__(".byte 0xF3, 0x0F, 0xC7, 0xF8" : "=a" (tsc_aux));
+		return (uint32_t) tsc_aux & TSC_AUX_CPU_MASK;
+	}
+
+	static uint32_t get_current_cpu_rdtscp(void) {
+		uint32_t tsc_lo, tsc_hi, tsc_aux;
+		__asm__ __volatile__("rdtscp" : "=a" (tsc_lo), "=d" (tsc_hi), "=c" (tsc_aux));
+		return tsc_aux & TSC_AUX_CPU_MASK;
+	}
+#endif
+
+#if CPUINFO_LINUX_RSEQ
+	/* Fallback for threads where glibc failed to register rseq */
+	static uint32_t (*rseq_fallback)(void) = get_current_cpu_syscall;
+
+	static inline const volatile int32_t* get_rseq_cpu_id(void) {
+		uintptr_t thread_pointer;
+		#if defined(__x86_64__)
+			__asm__("movq %%fs:0, %0" : "=r" (thread_pointer));
+		#elif defined(__i386__)
+			__asm__("movl %%gs:0, %0" : "=r" (thread_pointer));
+		#elif defined(__aarch64__)
+			__asm__("mrs %0, tpidr_el0" : "=r" (thread_pointer));
+		#endif
+		return (const volatile int32_t*) (thread_pointer + __rseq_offset + RSEQ_CPU_ID_OFFSET);
+	}
+
+	static uint32_t get_current_cpu_rseq(void) {
+		const int32_t cpu = *get_rseq_cpu_id();
+		if CPUINFO_UNLIKELY(cpu < 0) {
+			return rseq_fallback();
+		}
+		return (uint32_t) cpu;
+	}
+#endif
+
+uint32_t (*cpuinfo_linux_get_current_cpu)(void) = get_current_cpu_syscall;
+
+/*
+ * Checks that a method agrees with the getcpu system call.
+ * The thread may migrate between the calls, so the check accepts a match on any of several attempts.
+ */
+static bool validate_current_cpu_method(uint32_t (*method)(void), const char* name) {
+	for (uint32_t attempt = 0; attempt < 3; attempt++) {
+		const uint32_t syscall_cpu = get_current_cpu_syscall();
+		const uint32_t method_cpu = method();
+		if (syscall_cpu != UINT32_MAX && syscall_cpu == method_cpu && get_current_cpu_syscall() == syscall_cpu) {
+			return true;
+		}
+	}
+	cpuinfo_log_info("%s reports a processor different from getcpu system call: ignore it", name);
+	return false;
+}
+
+void cpuinfo_linux_init_current_cpu(void) {
+	uint32_t (*method)(void) = get_current_cpu_syscall;
+	const char* method_name = "getcpu system call";
+
+	if (validate_current_cpu_method(get_current_cpu_vdso, "sched_getcpu")) {
+		method = get_current_cpu_vdso;
+		method_name = "sched_getcpu";
+	}
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	if (cpuinfo_linux_cpu_max > TSC_AUX_MAX_CPUS) {
+		cpuinfo_log_debug("processor numbers up to %"PRIu32" do not fit into TSC_AUX: ignore RDPID and RDTSCP",
+			cpuinfo_linux_cpu_max - 1);
+	} else if (cpuinfo_isa.rdpid && validate_current_cpu_method(get_current_cpu_rdpid, "RDPID")) {
+		method = get_current_cpu_rdpid;
+		method_name = "RDPID";
+	} else if (cpuinfo_isa.rdtscp && validate_current_cpu_method(get_current_cpu_rdtscp, "RDTSCP")) {
+		method = get_current_cpu_rdtscp;
+		method_name = "RDTSCP";
+	}
+#endif
+#if CPUINFO_LINUX_RSEQ
+	if (&__rseq_size != NULL && &__rseq_offset != NULL && __rseq_size != 0 && *get_rseq_cpu_id() >= 0) {
+		rseq_fallback = method;
+		method = get_current_cpu_rseq;
+		method_name = "rseq";
+	}
+#endif
+
+	cpuinfo_log_debug("using %s to identify the current processor", method_name);
+	cpuinfo_linux_get_current_cpu = method;
+}
@@ -0,0 +1,329 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <linux/api.h>
+#include <cpuinfo/arena.h>
+#include <cpuinfo/log.h>
+
+
+#define STRINGIFY(token) #token
+
+#define ONLINE_NODELIST_FILENAME "/sys/devices/system/node/online"
+#define NODE_CPULIST_FILENAME_SIZE (sizeof("/sys/devices/system/node/node" STRINGIFY(UINT32_MAX) "/cpulist"))
+#define NODE_CPULIST_FILENAME_FORMAT "/sys/devices/system/node/node%" PRIu32 "/cpulist"
+#define NODE_DISTANCE_FILENAME_SIZE (sizeof("/sys/devices/system/node/node" STRINGIFY(UINT32_MAX) "/distance"))
+#define NODE_DISTANCE_FILENAME_FORMAT "/sys/devices/system/node/node%" PRIu32 "/distance"
+
+/* Distance from a node to itself, and the default distance to other nodes, as in ACPI SLIT */
+#define LOCAL_DISTANCE 10
+#define REMOTE_DISTANCE 20
+
+
+static bool max_node_number_parser(uint32_t node_list_start, uint32_t node_list_end, void* context) {
+	uint32_t* max_node_number_ptr = (uint32_t*) context;
+	const uint32_t node_list_last = node_list_end - 1;
+	if (*max_node_number_ptr < node_list_last) {
+		*max_node_number_ptr = node_list_last;
+	}
+	return true;
+}
+
+struct online_nodes_context {
+	uint32_t max_nodes_count;
+	uint32_t online_nodes_count;
+	/* Position of the node in the list of online nodes, or UINT32_MAX if the node is offline */
+	uint32_t* node_positions;
+};
+
+static bool online_nodes_parser(uint32_t node_list_start, uint32_t node_list_end, void* context) {
+	struct online_nodes_context* online_nodes_context = (struct online_nodes_context*) context;
+	for (uint32_t node = node_list_start; node < node_list_end; node++) {
+		if (node >= online_nodes_context->max_nodes_count) {
+			break;
+		}
+		online_nodes_context->node_positions[node] = online_nodes_context->online_nodes_count++;
+	}
+	return true;
+}
+
+struct node_cpus_context {
+	uint32_t node;
+	uint32_t max_processors_count;
+	uint32_t* linux_cpu_to_node_map;
+};
+
+static bool node_cpus_parser(uint32_t cpu_list_start, uint32_t cpu_list_end, void* context) {
+	struct node_cpus_context* node_cpus_context = (struct node_cpus_context*) context;
+	if (cpu_list_end > node_cpus_context->max_processors_count) {
+		cpuinfo_log_warning("ignore processors %"PRIu32"-%"PRIu32" of NUMA node %"PRIu32,
+			node_cpus_context->max_processors_count, cpu_list_end - 1, node_cpus_context->node);
+		cpu_list_end = node_cpus_context->max_processors_count;
+	}
+	for (uint32_t cpu = cpu_list_start; cpu < cpu_list_end; cpu++) {
+		node_cpus_context->linux_cpu_to_node_map[cpu] = node_cpus_context->node;
+	}
+	return true;
+}
+
+struct node_distance_context {
+	uint32_t online_nodes_count;
+	uint32_t parsed_count;
+	/* Distances to online nodes, in the order of the list of online nodes */
+	uint32_t* distances;
+};
+
+/* Locale-independent */
+inline static bool is_whitespace(char c) {
+	switch (c) {
+		case ' ':
+		case '\t':
+		case '\n':
+		case '\r':
+			return true;
+		default:
+			return false;
+	}
+}
+
+static bool node_distance_parser(const char* text_start, const char* text_end, void* context) {
+	struct node_distance_context* node_distance_context = (struct node_distance_context*) context;
+	const char* text = text_start;
+	while (text != text_end) {
+		if (is_whitespace(*text)) {
+			text++;
+			continue;
+		}
+
+		uint32_t distance = 0;
+		const char* number_start = text;
+		for (; text != text_end; text++) {
+			const uint32_t digit = (uint32_t) (uint8_t) (*text) - (uint32_t) '0';
+			if (digit >= 10) {
+				break;
+			}
+			distance = distance * UINT32_C(10) + digit;
+		}
+		if (text == number_start || (text != text_end && !is_whitespace(*text))) {
+			cpuinfo_log_warning("failed to parse NUMA distance list \"%.*s\": unexpected character '%c'",
+				(int) (text_end - text_start), text_start, *text);
+			return false;
+		}
+
+		if (node_distance_context->parsed_count < node_distance_context->online_nodes_count) {
+			node_distance_context->distances[node_distance_context->parsed_count] = distance;
+		}
+		node_distance_context->parsed_count += 1;
+	}
+	return node_distance_context->parsed_count == node_distance_context->online_nodes_count;
+}
+
+bool cpuinfo_linux_detect_nodes(
+	uint32_t max_processors_count,
+	uint32_t processors_count,
+	struct cpuinfo_processor processors[restrict static processors_count],
+	uint32_t cores_count,
+	struct cpuinfo_core cores[restrict static cores_count],
+	struct cpuinfo_node* nodes_ptr[restrict static 1],
+	uint32_t nodes_count_ptr[restrict static 1])
+{
+	bool status = false;
+	struct cpuinfo_arena scratch_arena = { NULL, 0 };
+	uint32_t* node_positions = NULL;
+	uint32_t* online_node_ids = NULL;
+	uint32_t* node_indices = NULL;
+	uint32_t* linux_cpu_to_node_map = NULL;
+	uint32_t* online_distances = NULL;
+	struct cpuinfo_node* nodes = NULL;
+
+	uint32_t max_node = 0;
+	const bool numa_supported =
+		cpuinfo_linux_parse_cpulist(ONLINE_NODELIST_FILENAME, max_node_number_parser, &max_node);
+	if (!numa_supported) {
+		/* Kernel built without CONFIG_NUMA: assume a single node which includes all processors */
+		cpuinfo_log_info("failed to parse the list of online NUMA nodes in %s: assume a single node",
+			ONLINE_NODELIST_FILENAME);
+		max_node = 0;
+	}
+	const uint32_t max_nodes_count = max_node + 1;
+
+	/* There are at most as many online nodes as node IDs */
+	const struct cpuinfo_arena_table scratch_tables[] = {
+		{ &node_positions, max_nodes_count, sizeof(uint32_t) },
+		{ &node_indices, max_nodes_count, sizeof(uint32_t) },
+		{ &online_node_ids, max_nodes_count, sizeof(uint32_t) },
+		{ &online_distances, max_nodes_count, sizeof(uint32_t) },
+		{ &linux_cpu_to_node_map, max_processors_count, sizeof(uint32_t) },
+	};
+	if (!cpuinfo_arena_allocate(&scratch_arena, CPUINFO_COUNT_OF(scratch_tables), scratch_tables)) {
+		cpuinfo_log_error("failed to allocate temporary NUMA node mapping entries");
+		goto cleanup;
+	}
+	for (uint32_t node = 0; node < max_nodes_count; node++) {
+		node_positions[node] = UINT32_MAX;
+		node_indices[node] = UINT32_MAX;
+	}
+	for (uint32_t cpu = 0; cpu < max_processors_count; cpu++) {
+		linux_cpu_to_node_map[cpu] = UINT32_MAX;
+	}
+
+	struct online_nodes_context online_nodes_context = {
+		.max_nodes_count = max_nodes_count,
+		.online_nodes_count = 0,
+		.node_positions = node_positions,
+	};
+	if (numa_supported) {
+		cpuinfo_linux_parse_cpulist(ONLINE_NODELIST_FILENAME, online_nodes_parser, &online_nodes_context);
+	}
+	uint32_t online_nodes_count = online_nodes_context.online_nodes_count;
+	if (online_nodes_count == 0) {
+		node_positions[0] = 0;
+		online_nodes_count = 1;
+	}
+	for (uint32_t node = 0; node < max_nodes_count; node++) {
+		if (node_positions[node] != UINT32_MAX) {
+			online_node_ids[node_positions[node]] = node;
+		}
+	}
+
+	/* Map Linux processor IDs to NUMA node IDs */
+	if (numa_supported) {
+		for (uint32_t position = 0; position < online_nodes_count; position++) {
+			const uint32_t node = online_node_ids[position];
+			char cpulist_filename[NODE_CPULIST_FILENAME_SIZE];
+			const int chars_formatted = snprintf(
+				cpulist_filename, NODE_CPULIST_FILENAME_SIZE, NODE_CPULIST_FILENAME_FORMAT, node);
+			if ((unsigned int) chars_formatted >= NODE_CPULIST_FILENAME_SIZE) {
+				cpuinfo_log_warning("failed to format filename for processors list of NUMA node %"PRIu32, node);
+				continue;
+			}
+
+			struct node_cpus_context node_cpus_context = {
+				.node = node,
+				.max_processors_count = max_processors_count,
+				.linux_cpu_to_node_map = linux_cpu_to_node_map,
+			};
+			if (!cpuinfo_linux_parse_cpulist(cpulist_filename, node_cpus_parser, &node_cpus_context)) {
+				/* Nodes without processors (e.g. memory-only nodes) have an empty list */
+				cpuinfo_log_info("failed to parse the list of processors for NUMA node %"PRIu32" from %s",
+					node, cpulist_filename);
+			}
+		}
+	}
+
+	/* Processors not listed on any node are attributed to the first online node */
+	uint32_t nodes_count = 0;
+	for (uint32_t i = 0; i < processors_count; i++) {
+		const uint32_t linux_id = (uint32_t) processors[i].linux_id;
+		uint32_t node = UINT32_MAX;
+		if (linux_id < max_processors_count) {
+			node = linux_cpu_to_node_map[linux_id];
+		}
+		if (node == UINT32_MAX) {
+			node = online_node_ids[0];
+			if (numa_supported) {
+				cpuinfo_log_warning("processor %"PRIu32" is not listed on any NUMA node: assume node %"PRIu32,
+					linux_id, node);
+			}
+		}
+		if (node_indices[node] == UINT32_MAX) {
+			node_indices[node] = 0;
+			nodes_count += 1;
+		}
+	}
+
+	/* Assign node indices in the order of node IDs */
+	uint32_t node_index = 0;
+	for (uint32_t position = 0; position < online_nodes_count; position++) {
+		const uint32_t node = online_node_ids[position];
+		if (node_indices[node] != UINT32_MAX) {
+			node_indices[node] = node_index++;
+		}
+	}
+	cpuinfo_log_debug("detected %"PRIu32" NUMA nodes with processors out of %"PRIu32" online NUMA nodes",
+		nodes_count, online_nodes_count);
+
+	/* Node descriptions are followed by nodes_count x nodes_count distance matrix in the same allocation */
+	const size_t nodes_size = nodes_count * sizeof(struct cpuinfo_node) + nodes_count * nodes_count * sizeof(uint32_t);
+	nodes = calloc(1, nodes_size);
+	if (nodes == NULL) {
+		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" NUMA nodes",
+			nodes_size, nodes_count);
+		goto cleanup;
+	}
+	uint32_t* distances = (uint32_t*) (nodes + nodes_count);
+
+	for (uint32_t position = 0; position < online_nodes_count; position++) {
+		const uint32_t node = online_node_ids[position];
+		const uint32_t index = node_indices[node];
+		if (index == UINT32_MAX) {
+			continue;
+		}
+
+		nodes[index].node_id = node;
+		nodes[index].distances = distances + index * nodes_count;
+
+		bool parsed_distances = false;
+		char distance_filename[NODE_DISTANCE_FILENAME_SIZE];
+		const int chars_formatted = snprintf(
+			distance_filename, NODE_DISTANCE_FILENAME_SIZE, NODE_DISTANCE_FILENAME_FORMAT, node);
+		if (numa_supported && (unsigned int) chars_formatted < NODE_DISTANCE_FILENAME_SIZE) {
+			struct node_distance_context node_distance_context = {
+				.online_nodes_count = online_nodes_count,
+				.parsed_count = 0,
+				.distances = online_distances,
+			};
+			/* Each distance takes at most 3 digits and a separator */
+			parsed_distances = cpuinfo_linux_parse_small_file(
+				distance_filename, 4 * online_nodes_count + 2, node_distance_parser, &node_distance_context);
+		}
+		if (!parsed_distances && numa_supported) {
+			cpuinfo_log_warning("failed to parse distances of NUMA node %"PRIu32" from %s: assume default distances",
+				node, distance_filename);
+		}
+
+		for (uint32_t other_position = 0; other_position < online_nodes_count; other_position++) {
+			const uint32_t other_index = node_indices[online_node_ids[other_position]];
+			if (other_index != UINT32_MAX) {
+				uint32_t distance = other_index == index ? LOCAL_DISTANCE : REMOTE_DISTANCE;
+				if (parsed_distances) {
+					distance = online_distances[other_position];
+				}
+				distances[index * nodes_count + other_index] = distance;
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < processors_count; i++) {
+		const uint32_t linux_id = (uint32_t) processors[i].linux_id;
+		uint32_t node = UINT32_MAX;
+		if (linux_id < max_processors_count) {
+			node = linux_cpu_to_node_map[linux_id];
+		}
+		if (node == UINT32_MAX) {
+			node = online_node_ids[0];
+		}
+		struct cpuinfo_node* processor_node = &nodes[node_indices[node]];
+		processors[i].node = processor_node;
+		processor_node->processor_count += 1;
+	}
+
+	for (uint32_t i = 0; i < cores_count; i++) {
+		/* Logical processors of a core always belong to the same node */
+		const struct cpuinfo_node* core_node = processors[cores[i].processor_start].node;
+		cores[i].node = core_node;
+		nodes[core_node - nodes].core_count += 1;
+	}
+
+	*nodes_ptr = nodes;
+	*nodes_count_ptr = nodes_count;
+	nodes = NULL;
+	status = true;
+
+cleanup:
+	cpuinfo_arena_free(&scratch_arena);
+	free(nodes);
+	return status;
+}
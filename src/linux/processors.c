@@ -13,6 +13,7 @@
 #endif
 
 #include <linux/api.h>
+#include <cpuinfo/arena.h>
 #include <cpuinfo/log.h>
 
 
@@ -30,6 +31,9 @@
 #define CORE_ID_FILENAME_SIZE (sizeof("/sys/devices/system/cpu/cpu" STRINGIFY(UINT32_MAX) "/topology/core_id"))
 #define CORE_ID_FILENAME_FORMAT "/sys/devices/system/cpu/cpu%" PRIu32 "/topology/core_id"
 #define CORE_ID_FILESIZE 32
+#define DIE_ID_FILENAME_SIZE (sizeof("/sys/devices/system/cpu/cpu" STRINGIFY(UINT32_MAX) "/topology/die_id"))
+#define DIE_ID_FILENAME_FORMAT "/sys/devices/system/cpu/cpu%" PRIu32 "/topology/die_id"
+#define DIE_ID_FILESIZE 32
 
 #define CORE_SIBLINGS_FILENAME_SIZE (sizeof("/sys/devices/system/cpu/cpu" STRINGIFY(UINT32_MAX) "/topology/core_siblings_list"))
 #define CORE_SIBLINGS_FILENAME_FORMAT "/sys/devices/system/cpu/cpu%" PRIu32 "/topology/core_siblings_list"
@@ -215,6 +219,28 @@ bool cpuinfo_linux_get_processor_package_id(uint32_t processor, uint32_t package
 	}
 }
 
+bool cpuinfo_linux_get_processor_die_id(uint32_t processor, uint32_t die_id_ptr[restrict static 1]) {
+	char die_id_filename[DIE_ID_FILENAME_SIZE];
+	const int chars_formatted = snprintf(
+		die_id_filename, DIE_ID_FILENAME_SIZE, DIE_ID_FILENAME_FORMAT, processor);
+	if ((unsigned int) chars_formatted >= DIE_ID_FILENAME_SIZE) {
+		cpuinfo_log_warning("failed to format filename for die id of processor %"PRIu32, processor);
+		return 0;
+	}
+
+	uint32_t die_id;
+	if (cpuinfo_linux_parse_small_file(die_id_filename, DIE_ID_FILESIZE, uint32_parser, &die_id)) {
+		cpuinfo_log_debug("parsed die id value of %"PRIu32" for logical processor %"PRIu32" from %s",
+			die_id, processor, die_id_filename);
+		*die_id_ptr = die_id;
+		return true;
+	} else {
+		cpuinfo_log_info("failed to parse die id for processor %"PRIu32" from %s",
+			processor, die_id_filename);
+		return false;
+	}
+}
+
 static bool max_processor_number_parser(uint32_t processor_list_start, uint32_t processor_list_end, void* context) {
 	uint32_t* processor_number_ptr = (uint32_t*) context;
 	const uint32_t processor_list_last = processor_list_end - 1;
@@ -408,3 +434,234 @@ bool cpuinfo_linux_detect_thread_siblings(
 	}
 }
 
+struct processor_attribute_info {
+	const char* name;
+	const char* filename;
+	bool zero_is_unknown;
+};
+
+static const struct processor_attribute_info processor_attributes[] = {
+	[cpuinfo_linux_processor_attribute_max_frequency] = {
+		.name = "max frequency",
+		.filename = "cpufreq/cpuinfo_max_freq",
+		.zero_is_unknown = true,
+	},
+	[cpuinfo_linux_processor_attribute_min_frequency] = {
+		.name = "min frequency",
+		.filename = "cpufreq/cpuinfo_min_freq",
+		.zero_is_unknown = true,
+	},
+	[cpuinfo_linux_processor_attribute_package_id] = {
+		.name = "package id",
+		.filename = "topology/physical_package_id",
+	},
+	[cpuinfo_linux_processor_attribute_core_id] = {
+		.name = "core id",
+		.filename = "topology/core_id",
+	},
+	[cpuinfo_linux_processor_attribute_die_id] = {
+		.name = "die id",
+		.filename = "topology/die_id",
+	},
+};
+
+/* Size of buffer for numeric attributes; cpulists which do not fit are parsed again with the streaming parser */
+#define ATTRIBUTE_BUFFER_SIZE 32
+#define CPULIST_BUFFER_SIZE 256
+
+static inline uint32_t* processor_field(uint32_t* processor0_field, uint32_t processor_struct_size, uint32_t processor) {
+	return (uint32_t*) ((uintptr_t) processor0_field + processor_struct_size * processor);
+}
+
+static uint32_t count_selected_processors(
+	uint32_t max_processors_count,
+	const uint32_t* processor0_flags,
+	uint32_t processor_struct_size,
+	uint32_t required_flags)
+{
+	uint32_t count = 0;
+	for (uint32_t processor = 0; processor < max_processors_count; processor++) {
+		const uint32_t flags = *processor_field((uint32_t*) processor0_flags, processor_struct_size, processor);
+		if ((flags & required_flags) == required_flags) {
+			count += 1;
+		}
+	}
+	return count;
+}
+
+void cpuinfo_linux_read_processor_attributes(
+	uint32_t max_processors_count,
+	uint32_t* processor0_flags,
+	uint32_t processor_struct_size,
+	uint32_t required_flags,
+	uint32_t fields_count,
+	const struct cpuinfo_linux_processor_field fields[restrict static fields_count])
+{
+	struct cpuinfo_arena arena = { NULL, 0 };
+	const uint32_t selected_count =
+		count_selected_processors(max_processors_count, processor0_flags, processor_struct_size, required_flags);
+	const size_t files_count = (size_t) selected_count * (size_t) fields_count;
+	if (files_count == 0) {
+		return;
+	}
+
+	struct cpuinfo_linux_sysfs_file* files = NULL;
+	char* buffers = NULL;
+	const struct cpuinfo_arena_table tables[] = {
+		{ &files, files_count, sizeof(struct cpuinfo_linux_sysfs_file) },
+		{ &buffers, files_count, ATTRIBUTE_BUFFER_SIZE },
+	};
+	if (!cpuinfo_arena_allocate(&arena, CPUINFO_COUNT_OF(tables), tables)) {
+		cpuinfo_log_error("failed to allocate buffers for %zu processor attribute files", files_count);
+		return;
+	}
+
+	size_t file_index = 0;
+	for (uint32_t processor = 0; processor < max_processors_count; processor++) {
+		const uint32_t flags = *processor_field(processor0_flags, processor_struct_size, processor);
+		if ((flags & required_flags) != required_flags) {
+			continue;
+		}
+		for (uint32_t i = 0; i < fields_count; i++) {
+			struct cpuinfo_linux_sysfs_file* file = &files[file_index];
+			snprintf(file->path, CPUINFO_LINUX_SYSFS_PATH_MAX, "cpu%" PRIu32 "/%s",
+				processor, processor_attributes[fields[i].attribute].filename);
+			file->buffer = &buffers[file_index * ATTRIBUTE_BUFFER_SIZE];
+			file->buffer_size = ATTRIBUTE_BUFFER_SIZE;
+			file_index += 1;
+		}
+	}
+
+	cpuinfo_linux_read_sysfs_files((uint32_t) files_count, files);
+
+	file_index = 0;
+	for (uint32_t processor = 0; processor < max_processors_count; processor++) {
+		uint32_t* flags = processor_field(processor0_flags, processor_struct_size, processor);
+		if ((*flags & required_flags) != required_flags) {
+			continue;
+		}
+		for (uint32_t i = 0; i < fields_count; i++) {
+			const struct cpuinfo_linux_sysfs_file* file = &files[file_index++];
+			const struct processor_attribute_info* attribute = &processor_attributes[fields[i].attribute];
+			if (file->size <= 0 || (size_t) file->size == file->buffer_size) {
+				cpuinfo_log_info("failed to parse %s for processor %"PRIu32" from %s",
+					attribute->name, processor, file->path);
+				continue;
+			}
+
+			const char* text_start = file->buffer;
+			const char* text_end = file->buffer + file->size;
+			uint32_t value = 0;
+			const char* parsed_end = parse_number(text_start, text_end, &value);
+			if (parsed_end == text_start) {
+				cpuinfo_log_info("failed to parse %s for processor %"PRIu32" from %s: \"%.*s\" is not an unsigned number",
+					attribute->name, processor, file->path, (int) (text_end - text_start), text_start);
+				continue;
+			}
+			if (attribute->zero_is_unknown && value == 0) {
+				continue;
+			}
+
+			cpuinfo_log_debug("parsed %s value of %"PRIu32" for logical processor %"PRIu32" from %s",
+				attribute->name, value, processor, file->path);
+			*processor_field(fields[i].processor0_value, processor_struct_size, processor) = value;
+			*flags |= fields[i].flag;
+		}
+	}
+
+	cpuinfo_arena_free(&arena);
+}
+
+static void detect_all_siblings(
+	const char* group_name,
+	const char* list_name,
+	bool (*detect_siblings)(uint32_t, uint32_t, cpuinfo_siblings_callback, void*),
+	uint32_t max_processors_count,
+	const uint32_t* processor0_flags,
+	uint32_t processor_struct_size,
+	uint32_t required_flags,
+	cpuinfo_siblings_callback callback,
+	void* context)
+{
+	struct cpuinfo_arena arena = { NULL, 0 };
+	const uint32_t files_count =
+		count_selected_processors(max_processors_count, processor0_flags, processor_struct_size, required_flags);
+	if (files_count == 0) {
+		return;
+	}
+
+	struct cpuinfo_linux_sysfs_file* files = NULL;
+	char* buffers = NULL;
+	const struct cpuinfo_arena_table tables[] = {
+		{ &files, files_count, sizeof(struct cpuinfo_linux_sysfs_file) },
+		{ &buffers, files_count, CPULIST_BUFFER_SIZE },
+	};
+	if (!cpuinfo_arena_allocate(&arena, CPUINFO_COUNT_OF(tables), tables)) {
+		cpuinfo_log_error("failed to allocate buffers for %"PRIu32" %s siblings files", files_count, group_name);
+		return;
+	}
+
+	/* Select processors before reading: callbacks may update the flags */
+	uint32_t file_index = 0;
+	for (uint32_t processor = 0; processor < max_processors_count; processor++) {
+		const uint32_t flags = *processor_field((uint32_t*) processor0_flags, processor_struct_size, processor);
+		if ((flags & required_flags) == required_flags) {
+			struct cpuinfo_linux_sysfs_file* file = &files[file_index];
+			snprintf(file->path, CPUINFO_LINUX_SYSFS_PATH_MAX, "cpu%" PRIu32 "/topology/%s", processor, list_name);
+			file->buffer = &buffers[(size_t) file_index * CPULIST_BUFFER_SIZE];
+			file->buffer_size = CPULIST_BUFFER_SIZE;
+			file_index += 1;
+		}
+	}
+
+	cpuinfo_linux_read_sysfs_files(files_count, files);
+
+	for (uint32_t i = 0; i < files_count; i++) {
+		const struct cpuinfo_linux_sysfs_file* file = &files[i];
+		uint32_t processor = 0;
+		parse_number(file->path + strlen("cpu"), file->path + strlen(file->path), &processor);
+
+		struct siblings_context siblings_context = {
+			.group_name = group_name,
+			.max_processors_count = max_processors_count,
+			.processor = processor,
+			.callback = callback,
+			.callback_context = context,
+		};
+		if ((size_t) file->size == file->buffer_size) {
+			/* The list does not fit into the buffer: parse it again with the streaming parser */
+			detect_siblings(max_processors_count, processor, callback, context);
+		} else if (file->size < 0 || !cpuinfo_linux_parse_cpulist_text(file->buffer, file->buffer + file->size,
+			(cpuinfo_cpulist_callback) siblings_parser, &siblings_context))
+		{
+			cpuinfo_log_info("failed to parse the list of %s siblings for processor %"PRIu32" from %s",
+				group_name, processor, file->path);
+		}
+	}
+
+	cpuinfo_arena_free(&arena);
+}
+
+void cpuinfo_linux_detect_all_core_siblings(
+	uint32_t max_processors_count,
+	const uint32_t* processor0_flags,
+	uint32_t processor_struct_size,
+	uint32_t required_flags,
+	cpuinfo_siblings_callback callback,
+	void* context)
+{
+	detect_all_siblings("package", "core_siblings_list", cpuinfo_linux_detect_core_siblings,
+		max_processors_count, processor0_flags, processor_struct_size, required_flags, callback, context);
+}
+
+void cpuinfo_linux_detect_all_thread_siblings(
+	uint32_t max_processors_count,
+	const uint32_t* processor0_flags,
+	uint32_t processor_struct_size,
+	uint32_t required_flags,
+	cpuinfo_siblings_callback callback,
+	void* context)
+{
+	detect_all_siblings("core", "thread_siblings_list", cpuinfo_linux_detect_thread_siblings,
+		max_processors_count, processor0_flags, processor_struct_size, required_flags, callback, context);
+}
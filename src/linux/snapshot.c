@@ -0,0 +1,808 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/utsname.h>
+
+#include <cpuinfo.h>
+#include <cpuinfo/internal-api.h>
+#include <cpuinfo/log.h>
+#include <linux/api.h>
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#include <x86/cpuid.h>
+	#include <x86/linux/api.h>
+#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#include <arm/linux/api.h>
+#elif CPUINFO_ARCH_LOONGARCH64
+	#include <loongarch/linux/api.h>
+#endif
+
+
+/*
+ * A snapshot is a single file with a header followed by sections, which hold copies of the arrays that cpuinfo
+ * detects during initialization. Pointers inside the arrays are stored as offsets from the start of the file, and
+ * relocated in place after the file is memory-mapped, so a snapshot does not depend on the address where it is loaded.
+ */
+
+#define SNAPSHOT_VERSION 4
+
+/* Sections start at cache line boundaries */
+#define SNAPSHOT_ALIGNMENT 64
+
+#define BOOT_ID_FILENAME "/proc/sys/kernel/random/boot_id"
+#define BOOT_ID_BUFFER_SIZE 64
+
+#define PRESENT_CPULIST_FILENAME "/sys/devices/system/cpu/present"
+#define ONLINE_CPULIST_FILENAME "/sys/devices/system/cpu/online"
+
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#define MIDR_FILENAME "/sys/devices/system/cpu/cpu0/regs/identification/midr_el1"
+	#define MIDR_BUFFER_SIZE 32
+#endif
+
+static const char snapshot_magic[8] = { 'C', 'P', 'U', 'I', 'N', 'F', 'O', 'S' };
+
+/* Mapping of the loaded snapshot, which holds the published tables until cpuinfo_deinitialize */
+static void* snapshot_image = NULL;
+static size_t snapshot_image_size = 0;
+
+enum snapshot_section {
+	snapshot_section_processors,
+	snapshot_section_cores,
+	snapshot_section_clusters,
+	snapshot_section_packages,
+	snapshot_section_dies,
+	snapshot_section_nodes,
+	snapshot_section_node_distances,
+	/* One section for each cache level, in the order of enum cpuinfo_cache_level */
+	snapshot_section_caches,
+	snapshot_section_uarchs = snapshot_section_caches + cpuinfo_cache_level_max,
+	snapshot_section_isa,
+	snapshot_section_linux_cpu_to_processor_map,
+	snapshot_section_linux_cpu_to_core_map,
+	snapshot_section_linux_cpu_to_uarch_index_map,
+	snapshot_section_max,
+};
+
+struct snapshot_section_header {
+	uint64_t offset;
+	uint32_t count;
+	uint32_t element_size;
+};
+
+/* Identifies the system where the snapshot was taken. The structure has no padding, so it can be compared with memcmp. */
+struct snapshot_signature {
+	char boot_id[40];
+	char kernel_release[68];
+	char kernel_version[68];
+	/*
+	 * x86: vendor string (EBX, ECX, EDX of CPUID leaf 0) and processor signature (EAX of CPUID leaf 1).
+	 * ARM: MIDR of the first logical processor.
+	 * LoongArch: processor ID (CPUCFG word 0).
+	 */
+	uint32_t processor[4];
+	/* Hashes of the lists of present and online logical processors, which change with CPU hotplug */
+	uint64_t present_processors_hash;
+	uint64_t online_processors_hash;
+};
+
+struct snapshot_header {
+	char magic[8];
+	uint32_t version;
+	/* Size of the header, which depends on the architecture and the size of pointers */
+	uint32_t header_size;
+	uint64_t size;
+	struct snapshot_signature signature;
+	uint32_t linux_cpu_max;
+	uint32_t max_cache_size;
+	struct snapshot_section_header sections[snapshot_section_max];
+};
+
+/* Location of the section contents in the memory of the process that saves the snapshot */
+struct snapshot_source {
+	const void* data;
+	uint32_t count;
+	uint32_t element_size;
+};
+
+static bool boot_id_parser(const char* text_start, const char* text_end, void* context) {
+	struct snapshot_signature* signature = (struct snapshot_signature*) context;
+	size_t length = (size_t) (text_end - text_start);
+	while (length != 0 && text_start[length - 1] == '\n') {
+		length--;
+	}
+	if (length == 0 || length >= sizeof(signature->boot_id)) {
+		cpuinfo_log_warning("failed to parse boot ID \"%.*s\"", (int) length, text_start);
+		return false;
+	}
+	memcpy(signature->boot_id, text_start, length);
+	return true;
+}
+
+/* Folds a range of processors into a FNV-1a hash of the processor list */
+static bool cpulist_hash_parser(uint32_t cpulist_start, uint32_t cpulist_end, void* context) {
+	uint64_t* hash = (uint64_t*) context;
+	const uint32_t range[2] = { cpulist_start, cpulist_end };
+	const unsigned char* bytes = (const unsigned char*) range;
+	for (size_t i = 0; i < sizeof(range); i++) {
+		*hash = (*hash ^ bytes[i]) * UINT64_C(0x00000100000001B3);
+	}
+	return true;
+}
+
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	static bool midr_parser(const char* text_start, const char* text_end, void* context) {
+		uint64_t* midr = (uint64_t*) context;
+		const char* text = text_start;
+		if (text_end - text >= 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+			text += 2;
+		}
+		uint64_t value = 0;
+		const char* digits_start = text;
+		for (; text != text_end && *text != '\n'; text++) {
+			uint32_t digit;
+			if (*text >= '0' && *text <= '9') {
+				digit = (uint32_t) (*text - '0');
+			} else if (*text >= 'a' && *text <= 'f') {
+				digit = (uint32_t) (*text - 'a') + 10;
+			} else if (*text >= 'A' && *text <= 'F') {
+				digit = (uint32_t) (*text - 'A') + 10;
+			} else {
+				cpuinfo_log_warning("failed to parse MIDR \"%.*s\": unexpected character '%c'",
+					(int) (text_end - text_start), text_start, *text);
+				return false;
+			}
+			value = (value << 4) | digit;
+		}
+		if (text == digits_start) {
+			return false;
+		}
+		*midr = value;
+		return true;
+	}
+#endif
+
+static bool get_snapshot_signature(struct snapshot_signature signature[restrict static 1]) {
+	memset(signature, 0, sizeof(struct snapshot_signature));
+
+	if (!cpuinfo_linux_parse_small_file(BOOT_ID_FILENAME, BOOT_ID_BUFFER_SIZE, boot_id_parser, signature)) {
+		cpuinfo_log_info("failed to read boot ID from %s", BOOT_ID_FILENAME);
+		return false;
+	}
+
+	struct utsname utsname;
+	if (uname(&utsname) != 0) {
+		cpuinfo_log_info("failed to query kernel version: %s", strerror(errno));
+		return false;
+	}
+	strncpy(signature->kernel_release, utsname.release, sizeof(signature->kernel_release) - 1);
+	strncpy(signature->kernel_version, utsname.version, sizeof(signature->kernel_version) - 1);
+
+	/* A snapshot taken before CPU hotplug describes a different set of processors */
+	signature->present_processors_hash = UINT64_C(0xCBF29CE484222325);
+	signature->online_processors_hash = UINT64_C(0xCBF29CE484222325);
+	if (!cpuinfo_linux_parse_cpulist(PRESENT_CPULIST_FILENAME, cpulist_hash_parser, &signature->present_processors_hash) ||
+		!cpuinfo_linux_parse_cpulist(ONLINE_CPULIST_FILENAME, cpulist_hash_parser, &signature->online_processors_hash))
+	{
+		cpuinfo_log_info("failed to read the lists of present and online processors");
+		return false;
+	}
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	const struct cpuid_regs leaf0 = cpuid(0);
+	signature->processor[0] = leaf0.ebx;
+	signature->processor[1] = leaf0.ecx;
+	signature->processor[2] = leaf0.edx;
+	if (leaf0.eax >= 1) {
+		signature->processor[3] = cpuid(1).eax;
+	}
+#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	/* Kernels before 4.7 do not report MIDR in sysfs: rely on the boot ID alone */
+	uint64_t midr = 0;
+	if (cpuinfo_linux_parse_small_file(MIDR_FILENAME, MIDR_BUFFER_SIZE, midr_parser, &midr)) {
+		signature->processor[0] = (uint32_t) midr;
+	}
+#elif CPUINFO_ARCH_LOONGARCH64
+	uint32_t prid;
+	__asm__ __volatile__("cpucfg %0, %1" : "=r" (prid) : "r" (0));
+	signature->processor[0] = prid;
+#endif
+	return true;
+}
+
+static void get_snapshot_sources(struct snapshot_source sources[restrict static snapshot_section_max]) {
+	sources[snapshot_section_processors] = (struct snapshot_source) {
+		cpuinfo_processors, cpuinfo_processors_count, sizeof(struct cpuinfo_processor) };
+	sources[snapshot_section_cores] = (struct snapshot_source) {
+		cpuinfo_cores, cpuinfo_cores_count, sizeof(struct cpuinfo_core) };
+	sources[snapshot_section_clusters] = (struct snapshot_source) {
+		cpuinfo_clusters, cpuinfo_clusters_count, sizeof(struct cpuinfo_cluster) };
+	sources[snapshot_section_packages] = (struct snapshot_source) {
+		cpuinfo_packages, cpuinfo_packages_count, sizeof(struct cpuinfo_package) };
+	sources[snapshot_section_dies] = (struct snapshot_source) {
+		cpuinfo_dies, cpuinfo_dies_count, sizeof(struct cpuinfo_die) };
+	sources[snapshot_section_nodes] = (struct snapshot_source) {
+		cpuinfo_nodes, cpuinfo_nodes_count, sizeof(struct cpuinfo_node) };
+	/* cpuinfo_linux_detect_nodes stores the matrix of distances between nodes right after the nodes */
+	sources[snapshot_section_node_distances] = (struct snapshot_source) {
+		cpuinfo_nodes_count != 0 ? cpuinfo_nodes[0].distances : NULL,
+		cpuinfo_nodes_count * cpuinfo_nodes_count, sizeof(uint32_t) };
+	for (uint32_t level = 0; level < cpuinfo_cache_level_max; level++) {
+		sources[snapshot_section_caches + level] = (struct snapshot_source) {
+			cpuinfo_cache[level], cpuinfo_cache_count[level], sizeof(struct cpuinfo_cache) };
+	}
+	sources[snapshot_section_uarchs] = (struct snapshot_source) {
+		cpuinfo_uarchs, cpuinfo_uarchs_count, sizeof(struct cpuinfo_uarch_info) };
+	sources[snapshot_section_isa] = (struct snapshot_source) { &cpuinfo_isa, 1, sizeof(cpuinfo_isa) };
+	sources[snapshot_section_linux_cpu_to_processor_map] = (struct snapshot_source) {
+		cpuinfo_linux_cpu_to_processor_map, cpuinfo_linux_cpu_max, sizeof(struct cpuinfo_processor*) };
+	sources[snapshot_section_linux_cpu_to_core_map] = (struct snapshot_source) {
+		cpuinfo_linux_cpu_to_core_map, cpuinfo_linux_cpu_max, sizeof(struct cpuinfo_core*) };
+	sources[snapshot_section_linux_cpu_to_uarch_index_map] = (struct snapshot_source) {
+		cpuinfo_linux_cpu_to_uarch_index_map, cpuinfo_linux_cpu_max, sizeof(uint32_t) };
+	for (uint32_t section = 0; section < snapshot_section_max; section++) {
+		if (sources[section].data == NULL) {
+			sources[section].count = 0;
+		}
+	}
+}
+
+/* Replaces a pointer to one of the detected arrays with the offset of its copy in the snapshot */
+static bool encode_pointer(
+	const struct snapshot_source sources[restrict static snapshot_section_max],
+	const struct snapshot_header header[restrict static 1],
+	void* field)
+{
+	uintptr_t address;
+	memcpy(&address, field, sizeof(address));
+	if (address == 0) {
+		return true;
+	}
+	for (uint32_t section = 0; section < snapshot_section_max; section++) {
+		const uintptr_t data = (uintptr_t) sources[section].data;
+		const size_t size = (size_t) sources[section].count * (size_t) sources[section].element_size;
+		if (address >= data && address - data < size) {
+			const uintptr_t offset = (uintptr_t) header->sections[section].offset + (address - data);
+			memcpy(field, &offset, sizeof(offset));
+			return true;
+		}
+	}
+	cpuinfo_log_error("failed to save snapshot: pointer %p does not refer to detected data", (const void*) address);
+	return false;
+}
+
+/*
+ * Replaces an offset in the snapshot with a pointer to an element of the section where the offset must point.
+ * The check guards against corrupted or mismatched snapshot files.
+ */
+static bool decode_pointer(
+	const struct snapshot_header header[restrict static 1],
+	enum snapshot_section section,
+	void* field)
+{
+	uintptr_t offset;
+	memcpy(&offset, field, sizeof(offset));
+	if (offset == 0) {
+		return true;
+	}
+	const struct snapshot_section_header* section_header = &header->sections[section];
+	const uint64_t section_size = (uint64_t) section_header->count * (uint64_t) section_header->element_size;
+	if (offset < section_header->offset || offset - section_header->offset >= section_size ||
+		(offset - section_header->offset) % section_header->element_size != 0)
+	{
+		cpuinfo_log_warning("invalid offset %"PRIu64" in snapshot section %"PRIu32, (uint64_t) offset, (uint32_t) section);
+		return false;
+	}
+	const uintptr_t address = (uintptr_t) header + offset;
+	memcpy(field, &address, sizeof(address));
+	return true;
+}
+
+bool cpuinfo_linux_save_snapshot(const char* path) {
+	bool status = false;
+	char* image = NULL;
+	int fd = -1;
+	char temp_path[PATH_MAX];
+	temp_path[0] = '\0';
+
+	if (!cpuinfo_is_initialized) {
+		cpuinfo_log_error("failed to save snapshot to %s: cpuinfo is not initialized", path);
+		return false;
+	}
+
+	struct snapshot_header header = { 0 };
+	memcpy(header.magic, snapshot_magic, sizeof(header.magic));
+	header.version = SNAPSHOT_VERSION;
+	header.header_size = (uint32_t) sizeof(struct snapshot_header);
+	if (!get_snapshot_signature(&header.signature)) {
+		cpuinfo_log_warning("failed to save snapshot to %s: cannot identify the system", path);
+		return false;
+	}
+	header.linux_cpu_max = cpuinfo_linux_cpu_max;
+	header.max_cache_size = cpuinfo_max_cache_size;
+
+	struct snapshot_source sources[snapshot_section_max];
+	get_snapshot_sources(sources);
+	uint64_t size = sizeof(struct snapshot_header);
+	for (uint32_t section = 0; section < snapshot_section_max; section++) {
+		header.sections[section].element_size = sources[section].element_size;
+		header.sections[section].count = sources[section].count;
+		if (sources[section].count != 0) {
+			size = (size + (SNAPSHOT_ALIGNMENT - 1)) & -(uint64_t) SNAPSHOT_ALIGNMENT;
+			header.sections[section].offset = size;
+			size += (uint64_t) sources[section].count * (uint64_t) sources[section].element_size;
+		}
+	}
+	header.size = size;
+
+	image = calloc(1, (size_t) size);
+	if (image == NULL) {
+		cpuinfo_log_error("failed to allocate %"PRIu64" bytes for snapshot", size);
+		goto cleanup;
+	}
+	memcpy(image, &header, sizeof(header));
+	for (uint32_t section = 0; section < snapshot_section_max; section++) {
+		if (sources[section].count != 0) {
+			memcpy(image + header.sections[section].offset, sources[section].data,
+				(size_t) sources[section].count * (size_t) sources[section].element_size);
+		}
+	}
+
+	struct cpuinfo_processor* processors =
+		(struct cpuinfo_processor*) (image + header.sections[snapshot_section_processors].offset);
+	for (uint32_t i = 0; i < cpuinfo_processors_count; i++) {
+		if (!encode_pointer(sources, &header, &processors[i].core) ||
+			!encode_pointer(sources, &header, &processors[i].cluster) ||
+			!encode_pointer(sources, &header, &processors[i].die) ||
+			!encode_pointer(sources, &header, &processors[i].package) ||
+			!encode_pointer(sources, &header, &processors[i].node) ||
+			!encode_pointer(sources, &header, &processors[i].cache.l1i) ||
+			!encode_pointer(sources, &header, &processors[i].cache.l1d) ||
+			!encode_pointer(sources, &header, &processors[i].cache.l2) ||
+			!encode_pointer(sources, &header, &processors[i].cache.l3) ||
+			!encode_pointer(sources, &header, &processors[i].cache.l4))
+		{
+			goto cleanup;
+		}
+	}
+	struct cpuinfo_core* cores = (struct cpuinfo_core*) (image + header.sections[snapshot_section_cores].offset);
+	for (uint32_t i = 0; i < cpuinfo_cores_count; i++) {
+		if (!encode_pointer(sources, &header, &cores[i].cluster) ||
+			!encode_pointer(sources, &header, &cores[i].die) ||
+			!encode_pointer(sources, &header, &cores[i].package) ||
+			!encode_pointer(sources, &header, &cores[i].node))
+		{
+			goto cleanup;
+		}
+	}
+	struct cpuinfo_cluster* clusters =
+		(struct cpuinfo_cluster*) (image + header.sections[snapshot_section_clusters].offset);
+	for (uint32_t i = 0; i < cpuinfo_clusters_count; i++) {
+		if (!encode_pointer(sources, &header, &clusters[i].package)) {
+			goto cleanup;
+		}
+	}
+	struct cpuinfo_die* dies = (struct cpuinfo_die*) (image + header.sections[snapshot_section_dies].offset);
+	for (uint32_t i = 0; i < cpuinfo_dies_count; i++) {
+		if (!encode_pointer(sources, &header, &dies[i].package)) {
+			goto cleanup;
+		}
+	}
+	struct cpuinfo_node* nodes = (struct cpuinfo_node*) (image + header.sections[snapshot_section_nodes].offset);
+	for (uint32_t i = 0; i < cpuinfo_nodes_count; i++) {
+		if (!encode_pointer(sources, &header, &nodes[i].distances)) {
+			goto cleanup;
+		}
+	}
+	for (uint32_t section = snapshot_section_linux_cpu_to_processor_map;
+		section <= snapshot_section_linux_cpu_to_core_map; section++)
+	{
+		void** map = (void**) (image + header.sections[section].offset);
+		for (uint32_t i = 0; i < header.sections[section].count; i++) {
+			if (!encode_pointer(sources, &header, &map[i])) {
+				goto cleanup;
+			}
+		}
+	}
+
+	/* Write to a temporary file and rename it, so that concurrent loaders never observe a partial snapshot */
+	if ((unsigned int) snprintf(temp_path, PATH_MAX, "%s.XXXXXX", path) >= PATH_MAX) {
+		cpuinfo_log_warning("failed to save snapshot: path %s is too long", path);
+		temp_path[0] = '\0';
+		goto cleanup;
+	}
+	fd = mkstemp(temp_path);
+	if (fd == -1) {
+		cpuinfo_log_warning("failed to create snapshot file %s: %s", temp_path, strerror(errno));
+		temp_path[0] = '\0';
+		goto cleanup;
+	}
+	size_t bytes_written = 0;
+	while (bytes_written < (size_t) size) {
+		const ssize_t chunk_size = write(fd, image + bytes_written, (size_t) size - bytes_written);
+		if (chunk_size < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			cpuinfo_log_warning("failed to write snapshot file %s: %s", temp_path, strerror(errno));
+			goto cleanup;
+		}
+		bytes_written += (size_t) chunk_size;
+	}
+	if (close(fd) != 0) {
+		fd = -1;
+		cpuinfo_log_warning("failed to write snapshot file %s: %s", temp_path, strerror(errno));
+		goto cleanup;
+	}
+	fd = -1;
+	if (rename(temp_path, path) != 0) {
+		cpuinfo_log_warning("failed to rename snapshot file %s to %s: %s", temp_path, path, strerror(errno));
+		goto cleanup;
+	}
+	temp_path[0] = '\0';
+	cpuinfo_log_debug("saved %"PRIu64"-byte snapshot to %s", size, path);
+	status = true;
+
+cleanup:
+	if (fd != -1) {
+		close(fd);
+	}
+	if (temp_path[0] != '\0') {
+		unlink(temp_path);
+	}
+	free(image);
+	return status;
+}
+
+static bool validate_snapshot_header(const struct snapshot_header header[restrict static 1], uint64_t file_size, const char* path) {
+	if (memcmp(header->magic, snapshot_magic, sizeof(header->magic)) != 0) {
+		cpuinfo_log_warning("file %s is not a cpuinfo snapshot", path);
+		return false;
+	}
+	if (header->version != SNAPSHOT_VERSION || header->header_size != sizeof(struct snapshot_header)) {
+		cpuinfo_log_info("snapshot %s was saved by an incompatible version of cpuinfo: ignore it", path);
+		return false;
+	}
+	if (header->size != file_size) {
+		cpuinfo_log_warning("snapshot %s is truncated: expected %"PRIu64" bytes, got %"PRIu64,
+			path, header->size, file_size);
+		return false;
+	}
+
+	struct snapshot_signature signature;
+	if (!get_snapshot_signature(&signature)) {
+		cpuinfo_log_info("failed to identify the system: ignore snapshot %s", path);
+		return false;
+	}
+	if (memcmp(signature.boot_id, header->signature.boot_id, sizeof(signature.boot_id)) != 0) {
+		cpuinfo_log_info("snapshot %s was saved before the last boot: ignore it", path);
+		return false;
+	}
+	if (signature.present_processors_hash != header->signature.present_processors_hash ||
+		signature.online_processors_hash != header->signature.online_processors_hash)
+	{
+		cpuinfo_log_info("snapshot %s was saved before processors went online or offline: ignore it", path);
+		return false;
+	}
+	if (memcmp(&signature, &header->signature, sizeof(signature)) != 0) {
+		cpuinfo_log_info("snapshot %s was saved with a different kernel or processor: ignore it", path);
+		return false;
+	}
+
+	/* Element types of all sections are fixed, so element sizes must match the detected arrays */
+	struct snapshot_source sources[snapshot_section_max];
+	get_snapshot_sources(sources);
+	for (uint32_t section = 0; section < snapshot_section_max; section++) {
+		const struct snapshot_section_header* section_header = &header->sections[section];
+		if (section_header->element_size != sources[section].element_size) {
+			cpuinfo_log_warning("invalid element size %"PRIu32" in section %"PRIu32" of snapshot %s",
+				section_header->element_size, section, path);
+			return false;
+		}
+		if (section_header->count == 0) {
+			continue;
+		}
+		const uint64_t section_size = (uint64_t) section_header->count * (uint64_t) section_header->element_size;
+		if (section_header->offset % SNAPSHOT_ALIGNMENT != 0 || section_header->offset < sizeof(struct snapshot_header) ||
+			section_header->offset > file_size || section_size > file_size - section_header->offset)
+		{
+			cpuinfo_log_warning("section %"PRIu32" of snapshot %s is out of bounds", section, path);
+			return false;
+		}
+	}
+
+	const struct snapshot_section_header* sections = header->sections;
+	if (sections[snapshot_section_processors].count == 0 || sections[snapshot_section_cores].count == 0 ||
+		sections[snapshot_section_clusters].count == 0 || sections[snapshot_section_packages].count == 0 ||
+		sections[snapshot_section_uarchs].count == 0 || sections[snapshot_section_isa].count != 1 ||
+		sections[snapshot_section_linux_cpu_to_processor_map].count != header->linux_cpu_max ||
+		sections[snapshot_section_linux_cpu_to_core_map].count != header->linux_cpu_max ||
+		(sections[snapshot_section_linux_cpu_to_uarch_index_map].count != 0 &&
+			sections[snapshot_section_linux_cpu_to_uarch_index_map].count != header->linux_cpu_max) ||
+		sections[snapshot_section_node_distances].count !=
+			sections[snapshot_section_nodes].count * sections[snapshot_section_nodes].count)
+	{
+		cpuinfo_log_warning("snapshot %s has inconsistent section sizes", path);
+		return false;
+	}
+	return true;
+}
+
+/* Relocates pointers in a memory-mapped snapshot, which passed validate_snapshot_header */
+static bool relocate_snapshot(struct snapshot_header header[restrict static 1]) {
+	char* image = (char*) header;
+	const struct snapshot_section_header* sections = header->sections;
+
+	struct cpuinfo_processor* processors = (struct cpuinfo_processor*) (image + sections[snapshot_section_processors].offset);
+	for (uint32_t i = 0; i < sections[snapshot_section_processors].count; i++) {
+		if (!decode_pointer(header, snapshot_section_cores, &processors[i].core) ||
+			!decode_pointer(header, snapshot_section_clusters, &processors[i].cluster) ||
+			!decode_pointer(header, snapshot_section_dies, &processors[i].die) ||
+			!decode_pointer(header, snapshot_section_packages, &processors[i].package) ||
+			!decode_pointer(header, snapshot_section_nodes, &processors[i].node) ||
+			!decode_pointer(header, snapshot_section_caches + cpuinfo_cache_level_1i, &processors[i].cache.l1i) ||
+			!decode_pointer(header, snapshot_section_caches + cpuinfo_cache_level_1d, &processors[i].cache.l1d) ||
+			!decode_pointer(header, snapshot_section_caches + cpuinfo_cache_level_2, &processors[i].cache.l2) ||
+			!decode_pointer(header, snapshot_section_caches + cpuinfo_cache_level_3, &processors[i].cache.l3) ||
+			!decode_pointer(header, snapshot_section_caches + cpuinfo_cache_level_4, &processors[i].cache.l4))
+		{
+			return false;
+		}
+	}
+	struct cpuinfo_core* cores = (struct cpuinfo_core*) (image + sections[snapshot_section_cores].offset);
+	for (uint32_t i = 0; i < sections[snapshot_section_cores].count; i++) {
+		if (!decode_pointer(header, snapshot_section_clusters, &cores[i].cluster) ||
+			!decode_pointer(header, snapshot_section_dies, &cores[i].die) ||
+			!decode_pointer(header, snapshot_section_packages, &cores[i].package) ||
+			!decode_pointer(header, snapshot_section_nodes, &cores[i].node))
+		{
+			return false;
+		}
+	}
+	struct cpuinfo_cluster* clusters = (struct cpuinfo_cluster*) (image + sections[snapshot_section_clusters].offset);
+	for (uint32_t i = 0; i < sections[snapshot_section_clusters].count; i++) {
+		if (!decode_pointer(header, snapshot_section_packages, &clusters[i].package)) {
+			return false;
+		}
+	}
+	struct cpuinfo_die* dies = (struct cpuinfo_die*) (image + sections[snapshot_section_dies].offset);
+	for (uint32_t i = 0; i < sections[snapshot_section_dies].count; i++) {
+		if (!decode_pointer(header, snapshot_section_packages, &dies[i].package)) {
+			return false;
+		}
+	}
+	struct cpuinfo_node* nodes = (struct cpuinfo_node*) (image + sections[snapshot_section_nodes].offset);
+	for (uint32_t i = 0; i < sections[snapshot_section_nodes].count; i++) {
+		if (!decode_pointer(header, snapshot_section_node_distances, &nodes[i].distances)) {
+			return false;
+		}
+	}
+	void** linux_cpu_to_processor_map = (void**) (image + sections[snapshot_section_linux_cpu_to_processor_map].offset);
+	void** linux_cpu_to_core_map = (void**) (image + sections[snapshot_section_linux_cpu_to_core_map].offset);
+	for (uint32_t i = 0; i < header->linux_cpu_max; i++) {
+		if (!decode_pointer(header, snapshot_section_processors, &linux_cpu_to_processor_map[i]) ||
+			!decode_pointer(header, snapshot_section_cores, &linux_cpu_to_core_map[i]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/* Checks that the range [start, start + count) lies within a section of max_count elements */
+static inline bool is_valid_range(uint32_t start, uint32_t count, uint32_t max_count) {
+	return start <= max_count && count <= max_count - start;
+}
+
+/*
+ * Checks that index ranges in the sections of a snapshot, which passed validate_snapshot_header, refer to elements of
+ * the respective sections, so that callers iterating over the ranges stay within the tables.
+ */
+static bool validate_snapshot_indices(const struct snapshot_header header[restrict static 1], const char* path) {
+	const char* image = (const char*) header;
+	const struct snapshot_section_header* sections = header->sections;
+	const uint32_t processors_count = sections[snapshot_section_processors].count;
+	const uint32_t cores_count = sections[snapshot_section_cores].count;
+	const uint32_t clusters_count = sections[snapshot_section_clusters].count;
+	const uint32_t dies_count = sections[snapshot_section_dies].count;
+	const uint32_t uarchs_count = sections[snapshot_section_uarchs].count;
+
+	const struct cpuinfo_core* cores = (const struct cpuinfo_core*) (image + sections[snapshot_section_cores].offset);
+	for (uint32_t i = 0; i < cores_count; i++) {
+		if (!is_valid_range(cores[i].processor_start, cores[i].processor_count, processors_count)) {
+			cpuinfo_log_warning("core %"PRIu32" in snapshot %s has invalid processor range", i, path);
+			return false;
+		}
+	}
+	const struct cpuinfo_cluster* clusters =
+		(const struct cpuinfo_cluster*) (image + sections[snapshot_section_clusters].offset);
+	for (uint32_t i = 0; i < clusters_count; i++) {
+		if (!is_valid_range(clusters[i].processor_start, clusters[i].processor_count, processors_count) ||
+			!is_valid_range(clusters[i].core_start, clusters[i].core_count, cores_count))
+		{
+			cpuinfo_log_warning("cluster %"PRIu32" in snapshot %s has invalid processor or core range", i, path);
+			return false;
+		}
+	}
+	const struct cpuinfo_package* packages =
+		(const struct cpuinfo_package*) (image + sections[snapshot_section_packages].offset);
+	for (uint32_t i = 0; i < sections[snapshot_section_packages].count; i++) {
+		if (!is_valid_range(packages[i].processor_start, packages[i].processor_count, processors_count) ||
+			!is_valid_range(packages[i].core_start, packages[i].core_count, cores_count) ||
+			!is_valid_range(packages[i].cluster_start, packages[i].cluster_count, clusters_count) ||
+			!is_valid_range(packages[i].die_start, packages[i].die_count, dies_count))
+		{
+			cpuinfo_log_warning("package %"PRIu32" in snapshot %s has invalid index range", i, path);
+			return false;
+		}
+	}
+	const struct cpuinfo_die* dies = (const struct cpuinfo_die*) (image + sections[snapshot_section_dies].offset);
+	for (uint32_t i = 0; i < dies_count; i++) {
+		if (!is_valid_range(dies[i].processor_start, dies[i].processor_count, processors_count) ||
+			!is_valid_range(dies[i].core_start, dies[i].core_count, cores_count))
+		{
+			cpuinfo_log_warning("die %"PRIu32" in snapshot %s has invalid processor or core range", i, path);
+			return false;
+		}
+	}
+	for (uint32_t level = 0; level < cpuinfo_cache_level_max; level++) {
+		const struct snapshot_section_header* cache_section = &sections[snapshot_section_caches + level];
+		const struct cpuinfo_cache* caches = (const struct cpuinfo_cache*) (image + cache_section->offset);
+		for (uint32_t i = 0; i < cache_section->count; i++) {
+			if (!is_valid_range(caches[i].processor_start, caches[i].processor_count, processors_count)) {
+				cpuinfo_log_warning("cache %"PRIu32" of level %"PRIu32" in snapshot %s has invalid processor range",
+					i, level, path);
+				return false;
+			}
+		}
+	}
+	const struct snapshot_section_header* uarch_index_section = &sections[snapshot_section_linux_cpu_to_uarch_index_map];
+	const uint32_t* linux_cpu_to_uarch_index_map = (const uint32_t*) (image + uarch_index_section->offset);
+	for (uint32_t i = 0; i < uarch_index_section->count; i++) {
+		if (linux_cpu_to_uarch_index_map[i] >= uarchs_count) {
+			cpuinfo_log_warning("invalid microarchitecture index %"PRIu32" for processor %"PRIu32" in snapshot %s",
+				linux_cpu_to_uarch_index_map[i], i, path);
+			return false;
+		}
+	}
+	return true;
+}
+
+bool cpuinfo_linux_load_snapshot(const char* path, bool update_isa) {
+	bool status = false;
+	void* image = MAP_FAILED;
+	size_t image_size = 0;
+
+	const int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd == -1) {
+		cpuinfo_log_info("failed to open snapshot %s: %s", path, strerror(errno));
+		return false;
+	}
+	struct stat file_stat;
+	if (fstat(fd, &file_stat) != 0) {
+		cpuinfo_log_warning("failed to query size of snapshot %s: %s", path, strerror(errno));
+		close(fd);
+		return false;
+	}
+	if ((uint64_t) file_stat.st_size < sizeof(struct snapshot_header) || (uint64_t) file_stat.st_size > SIZE_MAX) {
+		cpuinfo_log_warning("snapshot %s has invalid size %"PRIu64, path, (uint64_t) file_stat.st_size);
+		close(fd);
+		return false;
+	}
+	image_size = (size_t) file_stat.st_size;
+
+	/* The mapping is private: relocation of pointers does not modify the file */
+	image = mmap(NULL, image_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (image == MAP_FAILED) {
+		cpuinfo_log_warning("failed to map snapshot %s: %s", path, strerror(errno));
+		return false;
+	}
+
+	struct snapshot_header* header = (struct snapshot_header*) image;
+	if (!validate_snapshot_header(header, (uint64_t) image_size, path) || !validate_snapshot_indices(header, path) ||
+		!relocate_snapshot(header))
+	{
+		goto cleanup;
+	}
+	if (mprotect(image, image_size, PROT_READ) != 0) {
+		cpuinfo_log_warning("failed to protect snapshot %s: %s", path, strerror(errno));
+	}
+
+	/* Commit changes */
+	char* sections_base = (char*) image;
+	const struct snapshot_section_header* sections = header->sections;
+	cpuinfo_processors = (struct cpuinfo_processor*) (sections_base + sections[snapshot_section_processors].offset);
+	cpuinfo_cores = (struct cpuinfo_core*) (sections_base + sections[snapshot_section_cores].offset);
+	cpuinfo_clusters = (struct cpuinfo_cluster*) (sections_base + sections[snapshot_section_clusters].offset);
+	cpuinfo_packages = (struct cpuinfo_package*) (sections_base + sections[snapshot_section_packages].offset);
+	cpuinfo_dies = sections[snapshot_section_dies].count == 0 ? NULL :
+		(struct cpuinfo_die*) (sections_base + sections[snapshot_section_dies].offset);
+	cpuinfo_nodes = sections[snapshot_section_nodes].count == 0 ? NULL :
+		(struct cpuinfo_node*) (sections_base + sections[snapshot_section_nodes].offset);
+	for (uint32_t level = 0; level < cpuinfo_cache_level_max; level++) {
+		const struct snapshot_section_header* cache_section = &sections[snapshot_section_caches + level];
+		cpuinfo_cache[level] = cache_section->count == 0 ? NULL :
+			(struct cpuinfo_cache*) (sections_base + cache_section->offset);
+		cpuinfo_cache_count[level] = cache_section->count;
+	}
+
+	cpuinfo_processors_count = sections[snapshot_section_processors].count;
+	cpuinfo_cores_count = sections[snapshot_section_cores].count;
+	cpuinfo_clusters_count = sections[snapshot_section_clusters].count;
+	cpuinfo_packages_count = sections[snapshot_section_packages].count;
+	cpuinfo_dies_count = sections[snapshot_section_dies].count;
+	cpuinfo_nodes_count = sections[snapshot_section_nodes].count;
+	cpuinfo_max_cache_size = header->max_cache_size;
+
+	struct cpuinfo_uarch_info* uarchs = (struct cpuinfo_uarch_info*) (sections_base + sections[snapshot_section_uarchs].offset);
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	if (sections[snapshot_section_uarchs].count == 1) {
+		cpuinfo_global_uarch = uarchs[0];
+	} else {
+		cpuinfo_uarchs = uarchs;
+	}
+#else
+	cpuinfo_uarchs = uarchs;
+#endif
+	cpuinfo_uarchs_count = sections[snapshot_section_uarchs].count;
+	if (update_isa) {
+		memcpy(&cpuinfo_isa, sections_base + sections[snapshot_section_isa].offset, sizeof(cpuinfo_isa));
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		/* Permission to use AMX is granted per process */
+		cpuinfo_isa.amx_permitted = cpuinfo_isa.amx_tile && cpuinfo_x86_detect_amx_permission();
+	#elif CPUINFO_ARCH_ARM64
+		/* SVE and SME vector lengths are set per process with prctl, and inherited only through fork */
+		cpuinfo_isa.svelen = 0;
+		cpuinfo_isa.smelen = 0;
+		cpuinfo_arm64_linux_detect_vector_lengths(&cpuinfo_isa);
+	#endif
+	}
+
+	cpuinfo_linux_cpu_max = header->linux_cpu_max;
+	cpuinfo_linux_cpu_to_processor_map = (const struct cpuinfo_processor**)
+		(sections_base + sections[snapshot_section_linux_cpu_to_processor_map].offset);
+	cpuinfo_linux_cpu_to_core_map = (const struct cpuinfo_core**)
+		(sections_base + sections[snapshot_section_linux_cpu_to_core_map].offset);
+	cpuinfo_linux_cpu_to_uarch_index_map = sections[snapshot_section_linux_cpu_to_uarch_index_map].count == 0 ? NULL :
+		(const uint32_t*) (sections_base + sections[snapshot_section_linux_cpu_to_uarch_index_map].offset);
+
+	/* Affinity mask, cgroups, and the C library may differ between processes that share a snapshot */
+	cpuinfo_linux_init_usable_processors(header->linux_cpu_max);
+	cpuinfo_linux_init_current_cpu();
+
+	__sync_synchronize();
+
+	cpuinfo_is_initialized = true;
+	cpuinfo_log_debug("loaded snapshot of %"PRIu32" logical processors from %s", cpuinfo_processors_count, path);
+
+	snapshot_image = image;
+	snapshot_image_size = image_size;
+	image = MAP_FAILED;
+	status = true;
+
+cleanup:
+	if (image != MAP_FAILED) {
+		munmap(image, image_size);
+	}
+	return status;
+}
+
+bool cpuinfo_linux_release_snapshot(void) {
+	if (snapshot_image == NULL) {
+		return false;
+	}
+	munmap(snapshot_image, snapshot_image_size);
+	snapshot_image = NULL;
+	snapshot_image_size = 0;
+	return true;
+}
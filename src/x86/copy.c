@@ -0,0 +1,119 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cpuinfo.h>
+#include <cpuinfo/internal-api.h>
+#include <x86/api.h>
+
+
+/* Thresholds computed from the detected caches and ISA extensions, or defaults which always select vector copy */
+static struct cpuinfo_x86_copy_thresholds copy_thresholds = {
+	.rep_movsb_min_size = SIZE_MAX,
+	.rep_movsb_max_size = SIZE_MAX,
+	.non_temporal_min_size = SIZE_MAX,
+	.cache_line_size = 64,
+};
+
+void cpuinfo_x86_update_copy_thresholds(void) {
+	/*
+	 * Hybrid processors may have different L2 caches, and L2 may be the last level cache shared by a cluster of cores.
+	 * Thresholds must suit the smallest cache of any core, because the copy may run on any core.
+	 */
+	const struct cpuinfo_cache* l2_caches = cpuinfo_cache[cpuinfo_cache_level_2];
+	const uint32_t l2_count = cpuinfo_cache_count[cpuinfo_cache_level_2];
+	const struct cpuinfo_cache* llcs = l2_caches;
+	uint32_t llc_count = l2_count;
+	if (cpuinfo_cache_count[cpuinfo_cache_level_3] != 0) {
+		llcs = cpuinfo_cache[cpuinfo_cache_level_3];
+		llc_count = cpuinfo_cache_count[cpuinfo_cache_level_3];
+	}
+
+	size_t min_l2_size = SIZE_MAX;
+	for (uint32_t i = 0; i < l2_count; i++) {
+		if (l2_caches[i].size != 0 && (size_t) l2_caches[i].size < min_l2_size) {
+			min_l2_size = (size_t) l2_caches[i].size;
+		}
+	}
+	size_t min_llc_share = SIZE_MAX;
+	for (uint32_t i = 0; i < llc_count; i++) {
+		if (llcs[i].size != 0 && llcs[i].processor_count != 0) {
+			const size_t llc_share = (size_t) llcs[i].size / llcs[i].processor_count;
+			if (llc_share < min_llc_share) {
+				min_llc_share = llc_share;
+			}
+		}
+	}
+
+	/*
+	 * With ERMS, REP MOVSB outperforms vector loops once its startup overhead is amortized, which takes longer
+	 * with wider vectors. FSRM reduces the startup overhead so that REP MOVSB is profitable from about 2 KB
+	 * regardless of the vector width. The sizes are the defaults of the glibc.cpu.x86_rep_movsb_threshold tunable
+	 * in glibc (sysdeps/x86/dl-cacheinfo.h).
+	 */
+	size_t rep_movsb_min_size = SIZE_MAX;
+	if (cpuinfo_isa.erms) {
+		size_t vector_size = 16;
+		if (cpuinfo_isa.avx512f) {
+			vector_size = 64;
+		} else if (cpuinfo_isa.avx) {
+			vector_size = 32;
+		}
+		rep_movsb_min_size = cpuinfo_isa.fsrm ? 2112 : 2048 * (vector_size / 16);
+	}
+
+	/*
+	 * Non-temporal stores pay off when the copy would evict most of the share of the last level cache available to
+	 * each thread. Below 16 KB the cost of the fence after non-temporal stores dominates. As with the default and the
+	 * minimum (0x4040) of the glibc.cpu.x86_non_temporal_threshold tunable, the threshold is 3/4 of the per-thread
+	 * share.
+	 */
+	size_t non_temporal_min_size = SIZE_MAX;
+	if (min_llc_share != SIZE_MAX && cpuinfo_has_x86_sse2()) {
+		non_temporal_min_size = min_llc_share * 3 / 4;
+		if (non_temporal_min_size < 0x4040) {
+			non_temporal_min_size = 0x4040;
+		}
+	}
+
+	/*
+	 * REP MOVSB is used up to the non-temporal threshold, except on AMD processors where it falls behind vector
+	 * copy for blocks which do not fit into L2 cache.
+	 */
+	size_t rep_movsb_max_size = non_temporal_min_size;
+	bool amd_rep_movsb = false;
+	for (uint32_t i = 0; i < cpuinfo_cores_count; i++) {
+		const enum cpuinfo_vendor vendor = cpuinfo_cores[i].vendor;
+		amd_rep_movsb |= vendor == cpuinfo_vendor_amd || vendor == cpuinfo_vendor_hygon;
+	}
+	if (amd_rep_movsb && min_l2_size < rep_movsb_max_size) {
+		rep_movsb_max_size = min_l2_size;
+	}
+
+	uint32_t cache_line_size = cpuinfo_x86_clflush_size;
+	if (cache_line_size == 0) {
+		const struct cpuinfo_cache* l1d = cpuinfo_cache[cpuinfo_cache_level_1d];
+		cache_line_size = cpuinfo_cache_count[cpuinfo_cache_level_1d] != 0 && l1d->line_size != 0 ? l1d->line_size : 64;
+	}
+
+	copy_thresholds = (struct cpuinfo_x86_copy_thresholds) {
+		.rep_movsb_min_size = rep_movsb_min_size,
+		.rep_movsb_max_size = rep_movsb_max_size,
+		.non_temporal_min_size = non_temporal_min_size,
+		.cache_line_size = cache_line_size,
+	};
+}
+
+void CPUINFO_ABI cpuinfo_x86_get_copy_thresholds(struct cpuinfo_x86_copy_thresholds* thresholds) {
+	*thresholds = copy_thresholds;
+}
+
+enum cpuinfo_x86_copy_strategy CPUINFO_ABI cpuinfo_x86_get_copy_strategy(size_t size) {
+	if (size >= copy_thresholds.non_temporal_min_size) {
+		return cpuinfo_x86_copy_strategy_non_temporal;
+	}
+	if (size >= copy_thresholds.rep_movsb_min_size && size < copy_thresholds.rep_movsb_max_size) {
+		return cpuinfo_x86_copy_strategy_rep_movsb;
+	}
+	return cpuinfo_x86_copy_strategy_vector;
+}
@@ -12,6 +12,7 @@ struct cpuinfo_x86_model_info cpuinfo_x86_decode_model_info(uint32_t eax) {
 	model_info.processor_type  = (eax >> 12) & 0x3;
 	model_info.extended_model  = (eax >> 16) & 0xF;
 	model_info.extended_family = (eax >> 20) & 0xFF;
+	model_info.core_type       = cpuinfo_x86_core_type_none;
 
 	model_info.family = model_info.base_family + model_info.extended_family;
 	model_info.model  = model_info.base_model + (model_info.extended_model << 4);
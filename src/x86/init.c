@@ -4,14 +4,40 @@
 #include <cpuinfo.h>
 #include <x86/cpuid.h>
 #include <x86/api.h>
+#include <cpuinfo/internal-api.h>
 #include <cpuinfo/utils.h>
 #include <cpuinfo/log.h>
 #include <cpuinfo/common.h>
+#ifdef __linux__
+	#include <x86/linux/api.h>
+#endif
 
 
 struct cpuinfo_x86_isa cpuinfo_isa = { 0 };
 CPUINFO_INTERNAL uint32_t cpuinfo_x86_clflush_size = 0;
 
+/*
+ * Decodes the model and the microarchitecture from CPUID leaf 1.
+ * Hybrid part:
+ * - Intel: edx[bit 15] in structured feature info (ecx = 0).
+ * The type of the core which executes CPUID is then reported in eax[bits 24-31] of leaf 0x1A.
+ */
+static enum cpuinfo_uarch decode_uarch(
+	enum cpuinfo_vendor vendor,
+	uint32_t max_base_index,
+	uint32_t leaf1_eax,
+	struct cpuinfo_x86_model_info model_info[restrict static 1])
+{
+	*model_info = cpuinfo_x86_decode_model_info(leaf1_eax);
+	if (max_base_index >= 7) {
+		const struct cpuid_regs leaf7 = cpuidex(7, 0);
+		if ((leaf7.edx & UINT32_C(0x00008000)) && max_base_index >= UINT32_C(0x1A)) {
+			model_info->core_type = cpuid(UINT32_C(0x1A)).eax >> 24;
+		}
+	}
+	return cpuinfo_x86_decode_uarch(vendor, model_info);
+}
+
 void cpuinfo_x86_init_processor(struct cpuinfo_x86_processor* processor) {
 	const struct cpuid_regs leaf0 = cpuid(0);
 	const uint32_t max_base_index = leaf0.eax;
@@ -29,11 +55,10 @@ void cpuinfo_x86_init_processor(struct cpuinfo_x86_processor* processor) {
 		const struct cpuid_regs leaf1 = cpuid(1);
 		processor->cpuid = leaf1.eax;
 
-		const struct cpuinfo_x86_model_info model_info = cpuinfo_x86_decode_model_info(leaf1.eax);
+		struct cpuinfo_x86_model_info model_info;
 		const enum cpuinfo_uarch uarch = processor->uarch =
-			cpuinfo_x86_decode_uarch(vendor, &model_info);
-
-		cpuinfo_x86_clflush_size = ((leaf1.ebx >> 8) & UINT32_C(0x000000FF)) * 8;
+			decode_uarch(vendor, max_base_index, leaf1.eax, &model_info);
+		processor->core_type = model_info.core_type;
 
 		/*
 		 * Topology extensions support:
@@ -60,9 +85,9 @@ void cpuinfo_x86_init_processor(struct cpuinfo_x86_processor* processor) {
 			&processor->topology.core_bits_length);
 
 		cpuinfo_x86_detect_topology(max_base_index, max_extended_index, leaf1, &processor->topology);
-
-		cpuinfo_isa = cpuinfo_x86_detect_isa(leaf1, leaf0x80000001,
-			max_base_index, max_extended_index, vendor, uarch);
+		if (amd_topology_extensions && (vendor == cpuinfo_vendor_amd || vendor == cpuinfo_vendor_hygon)) {
+			cpuinfo_x86_detect_amd_topology(max_extended_index, uarch, &processor->cache, &processor->topology);
+		}
 	}
 	if (max_extended_index >= UINT32_C(0x80000004)) {
 		struct cpuid_regs brand_string[3];
@@ -73,3 +98,48 @@ void cpuinfo_x86_init_processor(struct cpuinfo_x86_processor* processor) {
 		cpuinfo_log_debug("raw CPUID brand string: \"%48s\"", processor->brand_string);
 	}
 }
+
+/*
+ * Detects ISA extensions with CPUID and XGETBV only, without memory allocation, locks, logging, or system calls, so
+ * that the function is safe to call from IFUNC resolvers. Returns false if CPUID does not report basic features.
+ */
+bool cpuinfo_x86_probe_isa(struct cpuinfo_x86_isa isa[restrict static 1]) {
+	const struct cpuid_regs leaf0 = cpuid(0);
+	const uint32_t max_base_index = leaf0.eax;
+	if (max_base_index < 1) {
+		return false;
+	}
+	const enum cpuinfo_vendor vendor = cpuinfo_x86_decode_vendor(leaf0.ebx, leaf0.ecx, leaf0.edx);
+
+	const struct cpuid_regs leaf0x80000000 = cpuid(UINT32_C(0x80000000));
+	const uint32_t max_extended_index =
+		leaf0x80000000.eax >= UINT32_C(0x80000000) ? leaf0x80000000.eax : 0;
+
+	const struct cpuid_regs leaf0x80000001 = max_extended_index >= UINT32_C(0x80000001) ?
+		cpuid(UINT32_C(0x80000001)) : (struct cpuid_regs) { 0, 0, 0, 0 };
+
+	const struct cpuid_regs leaf1 = cpuid(1);
+	struct cpuinfo_x86_model_info model_info;
+	const enum cpuinfo_uarch uarch = decode_uarch(vendor, max_base_index, leaf1.eax, &model_info);
+
+	*isa = cpuinfo_x86_detect_isa(leaf1, leaf0x80000001,
+		max_base_index, max_extended_index, vendor, uarch);
+	return true;
+}
+
+void cpuinfo_x86_init_isa(void) {
+	struct cpuinfo_x86_isa isa;
+	if (!cpuinfo_x86_probe_isa(&isa)) {
+		return;
+	}
+	isa.amx_permitted = isa.amx_tile && cpuinfo_x86_detect_amx_permission();
+#ifdef __linux__
+	if (isa.waitpkg) {
+		cpuinfo_x86_linux_detect_umwait_control(&isa);
+	}
+#endif
+	cpuinfo_isa = isa;
+
+	const struct cpuid_regs leaf1 = cpuid(1);
+	cpuinfo_x86_clflush_size = ((leaf1.ebx >> 8) & UINT32_C(0x000000FF)) * 8;
+}
@@ -3,7 +3,28 @@
 #include <stddef.h>
 
 #include <x86/cpuid.h>
+#include <x86/api.h>
 #include <cpuinfo.h>
+#include <cpuinfo/internal-api.h>
+#include <cpuinfo/log.h>
+
+#if defined(__linux__) && CPUINFO_ARCH_X86_64 && !CPUINFO_MOCK
+	#include <errno.h>
+	#include <string.h>
+	#include <unistd.h>
+	#include <sys/syscall.h>
+
+	/* arch/x86/include/uapi/asm/prctl.h */
+	#ifndef ARCH_GET_XCOMP_PERM
+		#define ARCH_GET_XCOMP_PERM 0x1022
+	#endif
+	#ifndef ARCH_REQ_XCOMP_PERM
+		#define ARCH_REQ_XCOMP_PERM 0x1023
+	#endif
+
+	/* Index of the AMX tile data state component in XCR0 */
+	#define XFEATURE_XTILEDATA 18
+#endif
 
 
 #if CPUINFO_ARCH_X86
@@ -52,7 +73,10 @@ struct cpuinfo_x86_isa cpuinfo_x86_detect_isa(
 		(max_extended_index >= processor_capacity_info_index) ?
 			cpuid(processor_capacity_info_index) : (struct cpuid_regs) { 0, 0, 0, 0 };
 
-	bool avx_regs = false, avx512_regs = false, mpx_regs = false;
+	bool avx_regs = false, avx512_regs = false, mpx_regs = false, amx_regs = false;
+	#if CPUINFO_ARCH_X86_64
+		bool apx_regs = false;
+	#endif
 	/*
 	 * OSXSAVE: Operating system enabled XSAVE instructions for application use:
 	 * - Intel, AMD: ecx[bit 26] in basic info = XSAVE/XRSTOR instructions supported by a chip.
@@ -100,6 +124,29 @@ struct cpuinfo_x86_isa cpuinfo_x86_detect_isa(
 		if ((xcr0_valid_bits & mpx_regs_mask) == mpx_regs_mask) {
 			mpx_regs = (xfeature_enabled_mask & mpx_regs_mask) == mpx_regs_mask;
 		}
+
+		/*
+		 * AMX registers:
+		 * - Intel: XFEATURE_ENABLED_MASK[bit 17] for 64-byte tile configuration register TILECFG
+		 * - Intel: XFEATURE_ENABLED_MASK[bit 18] for 8 1024-byte tile registers tmm0-tmm7
+		 * AMX instructions are only available in 64-bit mode.
+		 */
+		#if CPUINFO_ARCH_X86_64
+			const uint64_t amx_regs_mask = UINT64_C(0x0000000000060000);
+			if ((xcr0_valid_bits & amx_regs_mask) == amx_regs_mask) {
+				amx_regs = (xfeature_enabled_mask & amx_regs_mask) == amx_regs_mask;
+			}
+
+			/*
+			 * APX registers:
+			 * - Intel: XFEATURE_ENABLED_MASK[bit 19] for 16 extended general-purpose registers r16-r31
+			 * APX instructions are only available in 64-bit mode.
+			 */
+			const uint64_t apx_regs_mask = UINT64_C(0x0000000000080000);
+			if ((xcr0_valid_bits & apx_regs_mask) == apx_regs_mask) {
+				apx_regs = (xfeature_enabled_mask & apx_regs_mask) == apx_regs_mask;
+			}
+		#endif
 	}
 
 #if CPUINFO_ARCH_X86
@@ -150,6 +197,12 @@ struct cpuinfo_x86_isa cpuinfo_x86_detect_isa(
 	 */
 	isa.clflushopt = !!(structured_feature_info0.ebx & UINT32_C(0x00800000));
 
+	/*
+	 * CLDEMOTE instruction:
+	 * - Intel: ecx[bit 25] in structured feature info (ecx = 0).
+	 */
+	isa.cldemote = !!(structured_feature_info0.ecx & UINT32_C(0x02000000));
+
 	/*
 	 * MWAIT/MONITOR instructions:
 	 * - Intel, AMD: ecx[bit 3] in basic info.
@@ -162,6 +215,12 @@ struct cpuinfo_x86_isa cpuinfo_x86_detect_isa(
 	 */
 	isa.mwaitx = !!(extended_info.ecx & UINT32_C(0x20000000));
 
+	/*
+	 * UMONITOR/UMWAIT/TPAUSE instructions:
+	 * - Intel: ecx[bit 5] in structured feature info (ecx = 0).
+	 */
+	isa.waitpkg = !!(structured_feature_info0.ecx & UINT32_C(0x00000020));
+
 	/*
 	 * FXSAVE/FXRSTOR instructions:
 	 * - Intel, AMD: edx[bit 24] in basic info.
@@ -281,6 +340,15 @@ struct cpuinfo_x86_isa cpuinfo_x86_detect_isa(
 	 */
 	isa.prefetchwt1 = !!(structured_feature_info0.ecx & UINT32_C(0x00000001));
 
+#if CPUINFO_ARCH_X86_64
+	/*
+	 * PREFETCHIT0/PREFETCHIT1 instructions:
+	 * - Intel: edx[bit 14] in structured feature info (ecx = 1).
+	 * The instructions prefetch code only with RIP-relative addressing in 64-bit mode, and are NOPs otherwise.
+	 */
+	isa.prefetchi = !!(structured_feature_info1.edx & UINT32_C(0x00004000));
+#endif
+
 #if CPUINFO_ARCH_X86
 	/*
 	 * SSE instructions:
@@ -496,6 +564,93 @@ struct cpuinfo_x86_isa cpuinfo_x86_detect_isa(
 	 */
 	isa.avx512bf16 = avx512_regs && !!(structured_feature_info1.eax & UINT32_C(0x00000020));
 
+	/*
+	 * AVX512_FP16 instructions:
+	 * - Intel: edx[bit 23] in structured feature info (ecx = 0).
+	 */
+	isa.avx512fp16 = avx512_regs && !!(structured_feature_info0.edx & UINT32_C(0x00800000));
+
+	/*
+	 * AVX-VNNI instructions:
+	 * - Intel: eax[bit 4] in structured feature info (ecx = 1).
+	 */
+	isa.avxvnni = avx_regs && !!(structured_feature_info1.eax & UINT32_C(0x00000010));
+
+	/*
+	 * AVX-VNNI-INT8 instructions:
+	 * - Intel: edx[bit 4] in structured feature info (ecx = 1).
+	 */
+	isa.avxvnniint8 = avx_regs && !!(structured_feature_info1.edx & UINT32_C(0x00000010));
+
+	/*
+	 * AVX-IFMA instructions:
+	 * - Intel: eax[bit 23] in structured feature info (ecx = 1).
+	 */
+	isa.avxifma = avx_regs && !!(structured_feature_info1.eax & UINT32_C(0x00800000));
+
+	/*
+	 * AVX-NE-CONVERT instructions:
+	 * - Intel: edx[bit 5] in structured feature info (ecx = 1).
+	 */
+	isa.avxneconvert = avx_regs && !!(structured_feature_info1.edx & UINT32_C(0x00000020));
+
+	/*
+	 * AVX10 converged vector ISA:
+	 * - Intel: edx[bit 19] in structured feature info (ecx = 1).
+	 * - Intel: ebx[bits 0-7] in AVX10 feature info (eax = 0x24, ecx = 0) = AVX10 version.
+	 * - Intel: ebx[bit 16] in AVX10 feature info (eax = 0x24, ecx = 0) = 128-bit vectors.
+	 * - Intel: ebx[bit 17] in AVX10 feature info (eax = 0x24, ecx = 0) = 256-bit vectors.
+	 * - Intel: ebx[bit 18] in AVX10 feature info (eax = 0x24, ecx = 0) = 512-bit vectors.
+	 * Regardless of the maximum vector length, AVX10 uses opmask registers and 32 vector registers, and requires the
+	 * OS to enable all AVX-512 state components.
+	 */
+	if (avx512_regs && (structured_feature_info1.edx & UINT32_C(0x00080000)) && max_base_index >= 0x24) {
+		const struct cpuid_regs avx10_info = cpuidex(0x24, 0);
+		const uint32_t avx10_version = avx10_info.ebx & UINT32_C(0x000000FF);
+		uint32_t avx10_max_vector_bits = 0;
+		if (avx10_info.ebx & UINT32_C(0x00040000)) {
+			avx10_max_vector_bits = 512;
+		} else if (avx10_info.ebx & UINT32_C(0x00020000)) {
+			avx10_max_vector_bits = 256;
+		} else if (avx10_info.ebx & UINT32_C(0x00010000)) {
+			avx10_max_vector_bits = 128;
+		}
+		if (avx10_version != 0 && avx10_max_vector_bits != 0) {
+			isa.avx10_version = avx10_version;
+			isa.avx10_max_vector_bits = avx10_max_vector_bits;
+		}
+	}
+
+	/*
+	 * AMX-TILE instructions:
+	 * - Intel: edx[bit 24] in structured feature info (ecx = 0).
+	 */
+	isa.amx_tile = amx_regs && !!(structured_feature_info0.edx & UINT32_C(0x01000000));
+
+	/*
+	 * AMX-INT8 instructions:
+	 * - Intel: edx[bit 25] in structured feature info (ecx = 0).
+	 */
+	isa.amx_int8 = isa.amx_tile && !!(structured_feature_info0.edx & UINT32_C(0x02000000));
+
+	/*
+	 * AMX-BF16 instructions:
+	 * - Intel: edx[bit 22] in structured feature info (ecx = 0).
+	 */
+	isa.amx_bf16 = isa.amx_tile && !!(structured_feature_info0.edx & UINT32_C(0x00400000));
+
+	/*
+	 * AMX-FP16 instructions:
+	 * - Intel: eax[bit 21] in structured feature info (ecx = 1).
+	 */
+	isa.amx_fp16 = isa.amx_tile && !!(structured_feature_info1.eax & UINT32_C(0x00200000));
+
+	/*
+	 * AMX-COMPLEX instructions:
+	 * - Intel: edx[bit 8] in structured feature info (ecx = 1).
+	 */
+	isa.amx_complex = isa.amx_tile && !!(structured_feature_info1.edx & UINT32_C(0x00000100));
+
 	/*
 	 * HLE instructions:
 	 * - Intel: ebx[bit 4] in structured feature info (ecx = 0).
@@ -554,6 +709,62 @@ struct cpuinfo_x86_isa cpuinfo_x86_detect_isa(
 	 */
 	isa.movbe = !!(basic_info.ecx & UINT32_C(0x00400000));
 
+	/*
+	 * Enhanced REP MOVSB/STOSB:
+	 * - Intel: ebx[bit 9] in structured feature info (ecx = 0).
+	 * - AMD: ebx[bit 9] in structured feature info (ecx = 0) since Zen.
+	 */
+	isa.erms = !!(structured_feature_info0.ebx & UINT32_C(0x00000200));
+
+	/*
+	 * Fast short REP MOVSB:
+	 * - Intel: edx[bit 4] in structured feature info (ecx = 0).
+	 * - AMD: edx[bit 4] in structured feature info (ecx = 0) since Zen 3.
+	 */
+	isa.fsrm = !!(structured_feature_info0.edx & UINT32_C(0x00000010));
+
+	/*
+	 * Fast zero-length REP MOVSB:
+	 * - Intel: eax[bit 10] in structured feature info (ecx = 1).
+	 */
+	isa.fzlrm = !!(structured_feature_info1.eax & UINT32_C(0x00000400));
+
+	/*
+	 * Fast short REP STOSB:
+	 * - Intel: eax[bit 11] in structured feature info (ecx = 1).
+	 */
+	isa.fsrs = !!(structured_feature_info1.eax & UINT32_C(0x00000800));
+
+	/*
+	 * Fast short REP CMPSB and REP SCASB:
+	 * - Intel: eax[bit 12] in structured feature info (ecx = 1).
+	 */
+	isa.fsrc = !!(structured_feature_info1.eax & UINT32_C(0x00001000));
+
+	/*
+	 * MOVDIRI instruction:
+	 * - Intel: ecx[bit 27] in structured feature info (ecx = 0).
+	 */
+	isa.movdiri = !!(structured_feature_info0.ecx & UINT32_C(0x08000000));
+
+	/*
+	 * MOVDIR64B instruction:
+	 * - Intel: ecx[bit 28] in structured feature info (ecx = 0).
+	 */
+	isa.movdir64b = !!(structured_feature_info0.ecx & UINT32_C(0x10000000));
+
+	/*
+	 * ENQCMD/ENQCMDS instructions:
+	 * - Intel: ecx[bit 29] in structured feature info (ecx = 0).
+	 */
+	isa.enqcmd = !!(structured_feature_info0.ecx & UINT32_C(0x20000000));
+
+	/*
+	 * SERIALIZE instruction:
+	 * - Intel: edx[bit 14] in structured feature info (ecx = 0).
+	 */
+	isa.serialize = !!(structured_feature_info0.edx & UINT32_C(0x00004000));
+
 #if CPUINFO_ARCH_X86_64
 	/*
 	 * Some early x86-64 CPUs lack LAHF & SAHF instructions.
@@ -561,6 +772,12 @@ struct cpuinfo_x86_isa cpuinfo_x86_detect_isa(
 	 * - Intel, AMD: ecx[bit 0] in extended info.
 	 */
 	isa.lahf_sahf = !!(extended_info.ecx & UINT32_C(0x00000001));
+
+	/*
+	 * APX instructions:
+	 * - Intel: edx[bit 21] in structured feature info (ecx = 1).
+	 */
+	isa.apx = apx_regs && !!(structured_feature_info1.edx & UINT32_C(0x00200000));
 #endif
 
 	/*
@@ -722,3 +939,34 @@ struct cpuinfo_x86_isa cpuinfo_x86_detect_isa(
 
 	return isa;
 }
+
+/*
+ * Linux enables the AMX tile data state in XCR0 for all processes, but traps its use until the process requests
+ * permission with arch_prctl(ARCH_REQ_XCOMP_PERM).
+ */
+bool cpuinfo_x86_detect_amx_permission(void) {
+	#if defined(__linux__) && CPUINFO_ARCH_X86_64 && !CPUINFO_MOCK
+		uint64_t permitted_features = 0;
+		if (syscall(SYS_arch_prctl, ARCH_GET_XCOMP_PERM, &permitted_features) != 0) {
+			/* Linux before 5.16 does not support dynamically enabled state, and grants all state in XCR0 */
+			return true;
+		}
+		return !!(permitted_features & (UINT64_C(1) << XFEATURE_XTILEDATA));
+	#else
+		return true;
+	#endif
+}
+
+bool CPUINFO_ABI cpuinfo_x86_request_amx_permission(void) {
+	#if defined(__linux__) && CPUINFO_ARCH_X86_64 && !CPUINFO_MOCK
+		if (cpuinfo_isa.amx_tile && !__atomic_load_n(&cpuinfo_isa.amx_permitted, __ATOMIC_RELAXED)) {
+			if (syscall(SYS_arch_prctl, ARCH_REQ_XCOMP_PERM, XFEATURE_XTILEDATA) == 0) {
+				__atomic_store_n(&cpuinfo_isa.amx_permitted, true, __ATOMIC_RELAXED);
+				cpuinfo_update_isa_features();
+			} else {
+				cpuinfo_log_warning("failed to request permission to use AMX tile data: %s", strerror(errno));
+			}
+		}
+	#endif
+	return cpuinfo_isa.amx_tile && cpuinfo_isa.amx_permitted;
+}
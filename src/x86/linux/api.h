@@ -9,12 +9,45 @@
 #include <linux/api.h>
 
 
+/* Maximum number of distinct core types: cores of non-hybrid processors, P-cores, and E-cores */
+#define CPUINFO_X86_LINUX_MAX_CORE_TYPES 3
+
 struct cpuinfo_x86_linux_processor {
 	uint32_t apic_id;
 	uint32_t linux_id;
 	uint32_t flags;
+	/* Hybrid core type, one of cpuinfo_x86_core_type values */
+	uint32_t core_type;
+	/* Index of the core type in the order of appearance */
+	uint32_t core_type_index;
 };
 
 CPUINFO_INTERNAL bool cpuinfo_x86_linux_parse_proc_cpuinfo(
 	uint32_t max_processors_count,
 	struct cpuinfo_x86_linux_processor processors[restrict static max_processors_count]);
+
+/*
+ * Derives APIC IDs of valid processors from core_id, physical_package_id, and thread_siblings_list in sysfs
+ * and the APIC ID layout reported by CPUID. Returns false if sysfs does not describe a topology with this layout.
+ */
+CPUINFO_INTERNAL bool cpuinfo_x86_linux_detect_apic_ids(
+	uint32_t max_processors_count,
+	const struct cpuinfo_x86_topology topology[restrict static 1],
+	struct cpuinfo_x86_linux_processor processors[restrict static max_processors_count]);
+
+CPUINFO_INTERNAL bool cpuinfo_x86_linux_detect_core_types(
+	uint32_t max_processors_count,
+	struct cpuinfo_x86_linux_processor processors[restrict static max_processors_count]);
+
+/*
+ * Reads the limits which Linux imposes on UMWAIT and TPAUSE from /sys/devices/system/cpu/umwait_control.
+ */
+CPUINFO_INTERNAL void cpuinfo_x86_linux_detect_umwait_control(struct cpuinfo_x86_isa isa[restrict static 1]);
+
+CPUINFO_INTERNAL void cpuinfo_x86_linux_init_processor(
+	uint32_t max_processors_count,
+	uint32_t linux_id,
+	uint32_t core_type,
+	struct cpuinfo_x86_processor processor[restrict static 1]);
+
+extern CPUINFO_INTERNAL const uint32_t* cpuinfo_linux_cpu_to_uarch_index_map;
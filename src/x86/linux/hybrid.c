@@ -0,0 +1,167 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sched.h>
+
+#include <cpuinfo.h>
+#include <x86/api.h>
+#include <x86/cpuid.h>
+#include <x86/linux/api.h>
+#include <linux/api.h>
+#include <cpuinfo/log.h>
+
+
+/*
+ * Hybrid Intel processors register a separate PMU for each type of cores,
+ * and the kernel lists the logical processors of every type in its cpus file.
+ */
+#define CORE_CPULIST_FILENAME "/sys/devices/cpu_core/cpus"
+#define ATOM_CPULIST_FILENAME "/sys/devices/cpu_atom/cpus"
+
+
+static inline bool bitmask_all(uint32_t bitfield, uint32_t mask) {
+	return (bitfield & mask) == mask;
+}
+
+struct core_type_context {
+	uint32_t max_processors_count;
+	uint32_t core_type;
+	uint32_t processors_count;
+	struct cpuinfo_x86_linux_processor* processors;
+};
+
+static bool core_type_parser(uint32_t processor_list_start, uint32_t processor_list_end, void* context) {
+	struct core_type_context* core_type_context = (struct core_type_context*) context;
+	if (processor_list_end > core_type_context->max_processors_count) {
+		cpuinfo_log_warning("ignore processors %"PRIu32"-%"PRIu32" of core type %#"PRIx32,
+			core_type_context->max_processors_count, processor_list_end - 1, core_type_context->core_type);
+		processor_list_end = core_type_context->max_processors_count;
+	}
+	for (uint32_t processor = processor_list_start; processor < processor_list_end; processor++) {
+		core_type_context->processors[processor].core_type = core_type_context->core_type;
+		core_type_context->processors_count += 1;
+	}
+	return true;
+}
+
+/*
+ * Runs the function on the specified logical processor by temporarily binding the calling thread to it.
+ * Returns false, without calling the function, if the thread could not be bound.
+ */
+static bool run_on_processor(
+	uint32_t max_processors_count,
+	uint32_t processor,
+	void (*function)(void*),
+	void* argument)
+{
+#if CPUINFO_MOCK
+	/* CPUID is mocked: binding to a processor would not change the result */
+	(void) max_processors_count;
+	(void) processor;
+	(void) function;
+	(void) argument;
+	return false;
+#else
+	bool status = false;
+	const size_t set_size = CPU_ALLOC_SIZE(max_processors_count);
+	cpu_set_t* saved_set = CPU_ALLOC(max_processors_count);
+	cpu_set_t* target_set = CPU_ALLOC(max_processors_count);
+	if (saved_set == NULL || target_set == NULL) {
+		cpuinfo_log_warning("failed to allocate %zu bytes for affinity masks of %"PRIu32" logical processors",
+			2 * set_size, max_processors_count);
+		goto cleanup;
+	}
+
+	if (sched_getaffinity(0, set_size, saved_set) != 0) {
+		cpuinfo_log_warning("failed to query thread affinity mask");
+		goto cleanup;
+	}
+
+	CPU_ZERO_S(set_size, target_set);
+	CPU_SET_S(processor, set_size, target_set);
+	if (sched_setaffinity(0, set_size, target_set) != 0) {
+		cpuinfo_log_info("failed to bind thread to processor %"PRIu32, processor);
+		goto cleanup;
+	}
+
+	function(argument);
+	status = true;
+
+	if (sched_setaffinity(0, set_size, saved_set) != 0) {
+		cpuinfo_log_warning("failed to restore thread affinity mask");
+	}
+
+cleanup:
+	CPU_FREE(saved_set);
+	CPU_FREE(target_set);
+	return status;
+#endif
+}
+
+static void read_core_type(void* context) {
+	uint32_t* core_type_ptr = (uint32_t*) context;
+	*core_type_ptr = cpuid(UINT32_C(0x1A)).eax >> 24;
+}
+
+static void init_processor(void* context) {
+	cpuinfo_x86_init_processor((struct cpuinfo_x86_processor*) context);
+}
+
+bool cpuinfo_x86_linux_detect_core_types(
+	uint32_t max_processors_count,
+	struct cpuinfo_x86_linux_processor processors[restrict static max_processors_count])
+{
+	struct core_type_context context = {
+		.max_processors_count = max_processors_count,
+		.core_type = cpuinfo_x86_core_type_core,
+		.processors = processors,
+	};
+	if (!cpuinfo_linux_parse_cpulist(CORE_CPULIST_FILENAME, core_type_parser, &context)) {
+		cpuinfo_log_debug("failed to parse the list of P-cores from %s", CORE_CPULIST_FILENAME);
+	}
+	context.core_type = cpuinfo_x86_core_type_atom;
+	if (!cpuinfo_linux_parse_cpulist(ATOM_CPULIST_FILENAME, core_type_parser, &context)) {
+		cpuinfo_log_debug("failed to parse the list of E-cores from %s", ATOM_CPULIST_FILENAME);
+	}
+	if (context.processors_count != 0) {
+		return true;
+	}
+
+	/* Older kernels do not report core types: query CPUID leaf 0x1A on every processor */
+	uint32_t probed_processors_count = 0;
+	for (uint32_t i = 0; i < max_processors_count; i++) {
+		if (bitmask_all(processors[i].flags, CPUINFO_LINUX_FLAG_VALID)) {
+			uint32_t core_type = cpuinfo_x86_core_type_none;
+			if (run_on_processor(max_processors_count, i, read_core_type, &core_type)) {
+				processors[i].core_type = core_type;
+				probed_processors_count += 1;
+			}
+		}
+	}
+	return probed_processors_count != 0;
+}
+
+void cpuinfo_x86_linux_init_processor(
+	uint32_t max_processors_count,
+	uint32_t linux_id,
+	uint32_t core_type,
+	struct cpuinfo_x86_processor processor[restrict static 1])
+{
+	memset(processor, 0, sizeof(struct cpuinfo_x86_processor));
+	if (!run_on_processor(max_processors_count, linux_id, init_processor, processor)) {
+		cpuinfo_x86_init_processor(processor);
+	}
+
+	if (processor->core_type != core_type) {
+		cpuinfo_log_info(
+			"could not probe processor %"PRIu32" of core type %#"PRIx32": cache parameters may be inaccurate",
+			linux_id, core_type);
+
+		struct cpuinfo_x86_model_info model_info = cpuinfo_x86_decode_model_info(processor->cpuid);
+		model_info.core_type = core_type;
+		processor->core_type = core_type;
+		processor->uarch = cpuinfo_x86_decode_uarch(processor->vendor, &model_info);
+	}
+}
@@ -27,6 +27,27 @@ static inline int cmp(uint32_t a, uint32_t b) {
 	return (a > b) - (a < b);
 }
 
+static uint32_t get_llc_apic_bits(const struct cpuinfo_x86_processor processor[restrict static 1]) {
+	if (processor->cache.l4.size != 0) {
+		return processor->cache.l4.apic_bits;
+	} else if (processor->cache.l3.size != 0) {
+		return processor->cache.l3.apic_bits;
+	} else if (processor->cache.l2.size != 0) {
+		return processor->cache.l2.apic_bits;
+	} else if (processor->cache.l1d.size != 0) {
+		return processor->cache.l1d.apic_bits;
+	}
+	return 0;
+}
+
+/* Mask of APIC ID bits which identify a die, or a package if the processor does not report dies */
+static uint32_t get_die_apic_mask(const struct cpuinfo_x86_topology topology[restrict static 1]) {
+	if (topology->die_bits_length != 0) {
+		return ~bit_mask(topology->die_bits_offset);
+	}
+	return ~bit_mask(topology->package_bits_offset);
+}
+
 static int cmp_x86_linux_processor(const void* ptr_a, const void* ptr_b) {
 	const struct cpuinfo_x86_linux_processor* processor_a = (const struct cpuinfo_x86_linux_processor*) ptr_a;
 	const struct cpuinfo_x86_linux_processor* processor_b = (const struct cpuinfo_x86_linux_processor*) ptr_b;
@@ -47,11 +68,11 @@ static int cmp_x86_linux_processor(const void* ptr_a, const void* ptr_b) {
 static void cpuinfo_x86_count_objects(
 	uint32_t linux_processors_count,
 	const struct cpuinfo_x86_linux_processor linux_processors[restrict static linux_processors_count],
-	const struct cpuinfo_x86_processor processor[restrict static 1],
+	const struct cpuinfo_x86_processor x86_processors[restrict static 1],
 	uint32_t valid_processor_mask,
-	uint32_t llc_apic_bits,
 	uint32_t cores_count_ptr[restrict static 1],
 	uint32_t clusters_count_ptr[restrict static 1],
+	uint32_t dies_count_ptr[restrict static 1],
 	uint32_t packages_count_ptr[restrict static 1],
 	uint32_t l1i_count_ptr[restrict static 1],
 	uint32_t l1d_count_ptr[restrict static 1],
@@ -59,16 +80,11 @@ static void cpuinfo_x86_count_objects(
 	uint32_t l3_count_ptr[restrict static 1],
 	uint32_t l4_count_ptr[restrict static 1])
 {
-	const uint32_t core_apic_mask =
-		~(bit_mask(processor->topology.thread_bits_length) << processor->topology.thread_bits_offset);
-	const uint32_t package_apic_mask =
-		core_apic_mask & ~(bit_mask(processor->topology.core_bits_length) << processor->topology.core_bits_offset);
-	const uint32_t llc_apic_mask = ~bit_mask(llc_apic_bits);
-	const uint32_t cluster_apic_mask = package_apic_mask | llc_apic_mask;
-
-	uint32_t cores_count = 0, clusters_count = 0, packages_count = 0;
+	uint32_t cores_count = 0, clusters_count = 0, dies_count = 0, packages_count = 0;
 	uint32_t l1i_count = 0, l1d_count = 0, l2_count = 0, l3_count = 0, l4_count = 0;
-	uint32_t last_core_id = UINT32_MAX, last_cluster_id = UINT32_MAX, last_package_id = UINT32_MAX;
+	uint32_t last_core_id = UINT32_MAX, last_cluster_id = UINT32_MAX;
+	uint32_t last_die_id = UINT32_MAX, last_package_id = UINT32_MAX;
+	uint32_t last_core_type_index = UINT32_MAX;
 	uint32_t last_l1i_id = UINT32_MAX, last_l1d_id = UINT32_MAX;
 	uint32_t last_l2_id = UINT32_MAX, last_l3_id = UINT32_MAX, last_l4_id = UINT32_MAX;
 	for (uint32_t i = 0; i < linux_processors_count; i++) {
@@ -76,22 +92,38 @@ static void cpuinfo_x86_count_objects(
 			const uint32_t apic_id = linux_processors[i].apic_id;
 			cpuinfo_log_debug("APID ID %"PRIu32": system processor %"PRIu32, apic_id, linux_processors[i].linux_id);
 
+			const uint32_t core_type_index = linux_processors[i].core_type_index;
+			const struct cpuinfo_x86_processor* processor = &x86_processors[core_type_index];
+			const uint32_t core_apic_mask =
+				~(bit_mask(processor->topology.thread_bits_length) << processor->topology.thread_bits_offset);
+			const uint32_t package_apic_mask = ~bit_mask(processor->topology.package_bits_offset);
+			const uint32_t die_apic_mask = get_die_apic_mask(&processor->topology);
+			const uint32_t llc_apic_mask = ~bit_mask(get_llc_apic_bits(processor));
+			const uint32_t cluster_apic_mask = package_apic_mask | llc_apic_mask;
+
 			/* All bits of APIC ID except thread ID mask */
 			const uint32_t core_id = apic_id & core_apic_mask;
 			if (core_id != last_core_id) {
 				last_core_id = core_id;
 				cores_count++;
 			}
-			/* All bits of APIC ID except thread ID and core ID masks */
+			/* All bits of APIC ID above the die level */
 			const uint32_t package_id = apic_id & package_apic_mask;
 			if (package_id != last_package_id) {
 				last_package_id = package_id;
 				packages_count++;
 			}
-			/* Bits of APIC ID which are part of either LLC or package ID mask */
+			/* All bits of APIC ID above the core level, except module and tile IDs */
+			const uint32_t die_id = apic_id & die_apic_mask;
+			if (die_id != last_die_id) {
+				last_die_id = die_id;
+				dies_count++;
+			}
+			/* Bits of APIC ID which are part of either LLC or package ID mask; different core types form different clusters */
 			const uint32_t cluster_id = apic_id & cluster_apic_mask;
-			if (cluster_id != last_cluster_id) {
+			if (cluster_id != last_cluster_id || core_type_index != last_core_type_index) {
 				last_cluster_id = cluster_id;
+				last_core_type_index = core_type_index;
 				clusters_count++;
 			}
 			if (processor->cache.l1i.size != 0) {
@@ -133,6 +165,7 @@ static void cpuinfo_x86_count_objects(
 	}
 	*cores_count_ptr = cores_count;
 	*clusters_count_ptr = clusters_count;
+	*dies_count_ptr = dies_count;
 	*packages_count_ptr = packages_count;
 	*l1i_count_ptr = l1i_count;
 	*l1d_count_ptr = l1d_count;
@@ -141,14 +174,20 @@ static void cpuinfo_x86_count_objects(
 	*l4_count_ptr  = l4_count;
 }
 
-void cpuinfo_x86_linux_init(void) {
+void cpuinfo_x86_linux_init(bool update_isa) {
+	struct cpuinfo_arena scratch_arena = { NULL, 0 };
+	struct cpuinfo_arena arena = { NULL, 0 };
 	struct cpuinfo_x86_linux_processor* x86_linux_processors = NULL;
 	struct cpuinfo_processor* processors = NULL;
 	struct cpuinfo_core* cores = NULL;
 	struct cpuinfo_cluster* clusters = NULL;
 	struct cpuinfo_package* packages = NULL;
+	struct cpuinfo_die* dies = NULL;
+	struct cpuinfo_node* nodes = NULL;
+	struct cpuinfo_uarch_info* uarchs = NULL;
 	const struct cpuinfo_processor** linux_cpu_to_processor_map = NULL;
 	const struct cpuinfo_core** linux_cpu_to_core_map = NULL;
+	uint32_t* linux_cpu_to_uarch_index_map = NULL;
 	struct cpuinfo_cache* l1i = NULL;
 	struct cpuinfo_cache* l1d = NULL;
 	struct cpuinfo_cache* l2 = NULL;
@@ -178,11 +217,12 @@ void cpuinfo_x86_linux_init(void) {
 		valid_processor_mask |= CPUINFO_LINUX_FLAG_POSSIBLE;
 	}
 
-	x86_linux_processors = calloc(x86_linux_processors_count, sizeof(struct cpuinfo_x86_linux_processor));
-	if (x86_linux_processors == NULL) {
-		cpuinfo_log_error(
-			"failed to allocate %zu bytes for descriptions of %"PRIu32" x86 logical processors",
-			x86_linux_processors_count * sizeof(struct cpuinfo_x86_linux_processor),
+	/* Temporary descriptions of Linux processors are released together after initialization */
+	const struct cpuinfo_arena_table scratch_tables[] = {
+		{ &x86_linux_processors, x86_linux_processors_count, sizeof(struct cpuinfo_x86_linux_processor) },
+	};
+	if (!cpuinfo_arena_allocate(&scratch_arena, CPUINFO_COUNT_OF(scratch_tables), scratch_tables)) {
+		cpuinfo_log_error("failed to allocate descriptions of %"PRIu32" x86 logical processors",
 			x86_linux_processors_count);
 		return;
 	}
@@ -201,23 +241,48 @@ void cpuinfo_x86_linux_init(void) {
 			CPUINFO_LINUX_FLAG_PRESENT);
 	}
 
-	if (!cpuinfo_x86_linux_parse_proc_cpuinfo(x86_linux_processors_count, x86_linux_processors)) {
-		cpuinfo_log_error("failed to parse processor information from /proc/cpuinfo");
-		return;
+	struct cpuinfo_x86_processor x86_processor;
+	memset(&x86_processor, 0, sizeof(x86_processor));
+	cpuinfo_x86_init_processor(&x86_processor);
+	if (update_isa) {
+		cpuinfo_x86_init_isa();
 	}
 
-	for (uint32_t i = 0; i < x86_linux_processors_count; i++) {
-		if (bitmask_all(x86_linux_processors[i].flags, valid_processor_mask)) {
-			x86_linux_processors[i].flags |= CPUINFO_LINUX_FLAG_VALID;
+	/*
+	 * Reading /proc/cpuinfo makes the kernel sample frequency of every processor, so APIC IDs are derived from
+	 * sysfs topology when the list of present processors is available, and /proc/cpuinfo is only a fallback.
+	 */
+	bool apic_ids_detected = false;
+	if (!(valid_processor_mask & CPUINFO_LINUX_FLAG_PROC_CPUINFO)) {
+		for (uint32_t i = 0; i < x86_linux_processors_count; i++) {
+			if (bitmask_all(x86_linux_processors[i].flags, valid_processor_mask)) {
+				x86_linux_processors[i].flags |= CPUINFO_LINUX_FLAG_VALID;
+			}
 		}
+		apic_ids_detected = cpuinfo_x86_linux_detect_apic_ids(
+			x86_linux_processors_count, &x86_processor.topology, x86_linux_processors);
 	}
+	if (!apic_ids_detected) {
+		if (!cpuinfo_x86_linux_parse_proc_cpuinfo(x86_linux_processors_count, x86_linux_processors)) {
+			cpuinfo_log_error("failed to parse processor information from /proc/cpuinfo");
+			goto cleanup;
+		}
 
-	struct cpuinfo_x86_processor x86_processor;
-	memset(&x86_processor, 0, sizeof(x86_processor));
-	cpuinfo_x86_init_processor(&x86_processor);
+		for (uint32_t i = 0; i < x86_linux_processors_count; i++) {
+			if (bitmask_all(x86_linux_processors[i].flags, valid_processor_mask)) {
+				x86_linux_processors[i].flags |= CPUINFO_LINUX_FLAG_VALID;
+			}
+		}
+	}
 	char brand_string[48];
 	cpuinfo_x86_normalize_brand_string(x86_processor.brand_string, brand_string);
 
+	if (x86_processor.core_type != cpuinfo_x86_core_type_none) {
+		if (!cpuinfo_x86_linux_detect_core_types(x86_linux_processors_count, x86_linux_processors)) {
+			cpuinfo_log_warning("failed to detect core types of a hybrid processor");
+		}
+	}
+
 	uint32_t processors_count = 0;
 	for (uint32_t i = 0; i < x86_linux_processors_count; i++) {
 		if (bitmask_all(x86_linux_processors[i].flags, CPUINFO_LINUX_FLAG_VALID)) {
@@ -229,31 +294,62 @@ void cpuinfo_x86_linux_init(void) {
 	qsort(x86_linux_processors, x86_linux_processors_count, sizeof(struct cpuinfo_x86_linux_processor),
 		cmp_x86_linux_processor);
 
-	processors = calloc(processors_count, sizeof(struct cpuinfo_processor));
-	if (processors == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" logical processors",
-			processors_count * sizeof(struct cpuinfo_processor), processors_count);
-		goto cleanup;
+	/*
+	 * Hybrid processors combine cores of different types, which differ in microarchitecture and cache hierarchy.
+	 * Describe each core type with CPUID information probed on the first processor of that type.
+	 */
+	struct cpuinfo_x86_processor x86_processors[CPUINFO_X86_LINUX_MAX_CORE_TYPES];
+	uint32_t core_types_count = 0;
+	for (uint32_t i = 0; i < x86_linux_processors_count; i++) {
+		if (bitmask_all(x86_linux_processors[i].flags, CPUINFO_LINUX_FLAG_VALID)) {
+			const uint32_t core_type = x86_linux_processors[i].core_type;
+			uint32_t core_type_index = 0;
+			while (core_type_index < core_types_count && x86_processors[core_type_index].core_type != core_type) {
+				core_type_index++;
+			}
+			if (core_type_index == core_types_count) {
+				if (core_types_count == CPUINFO_X86_LINUX_MAX_CORE_TYPES) {
+					cpuinfo_log_warning("ignore core type %#"PRIx32" of processor %"PRIu32": too many core types",
+						core_type, x86_linux_processors[i].linux_id);
+					core_type_index = 0;
+				} else if (core_type == x86_processor.core_type) {
+					x86_processors[core_types_count++] = x86_processor;
+				} else {
+					cpuinfo_x86_linux_init_processor(x86_linux_processors_count,
+						x86_linux_processors[i].linux_id, core_type, &x86_processors[core_types_count++]);
+				}
+			}
+			x86_linux_processors[i].core_type_index = core_type_index;
+		}
+	}
+	if (core_types_count == 0) {
+		x86_processors[core_types_count++] = x86_processor;
 	}
 
-	uint32_t llc_apic_bits = 0;
-	if (x86_processor.cache.l4.size != 0) {
-		llc_apic_bits = x86_processor.cache.l4.apic_bits;
-	} else if (x86_processor.cache.l3.size != 0) {
-		llc_apic_bits = x86_processor.cache.l3.apic_bits;
-	} else if (x86_processor.cache.l2.size != 0) {
-		llc_apic_bits = x86_processor.cache.l2.apic_bits;
-	} else if (x86_processor.cache.l1d.size != 0) {
-		llc_apic_bits = x86_processor.cache.l1d.apic_bits;
+	/* Group core types with the same microarchitecture, in the order of appearance */
+	uint32_t core_type_to_uarch_index[CPUINFO_X86_LINUX_MAX_CORE_TYPES];
+	uint32_t uarchs_count = 0;
+	for (uint32_t t = 0; t < core_types_count; t++) {
+		uint32_t uarch_index = 0;
+		while (uarch_index < t && !(x86_processors[uarch_index].uarch == x86_processors[t].uarch &&
+			x86_processors[uarch_index].cpuid == x86_processors[t].cpuid))
+		{
+			uarch_index++;
+		}
+		core_type_to_uarch_index[t] = uarch_index == t ? uarchs_count++ : core_type_to_uarch_index[uarch_index];
 	}
-	uint32_t packages_count = 0, clusters_count = 0, cores_count = 0;
+	cpuinfo_log_debug("detected %"PRIu32" core types of %"PRIu32" microarchitectures", core_types_count, uarchs_count);
+
+	uint32_t packages_count = 0, dies_count = 0, clusters_count = 0, cores_count = 0;
 	uint32_t l1i_count = 0, l1d_count = 0, l2_count = 0, l3_count = 0, l4_count = 0;
 	cpuinfo_x86_count_objects(
-		x86_linux_processors_count, x86_linux_processors, &x86_processor, valid_processor_mask, llc_apic_bits,
-		&cores_count, &clusters_count, &packages_count, &l1i_count, &l1d_count, &l2_count, &l3_count, &l4_count);
+		x86_linux_processors_count, x86_linux_processors, x86_processors, valid_processor_mask,
+		&cores_count, &clusters_count, &dies_count, &packages_count,
+		&l1i_count, &l1d_count, &l2_count, &l3_count, &l4_count);
 
 	cpuinfo_log_debug("detected %"PRIu32" cores", cores_count);
 	cpuinfo_log_debug("detected %"PRIu32" clusters", clusters_count);
+	cpuinfo_log_debug("detected %"PRIu32" dies", dies_count);
 	cpuinfo_log_debug("detected %"PRIu32" packages", packages_count);
 	cpuinfo_log_debug("detected %"PRIu32" L1I caches", l1i_count);
 	cpuinfo_log_debug("detected %"PRIu32" L1D caches", l1d_count);
@@ -261,100 +357,56 @@ void cpuinfo_x86_linux_init(void) {
 	cpuinfo_log_debug("detected %"PRIu32" L3 caches", l3_count);
 	cpuinfo_log_debug("detected %"PRIu32" L4 caches", l4_count);
 
-	linux_cpu_to_processor_map = calloc(x86_linux_processors_count, sizeof(struct cpuinfo_processor*));
-	if (linux_cpu_to_processor_map == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for mapping entries of %"PRIu32" logical processors",
-			x86_linux_processors_count * sizeof(struct cpuinfo_processor*),
-			x86_linux_processors_count);
-		goto cleanup;
-	}
-
-	linux_cpu_to_core_map = calloc(x86_linux_processors_count, sizeof(struct cpuinfo_core*));
-	if (linux_cpu_to_core_map == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for mapping entries of %"PRIu32" cores",
-			x86_linux_processors_count * sizeof(struct cpuinfo_core*),
-			x86_linux_processors_count);
-		goto cleanup;
-	}
-
-	cores = calloc(cores_count, sizeof(struct cpuinfo_core));
-	if (cores == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" cores",
-			cores_count * sizeof(struct cpuinfo_core), cores_count);
-		goto cleanup;
-	}
-
-	clusters = calloc(clusters_count, sizeof(struct cpuinfo_cluster));
-	if (clusters == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" core clusters",
-			clusters_count * sizeof(struct cpuinfo_cluster), clusters_count);
+	/* All published tables share one arena, in the order in which lookups traverse them */
+	const struct cpuinfo_arena_table tables[] = {
+		{ &processors, processors_count, sizeof(struct cpuinfo_processor) },
+		{ &cores, cores_count, sizeof(struct cpuinfo_core) },
+		{ &clusters, clusters_count, sizeof(struct cpuinfo_cluster) },
+		{ &dies, dies_count, sizeof(struct cpuinfo_die) },
+		{ &packages, packages_count, sizeof(struct cpuinfo_package) },
+		{ &l1i, l1i_count, sizeof(struct cpuinfo_cache) },
+		{ &l1d, l1d_count, sizeof(struct cpuinfo_cache) },
+		{ &l2, l2_count, sizeof(struct cpuinfo_cache) },
+		{ &l3, l3_count, sizeof(struct cpuinfo_cache) },
+		{ &l4, l4_count, sizeof(struct cpuinfo_cache) },
+		{ &uarchs, uarchs_count, sizeof(struct cpuinfo_uarch_info) },
+		{ &linux_cpu_to_processor_map, x86_linux_processors_count, sizeof(struct cpuinfo_processor*) },
+		{ &linux_cpu_to_core_map, x86_linux_processors_count, sizeof(struct cpuinfo_core*) },
+		{ &linux_cpu_to_uarch_index_map, uarchs_count > 1 ? x86_linux_processors_count : 0, sizeof(uint32_t) },
+	};
+	if (!cpuinfo_arena_allocate(&arena, CPUINFO_COUNT_OF(tables), tables)) {
+		cpuinfo_log_error("failed to allocate descriptions of %"PRIu32" logical processors", processors_count);
 		goto cleanup;
 	}
 
-	packages = calloc(packages_count, sizeof(struct cpuinfo_package));
-	if (packages == NULL) {
-		cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" physical packages",
-			packages_count * sizeof(struct cpuinfo_package), packages_count);
-		goto cleanup;
+	for (uint32_t t = 0; t < core_types_count; t++) {
+		uarchs[core_type_to_uarch_index[t]].uarch = x86_processors[t].uarch;
+		uarchs[core_type_to_uarch_index[t]].cpuid = x86_processors[t].cpuid;
 	}
 
-	if (l1i_count != 0) {
-		l1i = calloc(l1i_count, sizeof(struct cpuinfo_cache));
-		if (l1i == NULL) {
-			cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" L1I caches",
-				l1i_count * sizeof(struct cpuinfo_cache), l1i_count);
-			goto cleanup;
-		}
-	}
-	if (l1d_count != 0) {
-		l1d = calloc(l1d_count, sizeof(struct cpuinfo_cache));
-		if (l1d == NULL) {
-			cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" L1D caches",
-				l1d_count * sizeof(struct cpuinfo_cache), l1d_count);
-			goto cleanup;
-		}
-	}
-	if (l2_count != 0) {
-		l2 = calloc(l2_count, sizeof(struct cpuinfo_cache));
-		if (l2 == NULL) {
-			cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" L2 caches",
-				l2_count * sizeof(struct cpuinfo_cache), l2_count);
-			goto cleanup;
-		}
-	}
-	if (l3_count != 0) {
-		l3 = calloc(l3_count, sizeof(struct cpuinfo_cache));
-		if (l3 == NULL) {
-			cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" L3 caches",
-				l3_count * sizeof(struct cpuinfo_cache), l3_count);
-			goto cleanup;
-		}
-	}
-	if (l4_count != 0) {
-		l4 = calloc(l4_count, sizeof(struct cpuinfo_cache));
-		if (l4 == NULL) {
-			cpuinfo_log_error("failed to allocate %zu bytes for descriptions of %"PRIu32" L4 caches",
-				l4_count * sizeof(struct cpuinfo_cache), l4_count);
-			goto cleanup;
-		}
-	}
-
-	const uint32_t core_apic_mask =
-		~(bit_mask(x86_processor.topology.thread_bits_length) << x86_processor.topology.thread_bits_offset);
-	const uint32_t package_apic_mask =
-		core_apic_mask & ~(bit_mask(x86_processor.topology.core_bits_length) << x86_processor.topology.core_bits_offset);
-	const uint32_t llc_apic_mask = ~bit_mask(llc_apic_bits);
-	const uint32_t cluster_apic_mask = package_apic_mask | llc_apic_mask;
-
-	uint32_t processor_index = UINT32_MAX, core_index = UINT32_MAX, cluster_index = UINT32_MAX, package_index = UINT32_MAX;
+	uint32_t processor_index = UINT32_MAX, core_index = UINT32_MAX, cluster_index = UINT32_MAX;
+	uint32_t die_index = UINT32_MAX, package_index = UINT32_MAX;
 	uint32_t l1i_index = UINT32_MAX, l1d_index = UINT32_MAX, l2_index = UINT32_MAX, l3_index = UINT32_MAX, l4_index = UINT32_MAX;
-	uint32_t cluster_id = 0, core_id = 0, smt_id = 0;
-	uint32_t last_apic_core_id = UINT32_MAX, last_apic_cluster_id = UINT32_MAX, last_apic_package_id = UINT32_MAX;
+	uint32_t cluster_id = 0, die_id = 0, core_id = 0, smt_id = 0;
+	uint32_t last_apic_core_id = UINT32_MAX, last_apic_cluster_id = UINT32_MAX;
+	uint32_t last_apic_die_id = UINT32_MAX, last_apic_package_id = UINT32_MAX;
+	uint32_t last_core_type_index = UINT32_MAX;
 	uint32_t last_l1i_id = UINT32_MAX, last_l1d_id = UINT32_MAX;
 	uint32_t last_l2_id = UINT32_MAX, last_l3_id = UINT32_MAX, last_l4_id = UINT32_MAX;
 	for (uint32_t i = 0; i < x86_linux_processors_count; i++) {
 		if (bitmask_all(x86_linux_processors[i].flags, CPUINFO_LINUX_FLAG_VALID)) {
 			const uint32_t apic_id = x86_linux_processors[i].apic_id;
+			const uint32_t core_type_index = x86_linux_processors[i].core_type_index;
+			const uint32_t uarch_index = core_type_to_uarch_index[core_type_index];
+			const struct cpuinfo_x86_processor* x86_core = &x86_processors[core_type_index];
+			const uint32_t core_apic_mask =
+				~(bit_mask(x86_core->topology.thread_bits_length) << x86_core->topology.thread_bits_offset);
+			const uint32_t package_apic_mask = ~bit_mask(x86_core->topology.package_bits_offset);
+			const uint32_t die_apic_mask = get_die_apic_mask(&x86_core->topology);
+			const uint32_t llc_apic_mask = ~bit_mask(get_llc_apic_bits(x86_core));
+			const uint32_t cluster_apic_mask = package_apic_mask | llc_apic_mask;
+			const bool new_core_type = core_type_index != last_core_type_index;
+			last_core_type_index = core_type_index;
 			processor_index++;
 			smt_id++;
 
@@ -367,22 +419,31 @@ void cpuinfo_x86_linux_init(void) {
 			}
 			/* Bits of APIC ID which are part of either LLC or package ID mask */
 			const uint32_t apic_cluster_id = apic_id & cluster_apic_mask;
-			if (apic_cluster_id != last_apic_cluster_id) {
+			const bool new_cluster = apic_cluster_id != last_apic_cluster_id || new_core_type;
+			if (new_cluster) {
 				cluster_index++;
 				cluster_id++;
 			}
-			/* All bits of APIC ID except thread ID and core ID masks */
+			/* All bits of APIC ID above the core level, except module and tile IDs */
+			const uint32_t apic_die_id = apic_id & die_apic_mask;
+			if (apic_die_id != last_apic_die_id) {
+				die_index++;
+				die_id++;
+			}
+			/* All bits of APIC ID above the die level */
 			const uint32_t apic_package_id = apic_id & package_apic_mask;
 			if (apic_package_id != last_apic_package_id) {
 				package_index++;
 				core_id = 0;
 				cluster_id = 0;
+				die_id = 0;
 			}
 
 			/* Initialize logical processor object */
 			processors[processor_index].smt_id   = smt_id;
 			processors[processor_index].core     = cores + core_index;
 			processors[processor_index].cluster  = clusters + cluster_index;
+			processors[processor_index].die      = dies + die_index;
 			processors[processor_index].package  = packages + package_index;
 			processors[processor_index].linux_id = x86_linux_processors[i].linux_id;
 			processors[processor_index].apic_id  = x86_linux_processors[i].apic_id;
@@ -394,29 +455,32 @@ void cpuinfo_x86_linux_init(void) {
 					.processor_count = 1,
 					.core_id = core_id,
 					.cluster = clusters + cluster_index,
+					.die = dies + die_index,
 					.package = packages + package_index,
-					.vendor = x86_processor.vendor,
-					.uarch = x86_processor.uarch,
-					.cpuid = x86_processor.cpuid,
+					.vendor = x86_core->vendor,
+					.uarch = x86_core->uarch,
+					.cpuid = x86_core->cpuid,
 				};
 				clusters[cluster_index].core_count += 1;
+				dies[die_index].core_count += 1;
 				packages[package_index].core_count += 1;
+				uarchs[uarch_index].core_count += 1;
 				last_apic_core_id = apid_core_id;
 			} else {
 				/* another logical processor on the same core */
 				cores[core_index].processor_count++;
 			}
 
-			if (apic_cluster_id != last_apic_cluster_id) {
+			if (new_cluster) {
 				/* new cluster */
 				clusters[cluster_index].processor_start = processor_index;
 				clusters[cluster_index].processor_count = 1;
 				clusters[cluster_index].core_start = core_index;
 				clusters[cluster_index].cluster_id = cluster_id;
 				clusters[cluster_index].package = packages + package_index;
-				clusters[cluster_index].vendor = x86_processor.vendor;
-				clusters[cluster_index].uarch = x86_processor.uarch;
-				clusters[cluster_index].cpuid = x86_processor.cpuid;
+				clusters[cluster_index].vendor = x86_core->vendor;
+				clusters[cluster_index].uarch = x86_core->uarch;
+				clusters[cluster_index].cpuid = x86_core->cpuid;
 				packages[package_index].cluster_count += 1;
 				last_apic_cluster_id = apic_cluster_id;
 			} else {
@@ -424,13 +488,28 @@ void cpuinfo_x86_linux_init(void) {
 				clusters[cluster_index].processor_count++;
 			}
 
+			if (apic_die_id != last_apic_die_id) {
+				/* new die */
+				dies[die_index].processor_start = processor_index;
+				dies[die_index].processor_count = 1;
+				dies[die_index].core_start = core_index;
+				dies[die_index].die_id = die_id;
+				dies[die_index].package = packages + package_index;
+				packages[package_index].die_count += 1;
+				last_apic_die_id = apic_die_id;
+			} else {
+				/* another logical processor on the same die */
+				dies[die_index].processor_count++;
+			}
+
 			if (apic_package_id != last_apic_package_id) {
 				/* new package */
 				packages[package_index].processor_start = processor_index;
 				packages[package_index].processor_count = 1;
 				packages[package_index].core_start = core_index;
 				packages[package_index].cluster_start = cluster_index;
-				cpuinfo_x86_format_package_name(x86_processor.vendor, brand_string, packages[package_index].name);
+				packages[package_index].die_start = die_index;
+				cpuinfo_x86_format_package_name(x86_core->vendor, brand_string, packages[package_index].name);
 				last_apic_package_id = apic_package_id;
 			} else {
 				/* another logical processor on the same package */
@@ -439,20 +518,24 @@ void cpuinfo_x86_linux_init(void) {
 
 			linux_cpu_to_processor_map[x86_linux_processors[i].linux_id] = processors + processor_index;
 			linux_cpu_to_core_map[x86_linux_processors[i].linux_id] = cores + core_index;
+			if (linux_cpu_to_uarch_index_map != NULL) {
+				linux_cpu_to_uarch_index_map[x86_linux_processors[i].linux_id] = uarch_index;
+			}
+			uarchs[uarch_index].processor_count += 1;
 
-			if (x86_processor.cache.l1i.size != 0) {
-				const uint32_t l1i_id = apic_id & ~bit_mask(x86_processor.cache.l1i.apic_bits);
+			if (x86_core->cache.l1i.size != 0) {
+				const uint32_t l1i_id = apic_id & ~bit_mask(x86_core->cache.l1i.apic_bits);
 				processors[i].cache.l1i = &l1i[l1i_index];
 				if (l1i_id != last_l1i_id) {
 					/* new cache */
 					last_l1i_id = l1i_id;
 					l1i[++l1i_index] = (struct cpuinfo_cache) {
-						.size            = x86_processor.cache.l1i.size,
-						.associativity   = x86_processor.cache.l1i.associativity,
-						.sets            = x86_processor.cache.l1i.sets,
-						.partitions      = x86_processor.cache.l1i.partitions,
-						.line_size       = x86_processor.cache.l1i.line_size,
-						.flags           = x86_processor.cache.l1i.flags,
+						.size            = x86_core->cache.l1i.size,
+						.associativity   = x86_core->cache.l1i.associativity,
+						.sets            = x86_core->cache.l1i.sets,
+						.partitions      = x86_core->cache.l1i.partitions,
+						.line_size       = x86_core->cache.l1i.line_size,
+						.flags           = x86_core->cache.l1i.flags,
 						.processor_start = processor_index,
 						.processor_count = 1,
 					};
@@ -465,19 +548,19 @@ void cpuinfo_x86_linux_init(void) {
 				/* reset cache id */
 				last_l1i_id = UINT32_MAX;
 			}
-			if (x86_processor.cache.l1d.size != 0) {
-				const uint32_t l1d_id = apic_id & ~bit_mask(x86_processor.cache.l1d.apic_bits);
+			if (x86_core->cache.l1d.size != 0) {
+				const uint32_t l1d_id = apic_id & ~bit_mask(x86_core->cache.l1d.apic_bits);
 				processors[i].cache.l1d = &l1d[l1d_index];
 				if (l1d_id != last_l1d_id) {
 					/* new cache */
 					last_l1d_id = l1d_id;
 					l1d[++l1d_index] = (struct cpuinfo_cache) {
-						.size            = x86_processor.cache.l1d.size,
-						.associativity   = x86_processor.cache.l1d.associativity,
-						.sets            = x86_processor.cache.l1d.sets,
-						.partitions      = x86_processor.cache.l1d.partitions,
-						.line_size       = x86_processor.cache.l1d.line_size,
-						.flags           = x86_processor.cache.l1d.flags,
+						.size            = x86_core->cache.l1d.size,
+						.associativity   = x86_core->cache.l1d.associativity,
+						.sets            = x86_core->cache.l1d.sets,
+						.partitions      = x86_core->cache.l1d.partitions,
+						.line_size       = x86_core->cache.l1d.line_size,
+						.flags           = x86_core->cache.l1d.flags,
 						.processor_start = processor_index,
 						.processor_count = 1,
 					};
@@ -490,19 +573,19 @@ void cpuinfo_x86_linux_init(void) {
 				/* reset cache id */
 				last_l1d_id = UINT32_MAX;
 			}
-			if (x86_processor.cache.l2.size != 0) {
-				const uint32_t l2_id = apic_id & ~bit_mask(x86_processor.cache.l2.apic_bits);
+			if (x86_core->cache.l2.size != 0) {
+				const uint32_t l2_id = apic_id & ~bit_mask(x86_core->cache.l2.apic_bits);
 				processors[i].cache.l2 = &l2[l2_index];
 				if (l2_id != last_l2_id) {
 					/* new cache */
 					last_l2_id = l2_id;
 					l2[++l2_index] = (struct cpuinfo_cache) {
-						.size            = x86_processor.cache.l2.size,
-						.associativity   = x86_processor.cache.l2.associativity,
-						.sets            = x86_processor.cache.l2.sets,
-						.partitions      = x86_processor.cache.l2.partitions,
-						.line_size       = x86_processor.cache.l2.line_size,
-						.flags           = x86_processor.cache.l2.flags,
+						.size            = x86_core->cache.l2.size,
+						.associativity   = x86_core->cache.l2.associativity,
+						.sets            = x86_core->cache.l2.sets,
+						.partitions      = x86_core->cache.l2.partitions,
+						.line_size       = x86_core->cache.l2.line_size,
+						.flags           = x86_core->cache.l2.flags,
 						.processor_start = processor_index,
 						.processor_count = 1,
 					};
@@ -515,19 +598,19 @@ void cpuinfo_x86_linux_init(void) {
 				/* reset cache id */
 				last_l2_id = UINT32_MAX;
 			}
-			if (x86_processor.cache.l3.size != 0) {
-				const uint32_t l3_id = apic_id & ~bit_mask(x86_processor.cache.l3.apic_bits);
+			if (x86_core->cache.l3.size != 0) {
+				const uint32_t l3_id = apic_id & ~bit_mask(x86_core->cache.l3.apic_bits);
 				processors[i].cache.l3 = &l3[l3_index];
 				if (l3_id != last_l3_id) {
 					/* new cache */
 					last_l3_id = l3_id;
 					l3[++l3_index] = (struct cpuinfo_cache) {
-						.size            = x86_processor.cache.l3.size,
-						.associativity   = x86_processor.cache.l3.associativity,
-						.sets            = x86_processor.cache.l3.sets,
-						.partitions      = x86_processor.cache.l3.partitions,
-						.line_size       = x86_processor.cache.l3.line_size,
-						.flags           = x86_processor.cache.l3.flags,
+						.size            = x86_core->cache.l3.size,
+						.associativity   = x86_core->cache.l3.associativity,
+						.sets            = x86_core->cache.l3.sets,
+						.partitions      = x86_core->cache.l3.partitions,
+						.line_size       = x86_core->cache.l3.line_size,
+						.flags           = x86_core->cache.l3.flags,
 						.processor_start = processor_index,
 						.processor_count = 1,
 					};
@@ -540,19 +623,19 @@ void cpuinfo_x86_linux_init(void) {
 				/* reset cache id */
 				last_l3_id = UINT32_MAX;
 			}
-			if (x86_processor.cache.l4.size != 0) {
-				const uint32_t l4_id = apic_id & ~bit_mask(x86_processor.cache.l4.apic_bits);
+			if (x86_core->cache.l4.size != 0) {
+				const uint32_t l4_id = apic_id & ~bit_mask(x86_core->cache.l4.apic_bits);
 				processors[i].cache.l4 = &l4[l4_index];
 				if (l4_id != last_l4_id) {
 					/* new cache */
 					last_l4_id = l4_id;
 					l4[++l4_index] = (struct cpuinfo_cache) {
-						.size            = x86_processor.cache.l4.size,
-						.associativity   = x86_processor.cache.l4.associativity,
-						.sets            = x86_processor.cache.l4.sets,
-						.partitions      = x86_processor.cache.l4.partitions,
-						.line_size       = x86_processor.cache.l4.line_size,
-						.flags           = x86_processor.cache.l4.flags,
+						.size            = x86_core->cache.l4.size,
+						.associativity   = x86_core->cache.l4.associativity,
+						.sets            = x86_core->cache.l4.sets,
+						.partitions      = x86_core->cache.l4.partitions,
+						.line_size       = x86_core->cache.l4.line_size,
+						.flags           = x86_core->cache.l4.flags,
 						.processor_start = processor_index,
 						.processor_count = 1,
 					};
@@ -568,11 +651,21 @@ void cpuinfo_x86_linux_init(void) {
 		}
 	}
 
+	uint32_t nodes_count = 0;
+	if (!cpuinfo_linux_detect_nodes(x86_linux_processors_count, processors_count, processors, cores_count, cores,
+		&nodes, &nodes_count))
+	{
+		cpuinfo_log_error("failed to detect NUMA nodes");
+		goto cleanup;
+	}
+
 	/* Commit changes */
 	cpuinfo_processors = processors;
 	cpuinfo_cores = cores;
 	cpuinfo_clusters = clusters;
 	cpuinfo_packages = packages;
+	cpuinfo_dies = dies;
+	cpuinfo_nodes = nodes;
 	cpuinfo_cache[cpuinfo_cache_level_1i] = l1i;
 	cpuinfo_cache[cpuinfo_cache_level_1d] = l1d;
 	cpuinfo_cache[cpuinfo_cache_level_2]  = l2;
@@ -583,6 +676,8 @@ void cpuinfo_x86_linux_init(void) {
 	cpuinfo_cores_count = cores_count;
 	cpuinfo_clusters_count = clusters_count;
 	cpuinfo_packages_count = packages_count;
+	cpuinfo_dies_count = dies_count;
+	cpuinfo_nodes_count = nodes_count;
 	cpuinfo_cache_count[cpuinfo_cache_level_1i] = l1i_count;
 	cpuinfo_cache_count[cpuinfo_cache_level_1d] = l1d_count;
 	cpuinfo_cache_count[cpuinfo_cache_level_2]  = l2_count;
@@ -590,40 +685,28 @@ void cpuinfo_x86_linux_init(void) {
 	cpuinfo_cache_count[cpuinfo_cache_level_4]  = l4_count;
 	cpuinfo_max_cache_size = cpuinfo_compute_max_cache_size(&processors[0]);
 
-	cpuinfo_global_uarch = (struct cpuinfo_uarch_info) {
-		.uarch = x86_processor.uarch,
-		.cpuid = x86_processor.cpuid,
-		.processor_count = processors_count,
-		.core_count = cores_count,
-	};
+	if (uarchs_count == 1) {
+		cpuinfo_global_uarch = uarchs[0];
+	} else {
+		cpuinfo_uarchs = uarchs;
+	}
+	cpuinfo_uarchs_count = uarchs_count;
 
 	cpuinfo_linux_cpu_max = x86_linux_processors_count;
 	cpuinfo_linux_cpu_to_processor_map = linux_cpu_to_processor_map;
 	cpuinfo_linux_cpu_to_core_map = linux_cpu_to_core_map;
+	cpuinfo_linux_cpu_to_uarch_index_map = linux_cpu_to_uarch_index_map;
+	cpuinfo_tables_arena = arena;
 
 	__sync_synchronize();
 
 	cpuinfo_is_initialized = true;
 
-	processors = NULL;
-	cores = NULL;
-	clusters = NULL;
-	packages = NULL;
-	l1i = l1d = l2 = l3 = l4 = NULL;
-	linux_cpu_to_processor_map = NULL;
-	linux_cpu_to_core_map = NULL;
+	arena = (struct cpuinfo_arena) { NULL, 0 };
+	nodes = NULL;
 
 cleanup:
-	free(x86_linux_processors);
-	free(processors);
-	free(cores);
-	free(clusters);
-	free(packages);
-	free(l1i);
-	free(l1d);
-	free(l2);
-	free(l3);
-	free(l4);
-	free(linux_cpu_to_processor_map);
-	free(linux_cpu_to_core_map);
+	cpuinfo_arena_free(&scratch_arena);
+	cpuinfo_arena_free(&arena);
+	free(nodes);
 }
@@ -0,0 +1,286 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#if !CPUINFO_MOCK
+	#include <unistd.h>
+	#include <sys/syscall.h>
+#endif
+
+#include <cpuinfo.h>
+#include <x86/api.h>
+#include <x86/cpuid.h>
+#include <x86/linux/api.h>
+#include <linux/api.h>
+#include <cpuinfo/arena.h>
+#include <cpuinfo/common.h>
+#include <cpuinfo/log.h>
+
+
+static inline bool bitmask_all(uint32_t bitfield, uint32_t mask) {
+	return (bitfield & mask) == mask;
+}
+
+/* Topology of a logical processor as reported in /sys/devices/system/cpu/cpu<N>/topology */
+struct sysfs_topology {
+	uint32_t flags;
+	uint32_t package_id;
+	uint32_t die_id;
+	uint32_t core_id;
+	/* Number of thread siblings with smaller processor numbers */
+	uint32_t smt_id;
+};
+
+#define SYSFS_TOPOLOGY_FLAGS (CPUINFO_LINUX_FLAG_PACKAGE_ID | CPUINFO_LINUX_FLAG_CORE_ID | CPUINFO_LINUX_FLAG_SMT_ID)
+
+/*
+ * Meaning of core_id in sysfs. Since Linux 6.9, and on processors without a die level, core_id holds all APIC ID bits
+ * between the SMT and package levels. Linux 5.2-6.8 parse the die level of CPUID leaf 0x1F, and report core_id with
+ * the bits of the core level only, and die_id with the bits between the core and package levels, including the module
+ * and tile levels.
+ */
+enum core_id_layout {
+	core_id_layout_package,
+	core_id_layout_die,
+};
+
+static bool smt_id_parser(uint32_t processor, uint32_t siblings_start, uint32_t siblings_end, void* context) {
+	struct sysfs_topology* topology = (struct sysfs_topology*) context;
+	if (siblings_start < processor) {
+		topology[processor].smt_id += (siblings_end < processor ? siblings_end : processor) - siblings_start;
+	}
+	topology[processor].flags |= CPUINFO_LINUX_FLAG_SMT_ID;
+	return true;
+}
+
+#if !CPUINFO_MOCK
+/*
+ * Checks the APIC ID reconstructed for the current processor against the APIC ID reported by CPUID.
+ * Returns true if the thread kept migrating and the check could not be done.
+ */
+static bool check_current_apic_id(
+	uint32_t max_processors_count,
+	const struct cpuinfo_x86_linux_processor processors[restrict static max_processors_count])
+{
+	const uint32_t max_base_index = cpuid(0).eax;
+	for (uint32_t attempt = 0; attempt < 3; attempt++) {
+		unsigned int cpu_before = 0, cpu_after = 0;
+		if (syscall(__NR_getcpu, &cpu_before, NULL, NULL) != 0) {
+			return true;
+		}
+		/* Initial APIC ID in CPUID leaf 1 holds the 8 low bits of x2APIC ID, and leaf 0xB reports all 32 bits */
+		uint32_t apic_id = cpuid(1).ebx >> 24;
+		uint32_t apic_id_mask = UINT32_C(0xFF);
+		if (max_base_index >= UINT32_C(0xB)) {
+			const struct cpuid_regs leafB = cpuidex(UINT32_C(0xB), 0);
+			if (leafB.ebx != 0) {
+				apic_id = leafB.edx;
+				apic_id_mask = UINT32_MAX;
+			}
+		}
+		if (syscall(__NR_getcpu, &cpu_after, NULL, NULL) != 0) {
+			return true;
+		}
+		if (cpu_before == cpu_after) {
+			if (cpu_before >= max_processors_count ||
+				!bitmask_all(processors[cpu_before].flags, CPUINFO_LINUX_FLAG_APIC_ID))
+			{
+				cpuinfo_log_info("sysfs does not report topology of current processor %u", cpu_before);
+				return false;
+			}
+			if ((processors[cpu_before].apic_id & apic_id_mask) != apic_id) {
+				cpuinfo_log_info("APIC ID %#"PRIx32" of processor %u derived from sysfs does not match CPUID value %#"PRIx32,
+					processors[cpu_before].apic_id, cpu_before, apic_id);
+				return false;
+			}
+			return true;
+		}
+	}
+	return true;
+}
+#endif
+
+static int cmp_apic_id(const void* ptr_a, const void* ptr_b) {
+	const uint32_t apic_id_a = *((const uint32_t*) ptr_a);
+	const uint32_t apic_id_b = *((const uint32_t*) ptr_b);
+	return (apic_id_a > apic_id_b) - (apic_id_a < apic_id_b);
+}
+
+/*
+ * Reconstructs APIC IDs of processors with topology in sysfs, assuming the layout of core_id. Returns false if the
+ * topology does not fit into APIC ID fields with this layout, or if two processors would get the same APIC ID.
+ */
+static bool reconstruct_apic_ids(
+	enum core_id_layout layout,
+	uint32_t max_processors_count,
+	const struct cpuinfo_x86_topology topology[restrict static 1],
+	const struct sysfs_topology sysfs_topology[restrict static max_processors_count],
+	uint32_t apic_ids[restrict static max_processors_count],
+	uint32_t sorted_apic_ids[restrict static max_processors_count])
+{
+	uint32_t required_flags = CPUINFO_LINUX_FLAG_VALID | SYSFS_TOPOLOGY_FLAGS;
+	const uint32_t core_bits_offset = topology->thread_bits_offset + topology->thread_bits_length;
+	uint32_t core_bits_length = topology->package_bits_offset - core_bits_offset;
+	uint32_t die_bits_offset = topology->package_bits_offset;
+	if (layout == core_id_layout_die) {
+		const uint32_t core_bits_end = topology->core_bits_offset + topology->core_bits_length;
+		if (topology->die_bits_length == 0 || core_bits_end < core_bits_offset ||
+			topology->die_bits_offset + topology->die_bits_length != topology->package_bits_offset)
+		{
+			/* Linux reports the bits above the die level, e.g. die groups, in physical_package_id */
+			return false;
+		}
+		required_flags |= CPUINFO_LINUX_FLAG_DIE_ID;
+		core_bits_length = core_bits_end - core_bits_offset;
+		die_bits_offset = core_bits_end;
+	}
+	const uint32_t die_bits_length = topology->package_bits_offset - die_bits_offset;
+
+	uint32_t apic_ids_count = 0;
+	for (uint32_t i = 0; i < max_processors_count; i++) {
+		if (!bitmask_all(sysfs_topology[i].flags, CPUINFO_LINUX_FLAG_VALID | SYSFS_TOPOLOGY_FLAGS)) {
+			continue;
+		}
+		const uint32_t die_id = layout == core_id_layout_die ? sysfs_topology[i].die_id : 0;
+		if (!bitmask_all(sysfs_topology[i].flags, required_flags) ||
+			(uint64_t) sysfs_topology[i].smt_id >> topology->thread_bits_length != 0 ||
+			(uint64_t) sysfs_topology[i].core_id >> core_bits_length != 0 ||
+			(uint64_t) die_id >> die_bits_length != 0 ||
+			(uint64_t) sysfs_topology[i].package_id << topology->package_bits_offset > UINT32_MAX)
+		{
+			cpuinfo_log_debug("topology of processor %"PRIu32" in sysfs (package %"PRIu32", die %"PRIu32", core %"PRIu32", "
+				"thread %"PRIu32") does not fit into APIC ID fields with %s-relative core ID", i,
+				sysfs_topology[i].package_id, die_id, sysfs_topology[i].core_id, sysfs_topology[i].smt_id,
+				layout == core_id_layout_die ? "die" : "package");
+			return false;
+		}
+		apic_ids[i] = (uint32_t) (((uint64_t) sysfs_topology[i].package_id << topology->package_bits_offset) |
+			((uint64_t) die_id << die_bits_offset) |
+			((uint64_t) sysfs_topology[i].core_id << core_bits_offset) |
+			((uint64_t) sysfs_topology[i].smt_id << topology->thread_bits_offset));
+		sorted_apic_ids[apic_ids_count++] = apic_ids[i];
+	}
+
+	qsort(sorted_apic_ids, apic_ids_count, sizeof(uint32_t), cmp_apic_id);
+	for (uint32_t i = 1; i < apic_ids_count; i++) {
+		if (sorted_apic_ids[i] == sorted_apic_ids[i - 1]) {
+			cpuinfo_log_debug("APIC ID %#"PRIx32" reconstructed with %s-relative core ID is not unique",
+				sorted_apic_ids[i], layout == core_id_layout_die ? "die" : "package");
+			return false;
+		}
+	}
+	return true;
+}
+
+bool cpuinfo_x86_linux_detect_apic_ids(
+	uint32_t max_processors_count,
+	const struct cpuinfo_x86_topology topology[restrict static 1],
+	struct cpuinfo_x86_linux_processor processors[restrict static max_processors_count])
+{
+	bool status = false;
+	struct cpuinfo_arena arena = { NULL, 0 };
+	struct sysfs_topology* sysfs_topology = NULL;
+	uint32_t* apic_ids = NULL;
+	uint32_t* sorted_apic_ids = NULL;
+	const struct cpuinfo_arena_table tables[] = {
+		{ &sysfs_topology, max_processors_count, sizeof(struct sysfs_topology) },
+		{ &apic_ids, max_processors_count, sizeof(uint32_t) },
+		{ &sorted_apic_ids, max_processors_count, sizeof(uint32_t) },
+	};
+	if (!cpuinfo_arena_allocate(&arena, CPUINFO_COUNT_OF(tables), tables)) {
+		cpuinfo_log_error("failed to allocate sysfs topology of %"PRIu32" logical processors", max_processors_count);
+		return false;
+	}
+
+	for (uint32_t i = 0; i < max_processors_count; i++) {
+		sysfs_topology[i].flags = processors[i].flags & CPUINFO_LINUX_FLAG_VALID;
+	}
+	const struct cpuinfo_linux_processor_field topology_fields[] = {
+		{
+			cpuinfo_linux_processor_attribute_package_id,
+			&sysfs_topology->package_id,
+			CPUINFO_LINUX_FLAG_PACKAGE_ID,
+		},
+		{
+			cpuinfo_linux_processor_attribute_die_id,
+			&sysfs_topology->die_id,
+			CPUINFO_LINUX_FLAG_DIE_ID,
+		},
+		{
+			cpuinfo_linux_processor_attribute_core_id,
+			&sysfs_topology->core_id,
+			CPUINFO_LINUX_FLAG_CORE_ID,
+		},
+	};
+	cpuinfo_linux_read_processor_attributes(
+		max_processors_count, &sysfs_topology->flags,
+		sizeof(struct sysfs_topology), CPUINFO_LINUX_FLAG_VALID,
+		CPUINFO_COUNT_OF(topology_fields), topology_fields);
+	cpuinfo_linux_detect_all_thread_siblings(
+		max_processors_count, &sysfs_topology->flags,
+		sizeof(struct sysfs_topology), CPUINFO_LINUX_FLAG_VALID | CPUINFO_LINUX_FLAG_CORE_ID,
+		smt_id_parser, sysfs_topology);
+
+	/*
+	 * Linux derives core_id, die_id and physical_package_id from fields of the APIC ID, so the APIC ID is recovered
+	 * from these fields and the index of the thread in its core. The meaning of core_id changed between kernel
+	 * versions, and the layout which gives every processor a unique APIC ID is taken.
+	 * Offline processors have no topology directory and, as with /proc/cpuinfo, get no APIC ID.
+	 */
+	const uint32_t core_bits_offset = topology->thread_bits_offset + topology->thread_bits_length;
+	if (topology->package_bits_offset < core_bits_offset || topology->package_bits_offset > 32) {
+		cpuinfo_log_info("unsupported APIC ID layout: core offset %"PRIu32", package offset %"PRIu32,
+			core_bits_offset, topology->package_bits_offset);
+		goto cleanup;
+	}
+	uint32_t detected_count = 0;
+	for (uint32_t i = 0; i < max_processors_count; i++) {
+		const uint32_t flags = sysfs_topology[i].flags;
+		if (!bitmask_all(flags, CPUINFO_LINUX_FLAG_VALID) || (flags & SYSFS_TOPOLOGY_FLAGS) == 0) {
+			continue;
+		}
+		if (!bitmask_all(flags, SYSFS_TOPOLOGY_FLAGS)) {
+			cpuinfo_log_info("sysfs reports incomplete topology of processor %"PRIu32, i);
+			goto cleanup;
+		}
+		detected_count += 1;
+	}
+	if (detected_count == 0) {
+		cpuinfo_log_info("sysfs does not report topology of processors");
+		goto cleanup;
+	}
+
+	if (!reconstruct_apic_ids(core_id_layout_package, max_processors_count, topology, sysfs_topology,
+			apic_ids, sorted_apic_ids) &&
+		!reconstruct_apic_ids(core_id_layout_die, max_processors_count, topology, sysfs_topology,
+			apic_ids, sorted_apic_ids))
+	{
+		cpuinfo_log_info("topology in sysfs does not map to unique APIC IDs");
+		goto cleanup;
+	}
+
+	for (uint32_t i = 0; i < max_processors_count; i++) {
+		if (bitmask_all(sysfs_topology[i].flags, CPUINFO_LINUX_FLAG_VALID | SYSFS_TOPOLOGY_FLAGS)) {
+			processors[i].apic_id = apic_ids[i];
+			processors[i].flags |= CPUINFO_LINUX_FLAG_APIC_ID;
+			cpuinfo_log_debug("APIC ID %#"PRIx32" for processor %"PRIu32" (package %"PRIu32", core %"PRIu32", thread %"PRIu32")",
+				processors[i].apic_id, i, sysfs_topology[i].package_id, sysfs_topology[i].core_id, sysfs_topology[i].smt_id);
+		}
+	}
+	status = true;
+
+#if !CPUINFO_MOCK
+	if (!check_current_apic_id(max_processors_count, processors)) {
+		for (uint32_t i = 0; i < max_processors_count; i++) {
+			processors[i].apic_id = 0;
+			processors[i].flags &= ~CPUINFO_LINUX_FLAG_APIC_ID;
+		}
+		status = false;
+	}
+#endif
+
+cleanup:
+	cpuinfo_arena_free(&arena);
+	return status;
+}
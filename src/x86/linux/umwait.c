@@ -0,0 +1,72 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <inttypes.h>
+
+#include <cpuinfo.h>
+#include <x86/linux/api.h>
+#include <linux/api.h>
+#include <cpuinfo/log.h>
+
+
+/* Size of buffers for umwait_control files, which contain a single decimal number */
+#define UMWAIT_CONTROL_BUFFER_SIZE 32
+
+static bool parse_number(const struct cpuinfo_linux_sysfs_file file[restrict static 1], uint32_t value[restrict static 1]) {
+	if (file->size <= 0 || (size_t) file->size == file->buffer_size) {
+		return false;
+	}
+
+	const char* text_end = file->buffer + file->size;
+	const char* digit_ptr = file->buffer;
+	uint64_t number = 0;
+	for (; digit_ptr != text_end; digit_ptr++) {
+		const uint32_t digit = (uint32_t) (uint8_t) (*digit_ptr) - (uint32_t) '0';
+		if (digit >= 10) {
+			break;
+		}
+		number = number * 10 + digit;
+		if (number > UINT32_MAX) {
+			return false;
+		}
+	}
+	if (digit_ptr == file->buffer) {
+		return false;
+	}
+	for (; digit_ptr != text_end; digit_ptr++) {
+		if (*digit_ptr != '\n' && *digit_ptr != ' ') {
+			return false;
+		}
+	}
+
+	*value = (uint32_t) number;
+	return true;
+}
+
+void cpuinfo_x86_linux_detect_umwait_control(struct cpuinfo_x86_isa isa[restrict static 1]) {
+	char buffers[2][UMWAIT_CONTROL_BUFFER_SIZE];
+	struct cpuinfo_linux_sysfs_file files[2] = {
+		{ "umwait_control/max_time", buffers[0], UMWAIT_CONTROL_BUFFER_SIZE, -1 },
+		{ "umwait_control/enable_c02", buffers[1], UMWAIT_CONTROL_BUFFER_SIZE, -1 },
+	};
+	cpuinfo_linux_read_sysfs_files(CPUINFO_COUNT_OF(files), files);
+
+	/* Kernels before 5.3 do not limit UMWAIT, and do not provide umwait_control */
+	uint32_t max_time = 0;
+	if (parse_number(&files[0], &max_time)) {
+		cpuinfo_log_debug("parsed UMWAIT maximum time of %"PRIu32" TSC cycles from %s", max_time, files[0].path);
+		isa->umwait_max_time = max_time;
+	} else if (files[0].size > 0) {
+		cpuinfo_log_info("failed to parse UMWAIT maximum time from %s: \"%.*s\"",
+			files[0].path, (int) files[0].size, files[0].buffer);
+	}
+
+	uint32_t enable_c02 = 0;
+	if (parse_number(&files[1], &enable_c02)) {
+		cpuinfo_log_debug("parsed UMWAIT C0.2 state %s from %s", enable_c02 ? "enabled" : "disabled", files[1].path);
+		isa->umwait_c02 = enable_c02 != 0;
+	} else if (files[1].size > 0) {
+		cpuinfo_log_info("failed to parse UMWAIT C0.2 control from %s: \"%.*s\"",
+			files[1].path, (int) files[1].size, files[1].buffer);
+	}
+}
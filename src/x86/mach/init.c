@@ -9,10 +9,6 @@
 #include <cpuinfo/log.h>
 
 
-static inline uint32_t max(uint32_t a, uint32_t b) {
-	return a > b ? a : b;
-}
-
 static inline uint32_t bit_mask(uint32_t bits) {
 	return (UINT32_C(1) << bits) - UINT32_C(1);
 }
@@ -58,6 +54,7 @@ void cpuinfo_x86_mach_init(void) {
 	struct cpuinfo_x86_processor x86_processor;
 	memset(&x86_processor, 0, sizeof(x86_processor));
 	cpuinfo_x86_init_processor(&x86_processor);
+	cpuinfo_x86_init_isa();
 	char brand_string[48];
 	cpuinfo_x86_normalize_brand_string(x86_processor.brand_string, brand_string);
 
@@ -98,19 +95,20 @@ void cpuinfo_x86_mach_init(void) {
 	}
 	for (uint32_t i = 0; i < mach_topology.threads; i++) {
 		const uint32_t smt_id = i % threads_per_core;
-		const uint32_t core_id = i / threads_per_core;
+		const uint32_t core_id = i / threads_per_core % cores_per_package;
 		const uint32_t package_id = i / threads_per_package;
 
-		/* Reconstruct APIC IDs from topology components */
+		/*
+		 * Reconstruct APIC IDs from topology components. The core ID within a package spans the core, module, tile
+		 * and die levels, i.e. all bits between the core and package offsets.
+		 */
 		const uint32_t thread_bits_mask = bit_mask(x86_processor.topology.thread_bits_length);
-		const uint32_t core_bits_mask   = bit_mask(x86_processor.topology.core_bits_length);
-		const uint32_t package_bits_offset = max(
-			x86_processor.topology.thread_bits_offset + x86_processor.topology.thread_bits_length,
-			x86_processor.topology.core_bits_offset + x86_processor.topology.core_bits_length);
+		const uint32_t core_bits_mask   =
+			bit_mask(x86_processor.topology.package_bits_offset - x86_processor.topology.core_bits_offset);
 		const uint32_t apic_id =
 			((smt_id & thread_bits_mask) << x86_processor.topology.thread_bits_offset) |
 			((core_id & core_bits_mask) << x86_processor.topology.core_bits_offset) |
-			(package_id << package_bits_offset);
+			(package_id << x86_processor.topology.package_bits_offset);
 		cpuinfo_log_debug("reconstructed APIC ID 0x%08"PRIx32" for thread %"PRIu32, apic_id, i);
 
 		processors[i].smt_id = smt_id;
@@ -332,6 +330,8 @@ void cpuinfo_x86_mach_init(void) {
 		.processor_count = mach_topology.threads,
 		.core_count = mach_topology.cores,
 	};
+	cpuinfo_update_isa_features();
+	cpuinfo_update_topology();
 
 	__sync_synchronize();
 
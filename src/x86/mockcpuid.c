@@ -1,3 +1,4 @@
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 
@@ -11,6 +12,8 @@
 static struct cpuinfo_mock_cpuid* cpuinfo_mock_cpuid_data = NULL;
 static uint32_t cpuinfo_mock_cpuid_entries = 0;
 static uint32_t cpuinfo_mock_cpuid_leaf4_iteration = 0;
+static bool cpuinfo_mock_xcr0_override = false;
+static uint64_t cpuinfo_mock_xcr0 = 0;
 
 void CPUINFO_ABI cpuinfo_mock_set_cpuid(struct cpuinfo_mock_cpuid* dump, size_t entries) {
 	cpuinfo_mock_cpuid_data = dump;
@@ -68,3 +71,21 @@ void CPUINFO_ABI cpuinfo_mock_get_cpuidex(uint32_t eax, uint32_t ecx, uint32_t r
 	}
 	regs[0] = regs[1] = regs[2] = regs[3] = 0;
 }
+
+void CPUINFO_ABI cpuinfo_mock_set_xcr0(uint64_t xcr0) {
+	cpuinfo_mock_xcr0 = xcr0;
+	cpuinfo_mock_xcr0_override = true;
+}
+
+uint64_t CPUINFO_ABI cpuinfo_mock_get_xgetbv(uint32_t ext_ctrl_reg) {
+	if (ext_ctrl_reg != 0) {
+		return 0;
+	}
+	if (cpuinfo_mock_xcr0_override) {
+		return cpuinfo_mock_xcr0;
+	}
+	/* Valid bits of XCR0 are reported in eax and edx of CPUID leaf 0xD, sub-leaf 0 */
+	uint32_t regs[4];
+	cpuinfo_mock_get_cpuidex(0xD, 0, regs);
+	return ((uint64_t) regs[3] << 32) | (uint64_t) regs[0];
+}
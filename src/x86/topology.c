@@ -9,9 +9,21 @@
 
 
 enum topology_type {
-	topology_type_invalid = 0,
-	topology_type_smt     = 1,
-	topology_type_core    = 2,
+	topology_type_invalid   = 0,
+	topology_type_smt       = 1,
+	topology_type_core      = 2,
+	topology_type_module    = 3,
+	topology_type_tile      = 4,
+	topology_type_die       = 5,
+	topology_type_die_group = 6,
+};
+
+enum amd_topology_type {
+	amd_topology_type_invalid = 0,
+	amd_topology_type_core    = 1,
+	amd_topology_type_complex = 2,
+	amd_topology_type_die     = 3,
+	amd_topology_type_socket  = 4,
 };
 
 void cpuinfo_x86_detect_topology(
@@ -81,47 +93,203 @@ void cpuinfo_x86_detect_topology(
 	 */
 	const bool x2apic = !!(leaf1.ecx & UINT32_C(0x00200000));
 	if (x2apic && (max_base_index >= UINT32_C(0xB))) {
+		/*
+		 * V2 extended topology enumeration leaf 0x1F supersedes leaf 0xB and additionally reports module, tile, and
+		 * die levels. Leaf 0x1F is supported if it reports a non-zero number of logical processors at level 0.
+		 */
+		uint32_t topology_leaf = UINT32_C(0xB);
+		if (max_base_index >= UINT32_C(0x1F) && (cpuidex(UINT32_C(0x1F), 0).ebx & UINT32_C(0x0000FFFF)) != 0) {
+			topology_leaf = UINT32_C(0x1F);
+		}
+
 		uint32_t level = 0;
 		uint32_t type;
 		uint32_t total_shift = 0;
 		topology->thread_bits_offset = topology->thread_bits_length  = 0;
 		topology->core_bits_offset   = topology->core_bits_length = 0;
 		do {
-			const struct cpuid_regs leafB = cpuidex(UINT32_C(0xB), level);
-			type = (leafB.ecx >> 8) & UINT32_C(0x000000FF);
-			const uint32_t level_shift = leafB.eax & UINT32_C(0x0000001F);
-			const uint32_t x2apic_id   = leafB.edx;
+			const struct cpuid_regs leaf = cpuidex(topology_leaf, level);
+			type = (leaf.ecx >> 8) & UINT32_C(0x000000FF);
+			/* Number of bits to shift x2APIC ID right to get the ID of the next topology level */
+			const uint32_t level_shift = leaf.eax & UINT32_C(0x0000001F);
+			const uint32_t x2apic_id   = leaf.edx;
 			apic_id = x2apic_id;
+			if (type == topology_type_invalid) {
+				break;
+			}
+			const uint32_t level_bits = level_shift > total_shift ? level_shift - total_shift : 0;
 			switch (type) {
-				case topology_type_invalid:
-					break;
 				case topology_type_smt:
 					cpuinfo_log_debug("x2 level %"PRIu32": APIC ID = %08"PRIx32", "
 						"type SMT, shift %"PRIu32", total shift %"PRIu32,
-						level, apic_id, level_shift, total_shift);
+						level, apic_id, level_bits, total_shift);
 					topology->thread_bits_offset = total_shift;
-					topology->thread_bits_length = level_shift;
+					topology->thread_bits_length = level_bits;
 					break;
 				case topology_type_core:
 					cpuinfo_log_debug("x2 level %"PRIu32": APIC ID = %08"PRIx32", "
 						"type core, shift %"PRIu32", total shift %"PRIu32,
-						level, apic_id, level_shift, total_shift);
+						level, apic_id, level_bits, total_shift);
 					topology->core_bits_offset = total_shift;
-					topology->core_bits_length = level_shift;
+					topology->core_bits_length = level_bits;
+					break;
+				case topology_type_module:
+				case topology_type_tile:
+				case topology_type_die_group:
+					/* Levels between core and die, or above the die: only the package boundary matters */
+					cpuinfo_log_debug("x2 level %"PRIu32": APIC ID = %08"PRIx32", "
+						"type %"PRIu32", shift %"PRIu32", total shift %"PRIu32,
+						level, apic_id, type, level_bits, total_shift);
+					break;
+				case topology_type_die:
+					cpuinfo_log_debug("x2 level %"PRIu32": APIC ID = %08"PRIx32", "
+						"type die, shift %"PRIu32", total shift %"PRIu32,
+						level, apic_id, level_bits, total_shift);
+					topology->die_bits_offset = total_shift;
+					topology->die_bits_length = level_bits;
 					break;
 				default:
 					cpuinfo_log_warning("unexpected topology type %"PRIu32" (offset %"PRIu32", length %"PRIu32") "
-						"reported in leaf 0x0000000B is ignored", type, total_shift, level_shift);
+						"reported in leaf 0x%08"PRIx32" is ignored", type, total_shift, level_bits, topology_leaf);
 					break;
 			}
-			total_shift += level_shift;
+			total_shift += level_bits;
 			level += 1;
-		} while (type != 0);
+		} while (type != topology_type_invalid);
+		topology->package_bits_offset = total_shift;
 		cpuinfo_log_debug("x2APIC ID 0x%08"PRIx32", "
-			"SMT offset %"PRIu32" length %"PRIu32", core offset %"PRIu32" length %"PRIu32, apic_id,
+			"SMT offset %"PRIu32" length %"PRIu32", core offset %"PRIu32" length %"PRIu32", "
+			"die offset %"PRIu32" length %"PRIu32", package offset %"PRIu32, apic_id,
 			topology->thread_bits_offset, topology->thread_bits_length,
-			topology->core_bits_offset, topology->core_bits_length);
+			topology->core_bits_offset, topology->core_bits_length,
+			topology->die_bits_offset, topology->die_bits_length,
+			topology->package_bits_offset);
+	}
+
+	if (topology->package_bits_offset == 0) {
+		/* Legacy enumeration: package ID is above the thread and core ID bits */
+		const uint32_t thread_bits_end = topology->thread_bits_offset + topology->thread_bits_length;
+		const uint32_t core_bits_end = topology->core_bits_offset + topology->core_bits_length;
+		topology->package_bits_offset = thread_bits_end > core_bits_end ? thread_bits_end : core_bits_end;
 	}
 
 	topology->apic_id = apic_id;
 }
+
+void cpuinfo_x86_detect_amd_topology(
+	uint32_t max_extended_index,
+	enum cpuinfo_uarch uarch,
+	const struct cpuinfo_x86_caches* cache,
+	struct cpuinfo_x86_topology* topology)
+{
+	if (max_extended_index >= UINT32_C(0x80000008)) {
+		/*
+		 * ApicIdSize: the number of least significant bits in the APIC ID that indicate the core ID within a package.
+		 * - AMD: ecx[bits 12-15] in leaf 0x80000008.
+		 */
+		const uint32_t apic_id_size = (cpuid(UINT32_C(0x80000008)).ecx >> 12) & UINT32_C(0x0000000F);
+		if (apic_id_size != 0) {
+			topology->package_bits_offset = apic_id_size;
+		}
+	}
+
+	uint32_t nodes_per_processor = 1;
+	if (max_extended_index >= UINT32_C(0x8000001E)) {
+		const struct cpuid_regs leaf0x8000001E = cpuid(UINT32_C(0x8000001E));
+		/*
+		 * ThreadsPerComputeUnit: the number of threads per core - 1.
+		 * - AMD: ebx[bits 8-15] in leaf 0x8000001E.
+		 * NodeId and NodesPerProcessor - 1:
+		 * - AMD: ecx[bits 0-7] and ecx[bits 8-10] in leaf 0x8000001E.
+		 */
+		const uint32_t threads_per_core = 1 + ((leaf0x8000001E.ebx >> 8) & UINT32_C(0x000000FF));
+		const uint32_t node_id = leaf0x8000001E.ecx & UINT32_C(0x000000FF);
+		nodes_per_processor = 1 + ((leaf0x8000001E.ecx >> 8) & UINT32_C(0x00000007));
+		cpuinfo_log_debug("AMD topology: extended APIC ID = %08"PRIx32", %"PRIu32" threads per core, "
+			"node %"PRIu32" of %"PRIu32, leaf0x8000001E.eax, threads_per_core, node_id, nodes_per_processor);
+	}
+
+	/*
+	 * Extended CPU topology leaf 0x80000026 reports the core complex (CCX) and core complex die (CCD) levels directly.
+	 * Here shift for each level is the number of bits to shift the extended APIC ID right to get the ID of the level.
+	 */
+	if (max_extended_index >= UINT32_C(0x80000026)) {
+		uint32_t level = 0;
+		uint32_t type;
+		uint32_t die_shift = 0, socket_shift = 0;
+		bool has_die = false;
+		do {
+			const struct cpuid_regs leaf = cpuidex(UINT32_C(0x80000026), level);
+			type = (leaf.ecx >> 8) & UINT32_C(0x000000FF);
+			const uint32_t level_shift = leaf.eax & UINT32_C(0x0000001F);
+			switch (type) {
+				case amd_topology_type_invalid:
+					break;
+				case amd_topology_type_core:
+				case amd_topology_type_complex:
+					cpuinfo_log_debug("AMD topology level %"PRIu32": type %"PRIu32", shift %"PRIu32,
+						level, type, level_shift);
+					break;
+				case amd_topology_type_die:
+					cpuinfo_log_debug("AMD topology level %"PRIu32": type CCD, shift %"PRIu32, level, level_shift);
+					die_shift = level_shift;
+					has_die = true;
+					break;
+				case amd_topology_type_socket:
+					cpuinfo_log_debug("AMD topology level %"PRIu32": type socket, shift %"PRIu32, level, level_shift);
+					socket_shift = level_shift;
+					break;
+				default:
+					cpuinfo_log_warning("unexpected topology type %"PRIu32" (shift %"PRIu32") "
+						"reported in leaf 0x80000026 is ignored", type, level_shift);
+					break;
+			}
+			level += 1;
+		} while (type != amd_topology_type_invalid);
+		if (socket_shift != 0) {
+			topology->package_bits_offset = socket_shift;
+		}
+		if (has_die && die_shift < topology->package_bits_offset) {
+			topology->die_bits_offset = die_shift;
+			topology->die_bits_length = topology->package_bits_offset - die_shift;
+		}
+		return;
+	}
+
+	/* On Zen and Hygon Dhyana processors, each node reported in leaf 0x8000001E is a separate die */
+	if ((uarch == cpuinfo_uarch_zen || uarch == cpuinfo_uarch_dhyana) && nodes_per_processor > 1) {
+		const uint32_t node_bits = bit_length(nodes_per_processor);
+		if (node_bits < topology->package_bits_offset) {
+			topology->die_bits_offset = topology->package_bits_offset - node_bits;
+			topology->die_bits_length = node_bits;
+			return;
+		}
+	}
+
+	/*
+	 * Otherwise, the CCX is the group of cores sharing an L3 cache (as reported in leaf 0x8000001D),
+	 * and the CCD is derived from the CCX: Zen and Zen 2 dies contain two CCXs, and Zen 3 dies contain one.
+	 */
+	if (cache->l3.size == 0) {
+		return;
+	}
+	uint32_t ccx_per_ccd_bits;
+	switch (uarch) {
+		case cpuinfo_uarch_zen:
+		case cpuinfo_uarch_zen2:
+		case cpuinfo_uarch_dhyana:
+			ccx_per_ccd_bits = 1;
+			break;
+		case cpuinfo_uarch_zen3:
+		case cpuinfo_uarch_zen4:
+			ccx_per_ccd_bits = 0;
+			break;
+		default:
+			return;
+	}
+	const uint32_t die_shift = cache->l3.apic_bits + ccx_per_ccd_bits;
+	if (die_shift < topology->package_bits_offset) {
+		topology->die_bits_offset = die_shift;
+		topology->die_bits_length = topology->package_bits_offset - die_shift;
+	}
+}
@@ -88,7 +88,40 @@ enum cpuinfo_uarch cpuinfo_x86_decode_uarch(
 						case 0x6C: // Ice Lake-SP
 						case 0x7D: // Ice Lake-Y
 						case 0x7E: // Ice Lake-U
+						case 0x9D: // Ice Lake-NNPI
+						case 0xA7: // Rocket Lake
 							return cpuinfo_uarch_sunny_cove;
+						case 0x8C: // Tiger Lake-U
+						case 0x8D: // Tiger Lake-H
+							return cpuinfo_uarch_willow_cove;
+						case 0x8F: // Sapphire Rapids
+						case 0xCF: // Emerald Rapids
+							return cpuinfo_uarch_golden_cove;
+						case 0xAD: // Granite Rapids
+						case 0xAE: // Granite Rapids-D
+							return cpuinfo_uarch_redwood_cove;
+
+						/* Hybrid processors: the uarch depends on the type of the core */
+						case 0x8A: // Lakefield
+							if (model_info->core_type == cpuinfo_x86_core_type_atom) {
+								return cpuinfo_uarch_tremont;
+							}
+							return cpuinfo_uarch_sunny_cove;
+						case 0x97: // Alder Lake-S
+						case 0x9A: // Alder Lake-P
+						case 0xB7: // Raptor Lake-S
+						case 0xBA: // Raptor Lake-P
+						case 0xBF: // Raptor Lake-S Refresh
+							if (model_info->core_type == cpuinfo_x86_core_type_atom) {
+								return cpuinfo_uarch_gracemont;
+							}
+							return cpuinfo_uarch_golden_cove;
+						case 0xAA: // Meteor Lake-H/U
+						case 0xAC: // Meteor Lake-S
+							if (model_info->core_type == cpuinfo_x86_core_type_atom) {
+								return cpuinfo_uarch_crestmont;
+							}
+							return cpuinfo_uarch_redwood_cove;
 
 						/* Low-power cores */
 						case 0x1C: // Diamondville, Silverthorne, Pineview
@@ -112,6 +145,15 @@ enum cpuinfo_uarch cpuinfo_x86_decode_uarch(
 							return cpuinfo_uarch_goldmont;
 						case 0x7A: // Gemini Lake
 							return cpuinfo_uarch_goldmont_plus;
+						case 0x86: // Snow Ridge, Jacobsville
+						case 0x96: // Elkhart Lake
+						case 0x9C: // Jasper Lake
+							return cpuinfo_uarch_tremont;
+						case 0xBE: // Alder Lake-N, Twin Lake
+							return cpuinfo_uarch_gracemont;
+						case 0xAF: // Sierra Forest
+						case 0xB6: // Grand Ridge
+							return cpuinfo_uarch_crestmont;
 
 						/* Knights-series cores */
 						case 0x57:
@@ -219,11 +261,24 @@ enum cpuinfo_uarch cpuinfo_x86_decode_uarch(
 				case 0x19:
 					switch (model_info->model) {
 						case 0x01: // Genesis
+						case 0x08: // Chagall
 						case 0x21: // Vermeer
 						case 0x30: // Badami, Trento
 						case 0x40: // Rembrandt
+						case 0x44: // Rembrandt-R
 						case 0x50: // Cezanne
 							return cpuinfo_uarch_zen3;
+						case 0x10: // Genoa
+						case 0x11: // Genoa
+						case 0x18: // Storm Peak
+						case 0x61: // Raphael
+						case 0x70: // Phoenix
+						case 0x74: // Phoenix
+						case 0x75: // Phoenix
+						case 0x78: // Phoenix 2
+						case 0x7C: // Hawk Point 2
+						case 0xA0: // Bergamo, Siena
+							return cpuinfo_uarch_zen4;
 					}
 					break;
 			}
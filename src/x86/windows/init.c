@@ -122,14 +122,15 @@ BOOL CALLBACK cpuinfo_x86_windows_init(PINIT_ONCE init_once, PVOID parameter, PV
 	struct cpuinfo_x86_processor x86_processor;
 	ZeroMemory(&x86_processor, sizeof(x86_processor));
 	cpuinfo_x86_init_processor(&x86_processor);
+	cpuinfo_x86_init_isa();
 	char brand_string[48];
 	cpuinfo_x86_normalize_brand_string(x86_processor.brand_string, brand_string);
 
+	/* Core ID within a package spans the core, module, tile and die levels of the APIC ID */
 	const uint32_t thread_bits_mask = bit_mask(x86_processor.topology.thread_bits_length);
-	const uint32_t core_bits_mask   = bit_mask(x86_processor.topology.core_bits_length);
-	const uint32_t package_bits_offset = max(
-		x86_processor.topology.thread_bits_offset + x86_processor.topology.thread_bits_length,
-		x86_processor.topology.core_bits_offset + x86_processor.topology.core_bits_length);
+	const uint32_t core_bits_mask   =
+		bit_mask(x86_processor.topology.package_bits_offset - x86_processor.topology.core_bits_offset);
+	const uint32_t package_bits_offset = x86_processor.topology.package_bits_offset;
 
 	/* WINE doesn't implement GetMaximumProcessorGroupCount and aborts when calling it */
 	const uint32_t max_group_count = is_wine ? 1 : (uint32_t) GetMaximumProcessorGroupCount();
@@ -591,6 +592,8 @@ BOOL CALLBACK cpuinfo_x86_windows_init(PINIT_ONCE init_once, PVOID parameter, PV
 		.processor_count = processors_count,
 		.core_count = cores_count,
 	};
+	cpuinfo_update_isa_features();
+	cpuinfo_update_topology();
 
 	MemoryBarrier();
 
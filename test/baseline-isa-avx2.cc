@@ -0,0 +1,24 @@
+#include <cpuinfo.h>
+#include <cpuinfo.hpp>
+
+
+/*
+ * Built with -mavx2 and linked into baseline-isa-test, whose other translation unit is built without it. Functions are
+ * called through pointers so that the compiler cannot fold them, and the linker keeps the definition of each unit.
+ */
+
+#ifndef CPUINFO_BASELINE_X86_AVX2
+	#error This translation unit must be compiled with AVX2 in the baseline
+#endif
+
+namespace avx2_translation_unit {
+	bool in_baseline() {
+		bool (*volatile in_baseline_avx2)() = &cpuinfo::in_baseline<cpuinfo::feature::avx2>;
+		return in_baseline_avx2();
+	}
+
+	bool has() {
+		bool (*volatile has_avx2)() = &cpuinfo::has<cpuinfo::feature::avx2>;
+		return has_avx2();
+	}
+}
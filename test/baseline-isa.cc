@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <cpuinfo.h>
+#include <cpuinfo.hpp>
+
+
+#if CPUINFO_ARCH_X86_64
+	static_assert(cpuinfo::in_baseline<cpuinfo::feature::sse, cpuinfo::feature::sse2>(), "x86-64 includes SSE2");
+	static_assert(!cpuinfo::in_baseline<cpuinfo::feature::amx_tile>(), "AMX needs permission at runtime");
+#elif CPUINFO_ARCH_ARM64
+	static_assert(cpuinfo::in_baseline<cpuinfo::feature::neon>(), "ARM64 includes NEON");
+#endif
+static_assert(cpuinfo::in_baseline<>(), "empty feature set is in the baseline");
+static_assert(!cpuinfo::in_baseline<cpuinfo::x86::amx_tile, cpuinfo::arm::sme>(), "no target has both");
+
+
+#if (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64) && defined(CPUINFO_TEST_AVX2_TRANSLATION_UNIT) && \
+	!defined(CPUINFO_BASELINE_X86_AVX2)
+namespace avx2_translation_unit {
+	bool in_baseline();
+	bool has();
+}
+
+TEST(BASELINE, per_translation_unit) {
+	/* Each translation unit keeps its own baseline, even when the templates are not inlined */
+	bool (*volatile in_baseline_avx2)() = &cpuinfo::in_baseline<cpuinfo::feature::avx2>;
+	EXPECT_FALSE(in_baseline_avx2());
+	EXPECT_TRUE(avx2_translation_unit::in_baseline());
+	/* AVX2 is in the baseline of the other translation unit, so it is reported even without initialization */
+	EXPECT_TRUE(avx2_translation_unit::has());
+}
+#endif
+
+TEST(BASELINE, before_initialize) {
+	/* Baseline features are reported without initialization */
+#if CPUINFO_ARCH_X86_64
+	EXPECT_TRUE(cpuinfo_has_x86_sse2());
+	EXPECT_TRUE(cpuinfo::has<cpuinfo::feature::sse2>());
+#elif CPUINFO_ARCH_ARM64
+	EXPECT_TRUE(cpuinfo_has_arm_neon());
+	EXPECT_TRUE(cpuinfo::has<cpuinfo::feature::neon>());
+#endif
+	EXPECT_TRUE(cpuinfo::has<>());
+}
+
+TEST(BASELINE, implies_detected) {
+	ASSERT_TRUE(cpuinfo_initialize());
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	#ifdef CPUINFO_BASELINE_X86_AVX2
+		EXPECT_TRUE(cpuinfo_isa.avx2);
+	#endif
+	#ifdef CPUINFO_BASELINE_X86_SSE4_2
+		EXPECT_TRUE(cpuinfo_isa.sse4_2);
+	#endif
+	#ifdef CPUINFO_BASELINE_X86_BMI2
+		EXPECT_TRUE(cpuinfo_isa.bmi2);
+	#endif
+#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	#ifdef CPUINFO_BASELINE_ARM_NEON_DOT
+		EXPECT_TRUE(cpuinfo_isa.dot);
+	#endif
+	#ifdef CPUINFO_BASELINE_ARM_CRC32
+		EXPECT_TRUE(cpuinfo_isa.crc32);
+	#endif
+#endif
+}
+
+TEST(HAS, matches_functions) {
+	ASSERT_TRUE(cpuinfo_initialize());
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	EXPECT_EQ(cpuinfo_has_x86_avx2(), cpuinfo::has<cpuinfo::feature::avx2>());
+	EXPECT_EQ(cpuinfo_has_x86_avx512f(), cpuinfo::has<cpuinfo::feature::avx512f>());
+	EXPECT_EQ(cpuinfo_has_x86_amx_tile(), cpuinfo::has<cpuinfo::feature::amx_tile>());
+	EXPECT_EQ(cpuinfo_has_x86_3dnow(), cpuinfo::has<cpuinfo::feature::three_d_now>());
+	EXPECT_EQ(
+		cpuinfo_has_x86_avx2() && cpuinfo_has_x86_fma3() && cpuinfo_has_x86_bmi2(),
+		(cpuinfo::has<cpuinfo::feature::avx2, cpuinfo::feature::fma3, cpuinfo::feature::bmi2>()));
+#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	EXPECT_EQ(cpuinfo_has_arm_neon_dot(), cpuinfo::has<cpuinfo::feature::neon_dot>());
+	EXPECT_EQ(cpuinfo_has_arm_sve(), cpuinfo::has<cpuinfo::feature::sve>());
+	EXPECT_EQ(
+		cpuinfo_has_arm_neon_dot() && cpuinfo_has_arm_i8mm(),
+		(cpuinfo::has<cpuinfo::feature::neon_dot, cpuinfo::feature::i8mm>()));
+#endif
+	EXPECT_FALSE((cpuinfo::has<cpuinfo::x86::amx_tile, cpuinfo::arm::sme>()));
+}
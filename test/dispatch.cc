@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <cpuinfo.h>
+
+
+static bool always(void) {
+	return true;
+}
+
+static bool never(void) {
+	return false;
+}
+
+static void kernel_a(void) {}
+static void kernel_b(void) {}
+static void kernel_c(void) {}
+
+static cpuinfo_dispatch_function function(void (*kernel)(void)) {
+	return reinterpret_cast<cpuinfo_dispatch_function>(kernel);
+}
+
+static cpuinfo_dispatch_table make_table(const cpuinfo_dispatch_variant* variants, uint32_t count) {
+	cpuinfo_dispatch_table table = {};
+	table.variants = variants;
+	table.variants_count = count;
+	return table;
+}
+
+TEST(DISPATCH, first_supported) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	const cpuinfo_dispatch_variant variants[] = {
+		{ kernel_a, { always, never }, cpuinfo_uarch_unknown },
+		{ kernel_b, { always, always }, cpuinfo_uarch_unknown },
+		{ kernel_c, { }, cpuinfo_uarch_unknown },
+	};
+	cpuinfo_dispatch_table table = make_table(variants, 3);
+	EXPECT_EQ(function(kernel_b), cpuinfo_dispatch_resolve(&table));
+}
+
+TEST(DISPATCH, no_predicates) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	const cpuinfo_dispatch_variant variants[] = {
+		{ kernel_a, { }, cpuinfo_uarch_unknown },
+	};
+	cpuinfo_dispatch_table table = make_table(variants, 1);
+	EXPECT_EQ(function(kernel_a), cpuinfo_dispatch_resolve(&table));
+}
+
+TEST(DISPATCH, none_supported) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	const cpuinfo_dispatch_variant variants[] = {
+		{ kernel_a, { never }, cpuinfo_uarch_unknown },
+		{ kernel_b, { always, never }, cpuinfo_uarch_unknown },
+	};
+	cpuinfo_dispatch_table table = make_table(variants, 2);
+	EXPECT_EQ(nullptr, cpuinfo_dispatch_resolve(&table));
+	EXPECT_EQ(nullptr, cpuinfo_dispatch_resolve_current(&table));
+}
+
+TEST(DISPATCH, empty) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	cpuinfo_dispatch_table table = make_table(nullptr, 0);
+	EXPECT_EQ(nullptr, cpuinfo_dispatch_resolve(&table));
+}
+
+TEST(DISPATCH, prefers_matching_uarch) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	const cpuinfo_uarch uarch = cpuinfo_get_uarch(0)->uarch;
+	if (uarch == cpuinfo_uarch_unknown) {
+		GTEST_SKIP();
+	}
+	const cpuinfo_dispatch_variant variants[] = {
+		{ kernel_a, { always }, cpuinfo_uarch_unknown },
+		{ kernel_b, { always }, uarch },
+	};
+	cpuinfo_dispatch_table table = make_table(variants, 2);
+	EXPECT_EQ(function(kernel_b), cpuinfo_dispatch_resolve_current(&table));
+	if (cpuinfo_get_uarchs_count() == 1) {
+		EXPECT_EQ(function(kernel_b), cpuinfo_dispatch_resolve(&table));
+	}
+}
+
+TEST(DISPATCH, prefers_generic_over_other_uarch) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	const cpuinfo_uarch uarch = cpuinfo_get_uarch(0)->uarch;
+	const cpuinfo_uarch other_uarch =
+		uarch == cpuinfo_uarch_cortex_a53 ? cpuinfo_uarch_cortex_a55 : cpuinfo_uarch_cortex_a53;
+	const cpuinfo_dispatch_variant variants[] = {
+		{ kernel_a, { always }, other_uarch },
+		{ kernel_b, { always }, cpuinfo_uarch_unknown },
+	};
+	cpuinfo_dispatch_table table = make_table(variants, 2);
+	if (cpuinfo_get_uarchs_count() == 1) {
+		EXPECT_EQ(function(kernel_b), cpuinfo_dispatch_resolve(&table));
+	}
+}
+
+TEST(DISPATCH, falls_back_to_other_uarch) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	const cpuinfo_uarch uarch = cpuinfo_get_uarch(0)->uarch;
+	const cpuinfo_uarch other_uarch =
+		uarch == cpuinfo_uarch_cortex_a53 ? cpuinfo_uarch_cortex_a55 : cpuinfo_uarch_cortex_a53;
+	const cpuinfo_dispatch_variant variants[] = {
+		{ kernel_a, { never }, cpuinfo_uarch_unknown },
+		{ kernel_b, { always }, other_uarch },
+	};
+	cpuinfo_dispatch_table table = make_table(variants, 2);
+	EXPECT_EQ(function(kernel_b), cpuinfo_dispatch_resolve(&table));
+}
+
+TEST(DISPATCH, resolves_once) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	static bool supported;
+	supported = true;
+	const cpuinfo_dispatch_variant variants[] = {
+		{ kernel_a, { [](void) { return supported; } }, cpuinfo_uarch_unknown },
+		{ kernel_b, { }, cpuinfo_uarch_unknown },
+	};
+	cpuinfo_dispatch_table table = make_table(variants, 2);
+	EXPECT_EQ(function(kernel_a), cpuinfo_dispatch_resolve(&table));
+	supported = false;
+	EXPECT_EQ(function(kernel_a), cpuinfo_dispatch_resolve(&table));
+	EXPECT_EQ(function(kernel_a), cpuinfo_dispatch_resolve_current(&table));
+}
@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#if defined(__linux__)
+	#include <sched.h>
+#endif
+
 #include <cpuinfo.h>
 
 
@@ -42,3 +46,43 @@ TEST(CURRENT_UARCH_INDEX_WITH_DEFAULT, within_bounds) {
 
 	ASSERT_LE(cpuinfo_get_current_uarch_index_with_default(cpuinfo_get_uarchs_count()), cpuinfo_get_uarchs_count());
 }
+
+TEST(CURRENT_LOCATION, consistent) {
+	ASSERT_TRUE(cpuinfo_initialize());
+
+	struct cpuinfo_current_location location;
+	if (!cpuinfo_get_current_location(&location)) {
+		ASSERT_FALSE(location.processor);
+		ASSERT_FALSE(location.core);
+		ASSERT_FALSE(location.cluster);
+		ASSERT_EQ(0, location.uarch_index);
+		GTEST_SKIP();
+	}
+
+	const struct cpuinfo_processor* processors_begin = cpuinfo_get_processors();
+	const struct cpuinfo_processor* processors_end = processors_begin + cpuinfo_get_processors_count();
+	ASSERT_GE(location.processor, processors_begin);
+	ASSERT_LT(location.processor, processors_end);
+	ASSERT_EQ(location.processor->core, location.core);
+	ASSERT_EQ(location.processor->cluster, location.cluster);
+	ASSERT_LT(location.uarch_index, cpuinfo_get_uarchs_count());
+}
+
+#if defined(__linux__)
+TEST(CURRENT_PROCESSOR, matches_sched_getcpu) {
+	ASSERT_TRUE(cpuinfo_initialize());
+
+	/* The thread may migrate between the calls: require a match on any of several attempts */
+	bool matched = false;
+	for (int attempt = 0; attempt < 10 && !matched; attempt++) {
+		const int cpu_before = sched_getcpu();
+		const struct cpuinfo_processor* current_processor = cpuinfo_get_current_processor();
+		const int cpu_after = sched_getcpu();
+		if (cpu_before < 0 || current_processor == nullptr) {
+			GTEST_SKIP();
+		}
+		matched = cpu_before == cpu_after && current_processor->linux_id == cpu_before;
+	}
+	ASSERT_TRUE(matched);
+}
+#endif
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <vector>
+
 #include <cpuinfo.h>
 
 
@@ -678,6 +681,383 @@ TEST(PACKAGE, consistent_cluster) {
 	cpuinfo_deinitialize();
 }
 
+#if defined(__linux__)
+TEST(NODES_COUNT, within_bounds) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	EXPECT_NE(0, cpuinfo_get_nodes_count());
+	EXPECT_LE(cpuinfo_get_nodes_count(), cpuinfo_get_cores_count());
+	EXPECT_LE(cpuinfo_get_nodes_count(), cpuinfo_get_processors_count());
+	cpuinfo_deinitialize();
+}
+
+TEST(NODES, non_null) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	EXPECT_TRUE(cpuinfo_get_nodes());
+	cpuinfo_deinitialize();
+}
+#endif /* defined(__linux__) */
+
+TEST(NODE, non_null) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	for (uint32_t i = 0; i < cpuinfo_get_nodes_count(); i++) {
+		EXPECT_TRUE(cpuinfo_get_node(i));
+	}
+	cpuinfo_deinitialize();
+}
+
+TEST(NODE, non_zero_processors) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	for (uint32_t i = 0; i < cpuinfo_get_nodes_count(); i++) {
+		const cpuinfo_node* node = cpuinfo_get_node(i);
+		ASSERT_TRUE(node);
+
+		EXPECT_NE(0, node->processor_count);
+		EXPECT_NE(0, node->core_count);
+	}
+	cpuinfo_deinitialize();
+}
+
+TEST(NODE, consistent_processors) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	for (uint32_t i = 0; i < cpuinfo_get_nodes_count(); i++) {
+		const cpuinfo_node* node = cpuinfo_get_node(i);
+		ASSERT_TRUE(node);
+
+		uint32_t processor_count = 0;
+		for (uint32_t j = 0; j < cpuinfo_get_processors_count(); j++) {
+			const cpuinfo_processor* processor = cpuinfo_get_processor(j);
+			ASSERT_TRUE(processor);
+
+			processor_count += (uint32_t) (processor->node == node);
+		}
+		EXPECT_EQ(node->processor_count, processor_count);
+	}
+	cpuinfo_deinitialize();
+}
+
+TEST(NODE, consistent_cores) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	for (uint32_t i = 0; i < cpuinfo_get_nodes_count(); i++) {
+		const cpuinfo_node* node = cpuinfo_get_node(i);
+		ASSERT_TRUE(node);
+
+		uint32_t core_count = 0;
+		for (uint32_t j = 0; j < cpuinfo_get_cores_count(); j++) {
+			const cpuinfo_core* core = cpuinfo_get_core(j);
+			ASSERT_TRUE(core);
+
+			core_count += (uint32_t) (core->node == node);
+		}
+		EXPECT_EQ(node->core_count, core_count);
+	}
+	cpuinfo_deinitialize();
+}
+
+TEST(NODE, valid_distances) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	for (uint32_t i = 0; i < cpuinfo_get_nodes_count(); i++) {
+		const cpuinfo_node* node = cpuinfo_get_node(i);
+		ASSERT_TRUE(node);
+		ASSERT_TRUE(node->distances);
+
+		for (uint32_t j = 0; j < cpuinfo_get_nodes_count(); j++) {
+			EXPECT_NE(0, node->distances[j]);
+			if (j != i) {
+				EXPECT_GE(node->distances[j], node->distances[i]);
+			}
+		}
+	}
+	cpuinfo_deinitialize();
+}
+
+TEST(PROCESSOR, valid_node) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		const cpuinfo_processor* processor = cpuinfo_get_processor(i);
+		ASSERT_TRUE(processor);
+
+		if (cpuinfo_get_nodes_count() != 0) {
+			ASSERT_TRUE(processor->node);
+			EXPECT_GE(processor->node, cpuinfo_get_nodes());
+			EXPECT_LT(processor->node, cpuinfo_get_nodes() + cpuinfo_get_nodes_count());
+			EXPECT_EQ(processor->core->node, processor->node);
+		} else {
+			EXPECT_FALSE(processor->node);
+		}
+	}
+	cpuinfo_deinitialize();
+}
+
+TEST(DIES_COUNT, within_bounds) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	if (cpuinfo_get_dies_count() != 0) {
+		EXPECT_GE(cpuinfo_get_dies_count(), cpuinfo_get_packages_count());
+		EXPECT_LE(cpuinfo_get_dies_count(), cpuinfo_get_cores_count());
+	}
+	cpuinfo_deinitialize();
+}
+
+TEST(DIE, non_null) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	for (uint32_t i = 0; i < cpuinfo_get_dies_count(); i++) {
+		EXPECT_TRUE(cpuinfo_get_die(i));
+	}
+	cpuinfo_deinitialize();
+}
+
+TEST(DIE, valid_package) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	for (uint32_t i = 0; i < cpuinfo_get_dies_count(); i++) {
+		const cpuinfo_die* die = cpuinfo_get_die(i);
+		ASSERT_TRUE(die);
+
+		ASSERT_TRUE(die->package);
+		EXPECT_GE(die->package, cpuinfo_get_packages());
+		EXPECT_LT(die->package, cpuinfo_get_packages() + cpuinfo_get_packages_count());
+		EXPECT_GE(i, die->package->die_start);
+		EXPECT_LT(i, die->package->die_start + die->package->die_count);
+	}
+	cpuinfo_deinitialize();
+}
+
+TEST(DIE, consistent_processors) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	for (uint32_t i = 0; i < cpuinfo_get_dies_count(); i++) {
+		const cpuinfo_die* die = cpuinfo_get_die(i);
+		ASSERT_TRUE(die);
+
+		EXPECT_NE(0, die->processor_count);
+		for (uint32_t j = 0; j < die->processor_count; j++) {
+			const cpuinfo_processor* processor = cpuinfo_get_processor(die->processor_start + j);
+			ASSERT_TRUE(processor);
+
+			EXPECT_EQ(die, processor->die);
+			EXPECT_EQ(die->package, processor->package);
+		}
+	}
+	cpuinfo_deinitialize();
+}
+
+TEST(DIE, consistent_cores) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	for (uint32_t i = 0; i < cpuinfo_get_dies_count(); i++) {
+		const cpuinfo_die* die = cpuinfo_get_die(i);
+		ASSERT_TRUE(die);
+
+		EXPECT_NE(0, die->core_count);
+		for (uint32_t j = 0; j < die->core_count; j++) {
+			const cpuinfo_core* core = cpuinfo_get_core(die->core_start + j);
+			ASSERT_TRUE(core);
+
+			EXPECT_EQ(die, core->die);
+		}
+	}
+	cpuinfo_deinitialize();
+}
+
+TEST(PROCESSOR, valid_die) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		const cpuinfo_processor* processor = cpuinfo_get_processor(i);
+		ASSERT_TRUE(processor);
+
+		if (cpuinfo_get_dies_count() != 0) {
+			ASSERT_TRUE(processor->die);
+			EXPECT_GE(processor->die, cpuinfo_get_dies());
+			EXPECT_LT(processor->die, cpuinfo_get_dies() + cpuinfo_get_dies_count());
+			EXPECT_EQ(processor->core->die, processor->die);
+		} else {
+			EXPECT_FALSE(processor->die);
+		}
+	}
+	cpuinfo_deinitialize();
+}
+
+TEST(TOPOLOGY, matches_getters) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	const cpuinfo_topology* topology = cpuinfo_get_topology();
+	ASSERT_TRUE(topology);
+	EXPECT_EQ(cpuinfo_get_processors(), topology->processors);
+	EXPECT_EQ(cpuinfo_get_cores(), topology->cores);
+	EXPECT_EQ(cpuinfo_get_clusters(), topology->clusters);
+	EXPECT_EQ(cpuinfo_get_packages(), topology->packages);
+	EXPECT_EQ(cpuinfo_get_dies(), topology->dies);
+	EXPECT_EQ(cpuinfo_get_nodes(), topology->nodes);
+	EXPECT_EQ(cpuinfo_get_uarchs(), topology->uarchs);
+	EXPECT_EQ(cpuinfo_get_l1i_caches(), topology->l1i_caches);
+	EXPECT_EQ(cpuinfo_get_l1d_caches(), topology->l1d_caches);
+	EXPECT_EQ(cpuinfo_get_l2_caches(), topology->l2_caches);
+	EXPECT_EQ(cpuinfo_get_l3_caches(), topology->l3_caches);
+	EXPECT_EQ(cpuinfo_get_l4_caches(), topology->l4_caches);
+
+	EXPECT_EQ(cpuinfo_get_processors_count(), topology->processors_count);
+	EXPECT_EQ(cpuinfo_get_cores_count(), topology->cores_count);
+	EXPECT_EQ(cpuinfo_get_clusters_count(), topology->clusters_count);
+	EXPECT_EQ(cpuinfo_get_packages_count(), topology->packages_count);
+	EXPECT_EQ(cpuinfo_get_dies_count(), topology->dies_count);
+	EXPECT_EQ(cpuinfo_get_nodes_count(), topology->nodes_count);
+	EXPECT_EQ(cpuinfo_get_uarchs_count(), topology->uarchs_count);
+	EXPECT_EQ(cpuinfo_get_l1i_caches_count(), topology->l1i_caches_count);
+	EXPECT_EQ(cpuinfo_get_l1d_caches_count(), topology->l1d_caches_count);
+	EXPECT_EQ(cpuinfo_get_l2_caches_count(), topology->l2_caches_count);
+	EXPECT_EQ(cpuinfo_get_l3_caches_count(), topology->l3_caches_count);
+	EXPECT_EQ(cpuinfo_get_l4_caches_count(), topology->l4_caches_count);
+	EXPECT_EQ(cpuinfo_get_max_cache_size(), topology->max_cache_size);
+	cpuinfo_deinitialize();
+}
+
+TEST(TOPOLOGY, reinitialized) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	const cpuinfo_topology* topology = cpuinfo_get_topology();
+	const uint32_t processors_count = topology->processors_count;
+	cpuinfo_deinitialize();
+
+	ASSERT_TRUE(cpuinfo_initialize());
+	EXPECT_EQ(topology, cpuinfo_get_topology());
+	EXPECT_EQ(processors_count, topology->processors_count);
+	EXPECT_EQ(cpuinfo_get_processors(), topology->processors);
+	cpuinfo_deinitialize();
+}
+
+TEST(DEINITIALIZE, nested) {
+	/* The tables stay until every initialization call is balanced by cpuinfo_deinitialize */
+	ASSERT_TRUE(cpuinfo_initialize());
+	ASSERT_TRUE(cpuinfo_initialize_ex(CPUINFO_INITIALIZE_TOPOLOGY));
+	const cpuinfo_processor* processors = cpuinfo_get_processors();
+	const uint32_t processors_count = cpuinfo_get_processors_count();
+	cpuinfo_deinitialize();
+
+	EXPECT_EQ(processors, cpuinfo_get_processors());
+	EXPECT_EQ(processors_count, cpuinfo_get_processors_count());
+	EXPECT_EQ(processors_count, cpuinfo_get_topology()->processors_count);
+	cpuinfo_deinitialize();
+}
+
+TEST(USABLE_PROCESSORS_COUNT, within_bounds) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	EXPECT_NE(0, cpuinfo_get_usable_processors_count());
+	EXPECT_LE(cpuinfo_get_usable_processors_count(), cpuinfo_get_processors_count());
+	EXPECT_LE(cpuinfo_get_usable_cores_count(), cpuinfo_get_cores_count());
+	EXPECT_LE(cpuinfo_get_usable_clusters_count(), cpuinfo_get_clusters_count());
+	EXPECT_LE(cpuinfo_get_usable_packages_count(), cpuinfo_get_packages_count());
+	EXPECT_LE(cpuinfo_get_usable_cores_count(), cpuinfo_get_usable_processors_count());
+	EXPECT_LE(cpuinfo_get_usable_packages_count(), cpuinfo_get_usable_cores_count());
+	cpuinfo_deinitialize();
+}
+
+TEST(USABLE_PROCESSOR, valid) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	for (uint32_t i = 0; i < cpuinfo_get_usable_processors_count(); i++) {
+		const cpuinfo_processor* processor = cpuinfo_get_usable_processor(i);
+		ASSERT_TRUE(processor);
+		EXPECT_GE(processor, cpuinfo_get_processors());
+		EXPECT_LT(processor, cpuinfo_get_processors() + cpuinfo_get_processors_count());
+		if (i != 0) {
+			EXPECT_LT(cpuinfo_get_usable_processor(i - 1), processor);
+		}
+	}
+	EXPECT_FALSE(cpuinfo_get_usable_processor(cpuinfo_get_usable_processors_count()));
+	cpuinfo_deinitialize();
+}
+
+TEST(USABLE_CORE, valid) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	for (uint32_t i = 0; i < cpuinfo_get_usable_cores_count(); i++) {
+		const cpuinfo_core* core = cpuinfo_get_usable_core(i);
+		ASSERT_TRUE(core);
+		EXPECT_GE(core, cpuinfo_get_cores());
+		EXPECT_LT(core, cpuinfo_get_cores() + cpuinfo_get_cores_count());
+	}
+	EXPECT_FALSE(cpuinfo_get_usable_core(cpuinfo_get_usable_cores_count()));
+	cpuinfo_deinitialize();
+}
+
+TEST(USABLE_CLUSTER, valid) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	for (uint32_t i = 0; i < cpuinfo_get_usable_clusters_count(); i++) {
+		const cpuinfo_cluster* cluster = cpuinfo_get_usable_cluster(i);
+		ASSERT_TRUE(cluster);
+		EXPECT_GE(cluster, cpuinfo_get_clusters());
+		EXPECT_LT(cluster, cpuinfo_get_clusters() + cpuinfo_get_clusters_count());
+	}
+	EXPECT_FALSE(cpuinfo_get_usable_cluster(cpuinfo_get_usable_clusters_count()));
+	cpuinfo_deinitialize();
+}
+
+TEST(USABLE_PACKAGE, valid) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	for (uint32_t i = 0; i < cpuinfo_get_usable_packages_count(); i++) {
+		const cpuinfo_package* package = cpuinfo_get_usable_package(i);
+		ASSERT_TRUE(package);
+		EXPECT_GE(package, cpuinfo_get_packages());
+		EXPECT_LT(package, cpuinfo_get_packages() + cpuinfo_get_packages_count());
+	}
+	EXPECT_FALSE(cpuinfo_get_usable_package(cpuinfo_get_usable_packages_count()));
+	cpuinfo_deinitialize();
+}
+
+TEST(RECOMMENDED_THREAD_COUNT, within_bounds) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	const uint32_t all_logical = cpuinfo_get_recommended_thread_count(cpuinfo_thread_policy_all_logical);
+	const uint32_t physical_cores = cpuinfo_get_recommended_thread_count(cpuinfo_thread_policy_physical_cores);
+	const uint32_t big_cores = cpuinfo_get_recommended_thread_count(cpuinfo_thread_policy_big_cores);
+	EXPECT_NE(0, big_cores);
+	EXPECT_LE(big_cores, physical_cores);
+	EXPECT_LE(physical_cores, all_logical);
+	EXPECT_LE(all_logical, cpuinfo_get_usable_processors_count());
+	EXPECT_LE(physical_cores, cpuinfo_get_usable_cores_count());
+	cpuinfo_deinitialize();
+}
+
+TEST(PLACEMENT, usable_processors) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	const cpuinfo_placement_policy policies[] = {
+		cpuinfo_placement_policy_compact,
+		cpuinfo_placement_policy_scatter,
+		cpuinfo_placement_policy_per_core,
+		cpuinfo_placement_policy_per_l2,
+		cpuinfo_placement_policy_per_llc,
+		cpuinfo_placement_policy_big_cores_first,
+	};
+	const uint32_t workers_count = cpuinfo_get_usable_processors_count();
+	std::vector<const cpuinfo_processor*> processors(workers_count);
+	for (cpuinfo_placement_policy policy : policies) {
+		ASSERT_TRUE(cpuinfo_plan_placement(policy, workers_count, processors.data()));
+		/* Each usable logical processor gets exactly one worker */
+		std::vector<const cpuinfo_processor*> sorted_processors(processors);
+		std::sort(sorted_processors.begin(), sorted_processors.end());
+		for (uint32_t i = 0; i < workers_count; i++) {
+			EXPECT_EQ(cpuinfo_get_usable_processor(i), sorted_processors[i]);
+		}
+	}
+	cpuinfo_deinitialize();
+}
+
+TEST(PLACEMENT, per_core) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	const uint32_t workers_count = cpuinfo_get_usable_cores_count();
+	std::vector<const cpuinfo_processor*> processors(workers_count);
+	ASSERT_TRUE(cpuinfo_plan_placement(cpuinfo_placement_policy_per_core, workers_count, processors.data()));
+	for (uint32_t i = 0; i < workers_count; i++) {
+		ASSERT_TRUE(processors[i]);
+		for (uint32_t j = 0; j < i; j++) {
+			EXPECT_NE(processors[j]->core, processors[i]->core);
+		}
+	}
+	cpuinfo_deinitialize();
+}
+
+TEST(PLACEMENT, wraps_around) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	const uint32_t usable_processors_count = cpuinfo_get_usable_processors_count();
+	std::vector<const cpuinfo_processor*> processors(2 * usable_processors_count);
+	ASSERT_TRUE(cpuinfo_plan_placement(cpuinfo_placement_policy_compact, 2 * usable_processors_count, processors.data()));
+	for (uint32_t i = 0; i < usable_processors_count; i++) {
+		EXPECT_EQ(processors[i], processors[usable_processors_count + i]);
+	}
+	cpuinfo_deinitialize();
+}
+
 TEST(UARCHS_COUNT, within_bounds) {
 	ASSERT_TRUE(cpuinfo_initialize());
 	EXPECT_NE(0, cpuinfo_get_uarchs_count());
@@ -1525,3 +1905,57 @@ TEST(L4_CACHE, consistent_processors) {
 	}
 	cpuinfo_deinitialize();
 }
+
+TEST(DEINITIALIZE, reinitialize) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	const uint32_t processors_count = cpuinfo_get_processors_count();
+	const uint32_t cores_count = cpuinfo_get_cores_count();
+	const uint32_t packages_count = cpuinfo_get_packages_count();
+	cpuinfo_deinitialize();
+
+	ASSERT_TRUE(cpuinfo_initialize());
+	EXPECT_EQ(processors_count, cpuinfo_get_processors_count());
+	EXPECT_EQ(cores_count, cpuinfo_get_cores_count());
+	EXPECT_EQ(packages_count, cpuinfo_get_packages_count());
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		const cpuinfo_processor* processor = cpuinfo_get_processor(i);
+		ASSERT_TRUE(processor);
+		EXPECT_EQ(processor->core, cpuinfo_get_core(processor->core - cpuinfo_get_cores()));
+		EXPECT_EQ(processor->package, cpuinfo_get_package(processor->package - cpuinfo_get_packages()));
+	}
+	cpuinfo_deinitialize();
+}
+
+TEST(INITIALIZE_EX, upgrade_tiers) {
+	ASSERT_TRUE(cpuinfo_initialize_ex(CPUINFO_INITIALIZE_ISA));
+	ASSERT_TRUE(cpuinfo_initialize_ex(CPUINFO_INITIALIZE_TOPOLOGY));
+	const uint32_t processors_count = cpuinfo_get_processors_count();
+	EXPECT_NE(0, processors_count);
+	EXPECT_NE(0, cpuinfo_get_usable_processors_count());
+
+	ASSERT_TRUE(cpuinfo_initialize_ex(CPUINFO_INITIALIZE_FULL));
+	EXPECT_EQ(processors_count, cpuinfo_get_processors_count());
+	EXPECT_LE(cpuinfo_get_usable_processors_count(), processors_count);
+	EXPECT_TRUE(cpuinfo_initialize());
+	cpuinfo_deinitialize();
+}
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+TEST(ISA, amx_permission) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	const bool amx = cpuinfo_x86_request_amx_permission();
+	EXPECT_EQ(amx, cpuinfo_has_x86_amx_tile());
+	if (!amx) {
+		EXPECT_FALSE(cpuinfo_has_x86_amx_int8());
+		EXPECT_FALSE(cpuinfo_has_x86_amx_bf16());
+		EXPECT_FALSE(cpuinfo_has_x86_amx_fp16());
+		EXPECT_FALSE(cpuinfo_has_x86_amx_complex());
+	}
+	cpuinfo_deinitialize();
+
+	/* The permission outlives reinitialization */
+	ASSERT_TRUE(cpuinfo_initialize());
+	EXPECT_EQ(amx, cpuinfo_has_x86_amx_tile());
+	cpuinfo_deinitialize();
+}
+#endif
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <set>
+#include <string>
+
+#include <cpuinfo.h>
+
+
+TEST(FEATURE_NAME, unique) {
+	std::set<std::string> names;
+	for (uint32_t i = 0; i < CPUINFO_ISA_FEATURE_MAX; i++) {
+		const char* name = cpuinfo_isa_feature_name((cpuinfo_isa_feature) i);
+		if (name != nullptr) {
+			EXPECT_NE(0, strlen(name));
+			EXPECT_EQ(nullptr, strchr(name, ','));
+			names.insert(std::string(i < 128 ? "x86:" : i < 256 ? "arm:" : "loongarch:") + name);
+		}
+	}
+	EXPECT_EQ(96 + 69 + 13, names.size());
+}
+
+TEST(FEATURE_NAME, stable) {
+	EXPECT_STREQ("avx2", cpuinfo_isa_feature_name(cpuinfo_isa_feature_x86_avx2));
+	EXPECT_STREQ("3dnow", cpuinfo_isa_feature_name(cpuinfo_isa_feature_x86_3dnow));
+	EXPECT_STREQ("neon_dot", cpuinfo_isa_feature_name(cpuinfo_isa_feature_arm_neon_dot));
+	EXPECT_STREQ("lasx", cpuinfo_isa_feature_name(cpuinfo_isa_feature_loongarch_lasx));
+	EXPECT_EQ(33, cpuinfo_isa_feature_x86_avx2);
+	EXPECT_EQ(128, cpuinfo_isa_feature_arm_thumb);
+	EXPECT_EQ(256, cpuinfo_isa_feature_loongarch_cpucfg);
+}
+
+TEST(FEATURE_NAME, unassigned) {
+	EXPECT_EQ(nullptr, cpuinfo_isa_feature_name((cpuinfo_isa_feature) 127));
+	EXPECT_EQ(nullptr, cpuinfo_isa_feature_name((cpuinfo_isa_feature) CPUINFO_ISA_FEATURE_MAX));
+}
+
+TEST(PARSE_FEATURES, list) {
+	cpuinfo_isa_features features = {};
+	ASSERT_TRUE(cpuinfo_isa_parse_features("avx2,fma3, bmi2 ", &features));
+	EXPECT_TRUE(cpuinfo_isa_features_contain(&features, cpuinfo_isa_feature_x86_avx2));
+	EXPECT_TRUE(cpuinfo_isa_features_contain(&features, cpuinfo_isa_feature_x86_fma3));
+	EXPECT_TRUE(cpuinfo_isa_features_contain(&features, cpuinfo_isa_feature_x86_bmi2));
+	EXPECT_FALSE(cpuinfo_isa_features_contain(&features, cpuinfo_isa_feature_x86_avx));
+}
+
+TEST(PARSE_FEATURES, empty) {
+	cpuinfo_isa_features features = {};
+	EXPECT_TRUE(cpuinfo_isa_parse_features("", &features));
+	EXPECT_TRUE(cpuinfo_isa_parse_features("  ", &features));
+	for (uint32_t i = 0; i < CPUINFO_ISA_FEATURE_WORDS; i++) {
+		EXPECT_EQ(0, features.words[i]);
+	}
+}
+
+TEST(PARSE_FEATURES, invalid) {
+	cpuinfo_isa_features features = {};
+	EXPECT_FALSE(cpuinfo_isa_parse_features("avx2,avx3", &features));
+	EXPECT_FALSE(cpuinfo_isa_parse_features("avx2,,fma3", &features));
+	EXPECT_FALSE(cpuinfo_isa_parse_features("avx2,", &features));
+	EXPECT_FALSE(cpuinfo_isa_parse_features("av", &features));
+}
+
+TEST(PARSE_FEATURES, native_architecture_first) {
+	cpuinfo_isa_features features = {};
+	ASSERT_TRUE(cpuinfo_isa_parse_features("aes", &features));
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	EXPECT_TRUE(cpuinfo_isa_features_contain(&features, cpuinfo_isa_feature_arm_aes));
+#else
+	EXPECT_TRUE(cpuinfo_isa_features_contain(&features, cpuinfo_isa_feature_x86_aes));
+#endif
+}
+
+TEST(FORMAT_FEATURES, round_trip) {
+	cpuinfo_isa_features features = {};
+	ASSERT_TRUE(cpuinfo_isa_parse_features("bmi2,avx2,fma3", &features));
+	char buffer[64];
+	EXPECT_EQ(strlen("fma3,avx2,bmi2"), cpuinfo_isa_format_features(&features, buffer, sizeof(buffer)));
+	EXPECT_STREQ("fma3,avx2,bmi2", buffer);
+
+	cpuinfo_isa_features parsed = {};
+	ASSERT_TRUE(cpuinfo_isa_parse_features(buffer, &parsed));
+	EXPECT_EQ(0, memcmp(&features, &parsed, sizeof(features)));
+}
+
+TEST(FORMAT_FEATURES, truncated) {
+	cpuinfo_isa_features features = {};
+	ASSERT_TRUE(cpuinfo_isa_parse_features("avx2,fma3", &features));
+	char buffer[6];
+	EXPECT_EQ(strlen("fma3,avx2"), cpuinfo_isa_format_features(&features, buffer, sizeof(buffer)));
+	EXPECT_STREQ("fma3,", buffer);
+	EXPECT_EQ(strlen("fma3,avx2"), cpuinfo_isa_format_features(&features, nullptr, 0));
+}
+
+TEST(ISA_FEATURES, match_getters) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	cpuinfo_isa_features features;
+	cpuinfo_get_isa_features(&features);
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	EXPECT_EQ(cpuinfo_has_x86_sse2(), cpuinfo_isa_features_contain(&features, cpuinfo_isa_feature_x86_sse2));
+	EXPECT_EQ(cpuinfo_has_x86_avx2(), cpuinfo_isa_features_contain(&features, cpuinfo_isa_feature_x86_avx2));
+	EXPECT_EQ(cpuinfo_has_x86_avx512f(), cpuinfo_isa_features_contain(&features, cpuinfo_isa_feature_x86_avx512f));
+	EXPECT_EQ(cpuinfo_has_x86_amx_tile(), cpuinfo_isa_features_contain(&features, cpuinfo_isa_feature_x86_amx_tile));
+#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+	EXPECT_EQ(cpuinfo_has_arm_neon(), cpuinfo_isa_features_contain(&features, cpuinfo_isa_feature_arm_neon));
+	EXPECT_EQ(cpuinfo_has_arm_sve(), cpuinfo_isa_features_contain(&features, cpuinfo_isa_feature_arm_sve));
+#endif
+	for (uint32_t i = 0; i < CPUINFO_ISA_FEATURE_MAX; i++) {
+		if (cpuinfo_isa_feature_name((cpuinfo_isa_feature) i) == nullptr) {
+			EXPECT_FALSE(cpuinfo_isa_features_contain(&features, (cpuinfo_isa_feature) i));
+		}
+	}
+}
+
+TEST(ISA_FEATURES, has_all) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	cpuinfo_isa_features features;
+	cpuinfo_get_isa_features(&features);
+	EXPECT_TRUE(cpuinfo_isa_has_all(&features));
+
+	const cpuinfo_isa_features empty = {};
+	EXPECT_TRUE(cpuinfo_isa_has_all(&empty));
+	EXPECT_FALSE(cpuinfo_isa_has_any(&empty));
+
+	cpuinfo_isa_features unsupported = {};
+	cpuinfo_isa_features_add(&unsupported, (cpuinfo_isa_feature) 511);
+	EXPECT_FALSE(cpuinfo_isa_has_all(&unsupported));
+	EXPECT_FALSE(cpuinfo_isa_has_any(&unsupported));
+
+#if CPUINFO_ARCH_X86_64
+	cpuinfo_isa_features sse2 = {};
+	cpuinfo_isa_features_add(&sse2, cpuinfo_isa_feature_x86_sse2);
+	EXPECT_TRUE(cpuinfo_isa_has_all(&sse2));
+	cpuinfo_isa_features_add(&sse2, (cpuinfo_isa_feature) 511);
+	EXPECT_FALSE(cpuinfo_isa_has_all(&sse2));
+	EXPECT_TRUE(cpuinfo_isa_has_any(&sse2));
+#endif
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+
+/*
+ * Lakefield has one Sunny Cove P-core and four Tremont E-cores without SMT. The CPUID dump is the Emerald Rapids VM
+ * dump with the signature, brand string, hybrid flag, core type, cache and topology leaves of Lakefield, and the kernel
+ * lists the processors of each core type in /sys/devices/cpu_core/cpus and /sys/devices/cpu_atom/cpus.
+ */
+
+TEST(PROCESSORS, count) {
+	ASSERT_EQ(5, cpuinfo_get_processors_count());
+}
+
+TEST(CORES, count) {
+	ASSERT_EQ(5, cpuinfo_get_cores_count());
+}
+
+TEST(CORES, uarch) {
+	ASSERT_EQ(cpuinfo_uarch_sunny_cove, cpuinfo_get_core(0)->uarch);
+	for (uint32_t i = 1; i < cpuinfo_get_cores_count(); i++) {
+		ASSERT_EQ(cpuinfo_uarch_tremont, cpuinfo_get_core(i)->uarch);
+	}
+}
+
+TEST(CORES, cpuid) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		ASSERT_EQ(UINT32_C(0x000806A1), cpuinfo_get_core(i)->cpuid);
+	}
+}
+
+TEST(CLUSTERS, count) {
+	ASSERT_EQ(2, cpuinfo_get_clusters_count());
+}
+
+TEST(CLUSTERS, uarch) {
+	ASSERT_EQ(cpuinfo_uarch_sunny_cove, cpuinfo_get_cluster(0)->uarch);
+	ASSERT_EQ(1, cpuinfo_get_cluster(0)->core_count);
+	ASSERT_EQ(cpuinfo_uarch_tremont, cpuinfo_get_cluster(1)->uarch);
+	ASSERT_EQ(4, cpuinfo_get_cluster(1)->core_count);
+}
+
+TEST(UARCHS, count) {
+	ASSERT_EQ(2, cpuinfo_get_uarchs_count());
+}
+
+TEST(UARCHS, uarch) {
+	ASSERT_EQ(cpuinfo_uarch_sunny_cove, cpuinfo_get_uarch(0)->uarch);
+	ASSERT_EQ(1, cpuinfo_get_uarch(0)->core_count);
+	ASSERT_EQ(cpuinfo_uarch_tremont, cpuinfo_get_uarch(1)->uarch);
+	ASSERT_EQ(4, cpuinfo_get_uarch(1)->core_count);
+}
+
+TEST(PACKAGES, name) {
+	ASSERT_EQ("Intel Core i5-L16G7",
+		std::string(cpuinfo_get_package(0)->name,
+			strnlen(cpuinfo_get_package(0)->name, CPUINFO_PACKAGE_NAME_MAX)));
+}
+
+TEST(L3, count) {
+	ASSERT_EQ(1, cpuinfo_get_l3_caches_count());
+}
+
+#include <core-i5-l16g7.h>
+
+int main(int argc, char* argv[]) {
+	cpuinfo_mock_filesystem(filesystem);
+	cpuinfo_mock_set_cpuid(cpuid_dump, sizeof(cpuid_dump) / sizeof(cpuinfo_mock_cpuid));
+	cpuinfo_initialize();
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,462 @@
+struct cpuinfo_mock_cpuid cpuid_dump[] = {
+	{
+		.input_eax = 0x00000000,
+		.eax = 0x00000020,
+		.ebx = 0x756E6547,
+		.ecx = 0x6C65746E,
+		.edx = 0x49656E69,
+	},
+	{
+		.input_eax = 0x00000001,
+		.eax = 0x000806A1,
+		.ebx = 0x00050800,
+		.ecx = 0xFFFA3203,
+		.edx = 0x1F8BFBFF,
+	},
+	{
+		.input_eax = 0x00000002,
+		.eax = 0x00FEFF01,
+		.ebx = 0x000000F0,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000003,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000000,
+		.eax = 0x10000121,
+		.ebx = 0x02C0003F,
+		.ecx = 0x0000003F,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000001,
+		.eax = 0x10000122,
+		.ebx = 0x01C0003F,
+		.ecx = 0x0000003F,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000002,
+		.eax = 0x10000143,
+		.ebx = 0x01C0003F,
+		.ecx = 0x000003FF,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000003,
+		.eax = 0x1001C163,
+		.ebx = 0x03C0003F,
+		.ecx = 0x00000FFF,
+		.edx = 0x00000004,
+	},
+	{
+		.input_eax = 0x00000005,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000006,
+		.eax = 0x00000004,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000007,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000002,
+		.ebx = 0xF1BF27EB,
+		.ecx = 0x1B415FDE,
+		.edx = 0xBFD1C410,
+	},
+	{
+		.input_eax = 0x00000007,
+		.input_ecx = 0x00000001,
+		.eax = 0x00001C30,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000007,
+		.input_ecx = 0x00000002,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x0000001F,
+	},
+	{
+		.input_eax = 0x00000008,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000009,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000A,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000000,
+		.ebx = 0x00000001,
+		.ecx = 0x00000100,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000001,
+		.eax = 0x00000003,
+		.ebx = 0x00000005,
+		.ecx = 0x00000201,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000002,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000002,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000C,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.eax = 0x000602E7,
+		.ebx = 0x00002B00,
+		.ecx = 0x00002B00,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000E,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000F,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000010,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000011,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000013,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000014,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000015,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000016,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000017,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000018,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000019,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001A,
+		.eax = 0x40000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001B,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001C,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001D,
+		.eax = 0x00000001,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001E,
+		.eax = 0x00000000,
+		.ebx = 0x00004010,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000020,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000000,
+		.eax = 0x80000008,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000001,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000121,
+		.edx = 0x2C100800,
+	},
+	{
+		.input_eax = 0x80000002,
+		.eax = 0x65746E49,
+		.ebx = 0x2952286C,
+		.ecx = 0x726F4320,
+		.edx = 0x4D542865,
+	},
+	{
+		.input_eax = 0x80000003,
+		.eax = 0x35692029,
+		.ebx = 0x36314C2D,
+		.ecx = 0x43203747,
+		.edx = 0x40205550,
+	},
+	{
+		.input_eax = 0x80000004,
+		.eax = 0x342E3120,
+		.ebx = 0x7A484730,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000005,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000006,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x08007040,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000007,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000100,
+	},
+	{
+		.input_eax = 0x80000008,
+		.eax = 0x002E392E,
+		.ebx = 0x0100D200,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+};
+
+struct cpuinfo_mock_file filesystem[] = {
+	{
+		.path = "/proc/cpuinfo",
+		.size = 1305,
+		.content =
+			"processor\t: 0\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 138\n"
+			"model name\t: Intel(R) Core(TM) i5-L16G7 CPU @ 1.40GHz\n"
+			"stepping\t: 1\n"
+			"physical id\t: 0\n"
+			"siblings\t: 5\n"
+			"core id\t\t: 0\n"
+			"cpu cores\t: 5\n"
+			"apicid\t\t: 0\n"
+			"initial apicid\t: 0\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 1\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 138\n"
+			"model name\t: Intel(R) Core(TM) i5-L16G7 CPU @ 1.40GHz\n"
+			"stepping\t: 1\n"
+			"physical id\t: 0\n"
+			"siblings\t: 5\n"
+			"core id\t\t: 1\n"
+			"cpu cores\t: 5\n"
+			"apicid\t\t: 1\n"
+			"initial apicid\t: 1\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 2\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 138\n"
+			"model name\t: Intel(R) Core(TM) i5-L16G7 CPU @ 1.40GHz\n"
+			"stepping\t: 1\n"
+			"physical id\t: 0\n"
+			"siblings\t: 5\n"
+			"core id\t\t: 2\n"
+			"cpu cores\t: 5\n"
+			"apicid\t\t: 2\n"
+			"initial apicid\t: 2\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 3\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 138\n"
+			"model name\t: Intel(R) Core(TM) i5-L16G7 CPU @ 1.40GHz\n"
+			"stepping\t: 1\n"
+			"physical id\t: 0\n"
+			"siblings\t: 5\n"
+			"core id\t\t: 3\n"
+			"cpu cores\t: 5\n"
+			"apicid\t\t: 3\n"
+			"initial apicid\t: 3\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 4\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 138\n"
+			"model name\t: Intel(R) Core(TM) i5-L16G7 CPU @ 1.40GHz\n"
+			"stepping\t: 1\n"
+			"physical id\t: 0\n"
+			"siblings\t: 5\n"
+			"core id\t\t: 4\n"
+			"cpu cores\t: 5\n"
+			"apicid\t\t: 4\n"
+			"initial apicid\t: 4\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n",
+	},
+	{
+		.path = "/sys/devices/cpu_atom/cpus",
+		.size = 4,
+		.content = "1-4\n",
+	},
+	{
+		.path = "/sys/devices/cpu_core/cpus",
+		.size = 2,
+		.content = "0\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/kernel_max",
+		.size = 5,
+		.content = "8191\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/possible",
+		.size = 4,
+		.content = "0-4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/present",
+		.size = 4,
+		.content = "0-4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/online",
+		.size = 4,
+		.content = "0-4\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/offline",
+		.size = 1,
+		.content = "\n",
+	},
+	{ NULL },
+};
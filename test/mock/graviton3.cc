@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+
+TEST(PROCESSORS, count) {
+	ASSERT_EQ(8, cpuinfo_get_processors_count());
+}
+
+TEST(PROCESSORS, non_null) {
+	ASSERT_TRUE(cpuinfo_get_processors());
+}
+
+TEST(PROCESSORS, smt_id) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(0, cpuinfo_get_processor(i)->smt_id);
+	}
+}
+
+TEST(PROCESSORS, core) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_core(i), cpuinfo_get_processor(i)->core);
+	}
+}
+
+TEST(PROCESSORS, cluster) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_cluster(0), cpuinfo_get_processor(i)->cluster);
+	}
+}
+
+TEST(PROCESSORS, package) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_package(0), cpuinfo_get_processor(i)->package);
+	}
+}
+
+TEST(PROCESSORS, linux_id) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(i, cpuinfo_get_processor(i)->linux_id);
+	}
+}
+
+TEST(CORES, count) {
+	ASSERT_EQ(8, cpuinfo_get_cores_count());
+}
+
+TEST(CORES, non_null) {
+	ASSERT_TRUE(cpuinfo_get_cores());
+}
+
+TEST(CORES, processor_start) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		ASSERT_EQ(i, cpuinfo_get_core(i)->processor_start);
+	}
+}
+
+TEST(CORES, processor_count) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		ASSERT_EQ(1, cpuinfo_get_core(i)->processor_count);
+	}
+}
+
+TEST(CORES, cluster) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_cluster(0), cpuinfo_get_core(i)->cluster);
+	}
+}
+
+TEST(CORES, vendor) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		ASSERT_EQ(cpuinfo_vendor_arm, cpuinfo_get_core(i)->vendor);
+	}
+}
+
+TEST(CORES, uarch) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		ASSERT_EQ(cpuinfo_uarch_neoverse_v1, cpuinfo_get_core(i)->uarch);
+	}
+}
+
+TEST(CORES, midr) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		ASSERT_EQ(UINT32_C(0x411FD401), cpuinfo_get_core(i)->midr);
+	}
+}
+
+TEST(CLUSTERS, count) {
+	ASSERT_EQ(1, cpuinfo_get_clusters_count());
+}
+
+TEST(CLUSTERS, processor_start) {
+	ASSERT_EQ(0, cpuinfo_get_cluster(0)->processor_start);
+}
+
+TEST(CLUSTERS, processor_count) {
+	ASSERT_EQ(8, cpuinfo_get_cluster(0)->processor_count);
+}
+
+TEST(CLUSTERS, uarch) {
+	ASSERT_EQ(cpuinfo_uarch_neoverse_v1, cpuinfo_get_cluster(0)->uarch);
+}
+
+TEST(CLUSTERS, midr) {
+	ASSERT_EQ(UINT32_C(0x411FD401), cpuinfo_get_cluster(0)->midr);
+}
+
+TEST(PACKAGES, count) {
+	ASSERT_EQ(1, cpuinfo_get_packages_count());
+}
+
+TEST(PACKAGES, processor_count) {
+	ASSERT_EQ(8, cpuinfo_get_package(0)->processor_count);
+}
+
+TEST(UARCHS, count) {
+	ASSERT_EQ(1, cpuinfo_get_uarchs_count());
+}
+
+TEST(ISA, atomics) {
+	ASSERT_TRUE(cpuinfo_has_arm_atomics());
+}
+
+TEST(ISA, neon_dot) {
+	ASSERT_TRUE(cpuinfo_has_arm_neon_dot());
+}
+
+TEST(ISA, jscvt) {
+	ASSERT_TRUE(cpuinfo_has_arm_jscvt());
+}
+
+TEST(ISA, sve) {
+	ASSERT_TRUE(cpuinfo_has_arm_sve());
+}
+
+TEST(ISA, sve2) {
+	ASSERT_FALSE(cpuinfo_has_arm_sve2());
+}
+
+TEST(ISA, sve_vector_bits) {
+	ASSERT_EQ(256, cpuinfo_get_arm_sve_vector_bits());
+}
+
+TEST(ISA, sme) {
+	ASSERT_FALSE(cpuinfo_has_arm_sme());
+}
+
+TEST(ISA, sme_streaming_vector_bits) {
+	ASSERT_EQ(0, cpuinfo_get_arm_sme_streaming_vector_bits());
+}
+
+TEST(ISA, fhm) {
+	ASSERT_TRUE(cpuinfo_has_arm_fhm());
+}
+
+TEST(ISA, bf16) {
+	ASSERT_TRUE(cpuinfo_has_arm_bf16());
+}
+
+TEST(ISA, ebf16) {
+	ASSERT_FALSE(cpuinfo_has_arm_ebf16());
+}
+
+TEST(ISA, i8mm) {
+	ASSERT_TRUE(cpuinfo_has_arm_i8mm());
+}
+
+TEST(ISA, svebf16) {
+	ASSERT_TRUE(cpuinfo_has_arm_svebf16());
+}
+
+TEST(ISA, svei8mm) {
+	ASSERT_TRUE(cpuinfo_has_arm_svei8mm());
+}
+
+TEST(ISA, svef32mm) {
+	ASSERT_FALSE(cpuinfo_has_arm_svef32mm());
+}
+
+TEST(ISA, aes) {
+	ASSERT_TRUE(cpuinfo_has_arm_aes());
+}
+
+TEST(ISA, pmull) {
+	ASSERT_TRUE(cpuinfo_has_arm_pmull());
+}
+
+TEST(ISA, sha3) {
+	ASSERT_TRUE(cpuinfo_has_arm_sha3());
+}
+
+TEST(ISA, sha512) {
+	ASSERT_TRUE(cpuinfo_has_arm_sha512());
+}
+
+TEST(ISA, sm4) {
+	ASSERT_TRUE(cpuinfo_has_arm_sm4());
+}
+
+TEST(ISA, rng) {
+	ASSERT_TRUE(cpuinfo_has_arm_rng());
+}
+
+TEST(ISA, rcpc2) {
+	ASSERT_TRUE(cpuinfo_has_arm_rcpc2());
+}
+
+TEST(ISA, rcpc3) {
+	ASSERT_FALSE(cpuinfo_has_arm_rcpc3());
+}
+
+TEST(ISA, flagm2) {
+	ASSERT_FALSE(cpuinfo_has_arm_flagm2());
+}
+
+TEST(ISA, lse128) {
+	ASSERT_FALSE(cpuinfo_has_arm_lse128());
+}
+
+TEST(ISA, mops) {
+	ASSERT_FALSE(cpuinfo_has_arm_mops());
+}
+
+#include <graviton3.h>
+
+/* Sanitised ID registers of Neoverse-V1 as seen from user space */
+static const cpuinfo_mock_id_registers id_registers = {
+	/* id_aa64isar0_el1 = */ UINT64_C(0x1011111110212120),
+	/* id_aa64isar1_el1 = */ UINT64_C(0x0011100001211012),
+	/* id_aa64isar2_el1 = */ UINT64_C(0x0000000000000000),
+	/* id_aa64pfr0_el1  = */ UINT64_C(0x1101000100110011),
+	/* id_aa64pfr1_el1  = */ UINT64_C(0x0000000000000020),
+	/* id_aa64zfr0_el1  = */ UINT64_C(0x0000100000100000),
+	/* id_aa64smfr0_el1 = */ UINT64_C(0x0000000000000000),
+};
+
+int main(int argc, char* argv[]) {
+	/* MIDR of every processor is reported in sysfs, so cpuinfo must not need /proc/cpuinfo */
+	std::vector<cpuinfo_mock_file> files;
+	for (const cpuinfo_mock_file* file = filesystem; file->path != NULL; file++) {
+		if (strcmp(file->path, "/proc/cpuinfo") != 0) {
+			files.push_back(*file);
+		}
+	}
+	files.push_back(cpuinfo_mock_file { });
+
+	/* HWCAP2 is not set, so features reported only in HWCAP2 (e.g. I8MM and BF16) must come from the ID registers */
+	cpuinfo_set_hwcap(UINT32_C(0xDFFFFFFF));
+	cpuinfo_set_id_registers(&id_registers);
+	cpuinfo_set_vector_lengths(32, 0);
+	cpuinfo_mock_filesystem(files.data());
+	cpuinfo_initialize();
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
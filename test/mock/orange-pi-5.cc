@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+
+TEST(PROCESSORS, count) {
+	ASSERT_EQ(8, cpuinfo_get_processors_count());
+}
+
+TEST(PROCESSORS, non_null) {
+	ASSERT_TRUE(cpuinfo_get_processors());
+}
+
+TEST(PROCESSORS, smt_id) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(0, cpuinfo_get_processor(i)->smt_id);
+	}
+}
+
+TEST(PROCESSORS, core) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_core(i), cpuinfo_get_processor(i)->core);
+	}
+}
+
+TEST(PROCESSORS, cluster) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		switch (i) {
+			case 0:
+			case 1:
+			case 2:
+			case 3:
+				ASSERT_EQ(cpuinfo_get_cluster(0), cpuinfo_get_processor(i)->cluster);
+				break;
+			case 4:
+			case 5:
+			case 6:
+			case 7:
+				ASSERT_EQ(cpuinfo_get_cluster(1), cpuinfo_get_processor(i)->cluster);
+				break;
+		}
+	}
+}
+
+TEST(PROCESSORS, package) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_package(0), cpuinfo_get_processor(i)->package);
+	}
+}
+
+TEST(PROCESSORS, linux_id) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		switch (i) {
+			case 0:
+			case 1:
+			case 2:
+			case 3:
+				ASSERT_EQ(i + 4, cpuinfo_get_processor(i)->linux_id);
+				break;
+			case 4:
+			case 5:
+			case 6:
+			case 7:
+				ASSERT_EQ(i - 4, cpuinfo_get_processor(i)->linux_id);
+				break;
+		}
+	}
+}
+
+TEST(CORES, count) {
+	ASSERT_EQ(8, cpuinfo_get_cores_count());
+}
+
+TEST(CORES, non_null) {
+	ASSERT_TRUE(cpuinfo_get_cores());
+}
+
+TEST(CORES, vendor) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		ASSERT_EQ(cpuinfo_vendor_arm, cpuinfo_get_core(i)->vendor);
+	}
+}
+
+TEST(CORES, uarch) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		switch (i) {
+			case 0:
+			case 1:
+			case 2:
+			case 3:
+				ASSERT_EQ(cpuinfo_uarch_cortex_a76, cpuinfo_get_core(i)->uarch);
+				break;
+			case 4:
+			case 5:
+			case 6:
+			case 7:
+				ASSERT_EQ(cpuinfo_uarch_cortex_a55, cpuinfo_get_core(i)->uarch);
+				break;
+		}
+	}
+}
+
+TEST(CORES, midr) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		switch (i) {
+			case 0:
+			case 1:
+			case 2:
+			case 3:
+				ASSERT_EQ(UINT32_C(0x414FD0B0), cpuinfo_get_core(i)->midr);
+				break;
+			case 4:
+			case 5:
+			case 6:
+			case 7:
+				ASSERT_EQ(UINT32_C(0x412FD050), cpuinfo_get_core(i)->midr);
+				break;
+		}
+	}
+}
+
+TEST(CLUSTERS, count) {
+	ASSERT_EQ(2, cpuinfo_get_clusters_count());
+}
+
+TEST(CLUSTERS, non_null) {
+	ASSERT_TRUE(cpuinfo_get_clusters());
+}
+
+TEST(CLUSTERS, processor_start) {
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		switch (i) {
+			case 0:
+				ASSERT_EQ(0, cpuinfo_get_cluster(i)->processor_start);
+				break;
+			case 1:
+				ASSERT_EQ(4, cpuinfo_get_cluster(i)->processor_start);
+				break;
+		}
+	}
+}
+
+TEST(CLUSTERS, processor_count) {
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		ASSERT_EQ(4, cpuinfo_get_cluster(i)->processor_count);
+	}
+}
+
+TEST(CLUSTERS, package) {
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_package(0), cpuinfo_get_cluster(i)->package);
+	}
+}
+
+TEST(CLUSTERS, uarch) {
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		switch (i) {
+			case 0:
+				ASSERT_EQ(cpuinfo_uarch_cortex_a76, cpuinfo_get_cluster(i)->uarch);
+				break;
+			case 1:
+				ASSERT_EQ(cpuinfo_uarch_cortex_a55, cpuinfo_get_cluster(i)->uarch);
+				break;
+		}
+	}
+}
+
+TEST(CLUSTERS, midr) {
+	for (uint32_t i = 0; i < cpuinfo_get_clusters_count(); i++) {
+		switch (i) {
+			case 0:
+				ASSERT_EQ(UINT32_C(0x414FD0B0), cpuinfo_get_cluster(i)->midr);
+				break;
+			case 1:
+				ASSERT_EQ(UINT32_C(0x412FD050), cpuinfo_get_cluster(i)->midr);
+				break;
+		}
+	}
+}
+
+TEST(PACKAGES, count) {
+	ASSERT_EQ(1, cpuinfo_get_packages_count());
+}
+
+TEST(PACKAGES, cluster_count) {
+	ASSERT_EQ(2, cpuinfo_get_package(0)->cluster_count);
+}
+
+TEST(UARCHS, count) {
+	ASSERT_EQ(2, cpuinfo_get_uarchs_count());
+}
+
+TEST(ISA, atomics) {
+	ASSERT_TRUE(cpuinfo_has_arm_atomics());
+}
+
+TEST(ISA, neon_dot) {
+	ASSERT_TRUE(cpuinfo_has_arm_neon_dot());
+}
+
+TEST(ISA, fp16_arith) {
+	ASSERT_TRUE(cpuinfo_has_arm_fp16_arith());
+}
+
+TEST(ISA, sve) {
+	ASSERT_FALSE(cpuinfo_has_arm_sve());
+}
+
+#include <orange-pi-5.h>
+
+/*
+ * Some vendor arm64 kernels print a Hardware line in /proc/cpuinfo. The chipset it names enables workarounds, e.g. for
+ * FP16 arithmetics on Exynos 9810, so /proc/cpuinfo must be parsed even when sysfs reports MIDR of every processor.
+ */
+TEST(CHIPSET, proc_cpuinfo_hardware) {
+	std::vector<cpuinfo_mock_file> files;
+	std::string proc_cpuinfo;
+	for (const cpuinfo_mock_file* file = filesystem; file->path != NULL; file++) {
+		if (strcmp(file->path, "/proc/cpuinfo") == 0) {
+			proc_cpuinfo = std::string(file->content, file->size) + "Hardware\t: SAMSUNG Exynos9810\n";
+		}
+		files.push_back(*file);
+	}
+	for (cpuinfo_mock_file& file : files) {
+		if (strcmp(file.path, "/proc/cpuinfo") == 0) {
+			file.size = proc_cpuinfo.size();
+			file.content = proc_cpuinfo.c_str();
+		}
+	}
+	files.push_back(cpuinfo_mock_file { });
+
+	cpuinfo_deinitialize();
+	cpuinfo_mock_filesystem(files.data());
+	ASSERT_TRUE(cpuinfo_initialize());
+	EXPECT_STREQ("Samsung Exynos 9810", cpuinfo_get_package(0)->name);
+	EXPECT_FALSE(cpuinfo_has_arm_fp16_arith());
+
+	cpuinfo_deinitialize();
+	cpuinfo_mock_filesystem(filesystem);
+	ASSERT_TRUE(cpuinfo_initialize());
+}
+
+int main(int argc, char* argv[]) {
+	cpuinfo_set_hwcap(UINT32_C(0x00119FFF));
+	cpuinfo_mock_filesystem(filesystem);
+	cpuinfo_initialize();
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,453 @@
+struct cpuinfo_mock_cpuid cpuid_dump[] = {
+	{
+		.input_eax = 0x00000000,
+		.eax = 0x00000010,
+		.ebx = 0x68747541,
+		.ecx = 0x444D4163,
+		.edx = 0x69746E65,
+	},
+	{
+		.input_eax = 0x00000001,
+		.eax = 0x00870F10,
+		.ebx = 0x00100800,
+		.ecx = 0x7EF8320B,
+		.edx = 0x178BFBFF,
+	},
+	{
+		.input_eax = 0x00000005,
+		.eax = 0x00000040,
+		.ebx = 0x00000040,
+		.ecx = 0x00000003,
+		.edx = 0x00000011,
+	},
+	{
+		.input_eax = 0x00000006,
+		.eax = 0x00000004,
+		.ebx = 0x00000000,
+		.ecx = 0x00000001,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000007,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000000,
+		.ebx = 0x219C91A9,
+		.ecx = 0x00400004,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000001,
+		.ebx = 0x00000002,
+		.ecx = 0x00000100,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000001,
+		.eax = 0x00000004,
+		.ebx = 0x00000010,
+		.ecx = 0x00000201,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000002,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000002,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000207,
+		.ebx = 0x00000340,
+		.ecx = 0x00000380,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000000,
+		.eax = 0x8000001F,
+		.ebx = 0x68747541,
+		.ecx = 0x444D4163,
+		.edx = 0x69746E65,
+	},
+	{
+		.input_eax = 0x80000001,
+		.eax = 0x00870F10,
+		.ebx = 0x20000000,
+		.ecx = 0x75C237FF,
+		.edx = 0x2FD3FBFF,
+	},
+	{
+		.input_eax = 0x80000002,
+		.eax = 0x20444D41,
+		.ebx = 0x657A7952,
+		.ecx = 0x2037206E,
+		.edx = 0x30303733,
+	},
+	{
+		.input_eax = 0x80000003,
+		.eax = 0x2D382058,
+		.ebx = 0x65726F43,
+		.ecx = 0x6F725020,
+		.edx = 0x73736563,
+	},
+	{
+		.input_eax = 0x80000004,
+		.eax = 0x0000726F,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000005,
+		.eax = 0xFF40FF40,
+		.ebx = 0xFF40FF40,
+		.ecx = 0x20080140,
+		.edx = 0x20080140,
+	},
+	{
+		.input_eax = 0x80000006,
+		.eax = 0x48006400,
+		.ebx = 0x68006400,
+		.ecx = 0x02006140,
+		.edx = 0x00809140,
+	},
+	{
+		.input_eax = 0x80000007,
+		.eax = 0x00000000,
+		.ebx = 0x0000003B,
+		.ecx = 0x00000000,
+		.edx = 0x00006799,
+	},
+	{
+		.input_eax = 0x80000008,
+		.eax = 0x00003030,
+		.ebx = 0x111EF657,
+		.ecx = 0x0000400F,
+		.edx = 0x00010000,
+	},
+	{
+		.input_eax = 0x8000001D,
+		.input_ecx = 0x00000000,
+		.eax = 0x00004121,
+		.ebx = 0x01C0003F,
+		.ecx = 0x0000003F,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x8000001D,
+		.input_ecx = 0x00000001,
+		.eax = 0x00004122,
+		.ebx = 0x01C0003F,
+		.ecx = 0x0000003F,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x8000001D,
+		.input_ecx = 0x00000002,
+		.eax = 0x00004143,
+		.ebx = 0x01C0003F,
+		.ecx = 0x000003FF,
+		.edx = 0x00000002,
+	},
+	{
+		.input_eax = 0x8000001D,
+		.input_ecx = 0x00000003,
+		.eax = 0x0001C163,
+		.ebx = 0x03C0003F,
+		.ecx = 0x00003FFF,
+		.edx = 0x00000001,
+	},
+	{
+		.input_eax = 0x8000001D,
+		.input_ecx = 0x00000004,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x8000001E,
+		.eax = 0x00000000,
+		.ebx = 0x00000100,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+};
+struct cpuinfo_mock_file filesystem[] = {
+	{
+		.path = "/proc/cpuinfo",
+		.size = 4130,
+		.content =
+			"processor\t: 0\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 23\n"
+			"model\t\t: 113\n"
+			"model name\t: AMD Ryzen 7 3700X 8-Core Processor\n"
+			"stepping\t: 0\n"
+			"physical id\t: 0\n"
+			"siblings\t: 16\n"
+			"core id\t\t: 0\n"
+			"cpu cores\t: 8\n"
+			"apicid\t\t: 0\n"
+			"initial apicid\t: 0\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 1\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 23\n"
+			"model\t\t: 113\n"
+			"model name\t: AMD Ryzen 7 3700X 8-Core Processor\n"
+			"stepping\t: 0\n"
+			"physical id\t: 0\n"
+			"siblings\t: 16\n"
+			"core id\t\t: 1\n"
+			"cpu cores\t: 8\n"
+			"apicid\t\t: 2\n"
+			"initial apicid\t: 2\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 2\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 23\n"
+			"model\t\t: 113\n"
+			"model name\t: AMD Ryzen 7 3700X 8-Core Processor\n"
+			"stepping\t: 0\n"
+			"physical id\t: 0\n"
+			"siblings\t: 16\n"
+			"core id\t\t: 2\n"
+			"cpu cores\t: 8\n"
+			"apicid\t\t: 4\n"
+			"initial apicid\t: 4\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 3\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 23\n"
+			"model\t\t: 113\n"
+			"model name\t: AMD Ryzen 7 3700X 8-Core Processor\n"
+			"stepping\t: 0\n"
+			"physical id\t: 0\n"
+			"siblings\t: 16\n"
+			"core id\t\t: 3\n"
+			"cpu cores\t: 8\n"
+			"apicid\t\t: 6\n"
+			"initial apicid\t: 6\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 4\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 23\n"
+			"model\t\t: 113\n"
+			"model name\t: AMD Ryzen 7 3700X 8-Core Processor\n"
+			"stepping\t: 0\n"
+			"physical id\t: 0\n"
+			"siblings\t: 16\n"
+			"core id\t\t: 4\n"
+			"cpu cores\t: 8\n"
+			"apicid\t\t: 8\n"
+			"initial apicid\t: 8\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 5\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 23\n"
+			"model\t\t: 113\n"
+			"model name\t: AMD Ryzen 7 3700X 8-Core Processor\n"
+			"stepping\t: 0\n"
+			"physical id\t: 0\n"
+			"siblings\t: 16\n"
+			"core id\t\t: 5\n"
+			"cpu cores\t: 8\n"
+			"apicid\t\t: 10\n"
+			"initial apicid\t: 10\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 6\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 23\n"
+			"model\t\t: 113\n"
+			"model name\t: AMD Ryzen 7 3700X 8-Core Processor\n"
+			"stepping\t: 0\n"
+			"physical id\t: 0\n"
+			"siblings\t: 16\n"
+			"core id\t\t: 6\n"
+			"cpu cores\t: 8\n"
+			"apicid\t\t: 12\n"
+			"initial apicid\t: 12\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 7\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 23\n"
+			"model\t\t: 113\n"
+			"model name\t: AMD Ryzen 7 3700X 8-Core Processor\n"
+			"stepping\t: 0\n"
+			"physical id\t: 0\n"
+			"siblings\t: 16\n"
+			"core id\t\t: 7\n"
+			"cpu cores\t: 8\n"
+			"apicid\t\t: 14\n"
+			"initial apicid\t: 14\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 8\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 23\n"
+			"model\t\t: 113\n"
+			"model name\t: AMD Ryzen 7 3700X 8-Core Processor\n"
+			"stepping\t: 0\n"
+			"physical id\t: 0\n"
+			"siblings\t: 16\n"
+			"core id\t\t: 0\n"
+			"cpu cores\t: 8\n"
+			"apicid\t\t: 1\n"
+			"initial apicid\t: 1\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 9\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 23\n"
+			"model\t\t: 113\n"
+			"model name\t: AMD Ryzen 7 3700X 8-Core Processor\n"
+			"stepping\t: 0\n"
+			"physical id\t: 0\n"
+			"siblings\t: 16\n"
+			"core id\t\t: 1\n"
+			"cpu cores\t: 8\n"
+			"apicid\t\t: 3\n"
+			"initial apicid\t: 3\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 10\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 23\n"
+			"model\t\t: 113\n"
+			"model name\t: AMD Ryzen 7 3700X 8-Core Processor\n"
+			"stepping\t: 0\n"
+			"physical id\t: 0\n"
+			"siblings\t: 16\n"
+			"core id\t\t: 2\n"
+			"cpu cores\t: 8\n"
+			"apicid\t\t: 5\n"
+			"initial apicid\t: 5\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 11\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 23\n"
+			"model\t\t: 113\n"
+			"model name\t: AMD Ryzen 7 3700X 8-Core Processor\n"
+			"stepping\t: 0\n"
+			"physical id\t: 0\n"
+			"siblings\t: 16\n"
+			"core id\t\t: 3\n"
+			"cpu cores\t: 8\n"
+			"apicid\t\t: 7\n"
+			"initial apicid\t: 7\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 12\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 23\n"
+			"model\t\t: 113\n"
+			"model name\t: AMD Ryzen 7 3700X 8-Core Processor\n"
+			"stepping\t: 0\n"
+			"physical id\t: 0\n"
+			"siblings\t: 16\n"
+			"core id\t\t: 4\n"
+			"cpu cores\t: 8\n"
+			"apicid\t\t: 9\n"
+			"initial apicid\t: 9\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 13\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 23\n"
+			"model\t\t: 113\n"
+			"model name\t: AMD Ryzen 7 3700X 8-Core Processor\n"
+			"stepping\t: 0\n"
+			"physical id\t: 0\n"
+			"siblings\t: 16\n"
+			"core id\t\t: 5\n"
+			"cpu cores\t: 8\n"
+			"apicid\t\t: 11\n"
+			"initial apicid\t: 11\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 14\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 23\n"
+			"model\t\t: 113\n"
+			"model name\t: AMD Ryzen 7 3700X 8-Core Processor\n"
+			"stepping\t: 0\n"
+			"physical id\t: 0\n"
+			"siblings\t: 16\n"
+			"core id\t\t: 6\n"
+			"cpu cores\t: 8\n"
+			"apicid\t\t: 13\n"
+			"initial apicid\t: 13\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 15\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 23\n"
+			"model\t\t: 113\n"
+			"model name\t: AMD Ryzen 7 3700X 8-Core Processor\n"
+			"stepping\t: 0\n"
+			"physical id\t: 0\n"
+			"siblings\t: 16\n"
+			"core id\t\t: 7\n"
+			"cpu cores\t: 8\n"
+			"apicid\t\t: 15\n"
+			"initial apicid\t: 15\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/kernel_max",
+		.size = 4,
+		.content = "511\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/possible",
+		.size = 5,
+		.content = "0-15\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/present",
+		.size = 5,
+		.content = "0-15\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/online",
+		.size = 5,
+		.content = "0-15\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/offline",
+		.size = 1,
+		.content = "\n",
+	},
+	{ NULL },
+};
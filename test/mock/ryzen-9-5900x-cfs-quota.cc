@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+
+TEST(USABLE_PROCESSORS, count) {
+	ASSERT_EQ(24, cpuinfo_get_usable_processors_count());
+}
+
+TEST(USABLE_CORES, count) {
+	ASSERT_EQ(12, cpuinfo_get_usable_cores_count());
+}
+
+TEST(RECOMMENDED_THREAD_COUNT, all_logical) {
+	ASSERT_EQ(6, cpuinfo_get_recommended_thread_count(cpuinfo_thread_policy_all_logical));
+}
+
+TEST(RECOMMENDED_THREAD_COUNT, physical_cores) {
+	ASSERT_EQ(6, cpuinfo_get_recommended_thread_count(cpuinfo_thread_policy_physical_cores));
+}
+
+TEST(RECOMMENDED_THREAD_COUNT, big_cores) {
+	ASSERT_EQ(6, cpuinfo_get_recommended_thread_count(cpuinfo_thread_policy_big_cores));
+}
+
+#include <ryzen-9-5900x.h>
+
+/*
+ * The process runs in a Docker container on a host with cgroup v1 hierarchies.
+ * The container is limited to 10 processors, and its parent to 6 processors.
+ */
+static const char proc_self_cgroup[] =
+	"12:cpuset:/docker/container0\n"
+	"4:cpu,cpuacct:/docker/container0\n"
+	"1:name=systemd:/docker/container0\n"
+	"0::/\n";
+static const char container_cpuset[] = "0-23\n";
+static const char container_cfs_quota[] = "1000000\n";
+static const char docker_cfs_quota[] = "600000\n";
+static const char root_cfs_quota[] = "-1\n";
+static const char cfs_period[] = "100000\n";
+
+static void add_file(std::vector<cpuinfo_mock_file>& files, const char* path, const char* content) {
+	cpuinfo_mock_file file = { };
+	file.path = path;
+	file.size = strlen(content);
+	file.content = content;
+	files.push_back(file);
+}
+
+int main(int argc, char* argv[]) {
+	std::vector<cpuinfo_mock_file> files;
+	for (const cpuinfo_mock_file* file = filesystem; file->path != NULL; file++) {
+		files.push_back(*file);
+	}
+	add_file(files, "/proc/self/cgroup", proc_self_cgroup);
+	add_file(files, "/sys/fs/cgroup/cpuset/docker/container0/cpuset.effective_cpus", container_cpuset);
+	add_file(files, "/sys/fs/cgroup/cpu,cpuacct/docker/container0/cpu.cfs_quota_us", container_cfs_quota);
+	add_file(files, "/sys/fs/cgroup/cpu,cpuacct/docker/container0/cpu.cfs_period_us", cfs_period);
+	add_file(files, "/sys/fs/cgroup/cpu,cpuacct/docker/cpu.cfs_quota_us", docker_cfs_quota);
+	add_file(files, "/sys/fs/cgroup/cpu,cpuacct/docker/cpu.cfs_period_us", cfs_period);
+	add_file(files, "/sys/fs/cgroup/cpu,cpuacct/cpu.cfs_quota_us", root_cfs_quota);
+	add_file(files, "/sys/fs/cgroup/cpu,cpuacct/cpu.cfs_period_us", cfs_period);
+	files.push_back(cpuinfo_mock_file { });
+
+	cpuinfo_mock_filesystem(files.data());
+	cpuinfo_mock_set_cpuid(cpuid_dump, sizeof(cpuid_dump) / sizeof(cpuinfo_mock_cpuid));
+	cpuinfo_initialize();
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+
+/* Topology of every logical processor detected from /proc/cpuinfo */
+struct processor_topology {
+	uint32_t apic_id;
+	int linux_id;
+	uint32_t smt_id;
+	uint32_t core_index;
+	uint32_t cluster_index;
+	uint32_t die_index;
+	uint32_t package_index;
+	uint32_t l2_index;
+	uint32_t l3_index;
+};
+
+static std::vector<processor_topology> proc_cpuinfo_topology;
+static uint32_t proc_cpuinfo_cores_count;
+static uint32_t proc_cpuinfo_clusters_count;
+static uint32_t proc_cpuinfo_dies_count;
+
+static std::vector<processor_topology> get_processor_topology() {
+	std::vector<processor_topology> topology;
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		const cpuinfo_processor* processor = cpuinfo_get_processor(i);
+		topology.push_back(processor_topology {
+			processor->apic_id,
+			processor->linux_id,
+			processor->smt_id,
+			(uint32_t) (processor->core - cpuinfo_get_cores()),
+			(uint32_t) (processor->cluster - cpuinfo_get_clusters()),
+			(uint32_t) (processor->die - cpuinfo_get_dies()),
+			(uint32_t) (processor->package - cpuinfo_get_packages()),
+			(uint32_t) (processor->cache.l2 - cpuinfo_get_l2_caches()),
+			(uint32_t) (processor->cache.l3 - cpuinfo_get_l3_caches()),
+		});
+	}
+	return topology;
+}
+
+TEST(PROCESSORS, count) {
+	ASSERT_EQ(24, cpuinfo_get_processors_count());
+	ASSERT_EQ(proc_cpuinfo_topology.size(), cpuinfo_get_processors_count());
+}
+
+TEST(PROCESSORS, apic_id) {
+	const std::vector<processor_topology> topology = get_processor_topology();
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(proc_cpuinfo_topology[i].apic_id, topology[i].apic_id);
+	}
+}
+
+TEST(PROCESSORS, linux_id) {
+	const std::vector<processor_topology> topology = get_processor_topology();
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(proc_cpuinfo_topology[i].linux_id, topology[i].linux_id);
+	}
+}
+
+TEST(PROCESSORS, smt_id) {
+	const std::vector<processor_topology> topology = get_processor_topology();
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(proc_cpuinfo_topology[i].smt_id, topology[i].smt_id);
+	}
+}
+
+TEST(PROCESSORS, core) {
+	const std::vector<processor_topology> topology = get_processor_topology();
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(proc_cpuinfo_topology[i].core_index, topology[i].core_index);
+	}
+}
+
+TEST(PROCESSORS, cluster) {
+	const std::vector<processor_topology> topology = get_processor_topology();
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(proc_cpuinfo_topology[i].cluster_index, topology[i].cluster_index);
+	}
+}
+
+TEST(PROCESSORS, die) {
+	const std::vector<processor_topology> topology = get_processor_topology();
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(proc_cpuinfo_topology[i].die_index, topology[i].die_index);
+	}
+}
+
+TEST(PROCESSORS, package) {
+	const std::vector<processor_topology> topology = get_processor_topology();
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(proc_cpuinfo_topology[i].package_index, topology[i].package_index);
+	}
+}
+
+TEST(PROCESSORS, l2) {
+	const std::vector<processor_topology> topology = get_processor_topology();
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(proc_cpuinfo_topology[i].l2_index, topology[i].l2_index);
+	}
+}
+
+TEST(PROCESSORS, l3) {
+	const std::vector<processor_topology> topology = get_processor_topology();
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		ASSERT_EQ(proc_cpuinfo_topology[i].l3_index, topology[i].l3_index);
+	}
+}
+
+TEST(CORES, count) {
+	ASSERT_EQ(12, cpuinfo_get_cores_count());
+	ASSERT_EQ(proc_cpuinfo_cores_count, cpuinfo_get_cores_count());
+}
+
+TEST(CLUSTERS, count) {
+	ASSERT_EQ(proc_cpuinfo_clusters_count, cpuinfo_get_clusters_count());
+}
+
+TEST(DIES, count) {
+	ASSERT_EQ(proc_cpuinfo_dies_count, cpuinfo_get_dies_count());
+}
+
+#include <ryzen-9-5900x.h>
+
+/*
+ * Topology reported by Linux in /sys/devices/system/cpu/cpu<N>/topology. The second CCD has cores 8-13, and
+ * processor N and N + 12 are threads of the same core.
+ */
+static const uint32_t core_ids[12] = { 0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 12, 13 };
+
+/* Paths and contents of generated files, which must outlive the mock filesystem */
+static std::deque<std::string> strings;
+
+static void add_file(std::vector<cpuinfo_mock_file>& files, const std::string& path, const std::string& content) {
+	strings.push_back(path);
+	const char* path_string = strings.back().c_str();
+	strings.push_back(content);
+	const char* content_string = strings.back().c_str();
+
+	cpuinfo_mock_file file = { };
+	file.path = path_string;
+	file.size = content.size();
+	file.content = content_string;
+	files.push_back(file);
+}
+
+int main(int argc, char* argv[]) {
+	cpuinfo_mock_filesystem(filesystem);
+	cpuinfo_mock_set_cpuid(cpuid_dump, sizeof(cpuid_dump) / sizeof(cpuinfo_mock_cpuid));
+	cpuinfo_initialize();
+	proc_cpuinfo_topology = get_processor_topology();
+	proc_cpuinfo_cores_count = cpuinfo_get_cores_count();
+	proc_cpuinfo_clusters_count = cpuinfo_get_clusters_count();
+	proc_cpuinfo_dies_count = cpuinfo_get_dies_count();
+	cpuinfo_deinitialize();
+
+	/* Without /proc/cpuinfo, cpuinfo must detect the same topology from sysfs */
+	std::vector<cpuinfo_mock_file> files;
+	for (const cpuinfo_mock_file* file = filesystem; file->path != NULL; file++) {
+		if (strcmp(file->path, "/proc/cpuinfo") != 0) {
+			files.push_back(*file);
+		}
+	}
+	for (uint32_t i = 0; i < 24; i++) {
+		const std::string topology = "/sys/devices/system/cpu/cpu" + std::to_string(i) + "/topology/";
+		const uint32_t core = i % 12;
+		add_file(files, topology + "physical_package_id", "0\n");
+		add_file(files, topology + "core_id", std::to_string(core_ids[core]) + "\n");
+		add_file(files, topology + "thread_siblings_list", std::to_string(core) + "," + std::to_string(core + 12) + "\n");
+	}
+	files.push_back(cpuinfo_mock_file { });
+
+	cpuinfo_mock_filesystem(files.data());
+	cpuinfo_initialize();
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
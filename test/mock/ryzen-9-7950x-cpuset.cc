@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+
+TEST(PROCESSORS, count) {
+	ASSERT_EQ(32, cpuinfo_get_processors_count());
+}
+
+TEST(USABLE_PROCESSORS, count) {
+	ASSERT_EQ(8, cpuinfo_get_usable_processors_count());
+}
+
+TEST(USABLE_PROCESSORS, linux_id) {
+	for (uint32_t i = 0; i < cpuinfo_get_usable_processors_count(); i++) {
+		ASSERT_EQ(i / 2 + (i % 2) * 16, cpuinfo_get_usable_processor(i)->linux_id);
+	}
+}
+
+TEST(USABLE_PROCESSORS, out_of_range) {
+	ASSERT_FALSE(cpuinfo_get_usable_processor(cpuinfo_get_usable_processors_count()));
+}
+
+TEST(USABLE_CORES, count) {
+	ASSERT_EQ(4, cpuinfo_get_usable_cores_count());
+}
+
+TEST(USABLE_CORES, core) {
+	for (uint32_t i = 0; i < cpuinfo_get_usable_cores_count(); i++) {
+		ASSERT_EQ(cpuinfo_get_core(i), cpuinfo_get_usable_core(i));
+	}
+}
+
+TEST(USABLE_CLUSTERS, count) {
+	ASSERT_EQ(1, cpuinfo_get_usable_clusters_count());
+}
+
+TEST(USABLE_CLUSTERS, cluster) {
+	ASSERT_EQ(cpuinfo_get_cluster(0), cpuinfo_get_usable_cluster(0));
+}
+
+TEST(USABLE_PACKAGES, count) {
+	ASSERT_EQ(1, cpuinfo_get_usable_packages_count());
+}
+
+TEST(RECOMMENDED_THREAD_COUNT, all_logical) {
+	ASSERT_EQ(5, cpuinfo_get_recommended_thread_count(cpuinfo_thread_policy_all_logical));
+}
+
+TEST(RECOMMENDED_THREAD_COUNT, physical_cores) {
+	ASSERT_EQ(4, cpuinfo_get_recommended_thread_count(cpuinfo_thread_policy_physical_cores));
+}
+
+TEST(RECOMMENDED_THREAD_COUNT, big_cores) {
+	ASSERT_EQ(4, cpuinfo_get_recommended_thread_count(cpuinfo_thread_policy_big_cores));
+}
+
+#include <ryzen-9-7950x.h>
+
+/*
+ * The process runs in a nested cgroup v2 without a cpuset of its own, and inherits the cpuset of the pod.
+ * The container is limited to 5.5 processors, and the pod to 6 processors.
+ */
+static const char proc_self_cgroup[] = "0::/kubepods/pod0/container0\n";
+static const char pod_cpuset[] = "0-3,16-19\n";
+static const char pod_cpu_max[] = "600000 100000\n";
+static const char container_cpu_max[] = "550000 100000\n";
+static const char kubepods_cpu_max[] = "max 100000\n";
+
+static void add_file(std::vector<cpuinfo_mock_file>& files, const char* path, const char* content) {
+	cpuinfo_mock_file file = { };
+	file.path = path;
+	file.size = strlen(content);
+	file.content = content;
+	files.push_back(file);
+}
+
+int main(int argc, char* argv[]) {
+	std::vector<cpuinfo_mock_file> files;
+	for (const cpuinfo_mock_file* file = filesystem; file->path != NULL; file++) {
+		files.push_back(*file);
+	}
+	add_file(files, "/proc/self/cgroup", proc_self_cgroup);
+	add_file(files, "/sys/fs/cgroup/kubepods/pod0/cpuset.cpus.effective", pod_cpuset);
+	add_file(files, "/sys/fs/cgroup/kubepods/pod0/container0/cpu.max", container_cpu_max);
+	add_file(files, "/sys/fs/cgroup/kubepods/pod0/cpu.max", pod_cpu_max);
+	add_file(files, "/sys/fs/cgroup/kubepods/cpu.max", kubepods_cpu_max);
+	files.push_back(cpuinfo_mock_file { });
+
+	cpuinfo_mock_filesystem(files.data());
+	cpuinfo_mock_set_cpuid(cpuid_dump, sizeof(cpuid_dump) / sizeof(cpuinfo_mock_cpuid));
+	cpuinfo_initialize();
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <sched.h>
+
+#include <vector>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+
+/* Topology of the processor is checked in ryzen.cc together with other Ryzen processors */
+
+TEST(COPY, thresholds) {
+	cpuinfo_x86_copy_thresholds thresholds;
+	cpuinfo_x86_get_copy_thresholds(&thresholds);
+	ASSERT_EQ(2112, thresholds.rep_movsb_min_size);
+	ASSERT_EQ(1048576, thresholds.rep_movsb_max_size);
+	ASSERT_EQ(1572864, thresholds.non_temporal_min_size);
+	ASSERT_EQ(64, thresholds.cache_line_size);
+}
+
+TEST(COPY, strategy) {
+	ASSERT_EQ(cpuinfo_x86_copy_strategy_vector, cpuinfo_x86_get_copy_strategy(1024));
+	ASSERT_EQ(cpuinfo_x86_copy_strategy_rep_movsb, cpuinfo_x86_get_copy_strategy(65536));
+	ASSERT_EQ(cpuinfo_x86_copy_strategy_vector, cpuinfo_x86_get_copy_strategy(1048576));
+	ASSERT_EQ(cpuinfo_x86_copy_strategy_non_temporal, cpuinfo_x86_get_copy_strategy(2097152));
+}
+
+TEST(PLACEMENT, compact) {
+	const cpuinfo_processor* processors[4];
+	ASSERT_TRUE(cpuinfo_plan_placement(cpuinfo_placement_policy_compact, 4, processors));
+	for (uint32_t i = 0; i < 4; i++) {
+		ASSERT_EQ(cpuinfo_get_processor(i), processors[i]);
+	}
+}
+
+TEST(PLACEMENT, per_core) {
+	const cpuinfo_processor* processors[32];
+	ASSERT_TRUE(cpuinfo_plan_placement(cpuinfo_placement_policy_per_core, 32, processors));
+	for (uint32_t i = 0; i < 16; i++) {
+		ASSERT_EQ(cpuinfo_get_processor(2 * i), processors[i]);
+		ASSERT_EQ(cpuinfo_get_processor(2 * i + 1), processors[16 + i]);
+	}
+}
+
+TEST(PLACEMENT, per_llc) {
+	const cpuinfo_processor* processors[4];
+	ASSERT_TRUE(cpuinfo_plan_placement(cpuinfo_placement_policy_per_llc, 4, processors));
+	ASSERT_EQ(cpuinfo_get_processor(0), processors[0]);
+	ASSERT_EQ(cpuinfo_get_processor(16), processors[1]);
+	ASSERT_EQ(cpuinfo_get_processor(2), processors[2]);
+	ASSERT_EQ(cpuinfo_get_processor(18), processors[3]);
+}
+
+TEST(PLACEMENT, per_llc_cpusets) {
+	cpu_set_t cpusets[2];
+	ASSERT_TRUE(cpuinfo_plan_placement_cpusets(cpuinfo_placement_policy_per_llc, 2, NULL, sizeof(cpu_set_t), cpusets));
+	for (uint32_t i = 0; i < 2; i++) {
+		ASSERT_EQ(16, CPU_COUNT(&cpusets[i]));
+		for (uint32_t j = 0; j < 16; j++) {
+			const cpuinfo_processor* processor = cpuinfo_get_processor(16 * i + j);
+			ASSERT_TRUE(CPU_ISSET(processor->linux_id, &cpusets[i]));
+		}
+	}
+}
+
+TEST(PLACEMENT, per_core_cpusets) {
+	cpu_set_t cpusets[1];
+	ASSERT_TRUE(cpuinfo_plan_placement_cpusets(cpuinfo_placement_policy_per_core, 1, NULL, sizeof(cpu_set_t), cpusets));
+	ASSERT_EQ(2, CPU_COUNT(&cpusets[0]));
+	ASSERT_TRUE(CPU_ISSET(0, &cpusets[0]));
+	ASSERT_TRUE(CPU_ISSET(16, &cpusets[0]));
+}
+
+TEST(PLACEMENT, per_llc_dynamic_cpusets) {
+	const size_t cpuset_size = CPU_ALLOC_SIZE(32);
+	std::vector<char> cpusets(2 * cpuset_size);
+	ASSERT_TRUE(
+		cpuinfo_plan_placement_cpusets(cpuinfo_placement_policy_per_llc, 2, NULL, cpuset_size, cpusets.data()));
+	for (uint32_t i = 0; i < 2; i++) {
+		const cpu_set_t* cpuset = (const cpu_set_t*) &cpusets[i * cpuset_size];
+		ASSERT_EQ(16, CPU_COUNT_S(cpuset_size, cpuset));
+		for (uint32_t j = 0; j < 16; j++) {
+			const cpuinfo_processor* processor = cpuinfo_get_processor(16 * i + j);
+			ASSERT_TRUE(CPU_ISSET_S(processor->linux_id, cpuset_size, cpuset));
+		}
+	}
+}
+
+#include <ryzen-9-7950x.h>
+
+int main(int argc, char* argv[]) {
+	cpuinfo_mock_filesystem(filesystem);
+	cpuinfo_mock_set_cpuid(cpuid_dump, sizeof(cpuid_dump) / sizeof(cpuinfo_mock_cpuid));
+	cpuinfo_initialize();
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,741 @@
+struct cpuinfo_mock_cpuid cpuid_dump[] = {
+	{
+		.input_eax = 0x00000000,
+		.eax = 0x00000010,
+		.ebx = 0x68747541,
+		.ecx = 0x444D4163,
+		.edx = 0x69746E65,
+	},
+	{
+		.input_eax = 0x00000001,
+		.eax = 0x00A60F12,
+		.ebx = 0x00200800,
+		.ecx = 0x7EF8320B,
+		.edx = 0x178BFBFF,
+	},
+	{
+		.input_eax = 0x00000005,
+		.eax = 0x00000040,
+		.ebx = 0x00000040,
+		.ecx = 0x00000003,
+		.edx = 0x00000011,
+	},
+	{
+		.input_eax = 0x00000006,
+		.eax = 0x00000004,
+		.ebx = 0x00000000,
+		.ecx = 0x00000001,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000007,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000001,
+		.ebx = 0xF1BF97A9,
+		.ecx = 0x00405FCE,
+		.edx = 0x10000010,
+	},
+	{
+		.input_eax = 0x00000007,
+		.input_ecx = 0x00000001,
+		.eax = 0x00000020,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000001,
+		.ebx = 0x00000002,
+		.ecx = 0x00000100,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000001,
+		.eax = 0x00000005,
+		.ebx = 0x00000020,
+		.ecx = 0x00000201,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000002,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000002,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000207,
+		.ebx = 0x00000988,
+		.ecx = 0x00000988,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000000,
+		.eax = 0x80000028,
+		.ebx = 0x68747541,
+		.ecx = 0x444D4163,
+		.edx = 0x69746E65,
+	},
+	{
+		.input_eax = 0x80000001,
+		.eax = 0x00A60F12,
+		.ebx = 0x00000000,
+		.ecx = 0x75C237FF,
+		.edx = 0x2FD3FBFF,
+	},
+	{
+		.input_eax = 0x80000002,
+		.eax = 0x20444D41,
+		.ebx = 0x657A7952,
+		.ecx = 0x2039206E,
+		.edx = 0x30353937,
+	},
+	{
+		.input_eax = 0x80000003,
+		.eax = 0x36312058,
+		.ebx = 0x726F432D,
+		.ecx = 0x72502065,
+		.edx = 0x7365636F,
+	},
+	{
+		.input_eax = 0x80000004,
+		.eax = 0x00726F73,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000005,
+		.eax = 0xFF40FF40,
+		.ebx = 0xFF40FF40,
+		.ecx = 0x20080140,
+		.edx = 0x20080140,
+	},
+	{
+		.input_eax = 0x80000006,
+		.eax = 0x48006400,
+		.ebx = 0x68006400,
+		.ecx = 0x04006140,
+		.edx = 0x01009140,
+	},
+	{
+		.input_eax = 0x80000007,
+		.eax = 0x00000000,
+		.ebx = 0x0000003B,
+		.ecx = 0x00000000,
+		.edx = 0x00006799,
+	},
+	{
+		.input_eax = 0x80000008,
+		.eax = 0x00003030,
+		.ebx = 0x111EF657,
+		.ecx = 0x0000501F,
+		.edx = 0x00010000,
+	},
+	{
+		.input_eax = 0x8000001D,
+		.input_ecx = 0x00000000,
+		.eax = 0x00004121,
+		.ebx = 0x01C0003F,
+		.ecx = 0x0000003F,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x8000001D,
+		.input_ecx = 0x00000001,
+		.eax = 0x00004122,
+		.ebx = 0x01C0003F,
+		.ecx = 0x0000003F,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x8000001D,
+		.input_ecx = 0x00000002,
+		.eax = 0x00004143,
+		.ebx = 0x01C0003F,
+		.ecx = 0x000007FF,
+		.edx = 0x00000002,
+	},
+	{
+		.input_eax = 0x8000001D,
+		.input_ecx = 0x00000003,
+		.eax = 0x0003C163,
+		.ebx = 0x03C0003F,
+		.ecx = 0x00007FFF,
+		.edx = 0x00000001,
+	},
+	{
+		.input_eax = 0x8000001D,
+		.input_ecx = 0x00000004,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x8000001E,
+		.eax = 0x00000000,
+		.ebx = 0x00000100,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000026,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000001,
+		.ebx = 0x00000002,
+		.ecx = 0x00000100,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000026,
+		.input_ecx = 0x00000001,
+		.eax = 0x00000004,
+		.ebx = 0x00000010,
+		.ecx = 0x00000201,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000026,
+		.input_ecx = 0x00000002,
+		.eax = 0x00000004,
+		.ebx = 0x00000010,
+		.ecx = 0x00000302,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000026,
+		.input_ecx = 0x00000003,
+		.eax = 0x00000005,
+		.ebx = 0x00000020,
+		.ecx = 0x00000403,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000026,
+		.input_ecx = 0x00000004,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+};
+struct cpuinfo_mock_file filesystem[] = {
+	{
+		.path = "/proc/cpuinfo",
+		.size = 8334,
+		.content =
+			"processor\t: 0\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 0\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 0\n"
+			"initial apicid\t: 0\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 1\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 1\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 2\n"
+			"initial apicid\t: 2\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 2\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 2\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 4\n"
+			"initial apicid\t: 4\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 3\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 3\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 6\n"
+			"initial apicid\t: 6\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 4\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 4\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 8\n"
+			"initial apicid\t: 8\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 5\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 5\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 10\n"
+			"initial apicid\t: 10\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 6\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 6\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 12\n"
+			"initial apicid\t: 12\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 7\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 7\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 14\n"
+			"initial apicid\t: 14\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 8\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 8\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 16\n"
+			"initial apicid\t: 16\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 9\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 9\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 18\n"
+			"initial apicid\t: 18\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 10\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 10\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 20\n"
+			"initial apicid\t: 20\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 11\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 11\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 22\n"
+			"initial apicid\t: 22\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 12\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 12\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 24\n"
+			"initial apicid\t: 24\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 13\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 13\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 26\n"
+			"initial apicid\t: 26\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 14\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 14\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 28\n"
+			"initial apicid\t: 28\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 15\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 15\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 30\n"
+			"initial apicid\t: 30\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 16\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 0\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 1\n"
+			"initial apicid\t: 1\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 17\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 1\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 3\n"
+			"initial apicid\t: 3\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 18\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 2\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 5\n"
+			"initial apicid\t: 5\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 19\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 3\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 7\n"
+			"initial apicid\t: 7\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 20\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 4\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 9\n"
+			"initial apicid\t: 9\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 21\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 5\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 11\n"
+			"initial apicid\t: 11\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 22\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 6\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 13\n"
+			"initial apicid\t: 13\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 23\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 7\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 15\n"
+			"initial apicid\t: 15\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 24\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 8\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 17\n"
+			"initial apicid\t: 17\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 25\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 9\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 19\n"
+			"initial apicid\t: 19\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 26\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 10\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 21\n"
+			"initial apicid\t: 21\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 27\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 11\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 23\n"
+			"initial apicid\t: 23\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 28\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 12\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 25\n"
+			"initial apicid\t: 25\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 29\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 13\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 27\n"
+			"initial apicid\t: 27\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 30\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 14\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 29\n"
+			"initial apicid\t: 29\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 31\n"
+			"vendor_id\t: AuthenticAMD\n"
+			"cpu family\t: 25\n"
+			"model\t\t: 97\n"
+			"model name\t: AMD Ryzen 9 7950X 16-Core Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 32\n"
+			"core id\t\t: 15\n"
+			"cpu cores\t: 16\n"
+			"apicid\t\t: 31\n"
+			"initial apicid\t: 31\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/kernel_max",
+		.size = 4,
+		.content = "511\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/possible",
+		.size = 5,
+		.content = "0-31\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/present",
+		.size = 5,
+		.content = "0-31\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/online",
+		.size = 5,
+		.content = "0-31\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/offline",
+		.size = 1,
+		.content = "\n",
+	},
+	{ NULL },
+};
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <ostream>
+#include <string>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+
+/*
+ * Zen 2 has two 4-core CCXs per CCD, Zen 3 and Zen 4 have one 8-core CCX per CCD. These CPUID dumps are not captured
+ * on hardware: the signature, cache and topology leaves (1, 0xB, 0x8000001D, 0x8000001E, 0x80000026) hold the values
+ * documented in the AMD Processor Programming Reference of each family for the listed core counts.
+ */
+
+namespace ryzen_7_3700x {
+	#include <ryzen-7-3700x.h>
+}
+
+namespace ryzen_9_5900x {
+	#include <ryzen-9-5900x.h>
+}
+
+namespace ryzen_9_7950x {
+	#include <ryzen-9-7950x.h>
+}
+
+struct ryzen_processor {
+	const char* name;
+	cpuinfo_mock_cpuid* cpuid_dump;
+	size_t cpuid_dump_entries;
+	cpuinfo_mock_file* filesystem;
+	cpuinfo_uarch uarch;
+	uint32_t cores_count;
+	/* One cluster and one L3 cache per CCX */
+	uint32_t ccx_count;
+	/* One die per CCD */
+	uint32_t ccd_count;
+	uint32_t l2_size;
+	uint32_t l3_size;
+};
+
+static std::ostream& operator<<(std::ostream& stream, const ryzen_processor& processor) {
+	return stream << processor.name;
+}
+
+#define RYZEN_PROCESSOR(name) #name, name::cpuid_dump, sizeof(name::cpuid_dump) / sizeof(cpuinfo_mock_cpuid), name::filesystem
+
+static const ryzen_processor ryzen_processors[] = {
+	{ RYZEN_PROCESSOR(ryzen_7_3700x), cpuinfo_uarch_zen2,  8, 2, 1,  524288, 16777216 },
+	{ RYZEN_PROCESSOR(ryzen_9_5900x), cpuinfo_uarch_zen3, 12, 2, 2,  524288, 33554432 },
+	{ RYZEN_PROCESSOR(ryzen_9_7950x), cpuinfo_uarch_zen4, 16, 2, 2, 1048576, 33554432 },
+};
+
+class RYZEN : public ::testing::TestWithParam<ryzen_processor> {
+protected:
+	void SetUp() override {
+		cpuinfo_mock_filesystem(GetParam().filesystem);
+		cpuinfo_mock_set_cpuid(GetParam().cpuid_dump, GetParam().cpuid_dump_entries);
+		ASSERT_TRUE(cpuinfo_initialize());
+
+		cores_count = GetParam().cores_count;
+		processors_count = 2 * cores_count;
+		processors_per_ccx = processors_count / GetParam().ccx_count;
+		processors_per_ccd = processors_count / GetParam().ccd_count;
+		cores_per_ccx = cores_count / GetParam().ccx_count;
+		cores_per_ccd = cores_count / GetParam().ccd_count;
+	}
+
+	void TearDown() override {
+		cpuinfo_deinitialize();
+	}
+
+	uint32_t cores_count;
+	uint32_t processors_count;
+	uint32_t processors_per_ccx;
+	uint32_t processors_per_ccd;
+	uint32_t cores_per_ccx;
+	uint32_t cores_per_ccd;
+};
+
+TEST_P(RYZEN, processors) {
+	ASSERT_EQ(processors_count, cpuinfo_get_processors_count());
+	for (uint32_t i = 0; i < processors_count; i++) {
+		const cpuinfo_processor* processor = cpuinfo_get_processor(i);
+		ASSERT_EQ(i % 2, processor->smt_id);
+		ASSERT_EQ(i / 2 + (i % 2) * cores_count, processor->linux_id);
+		ASSERT_EQ(cpuinfo_get_core(i / 2), processor->core);
+		ASSERT_EQ(cpuinfo_get_cluster(i / processors_per_ccx), processor->cluster);
+		ASSERT_EQ(cpuinfo_get_die(i / processors_per_ccd), processor->die);
+		ASSERT_EQ(cpuinfo_get_package(0), processor->package);
+		ASSERT_EQ(cpuinfo_get_l2_cache(i / 2), processor->cache.l2);
+		ASSERT_EQ(cpuinfo_get_l3_cache(i / processors_per_ccx), processor->cache.l3);
+	}
+}
+
+TEST_P(RYZEN, cores) {
+	ASSERT_EQ(cores_count, cpuinfo_get_cores_count());
+	for (uint32_t i = 0; i < cores_count; i++) {
+		const cpuinfo_core* core = cpuinfo_get_core(i);
+		ASSERT_EQ(2, core->processor_count);
+		ASSERT_EQ(cpuinfo_get_die(i / cores_per_ccd), core->die);
+		ASSERT_EQ(cpuinfo_vendor_amd, core->vendor);
+		ASSERT_EQ(GetParam().uarch, core->uarch);
+	}
+}
+
+TEST_P(RYZEN, clusters) {
+	ASSERT_EQ(GetParam().ccx_count, cpuinfo_get_clusters_count());
+	for (uint32_t i = 0; i < GetParam().ccx_count; i++) {
+		ASSERT_EQ(cores_per_ccx, cpuinfo_get_cluster(i)->core_count);
+		ASSERT_EQ(processors_per_ccx, cpuinfo_get_cluster(i)->processor_count);
+	}
+}
+
+TEST_P(RYZEN, dies) {
+	ASSERT_EQ(GetParam().ccd_count, cpuinfo_get_dies_count());
+	for (uint32_t i = 0; i < GetParam().ccd_count; i++) {
+		const cpuinfo_die* die = cpuinfo_get_die(i);
+		ASSERT_EQ(i, die->die_id);
+		ASSERT_EQ(i * cores_per_ccd, die->core_start);
+		ASSERT_EQ(cores_per_ccd, die->core_count);
+		ASSERT_EQ(processors_per_ccd, die->processor_count);
+		ASSERT_EQ(cpuinfo_get_package(0), die->package);
+	}
+}
+
+TEST_P(RYZEN, packages) {
+	ASSERT_EQ(1, cpuinfo_get_packages_count());
+	const cpuinfo_package* package = cpuinfo_get_package(0);
+	ASSERT_EQ(GetParam().ccd_count, package->die_count);
+	ASSERT_EQ(GetParam().ccx_count, package->cluster_count);
+	ASSERT_EQ(cores_count, package->core_count);
+	ASSERT_EQ(processors_count, package->processor_count);
+}
+
+TEST_P(RYZEN, l2) {
+	ASSERT_EQ(cores_count, cpuinfo_get_l2_caches_count());
+	for (uint32_t i = 0; i < cores_count; i++) {
+		ASSERT_EQ(GetParam().l2_size, cpuinfo_get_l2_cache(i)->size);
+	}
+}
+
+TEST_P(RYZEN, l3) {
+	ASSERT_EQ(GetParam().ccx_count, cpuinfo_get_l3_caches_count());
+	for (uint32_t i = 0; i < GetParam().ccx_count; i++) {
+		ASSERT_EQ(GetParam().l3_size, cpuinfo_get_l3_cache(i)->size);
+		ASSERT_EQ(processors_per_ccx, cpuinfo_get_l3_cache(i)->processor_count);
+	}
+}
+
+INSTANTIATE_TEST_SUITE_P(MOCK, RYZEN, ::testing::ValuesIn(ryzen_processors),
+	[](const ::testing::TestParamInfo<ryzen_processor>& info) { return std::string(info.param.name); });
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+
+/* Topology of every logical processor detected from /proc/cpuinfo */
+struct processor_topology {
+	uint32_t apic_id;
+	int linux_id;
+	uint32_t smt_id;
+	uint32_t core_index;
+	uint32_t die_index;
+	uint32_t package_index;
+	uint32_t l3_index;
+};
+
+static std::vector<processor_topology> proc_cpuinfo_topology;
+
+static std::vector<processor_topology> get_processor_topology() {
+	std::vector<processor_topology> topology;
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		const cpuinfo_processor* processor = cpuinfo_get_processor(i);
+		topology.push_back(processor_topology {
+			processor->apic_id,
+			processor->linux_id,
+			processor->smt_id,
+			(uint32_t) (processor->core - cpuinfo_get_cores()),
+			(uint32_t) (processor->die - cpuinfo_get_dies()),
+			(uint32_t) (processor->package - cpuinfo_get_packages()),
+			(uint32_t) (processor->cache.l3 - cpuinfo_get_l3_caches()),
+		});
+	}
+	return topology;
+}
+
+#include <xeon-emerald-rapids-2s-numa.h>
+
+/*
+ * Topology files in /sys/devices/system/cpu/cpu<N>/topology of the 2-socket, 2-die guest. Processor N has APIC ID N,
+ * with the thread in bit 0, the core in bit 1, the die in bit 2, and the package in bit 3.
+ */
+enum sysfs_layout {
+	/* Linux 5.2-6.8: core_id is relative to the die, and die_id holds the die */
+	sysfs_layout_die_relative,
+	/* Linux 6.9+: core_id is relative to the package */
+	sysfs_layout_package_relative,
+	/* Die-relative core_id without die_id: the topology in sysfs is ambiguous, and /proc/cpuinfo is kept */
+	sysfs_layout_ambiguous,
+};
+
+/* Paths and contents of generated files, which must outlive the mock filesystem */
+static std::deque<std::string> strings;
+static std::vector<cpuinfo_mock_file> files;
+
+static void add_file(const std::string& path, const std::string& content) {
+	strings.push_back(path);
+	const char* path_string = strings.back().c_str();
+	strings.push_back(content);
+	const char* content_string = strings.back().c_str();
+
+	cpuinfo_mock_file file = { };
+	file.path = path_string;
+	file.size = content.size();
+	file.content = content_string;
+	files.push_back(file);
+}
+
+static void mock_sysfs_topology(sysfs_layout layout) {
+	files.clear();
+	strings.clear();
+	for (const cpuinfo_mock_file* file = filesystem; file->path != NULL; file++) {
+		if (layout == sysfs_layout_ambiguous || strcmp(file->path, "/proc/cpuinfo") != 0) {
+			files.push_back(*file);
+		}
+	}
+	for (uint32_t i = 0; i < 16; i++) {
+		const std::string topology = "/sys/devices/system/cpu/cpu" + std::to_string(i) + "/topology/";
+		const uint32_t core = (i >> 1) & 1;
+		const uint32_t die = (i >> 2) & 1;
+		add_file(topology + "physical_package_id", std::to_string(i >> 3) + "\n");
+		if (layout == sysfs_layout_package_relative) {
+			add_file(topology + "core_id", std::to_string(die << 1 | core) + "\n");
+		} else {
+			add_file(topology + "core_id", std::to_string(core) + "\n");
+		}
+		if (layout != sysfs_layout_ambiguous) {
+			add_file(topology + "die_id", std::to_string(die) + "\n");
+		}
+		add_file(topology + "thread_siblings_list", std::to_string(i & ~1u) + "-" + std::to_string(i | 1u) + "\n");
+	}
+	files.push_back(cpuinfo_mock_file { });
+	cpuinfo_mock_filesystem(files.data());
+}
+
+class SYSFS_TOPOLOGY : public ::testing::TestWithParam<sysfs_layout> {
+protected:
+	void SetUp() override {
+		mock_sysfs_topology(GetParam());
+		ASSERT_TRUE(cpuinfo_initialize());
+	}
+
+	void TearDown() override {
+		cpuinfo_deinitialize();
+	}
+};
+
+TEST_P(SYSFS_TOPOLOGY, count) {
+	ASSERT_EQ(16, cpuinfo_get_processors_count());
+	ASSERT_EQ(8, cpuinfo_get_cores_count());
+	ASSERT_EQ(4, cpuinfo_get_dies_count());
+	ASSERT_EQ(2, cpuinfo_get_packages_count());
+}
+
+TEST_P(SYSFS_TOPOLOGY, processors) {
+	const std::vector<processor_topology> topology = get_processor_topology();
+	ASSERT_EQ(proc_cpuinfo_topology.size(), topology.size());
+	for (size_t i = 0; i < topology.size(); i++) {
+		ASSERT_EQ(proc_cpuinfo_topology[i].apic_id, topology[i].apic_id);
+		ASSERT_EQ(proc_cpuinfo_topology[i].linux_id, topology[i].linux_id);
+		ASSERT_EQ(proc_cpuinfo_topology[i].smt_id, topology[i].smt_id);
+		ASSERT_EQ(proc_cpuinfo_topology[i].core_index, topology[i].core_index);
+		ASSERT_EQ(proc_cpuinfo_topology[i].die_index, topology[i].die_index);
+		ASSERT_EQ(proc_cpuinfo_topology[i].package_index, topology[i].package_index);
+		ASSERT_EQ(proc_cpuinfo_topology[i].l3_index, topology[i].l3_index);
+	}
+}
+
+INSTANTIATE_TEST_SUITE_P(MOCK, SYSFS_TOPOLOGY,
+	::testing::Values(sysfs_layout_die_relative, sysfs_layout_package_relative, sysfs_layout_ambiguous),
+	[](const ::testing::TestParamInfo<sysfs_layout>& info) {
+		switch (info.param) {
+			case sysfs_layout_die_relative:
+				return std::string("die_relative");
+			case sysfs_layout_package_relative:
+				return std::string("package_relative");
+			case sysfs_layout_ambiguous:
+				return std::string("ambiguous");
+		}
+		return std::string();
+	});
+
+int main(int argc, char* argv[]) {
+	cpuinfo_mock_filesystem(filesystem);
+	cpuinfo_mock_set_cpuid(cpuid_dump, sizeof(cpuid_dump) / sizeof(cpuinfo_mock_cpuid));
+	cpuinfo_initialize();
+	proc_cpuinfo_topology = get_processor_topology();
+	cpuinfo_deinitialize();
+
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
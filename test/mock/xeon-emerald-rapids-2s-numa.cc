@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+
+/*
+ * The CPUID dump of the Emerald Rapids VM with the topology leaves of a guest with 2 sockets, 2 dies per socket, 2 cores
+ * per die and 2 threads per core, and one NUMA node per die. Linux processor number equals the APIC ID.
+ */
+
+TEST(PROCESSORS, count) {
+	ASSERT_EQ(16, cpuinfo_get_processors_count());
+}
+
+TEST(PROCESSORS, node) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		const cpuinfo_processor* processor = cpuinfo_get_processor(i);
+		ASSERT_TRUE(processor->node);
+		ASSERT_EQ(processor->linux_id / 4, processor->node->node_id);
+	}
+}
+
+TEST(CORES, count) {
+	ASSERT_EQ(8, cpuinfo_get_cores_count());
+}
+
+TEST(CORES, node) {
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		const cpuinfo_core* core = cpuinfo_get_core(i);
+		ASSERT_TRUE(core->node);
+		ASSERT_EQ(core->node, cpuinfo_get_processor(core->processor_start)->node);
+	}
+}
+
+TEST(DIES, count) {
+	ASSERT_EQ(4, cpuinfo_get_dies_count());
+}
+
+TEST(PACKAGES, count) {
+	ASSERT_EQ(2, cpuinfo_get_packages_count());
+}
+
+TEST(NODES, count) {
+	ASSERT_EQ(4, cpuinfo_get_nodes_count());
+}
+
+TEST(NODES, node_id) {
+	for (uint32_t i = 0; i < cpuinfo_get_nodes_count(); i++) {
+		ASSERT_EQ(i, cpuinfo_get_node(i)->node_id);
+	}
+}
+
+TEST(NODES, processor_count) {
+	for (uint32_t i = 0; i < cpuinfo_get_nodes_count(); i++) {
+		ASSERT_EQ(4, cpuinfo_get_node(i)->processor_count);
+	}
+}
+
+TEST(NODES, core_count) {
+	for (uint32_t i = 0; i < cpuinfo_get_nodes_count(); i++) {
+		ASSERT_EQ(2, cpuinfo_get_node(i)->core_count);
+	}
+}
+
+TEST(NODES, distances) {
+	for (uint32_t i = 0; i < cpuinfo_get_nodes_count(); i++) {
+		const uint32_t* distances = cpuinfo_get_node(i)->distances;
+		for (uint32_t j = 0; j < cpuinfo_get_nodes_count(); j++) {
+			if (i == j) {
+				ASSERT_EQ(10, distances[j]);
+			} else if (i / 2 == j / 2) {
+				ASSERT_EQ(11, distances[j]);
+			} else {
+				ASSERT_EQ(21, distances[j]);
+			}
+		}
+	}
+}
+
+TEST(NODES, die) {
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		const cpuinfo_processor* processor = cpuinfo_get_processor(i);
+		ASSERT_EQ(processor->die - cpuinfo_get_dies(), processor->node - cpuinfo_get_nodes());
+	}
+}
+
+TEST(L3, count) {
+	ASSERT_EQ(4, cpuinfo_get_l3_caches_count());
+}
+
+#include <xeon-emerald-rapids-2s-numa.h>
+
+int main(int argc, char* argv[]) {
+	cpuinfo_mock_filesystem(filesystem);
+	cpuinfo_mock_set_cpuid(cpuid_dump, sizeof(cpuid_dump) / sizeof(cpuinfo_mock_cpuid));
+	cpuinfo_initialize();
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,699 @@
+struct cpuinfo_mock_cpuid cpuid_dump[] = {
+	{
+		.input_eax = 0x00000000,
+		.eax = 0x00000020,
+		.ebx = 0x756E6547,
+		.ecx = 0x6C65746E,
+		.edx = 0x49656E69,
+	},
+	{
+		.input_eax = 0x00000001,
+		.eax = 0x000C06F2,
+		.ebx = 0x00080800,
+		.ecx = 0xFFFA3203,
+		.edx = 0x1F8BFBFF,
+	},
+	{
+		.input_eax = 0x00000002,
+		.eax = 0x00FEFF01,
+		.ebx = 0x000000F0,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000003,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000000,
+		.eax = 0x0C004121,
+		.ebx = 0x02C0003F,
+		.ecx = 0x0000003F,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000001,
+		.eax = 0x0C004122,
+		.ebx = 0x01C0003F,
+		.ecx = 0x0000003F,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000002,
+		.eax = 0x0C004143,
+		.ebx = 0x03C0003F,
+		.ecx = 0x000007FF,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000004,
+		.input_ecx = 0x00000003,
+		.eax = 0x0C00C163,
+		.ebx = 0x04C0003F,
+		.ecx = 0x0003BFFF,
+		.edx = 0x00000004,
+	},
+	{
+		.input_eax = 0x00000005,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000006,
+		.eax = 0x00000004,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000007,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000002,
+		.ebx = 0xF1BF27EB,
+		.ecx = 0x1B415FDE,
+		.edx = 0xBFD14410,
+	},
+	{
+		.input_eax = 0x00000007,
+		.input_ecx = 0x00000001,
+		.eax = 0x00001C30,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000007,
+		.input_ecx = 0x00000002,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x0000001F,
+	},
+	{
+		.input_eax = 0x00000008,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000009,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000A,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000001,
+		.ebx = 0x00000002,
+		.ecx = 0x00000100,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000001,
+		.eax = 0x00000003,
+		.ebx = 0x00000008,
+		.ecx = 0x00000201,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000B,
+		.input_ecx = 0x00000002,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000002,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000C,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000D,
+		.eax = 0x000602E7,
+		.ebx = 0x00002B00,
+		.ecx = 0x00002B00,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000E,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000000F,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000010,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000011,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000013,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000014,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000015,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000016,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000017,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000018,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000019,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001A,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001B,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001C,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001D,
+		.eax = 0x00000001,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001E,
+		.eax = 0x00000000,
+		.ebx = 0x00004010,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001F,
+		.input_ecx = 0x00000000,
+		.eax = 0x00000001,
+		.ebx = 0x00000002,
+		.ecx = 0x00000100,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001F,
+		.input_ecx = 0x00000001,
+		.eax = 0x00000002,
+		.ebx = 0x00000004,
+		.ecx = 0x00000201,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001F,
+		.input_ecx = 0x00000002,
+		.eax = 0x00000003,
+		.ebx = 0x00000008,
+		.ecx = 0x00000502,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x0000001F,
+		.input_ecx = 0x00000003,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000003,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x00000020,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000000,
+		.eax = 0x80000008,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000001,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000121,
+		.edx = 0x2C100800,
+	},
+	{
+		.input_eax = 0x80000002,
+		.eax = 0x65746E49,
+		.ebx = 0x2952286C,
+		.ecx = 0x6F655820,
+		.edx = 0x2952286E,
+	},
+	{
+		.input_eax = 0x80000003,
+		.eax = 0x6F725020,
+		.ebx = 0x73736563,
+		.ecx = 0x0000726F,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000004,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000005,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000006,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x08007040,
+		.edx = 0x00000000,
+	},
+	{
+		.input_eax = 0x80000007,
+		.eax = 0x00000000,
+		.ebx = 0x00000000,
+		.ecx = 0x00000000,
+		.edx = 0x00000100,
+	},
+	{
+		.input_eax = 0x80000008,
+		.eax = 0x002E392E,
+		.ebx = 0x0100D200,
+		.ecx = 0x00000000,
+		.edx = 0x00000000,
+	},
+};
+
+struct cpuinfo_mock_file filesystem[] = {
+	{
+		.path = "/proc/cpuinfo",
+		.size = 3970,
+		.content =
+			"processor\t: 0\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 207\n"
+			"model name\t: Intel(R) Xeon(R) Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 8\n"
+			"core id\t\t: 0\n"
+			"cpu cores\t: 4\n"
+			"apicid\t\t: 0\n"
+			"initial apicid\t: 0\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 1\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 207\n"
+			"model name\t: Intel(R) Xeon(R) Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 8\n"
+			"core id\t\t: 0\n"
+			"cpu cores\t: 4\n"
+			"apicid\t\t: 1\n"
+			"initial apicid\t: 1\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 2\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 207\n"
+			"model name\t: Intel(R) Xeon(R) Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 8\n"
+			"core id\t\t: 1\n"
+			"cpu cores\t: 4\n"
+			"apicid\t\t: 2\n"
+			"initial apicid\t: 2\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 3\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 207\n"
+			"model name\t: Intel(R) Xeon(R) Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 8\n"
+			"core id\t\t: 1\n"
+			"cpu cores\t: 4\n"
+			"apicid\t\t: 3\n"
+			"initial apicid\t: 3\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 4\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 207\n"
+			"model name\t: Intel(R) Xeon(R) Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 8\n"
+			"core id\t\t: 2\n"
+			"cpu cores\t: 4\n"
+			"apicid\t\t: 4\n"
+			"initial apicid\t: 4\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 5\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 207\n"
+			"model name\t: Intel(R) Xeon(R) Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 8\n"
+			"core id\t\t: 2\n"
+			"cpu cores\t: 4\n"
+			"apicid\t\t: 5\n"
+			"initial apicid\t: 5\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 6\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 207\n"
+			"model name\t: Intel(R) Xeon(R) Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 8\n"
+			"core id\t\t: 3\n"
+			"cpu cores\t: 4\n"
+			"apicid\t\t: 6\n"
+			"initial apicid\t: 6\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 7\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 207\n"
+			"model name\t: Intel(R) Xeon(R) Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 0\n"
+			"siblings\t: 8\n"
+			"core id\t\t: 3\n"
+			"cpu cores\t: 4\n"
+			"apicid\t\t: 7\n"
+			"initial apicid\t: 7\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 8\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 207\n"
+			"model name\t: Intel(R) Xeon(R) Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 1\n"
+			"siblings\t: 8\n"
+			"core id\t\t: 0\n"
+			"cpu cores\t: 4\n"
+			"apicid\t\t: 8\n"
+			"initial apicid\t: 8\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 9\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 207\n"
+			"model name\t: Intel(R) Xeon(R) Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 1\n"
+			"siblings\t: 8\n"
+			"core id\t\t: 0\n"
+			"cpu cores\t: 4\n"
+			"apicid\t\t: 9\n"
+			"initial apicid\t: 9\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 10\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 207\n"
+			"model name\t: Intel(R) Xeon(R) Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 1\n"
+			"siblings\t: 8\n"
+			"core id\t\t: 1\n"
+			"cpu cores\t: 4\n"
+			"apicid\t\t: 10\n"
+			"initial apicid\t: 10\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 11\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 207\n"
+			"model name\t: Intel(R) Xeon(R) Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 1\n"
+			"siblings\t: 8\n"
+			"core id\t\t: 1\n"
+			"cpu cores\t: 4\n"
+			"apicid\t\t: 11\n"
+			"initial apicid\t: 11\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 12\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 207\n"
+			"model name\t: Intel(R) Xeon(R) Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 1\n"
+			"siblings\t: 8\n"
+			"core id\t\t: 2\n"
+			"cpu cores\t: 4\n"
+			"apicid\t\t: 12\n"
+			"initial apicid\t: 12\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 13\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 207\n"
+			"model name\t: Intel(R) Xeon(R) Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 1\n"
+			"siblings\t: 8\n"
+			"core id\t\t: 2\n"
+			"cpu cores\t: 4\n"
+			"apicid\t\t: 13\n"
+			"initial apicid\t: 13\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 14\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 207\n"
+			"model name\t: Intel(R) Xeon(R) Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 1\n"
+			"siblings\t: 8\n"
+			"core id\t\t: 3\n"
+			"cpu cores\t: 4\n"
+			"apicid\t\t: 14\n"
+			"initial apicid\t: 14\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n"
+			"processor\t: 15\n"
+			"vendor_id\t: GenuineIntel\n"
+			"cpu family\t: 6\n"
+			"model\t\t: 207\n"
+			"model name\t: Intel(R) Xeon(R) Processor\n"
+			"stepping\t: 2\n"
+			"physical id\t: 1\n"
+			"siblings\t: 8\n"
+			"core id\t\t: 3\n"
+			"cpu cores\t: 4\n"
+			"apicid\t\t: 15\n"
+			"initial apicid\t: 15\n"
+			"clflush size\t: 64\n"
+			"cache_alignment\t: 64\n"
+			"\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/kernel_max",
+		.size = 5,
+		.content = "8191\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/possible",
+		.size = 5,
+		.content = "0-15\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/present",
+		.size = 5,
+		.content = "0-15\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/online",
+		.size = 5,
+		.content = "0-15\n",
+	},
+	{
+		.path = "/sys/devices/system/cpu/offline",
+		.size = 1,
+		.content = "\n",
+	},
+	{
+		.path = "/sys/devices/system/node/online",
+		.size = 4,
+		.content = "0-3\n",
+	},
+	{
+		.path = "/sys/devices/system/node/possible",
+		.size = 4,
+		.content = "0-3\n",
+	},
+	{
+		.path = "/sys/devices/system/node/node0/cpulist",
+		.size = 4,
+		.content = "0-3\n",
+	},
+	{
+		.path = "/sys/devices/system/node/node0/distance",
+		.size = 12,
+		.content = "10 11 21 21\n",
+	},
+	{
+		.path = "/sys/devices/system/node/node1/cpulist",
+		.size = 4,
+		.content = "4-7\n",
+	},
+	{
+		.path = "/sys/devices/system/node/node1/distance",
+		.size = 12,
+		.content = "11 10 21 21\n",
+	},
+	{
+		.path = "/sys/devices/system/node/node2/cpulist",
+		.size = 5,
+		.content = "8-11\n",
+	},
+	{
+		.path = "/sys/devices/system/node/node2/distance",
+		.size = 12,
+		.content = "21 21 10 11\n",
+	},
+	{
+		.path = "/sys/devices/system/node/node3/cpulist",
+		.size = 6,
+		.content = "12-15\n",
+	},
+	{
+		.path = "/sys/devices/system/node/node3/distance",
+		.size = 12,
+		.content = "21 21 11 10\n",
+	},
+	{ NULL },
+};
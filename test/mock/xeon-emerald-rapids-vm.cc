@@ -0,0 +1,301 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <cpuinfo.h>
+#include <cpuinfo-mock.h>
+
+
+TEST(PROCESSORS, count) {
+	ASSERT_EQ(1, cpuinfo_get_processors_count());
+}
+
+TEST(PROCESSORS, vendor) {
+	ASSERT_EQ(cpuinfo_vendor_intel, cpuinfo_get_processor(0)->core->vendor);
+}
+
+TEST(PROCESSORS, uarch) {
+	ASSERT_EQ(cpuinfo_uarch_golden_cove, cpuinfo_get_processor(0)->core->uarch);
+}
+
+TEST(ISA, avx512f) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx512f());
+}
+
+TEST(ISA, avx512bf16) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx512bf16());
+}
+
+TEST(ISA, avx512fp16) {
+	ASSERT_TRUE(cpuinfo_has_x86_avx512fp16());
+}
+
+TEST(ISA, avxvnni) {
+	ASSERT_TRUE(cpuinfo_has_x86_avxvnni());
+}
+
+TEST(ISA, avxvnniint8) {
+	ASSERT_FALSE(cpuinfo_has_x86_avxvnniint8());
+}
+
+#if CPUINFO_ARCH_X86_64
+TEST(ISA, amx_tile) {
+	ASSERT_TRUE(cpuinfo_has_x86_amx_tile());
+}
+
+TEST(ISA, amx_int8) {
+	ASSERT_TRUE(cpuinfo_has_x86_amx_int8());
+}
+
+TEST(ISA, amx_bf16) {
+	ASSERT_TRUE(cpuinfo_has_x86_amx_bf16());
+}
+
+TEST(ISA, amx_fp16) {
+	ASSERT_FALSE(cpuinfo_has_x86_amx_fp16());
+}
+#endif /* CPUINFO_ARCH_X86_64 */
+
+TEST(ISA, waitpkg) {
+	ASSERT_FALSE(cpuinfo_has_x86_waitpkg());
+	ASSERT_EQ(0, cpuinfo_get_x86_umwait_max_time());
+}
+
+TEST(ISA, prefetchi) {
+	ASSERT_FALSE(cpuinfo_has_x86_prefetchi());
+}
+
+TEST(ISA, erms) {
+	ASSERT_TRUE(cpuinfo_has_x86_erms());
+}
+
+TEST(ISA, fsrm) {
+	ASSERT_TRUE(cpuinfo_has_x86_fsrm());
+}
+
+TEST(ISA, fzlrm) {
+	ASSERT_TRUE(cpuinfo_has_x86_fzlrm());
+}
+
+TEST(ISA, fsrs) {
+	ASSERT_TRUE(cpuinfo_has_x86_fsrs());
+}
+
+TEST(ISA, fsrc) {
+	ASSERT_TRUE(cpuinfo_has_x86_fsrc());
+}
+
+TEST(ISA, movdiri) {
+	ASSERT_TRUE(cpuinfo_has_x86_movdiri());
+}
+
+TEST(ISA, movdir64b) {
+	ASSERT_TRUE(cpuinfo_has_x86_movdir64b());
+}
+
+TEST(ISA, enqcmd) {
+	ASSERT_FALSE(cpuinfo_has_x86_enqcmd());
+}
+
+TEST(ISA, cldemote) {
+	ASSERT_TRUE(cpuinfo_has_x86_cldemote());
+}
+
+TEST(ISA, serialize) {
+	ASSERT_TRUE(cpuinfo_has_x86_serialize());
+}
+
+TEST(ISA, avx10_version) {
+	ASSERT_EQ(0, cpuinfo_get_x86_avx10_version());
+}
+
+TEST(ISA, avx10_max_vector_bits) {
+	ASSERT_EQ(0, cpuinfo_get_x86_avx10_max_vector_bits());
+}
+
+TEST(ISA, apx) {
+	ASSERT_FALSE(cpuinfo_has_x86_apx());
+}
+
+TEST(COPY, thresholds) {
+	cpuinfo_x86_copy_thresholds thresholds;
+	cpuinfo_x86_get_copy_thresholds(&thresholds);
+	ASSERT_EQ(2112, thresholds.rep_movsb_min_size);
+	ASSERT_EQ(235929600, thresholds.rep_movsb_max_size);
+	ASSERT_EQ(235929600, thresholds.non_temporal_min_size);
+	ASSERT_EQ(64, thresholds.cache_line_size);
+}
+
+TEST(COPY, strategy) {
+	ASSERT_EQ(cpuinfo_x86_copy_strategy_vector, cpuinfo_x86_get_copy_strategy(1024));
+	ASSERT_EQ(cpuinfo_x86_copy_strategy_rep_movsb, cpuinfo_x86_get_copy_strategy(65536));
+	ASSERT_EQ(cpuinfo_x86_copy_strategy_rep_movsb, cpuinfo_x86_get_copy_strategy(134217728));
+	ASSERT_EQ(cpuinfo_x86_copy_strategy_non_temporal, cpuinfo_x86_get_copy_strategy(268435456));
+}
+
+#include <xeon-emerald-rapids-vm.h>
+
+/*
+ * AVX10 and APX are not supported on Emerald Rapids, so their detection is checked on copies of the CPUID dump
+ * patched as newer Xeon processors report these extensions.
+ */
+class PatchedCPUID : public ::testing::Test {
+protected:
+	void SetUp() override {
+		dump.assign(cpuid_dump, cpuid_dump + sizeof(cpuid_dump) / sizeof(cpuinfo_mock_cpuid));
+	}
+
+	void TearDown() override {
+		cpuinfo_deinitialize();
+		cpuinfo_mock_filesystem(filesystem);
+		cpuinfo_mock_set_cpuid(cpuid_dump, sizeof(cpuid_dump) / sizeof(cpuinfo_mock_cpuid));
+		cpuinfo_mock_set_xcr0(xcr0);
+		cpuinfo_initialize();
+	}
+
+	cpuinfo_mock_cpuid& leaf(uint32_t eax, uint32_t ecx) {
+		for (cpuinfo_mock_cpuid& entry : dump) {
+			if (entry.input_eax == eax && entry.input_ecx == ecx) {
+				return entry;
+			}
+		}
+		cpuinfo_mock_cpuid entry = { };
+		entry.input_eax = eax;
+		entry.input_ecx = ecx;
+		dump.push_back(entry);
+		if (leaf(0, 0).eax < eax) {
+			leaf(0, 0).eax = eax;
+		}
+		return leaf(eax, ecx);
+	}
+
+	void add_avx10(uint32_t avx10_info) {
+		leaf(7, 1).edx |= UINT32_C(0x00080000);
+		leaf(0x24, 0).ebx = avx10_info;
+	}
+
+	void reinitialize() {
+		cpuinfo_deinitialize();
+		cpuinfo_mock_set_cpuid(dump.data(), dump.size());
+		cpuinfo_initialize();
+	}
+
+	/* XCR0 with x87, SSE, AVX, AVX-512 and AMX state components enabled */
+	static const uint64_t xcr0 = UINT64_C(0x00000000000602E7);
+
+	std::vector<cpuinfo_mock_cpuid> dump;
+};
+
+TEST_F(PatchedCPUID, avx10_1_512) {
+	add_avx10(UINT32_C(0x00070001));
+	reinitialize();
+	ASSERT_EQ(1, cpuinfo_get_x86_avx10_version());
+	ASSERT_EQ(512, cpuinfo_get_x86_avx10_max_vector_bits());
+}
+
+TEST_F(PatchedCPUID, avx10_2_512) {
+	add_avx10(UINT32_C(0x00070002));
+	reinitialize();
+	ASSERT_EQ(2, cpuinfo_get_x86_avx10_version());
+	ASSERT_EQ(512, cpuinfo_get_x86_avx10_max_vector_bits());
+}
+
+TEST_F(PatchedCPUID, avx10_1_256) {
+	add_avx10(UINT32_C(0x00030001));
+	reinitialize();
+	ASSERT_EQ(1, cpuinfo_get_x86_avx10_version());
+	ASSERT_EQ(256, cpuinfo_get_x86_avx10_max_vector_bits());
+}
+
+TEST_F(PatchedCPUID, avx10_without_leaf) {
+	leaf(7, 1).edx |= UINT32_C(0x00080000);
+	reinitialize();
+	ASSERT_EQ(0, cpuinfo_get_x86_avx10_version());
+	ASSERT_EQ(0, cpuinfo_get_x86_avx10_max_vector_bits());
+}
+
+TEST_F(PatchedCPUID, avx10_disabled_by_os) {
+	add_avx10(UINT32_C(0x00070001));
+	/* Opmask and upper zmm state components are disabled */
+	cpuinfo_mock_set_xcr0(xcr0 & ~UINT64_C(0x00000000000000E0));
+	reinitialize();
+	ASSERT_FALSE(cpuinfo_has_x86_avx512f());
+	ASSERT_EQ(0, cpuinfo_get_x86_avx10_version());
+	ASSERT_EQ(0, cpuinfo_get_x86_avx10_max_vector_bits());
+}
+
+TEST_F(PatchedCPUID, copy_without_erms) {
+	leaf(7, 0).ebx &= ~UINT32_C(0x00000200);
+	reinitialize();
+	cpuinfo_x86_copy_thresholds thresholds;
+	cpuinfo_x86_get_copy_thresholds(&thresholds);
+	ASSERT_EQ(SIZE_MAX, thresholds.rep_movsb_min_size);
+	ASSERT_EQ(cpuinfo_x86_copy_strategy_vector, cpuinfo_x86_get_copy_strategy(65536));
+}
+
+TEST_F(PatchedCPUID, copy_without_fsrm) {
+	leaf(7, 0).edx &= ~UINT32_C(0x00000010);
+	reinitialize();
+	cpuinfo_x86_copy_thresholds thresholds;
+	cpuinfo_x86_get_copy_thresholds(&thresholds);
+	ASSERT_EQ(8192, thresholds.rep_movsb_min_size);
+	ASSERT_EQ(cpuinfo_x86_copy_strategy_vector, cpuinfo_x86_get_copy_strategy(4096));
+}
+
+TEST_F(PatchedCPUID, waitpkg) {
+	leaf(7, 0).ecx |= UINT32_C(0x00000020);
+	std::vector<cpuinfo_mock_file> files;
+	for (const cpuinfo_mock_file* file = filesystem; file->path != NULL; file++) {
+		files.push_back(*file);
+	}
+	files.push_back(cpuinfo_mock_file { "/sys/devices/system/cpu/umwait_control/max_time", 7, "100000\n", 0 });
+	files.push_back(cpuinfo_mock_file { "/sys/devices/system/cpu/umwait_control/enable_c02", 2, "1\n", 0 });
+	files.push_back(cpuinfo_mock_file { });
+	cpuinfo_mock_filesystem(files.data());
+	reinitialize();
+	ASSERT_TRUE(cpuinfo_has_x86_waitpkg());
+	ASSERT_EQ(100000, cpuinfo_get_x86_umwait_max_time());
+}
+
+TEST_F(PatchedCPUID, waitpkg_isa_only) {
+	leaf(7, 0).ecx |= UINT32_C(0x00000020);
+	std::vector<cpuinfo_mock_file> files;
+	for (const cpuinfo_mock_file* file = filesystem; file->path != NULL; file++) {
+		files.push_back(*file);
+	}
+	files.push_back(cpuinfo_mock_file { "/sys/devices/system/cpu/umwait_control/max_time", 7, "100000\n", 0 });
+	files.push_back(cpuinfo_mock_file { "/sys/devices/system/cpu/umwait_control/enable_c02", 2, "1\n", 0 });
+	files.push_back(cpuinfo_mock_file { });
+	cpuinfo_mock_filesystem(files.data());
+	cpuinfo_deinitialize();
+	cpuinfo_mock_set_cpuid(dump.data(), dump.size());
+	ASSERT_TRUE(cpuinfo_initialize_ex(CPUINFO_INITIALIZE_ISA));
+	ASSERT_TRUE(cpuinfo_has_x86_waitpkg());
+	ASSERT_EQ(100000, cpuinfo_get_x86_umwait_max_time());
+}
+
+#if CPUINFO_ARCH_X86_64
+TEST_F(PatchedCPUID, apx) {
+	leaf(7, 1).edx |= UINT32_C(0x00200000);
+	leaf(0xD, 0).eax |= UINT32_C(0x00080000);
+	cpuinfo_mock_set_xcr0(xcr0 | UINT64_C(0x0000000000080000));
+	reinitialize();
+	ASSERT_TRUE(cpuinfo_has_x86_apx());
+}
+
+TEST_F(PatchedCPUID, apx_disabled_by_os) {
+	leaf(7, 1).edx |= UINT32_C(0x00200000);
+	leaf(0xD, 0).eax |= UINT32_C(0x00080000);
+	cpuinfo_mock_set_xcr0(xcr0);
+	reinitialize();
+	ASSERT_FALSE(cpuinfo_has_x86_apx());
+}
+#endif /* CPUINFO_ARCH_X86_64 */
+
+int main(int argc, char* argv[]) {
+	cpuinfo_mock_filesystem(filesystem);
+	cpuinfo_mock_set_cpuid(cpuid_dump, sizeof(cpuid_dump) / sizeof(cpuinfo_mock_cpuid));
+	cpuinfo_initialize();
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <cpuinfo.h>
+
+
+#if defined(__linux__) && defined(__GNUC__) && (CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 || CPUINFO_ARCH_ARM64)
+	#define TEST_IFUNC 1
+
+	static bool has_fast_kernel(void) {
+	#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+		return cpuinfo_has_x86_avx2();
+	#else
+		return cpuinfo_has_arm_neon_dot();
+	#endif
+	}
+
+	static int fast_kernel(void) {
+		return 2;
+	}
+
+	static int generic_kernel(void) {
+		return 1;
+	}
+
+	/* Runs during relocation of the executable, before cpuinfo_initialize can be called */
+	extern "C" int (*resolve_kernel(void))(void) {
+		if (!cpuinfo_probe_isa()) {
+			return generic_kernel;
+		}
+		return has_fast_kernel() ? fast_kernel : generic_kernel;
+	}
+
+	extern "C" int kernel(void) __attribute__((__ifunc__("resolve_kernel")));
+#endif
+
+/* Must run before other tests initialize cpuinfo */
+TEST(PROBE_ISA, matches_initialize) {
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	ASSERT_TRUE(cpuinfo_probe_isa());
+	const bool sse2 = cpuinfo_has_x86_sse2();
+	const bool avx = cpuinfo_has_x86_avx();
+	const bool avx2 = cpuinfo_has_x86_avx2();
+	const bool fma3 = cpuinfo_has_x86_fma3();
+	const bool bmi2 = cpuinfo_has_x86_bmi2();
+	const bool avx512f = cpuinfo_has_x86_avx512f();
+	const bool avx512bw = cpuinfo_has_x86_avx512bw();
+	const bool amx_tile = cpuinfo_has_x86_amx_tile();
+	const bool erms = cpuinfo_has_x86_erms();
+	const bool waitpkg = cpuinfo_has_x86_waitpkg();
+	const uint32_t avx10_version = cpuinfo_get_x86_avx10_version();
+
+	ASSERT_TRUE(cpuinfo_initialize());
+	EXPECT_EQ(cpuinfo_has_x86_sse2(), sse2);
+	EXPECT_EQ(cpuinfo_has_x86_avx(), avx);
+	EXPECT_EQ(cpuinfo_has_x86_avx2(), avx2);
+	EXPECT_EQ(cpuinfo_has_x86_fma3(), fma3);
+	EXPECT_EQ(cpuinfo_has_x86_bmi2(), bmi2);
+	EXPECT_EQ(cpuinfo_has_x86_avx512f(), avx512f);
+	EXPECT_EQ(cpuinfo_has_x86_avx512bw(), avx512bw);
+	EXPECT_EQ(cpuinfo_has_x86_amx_tile(), amx_tile);
+	EXPECT_EQ(cpuinfo_has_x86_erms(), erms);
+	EXPECT_EQ(cpuinfo_has_x86_waitpkg(), waitpkg);
+	EXPECT_EQ(cpuinfo_get_x86_avx10_version(), avx10_version);
+#elif CPUINFO_ARCH_ARM64 && defined(__linux__)
+	ASSERT_TRUE(cpuinfo_probe_isa());
+	const bool aes = cpuinfo_has_arm_aes();
+	const bool crc32 = cpuinfo_has_arm_crc32();
+	const bool atomics = cpuinfo_has_arm_atomics();
+	const bool sve = cpuinfo_has_arm_sve();
+	const bool sve2 = cpuinfo_has_arm_sve2();
+	const bool sme = cpuinfo_has_arm_sme();
+
+	ASSERT_TRUE(cpuinfo_initialize());
+	EXPECT_EQ(cpuinfo_has_arm_aes(), aes);
+	EXPECT_EQ(cpuinfo_has_arm_crc32(), crc32);
+	EXPECT_EQ(cpuinfo_has_arm_atomics(), atomics);
+	EXPECT_EQ(cpuinfo_has_arm_sve(), sve);
+	EXPECT_EQ(cpuinfo_has_arm_sve2(), sve2);
+	EXPECT_EQ(cpuinfo_has_arm_sme(), sme);
+#else
+	GTEST_SKIP();
+#endif
+}
+
+TEST(PROBE_ISA, keeps_initialized_isa) {
+	ASSERT_TRUE(cpuinfo_initialize());
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+	const bool amx_permitted = cpuinfo_isa.amx_permitted;
+	ASSERT_TRUE(cpuinfo_probe_isa());
+	EXPECT_EQ(cpuinfo_isa.amx_permitted, amx_permitted);
+#elif CPUINFO_ARCH_ARM64 && defined(__linux__)
+	const uint32_t svelen = cpuinfo_isa.svelen;
+	ASSERT_TRUE(cpuinfo_probe_isa());
+	EXPECT_EQ(cpuinfo_isa.svelen, svelen);
+#endif
+}
+
+#if TEST_IFUNC
+	TEST(PROBE_ISA, ifunc_resolver) {
+		ASSERT_TRUE(cpuinfo_initialize());
+		EXPECT_EQ(has_fast_kernel() ? 2 : 1, kernel());
+	}
+#endif
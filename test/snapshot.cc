@@ -0,0 +1,238 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include <cpuinfo.h>
+
+
+/*
+ * Every initialization in these tests runs in a child process, so that snapshots are loaded by a process which did not
+ * detect the topology itself, as in the intended use. The parent process never initializes cpuinfo.
+ */
+
+/* Runs the function in a child process, passes its output through a pipe, and returns its exit status */
+static int run_in_child(const std::function<int(std::string&)>& function, std::string& output) {
+	int pipe_fds[2];
+	if (pipe(pipe_fds) != 0) {
+		return -1;
+	}
+	const pid_t pid = fork();
+	if (pid == 0) {
+		close(pipe_fds[0]);
+		std::string child_output;
+		const int status = function(child_output);
+		size_t bytes_written = 0;
+		while (bytes_written < child_output.size()) {
+			const ssize_t chunk_size = write(pipe_fds[1], child_output.data() + bytes_written, child_output.size() - bytes_written);
+			if (chunk_size <= 0) {
+				_exit(127);
+			}
+			bytes_written += static_cast<size_t>(chunk_size);
+		}
+		_exit(status);
+	}
+	close(pipe_fds[1]);
+	output.clear();
+	char buffer[4096];
+	ssize_t chunk_size;
+	while ((chunk_size = read(pipe_fds[0], buffer, sizeof(buffer))) > 0) {
+		output.append(buffer, static_cast<size_t>(chunk_size));
+	}
+	close(pipe_fds[0]);
+
+	int status = 0;
+	if (pid < 0 || waitpid(pid, &status, 0) != pid || !WIFEXITED(status)) {
+		return -1;
+	}
+	return WEXITSTATUS(status);
+}
+
+/* Describes the topology through the public API, so that topologies from different processes can be compared */
+static std::string describe_topology() {
+	std::ostringstream description;
+	const struct cpuinfo_core* cores = cpuinfo_get_cores();
+	const struct cpuinfo_cluster* clusters = cpuinfo_get_clusters();
+	const struct cpuinfo_package* packages = cpuinfo_get_packages();
+	for (uint32_t i = 0; i < cpuinfo_get_processors_count(); i++) {
+		const struct cpuinfo_processor* processor = cpuinfo_get_processor(i);
+		description << "processor " << i << ": smt " << processor->smt_id
+			<< " core " << (processor->core - cores)
+			<< " cluster " << (processor->cluster - clusters)
+			<< " package " << (processor->package - packages)
+			<< " linux " << processor->linux_id;
+		const struct cpuinfo_cache* caches[] = {
+			processor->cache.l1i, processor->cache.l1d, processor->cache.l2, processor->cache.l3, processor->cache.l4,
+		};
+		for (const struct cpuinfo_cache* cache : caches) {
+			if (cache != nullptr) {
+				description << " cache " << cache->size << "/" << cache->associativity << "/" << cache->line_size
+					<< "/" << cache->processor_start << "+" << cache->processor_count;
+			}
+		}
+		description << "\n";
+	}
+	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
+		const struct cpuinfo_core* core = cpuinfo_get_core(i);
+		description << "core " << i << ": processors " << core->processor_start << "+" << core->processor_count
+			<< " id " << core->core_id << " cluster " << (core->cluster - clusters)
+			<< " vendor " << core->vendor << " uarch " << core->uarch << " frequency " << core->frequency << "\n";
+	}
+	for (uint32_t i = 0; i < cpuinfo_get_packages_count(); i++) {
+		const struct cpuinfo_package* package = cpuinfo_get_package(i);
+		description << "package " << i << ": " << package->name << " processors " << package->processor_start
+			<< "+" << package->processor_count << " cores " << package->core_start << "+" << package->core_count << "\n";
+	}
+	for (uint32_t i = 0; i < cpuinfo_get_uarchs_count(); i++) {
+		const struct cpuinfo_uarch_info* uarch_info = cpuinfo_get_uarch(i);
+		description << "uarch " << i << ": " << uarch_info->uarch << " processors " << uarch_info->processor_count
+			<< " cores " << uarch_info->core_count << "\n";
+	}
+	description << "clusters " << cpuinfo_get_clusters_count() << " dies " << cpuinfo_get_dies_count()
+		<< " nodes " << cpuinfo_get_nodes_count() << " max cache " << cpuinfo_get_max_cache_size() << "\n";
+	return description.str();
+}
+
+/* Checks whether the file is mapped into the address space of the calling process */
+static bool is_mapped(const std::string& path) {
+	std::ifstream maps("/proc/self/maps");
+	std::string line;
+	while (std::getline(maps, line)) {
+		if (line.size() >= path.size() && line.compare(line.size() - path.size(), path.size(), path) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+class SNAPSHOT : public testing::Test {
+protected:
+	void SetUp() override {
+		path = testing::TempDir() + "cpuinfo-snapshot-" + std::to_string(getpid()) + "-" +
+			testing::UnitTest::GetInstance()->current_test_info()->name();
+		std::remove(path.c_str());
+	}
+
+	void TearDown() override {
+		std::remove(path.c_str());
+	}
+
+	bool file_exists() const {
+		return access(path.c_str(), F_OK) == 0;
+	}
+
+	std::string path;
+};
+
+TEST_F(SNAPSHOT, save_and_load) {
+	std::string detected_topology;
+	ASSERT_EQ(0, run_in_child([this](std::string& output) {
+		if (!cpuinfo_initialize() || !cpuinfo_save_snapshot(path.c_str())) {
+			return 1;
+		}
+		output = describe_topology();
+		return 0;
+	}, detected_topology));
+	ASSERT_TRUE(file_exists());
+
+	std::string loaded_topology;
+	ASSERT_EQ(0, run_in_child([this](std::string& output) {
+		if (!cpuinfo_initialize_from_snapshot(path.c_str())) {
+			return 1;
+		}
+		if (!is_mapped(path)) {
+			return 2;
+		}
+		output = describe_topology();
+		return 0;
+	}, loaded_topology));
+	EXPECT_EQ(detected_topology, loaded_topology);
+}
+
+TEST_F(SNAPSHOT, missing_file) {
+	std::string topology;
+	ASSERT_EQ(0, run_in_child([this](std::string&) {
+		if (!cpuinfo_initialize_from_snapshot(path.c_str())) {
+			return 1;
+		}
+		/* Detection initializes cpuinfo and writes a new snapshot */
+		return is_mapped(path) ? 2 : 0;
+	}, topology));
+	EXPECT_TRUE(file_exists());
+
+	ASSERT_EQ(0, run_in_child([this](std::string&) {
+		return cpuinfo_initialize_from_snapshot(path.c_str()) && is_mapped(path) ? 0 : 1;
+	}, topology));
+}
+
+TEST_F(SNAPSHOT, corrupted_file) {
+	std::string topology;
+	ASSERT_EQ(0, run_in_child([this](std::string&) {
+		return cpuinfo_initialize() && cpuinfo_save_snapshot(path.c_str()) ? 0 : 1;
+	}, topology));
+
+	/* Overwrite the header, which includes the signature of the system */
+	FILE* file = std::fopen(path.c_str(), "r+b");
+	ASSERT_NE(file, nullptr);
+	const char garbage[64] = { 1 };
+	ASSERT_EQ(sizeof(garbage), std::fwrite(garbage, 1, sizeof(garbage), file));
+	ASSERT_EQ(0, std::fclose(file));
+
+	/* The snapshot is ignored, and replaced after detection */
+	ASSERT_EQ(0, run_in_child([this](std::string&) {
+		return cpuinfo_initialize_from_snapshot(path.c_str()) && !is_mapped(path) ? 0 : 1;
+	}, topology));
+	ASSERT_EQ(0, run_in_child([this](std::string&) {
+		return cpuinfo_initialize_from_snapshot(path.c_str()) && is_mapped(path) ? 0 : 1;
+	}, topology));
+}
+
+TEST_F(SNAPSHOT, corrupted_index) {
+	std::string topology;
+	ASSERT_EQ(0, run_in_child([this](std::string&) {
+		return cpuinfo_initialize() && cpuinfo_save_snapshot(path.c_str()) ? 0 : 1;
+	}, topology));
+
+	/*
+	 * The header ends with an array of section headers, each with a 64-bit offset and 32-bit count and element size.
+	 * Cores are the second section, and the processor count of the first core follows its processor start.
+	 */
+	const uint32_t sections_count = 17;
+	const uint32_t cores_section = 1;
+	FILE* file = std::fopen(path.c_str(), "r+b");
+	ASSERT_NE(file, nullptr);
+	uint32_t header_size = 0;
+	ASSERT_EQ(0, std::fseek(file, 12, SEEK_SET));
+	ASSERT_EQ(1, std::fread(&header_size, sizeof(header_size), 1, file));
+	uint64_t cores_offset = 0;
+	ASSERT_EQ(0, std::fseek(file, static_cast<long>(header_size - (sections_count - cores_section) * 16), SEEK_SET));
+	ASSERT_EQ(1, std::fread(&cores_offset, sizeof(cores_offset), 1, file));
+	const uint32_t processor_count = UINT32_MAX;
+	ASSERT_EQ(0, std::fseek(file, static_cast<long>(cores_offset + offsetof(cpuinfo_core, processor_count)), SEEK_SET));
+	ASSERT_EQ(1, std::fwrite(&processor_count, sizeof(processor_count), 1, file));
+	ASSERT_EQ(0, std::fclose(file));
+
+	/* The snapshot is rejected, and cpuinfo detects the topology instead */
+	ASSERT_EQ(0, run_in_child([this](std::string&) {
+		if (!cpuinfo_initialize_from_snapshot(path.c_str()) || is_mapped(path)) {
+			return 1;
+		}
+		return cpuinfo_get_core(0)->processor_count <= cpuinfo_get_processors_count() ? 0 : 2;
+	}, topology));
+}
+
+TEST_F(SNAPSHOT, save_before_initialization) {
+	std::string topology;
+	ASSERT_EQ(0, run_in_child([this](std::string&) {
+		return cpuinfo_save_snapshot(path.c_str()) ? 1 : 0;
+	}, topology));
+	EXPECT_FALSE(file_exists());
+}
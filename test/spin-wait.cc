@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include <cpuinfo.h>
+
+
+TEST(MONOTONIC_TIME, increases) {
+	const uint64_t start = cpuinfo_get_monotonic_time_ns();
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	const uint64_t end = cpuinfo_get_monotonic_time_ns();
+	ASSERT_GE(end - start, UINT64_C(10000000));
+}
+
+TEST(SPIN_WAIT, value_already_set) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	volatile uint32_t word = 1;
+	ASSERT_TRUE(cpuinfo_spin_wait_until(&word, 1, 0));
+}
+
+TEST(SPIN_WAIT, deadline) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	volatile uint32_t word = 0;
+	const uint64_t start = cpuinfo_get_monotonic_time_ns();
+	ASSERT_FALSE(cpuinfo_spin_wait_until(&word, 1, start + UINT64_C(20000000)));
+	ASSERT_GE(cpuinfo_get_monotonic_time_ns() - start, UINT64_C(20000000));
+}
+
+TEST(SPIN_WAIT, store_from_other_thread) {
+	ASSERT_TRUE(cpuinfo_initialize());
+	volatile uint32_t word = 0;
+	std::thread writer([&word]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		std::atomic_thread_fence(std::memory_order_release);
+		word = 1;
+	});
+	const uint64_t deadline = cpuinfo_get_monotonic_time_ns() + UINT64_C(10000000000);
+	const bool woken = cpuinfo_spin_wait_until(&word, 1, deadline);
+	writer.join();
+	ASSERT_TRUE(woken);
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+
+#define CPUINFO_LINUX_SYSFS_PATH_MAX 64
+
+struct cpuinfo_linux_sysfs_file {
+	char path[CPUINFO_LINUX_SYSFS_PATH_MAX];
+	char* buffer;
+	size_t buffer_size;
+	ssize_t size;
+};
+
+extern "C" void cpuinfo_linux_read_sysfs_files(uint32_t files_count, struct cpuinfo_linux_sysfs_file* files);
+
+
+/* Reads a file in /sys/devices/system/cpu with plain system calls, as the sequential backend does */
+static ssize_t read_file(const char* path, char* buffer, size_t buffer_size) {
+	const std::string filename = std::string("/sys/devices/system/cpu/") + path;
+	const int file = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+	if (file == -1) {
+		return -1;
+	}
+	size_t buffer_position = 0;
+	ssize_t bytes_read;
+	do {
+		bytes_read = read(file, &buffer[buffer_position], buffer_size - buffer_position);
+		if (bytes_read < 0) {
+			close(file);
+			return -1;
+		}
+		buffer_position += static_cast<size_t>(bytes_read);
+	} while (bytes_read != 0 && buffer_position < buffer_size);
+	close(file);
+	return static_cast<ssize_t>(buffer_position);
+}
+
+/*
+ * Batches of files larger than the io_uring threshold of the library, with files that exist on every Linux system,
+ * files that do not exist, and files that exist only on some systems. With CPUINFO_USE_IO_URING, the library reads the
+ * batch through io_uring if the kernel supports it.
+ */
+static std::vector<std::string> list_files(uint32_t min_files_count) {
+	static const char* const processor_attributes[] = {
+		"topology/core_id",
+		"topology/physical_package_id",
+		"topology/die_id",
+		"topology/thread_siblings_list",
+		"topology/core_cpus_list",
+		"topology/package_cpus_list",
+		"cache/index0/size",
+		"cache/index0/shared_cpu_list",
+		"cache/index2/size",
+		"cache/index3/shared_cpu_list",
+		"cpufreq/cpuinfo_max_freq",
+		"regs/identification/midr_el1",
+		"nonexistent",
+	};
+	const long processors_count = sysconf(_SC_NPROCESSORS_CONF);
+	std::vector<std::string> files;
+	files.push_back("possible");
+	files.push_back("present");
+	do {
+		for (long processor = 0; processor < processors_count; processor++) {
+			for (const char* attribute : processor_attributes) {
+				files.push_back("cpu" + std::to_string(processor) + "/" + attribute);
+			}
+		}
+	} while (files.size() < min_files_count);
+	return files;
+}
+
+static void compare_backends(uint32_t min_files_count, size_t buffer_size) {
+	const std::vector<std::string> paths = list_files(min_files_count);
+	std::vector<cpuinfo_linux_sysfs_file> files(paths.size());
+	std::vector<char> buffers(paths.size() * buffer_size);
+	for (size_t i = 0; i < paths.size(); i++) {
+		snprintf(files[i].path, sizeof(files[i].path), "%s", paths[i].c_str());
+		files[i].buffer = &buffers[i * buffer_size];
+		files[i].buffer_size = buffer_size;
+	}
+	cpuinfo_linux_read_sysfs_files(static_cast<uint32_t>(files.size()), files.data());
+
+	std::vector<char> expected_buffer(buffer_size);
+	for (const cpuinfo_linux_sysfs_file& file : files) {
+		const ssize_t expected_size = read_file(file.path, expected_buffer.data(), buffer_size);
+		ASSERT_EQ(expected_size, file.size) << file.path;
+		if (expected_size > 0) {
+			EXPECT_EQ(
+				std::string(expected_buffer.data(), static_cast<size_t>(expected_size)),
+				std::string(file.buffer, static_cast<size_t>(file.size))) << file.path;
+		}
+	}
+}
+
+TEST(SYSFS, small_batch) {
+	compare_backends(1, 64);
+}
+
+TEST(SYSFS, large_batch) {
+	compare_backends(512, 64);
+}
+
+TEST(SYSFS, truncated) {
+	compare_backends(512, 2);
+}
@@ -83,6 +83,12 @@ static const char* uarch_to_string(enum cpuinfo_uarch uarch) {
 			return "Palm Cove";
 		case cpuinfo_uarch_sunny_cove:
 			return "Sunny Cove";
+		case cpuinfo_uarch_willow_cove:
+			return "Willow Cove";
+		case cpuinfo_uarch_golden_cove:
+			return "Golden Cove";
+		case cpuinfo_uarch_redwood_cove:
+			return "Redwood Cove";
 		case cpuinfo_uarch_willamette:
 			return "Willamette";
 		case cpuinfo_uarch_prescott:
@@ -99,6 +105,12 @@ static const char* uarch_to_string(enum cpuinfo_uarch uarch) {
 			return "Goldmont";
 		case cpuinfo_uarch_goldmont_plus:
 			return "Goldmont Plus";
+		case cpuinfo_uarch_tremont:
+			return "Tremont";
+		case cpuinfo_uarch_gracemont:
+			return "Gracemont";
+		case cpuinfo_uarch_crestmont:
+			return "Crestmont";
 		case cpuinfo_uarch_knights_ferry:
 			return "Knights Ferry";
 		case cpuinfo_uarch_knights_corner:
@@ -133,6 +145,8 @@ static const char* uarch_to_string(enum cpuinfo_uarch uarch) {
 			return "Zen 2";
 		case cpuinfo_uarch_zen3:
 			return "Zen 3";
+		case cpuinfo_uarch_zen4:
+			return "Zen 4";
 		case cpuinfo_uarch_geode:
 			return "Geode";
 		case cpuinfo_uarch_bobcat:
@@ -296,6 +310,27 @@ int main(int argc, char** argv) {
 			printf("\t%"PRIu32"x %s\n", uarch_info->core_count, uarch_string);
 		}
 	}
+	if (cpuinfo_get_dies_count() != 0) {
+		printf("Dies:\n");
+		for (uint32_t i = 0; i < cpuinfo_get_dies_count(); i++) {
+			const struct cpuinfo_die* die = cpuinfo_get_die(i);
+			printf("\t%"PRIu32": package %"PRIu32" die %"PRIu32", %"PRIu32" cores (%"PRIu32"-%"PRIu32")\n",
+				i, (uint32_t) (die->package - cpuinfo_get_package(0)), die->die_id,
+				die->core_count, die->core_start, die->core_start + die->core_count - 1);
+		}
+	}
+	if (cpuinfo_get_nodes_count() != 0) {
+		printf("NUMA nodes:\n");
+		for (uint32_t i = 0; i < cpuinfo_get_nodes_count(); i++) {
+			const struct cpuinfo_node* node = cpuinfo_get_node(i);
+			printf("\t%"PRIu32": node %"PRIu32", %"PRIu32" cores, %"PRIu32" processors, distances",
+				i, node->node_id, node->core_count, node->processor_count);
+			for (uint32_t j = 0; j < cpuinfo_get_nodes_count(); j++) {
+				printf(" %"PRIu32, node->distances[j]);
+			}
+			printf("\n");
+		}
+	}
 	printf("Cores:\n");
 	for (uint32_t i = 0; i < cpuinfo_get_cores_count(); i++) {
 		const struct cpuinfo_core* core = cpuinfo_get_core(i);
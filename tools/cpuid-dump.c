@@ -40,7 +40,7 @@ static void print_cpuid_brand_string(struct cpuid_regs regs, uint32_t eax) {
 
 int main(int argc, char** argv) {
 	const uint32_t max_base_index = cpuid(0).eax;
-	uint32_t max_structured_index = 0, max_trace_index = 0, max_socid_index = 0;
+	uint32_t max_structured_index = 0, max_trace_index = 0, max_socid_index = 0, max_avx10_index = 0;
 	bool has_sgx = false;
 	for (uint32_t eax = 0; eax <= max_base_index; eax++) {
 		switch (eax) {
@@ -104,6 +104,15 @@ int main(int argc, char** argv) {
 					print_cpuidex(regs, eax, ecx);
 				}
 				break;
+			case UINT32_C(0x00000024):
+				for (uint32_t ecx = 0; ecx <= max_avx10_index; ecx++) {
+					const struct cpuid_regs regs = cpuidex(eax, ecx);
+					if (ecx == 0) {
+						max_avx10_index = regs.eax;
+					}
+					print_cpuidex(regs, eax, ecx);
+				}
+				break;
 			default:
 				print_cpuid(cpuidex(eax, 0), eax);
 				break;
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <inttypes.h>
 
 #include <cpuinfo.h>
 
@@ -17,6 +18,7 @@ int main(int argc, char** argv) {
 		printf("\tCMOV: %s\n", cpuinfo_has_x86_cmov() ? "yes" : "no");
 #endif
 		printf("\tLAHF/SAHF: %s\n", cpuinfo_has_x86_lahf_sahf() ? "yes" : "no");
+		printf("\tAPX: %s\n", cpuinfo_has_x86_apx() ? "yes" : "no");
 		printf("\tLZCNT: %s\n", cpuinfo_has_x86_lzcnt() ? "yes" : "no");
 		printf("\tPOPCNT: %s\n", cpuinfo_has_x86_popcnt() ? "yes" : "no");
 		printf("\tTBM: %s\n", cpuinfo_has_x86_tbm() ? "yes" : "no");
@@ -30,6 +32,14 @@ int main(int argc, char** argv) {
 		printf("\tPREFETCH: %s\n", cpuinfo_has_x86_prefetch() ? "yes" : "no");
 		printf("\tPREFETCHW: %s\n", cpuinfo_has_x86_prefetchw() ? "yes" : "no");
 		printf("\tPREFETCHWT1: %s\n", cpuinfo_has_x86_prefetchwt1() ? "yes" : "no");
+		printf("\tPREFETCHI: %s\n", cpuinfo_has_x86_prefetchi() ? "yes" : "no");
+		printf("\tERMS: %s\n", cpuinfo_has_x86_erms() ? "yes" : "no");
+		printf("\tFSRM: %s\n", cpuinfo_has_x86_fsrm() ? "yes" : "no");
+		printf("\tFZLRM: %s\n", cpuinfo_has_x86_fzlrm() ? "yes" : "no");
+		printf("\tFSRS: %s\n", cpuinfo_has_x86_fsrs() ? "yes" : "no");
+		printf("\tFSRC: %s\n", cpuinfo_has_x86_fsrc() ? "yes" : "no");
+		printf("\tMOVDIRI: %s\n", cpuinfo_has_x86_movdiri() ? "yes" : "no");
+		printf("\tMOVDIR64B: %s\n", cpuinfo_has_x86_movdir64b() ? "yes" : "no");
 		printf("\tCLZERO: %s\n", cpuinfo_has_x86_clzero() ? "yes" : "no");
 
 
@@ -71,11 +81,30 @@ int main(int argc, char** argv) {
 		printf("\tAVX512VP2INTERSECT: %s\n", cpuinfo_has_x86_avx512vp2intersect() ? "yes" : "no");
 		printf("\tAVX512_4VNNIW: %s\n", cpuinfo_has_x86_avx512_4vnniw() ? "yes" : "no");
 		printf("\tAVX512_4FMAPS: %s\n", cpuinfo_has_x86_avx512_4fmaps() ? "yes" : "no");
+		printf("\tAVX512FP16: %s\n", cpuinfo_has_x86_avx512fp16() ? "yes" : "no");
+		printf("\tAVX-VNNI: %s\n", cpuinfo_has_x86_avxvnni() ? "yes" : "no");
+		printf("\tAVX-VNNI-INT8: %s\n", cpuinfo_has_x86_avxvnniint8() ? "yes" : "no");
+		printf("\tAVX-IFMA: %s\n", cpuinfo_has_x86_avxifma() ? "yes" : "no");
+		printf("\tAVX-NE-CONVERT: %s\n", cpuinfo_has_x86_avxneconvert() ? "yes" : "no");
+		printf("\tAVX10 version: %"PRIu32"\n", cpuinfo_get_x86_avx10_version());
+		printf("\tAVX10 vector length: %"PRIu32" bits\n", cpuinfo_get_x86_avx10_max_vector_bits());
+
+	printf("Matrix extensions:\n");
+		printf("\tAMX permission: %s\n", cpuinfo_x86_request_amx_permission() ? "granted" : "not granted");
+		printf("\tAMX-TILE: %s\n", cpuinfo_has_x86_amx_tile() ? "yes" : "no");
+		printf("\tAMX-INT8: %s\n", cpuinfo_has_x86_amx_int8() ? "yes" : "no");
+		printf("\tAMX-BF16: %s\n", cpuinfo_has_x86_amx_bf16() ? "yes" : "no");
+		printf("\tAMX-FP16: %s\n", cpuinfo_has_x86_amx_fp16() ? "yes" : "no");
+		printf("\tAMX-COMPLEX: %s\n", cpuinfo_has_x86_amx_complex() ? "yes" : "no");
 
 
 	printf("Multi-threading extensions:\n");
 		printf("\tMONITOR/MWAIT: %s\n", cpuinfo_has_x86_mwait() ? "yes" : "no");
 		printf("\tMONITORX/MWAITX: %s\n", cpuinfo_has_x86_mwaitx() ? "yes" : "no");
+		printf("\tUMONITOR/UMWAIT/TPAUSE: %s\n", cpuinfo_has_x86_waitpkg() ? "yes" : "no");
+		if (cpuinfo_get_x86_umwait_max_time() != 0) {
+			printf("\tUMWAIT time limit: %"PRIu32" TSC cycles\n", cpuinfo_get_x86_umwait_max_time());
+		}
 #if CPUINFO_ARCH_X86
 		printf("\tCMPXCHG8B: %s\n", cpuinfo_has_x86_cmpxchg8b() ? "yes" : "no");
 #endif
@@ -107,6 +136,9 @@ int main(int argc, char** argv) {
 
 	printf("System instructions:\n");
 		printf("\tCLWB: %s\n", cpuinfo_has_x86_clwb() ? "yes" : "no");
+		printf("\tCLDEMOTE: %s\n", cpuinfo_has_x86_cldemote() ? "yes" : "no");
+		printf("\tSERIALIZE: %s\n", cpuinfo_has_x86_serialize() ? "yes" : "no");
+		printf("\tENQCMD: %s\n", cpuinfo_has_x86_enqcmd() ? "yes" : "no");
 		printf("\tFXSAVE/FXSTOR: %s\n", cpuinfo_has_x86_fxsave() ? "yes" : "no");
 		printf("\tXSAVE/XSTOR: %s\n", cpuinfo_has_x86_xsave() ? "yes" : "no");
 
@@ -166,6 +198,12 @@ int main(int argc, char** argv) {
 		printf("\tARM SVE: %s\n", cpuinfo_has_arm_sve() ? "yes" : "no");
 		printf("\tARM SVE BF16: %s\n", cpuinfo_has_arm_svebf16() ? "yes" : "no");
 		printf("\tARM SVE 2: %s\n", cpuinfo_has_arm_sve2() ? "yes" : "no");
+		printf("\tARM SVE 2.1: %s\n", cpuinfo_has_arm_sve2p1() ? "yes" : "no");
+		printf("\tARM SVE bit permute: %s\n", cpuinfo_has_arm_svebitperm() ? "yes" : "no");
+		printf("\tARM SVE vector length: %"PRIu32" bits\n", cpuinfo_get_arm_sve_vector_bits());
+		printf("\tARM SME: %s\n", cpuinfo_has_arm_sme() ? "yes" : "no");
+		printf("\tARM SME 2: %s\n", cpuinfo_has_arm_sme2() ? "yes" : "no");
+		printf("\tARM SME streaming vector length: %"PRIu32" bits\n", cpuinfo_get_arm_sme_streaming_vector_bits());
 
 	printf("Cryptography extensions:\n");
 		printf("\tAES: %s\n", cpuinfo_has_arm_aes() ? "yes" : "no");
@@ -200,4 +238,13 @@ int main(int argc, char** argv) {
 		
 #endif
 
+	struct cpuinfo_isa_features features;
+	cpuinfo_get_isa_features(&features);
+	const size_t features_length = cpuinfo_isa_format_features(&features, NULL, 0);
+	char* features_list = malloc(features_length + 1);
+	if (features_list != NULL) {
+		cpuinfo_isa_format_features(&features, features_list, features_length + 1);
+		printf("Feature list (version %d): %s\n", CPUINFO_ISA_FEATURES_VERSION, features_list);
+		free(features_list);
+	}
 }